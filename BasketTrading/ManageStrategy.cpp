@@ -895,12 +895,21 @@ void ManageStrategy::HandleAfterRH( const ou::tf::Bar& bar ) {
   // need to set a state to do this once
 }
 
-void ManageStrategy::SaveSeries( const std::string& sPrefix ) {
+void ManageStrategy::CollectSeries( ou::tf::HDF5WriteBatch& batch, const std::string& sPrefix ) {
   // TODO: pWatchUnderlying should be saved in caller hierarchy
   if ( m_pCombo ) {
     combo_t& combo( dynamic_cast<combo_t&>( *m_pCombo ) );
     //entry.second.ClosePositions();
-    combo.SaveSeries( sPrefix ); // TODO: generify via Common or Base
+    combo.CollectSeries( batch, sPrefix ); // TODO: generify via Common or Base
+  }
+}
+
+void ManageStrategy::RiskGridLegs( boost::posix_time::ptime dtUtcOrigin, ou::tf::option::RiskGrid::vLeg_t& vLeg ) const {
+  if ( m_pCombo ) {
+    m_pCombo->RiskGridLegs( dtUtcOrigin, vLeg );
+  }
+  else {
+    vLeg.clear();
   }
 }
 
@@ -134,7 +134,8 @@ public:
   ou::tf::DatedDatum::volume_t CalcShareCount( double dblAmount ) const;
   //void SetFundsToTrade( double dblFundsToTrade ) { m_dblFundsToTrade = dblFundsToTrade; };
   void ClosePositions( void );
-  void SaveSeries( const std::string& sPrefix );
+  void CollectSeries( ou::tf::HDF5WriteBatch&, const std::string& sPrefix );
+  void RiskGridLegs( boost::posix_time::ptime dtUtcOrigin, ou::tf::option::RiskGrid::vLeg_t& ) const;
 
   void AddPosition( pPosition_t ); // add pre-existing position
   void SetTreeItem( ou::tf::TreeItem* ptiSelf );
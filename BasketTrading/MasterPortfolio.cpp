@@ -30,6 +30,8 @@
 #include <TFTrading/InstrumentManager.h>
 #include <TFTrading/ComposeInstrument.hpp>
 
+#include <TFHDF5TimeSeries/HDF5WriteBatch.h>
+
 #include <TFOptions/Engine.h>
 
 #include <TFVuTrading/TreeItem.hpp>
@@ -1011,11 +1013,13 @@ void MasterPortfolio::ClosePositions() {
 void MasterPortfolio::SaveSeries( const std::string& sPrefix ) {
   std::string sPath( sPrefix + m_sTSDataStreamStarted );
   m_fedrate.SaveSeries( sPath );
+  ou::tf::HDF5WriteBatch batch;
   std::for_each(
     m_mapUnderlyingWithStrategies.begin(), m_mapUnderlyingWithStrategies.end(),
-    [&sPath](mapUnderlyingWithStrategies_t::value_type& uws){
-      uws.second.SaveSeries( sPath );
+    [&sPath,&batch](mapUnderlyingWithStrategies_t::value_type& uws){
+      uws.second.CollectSeries( batch, sPath );
     } );
+  batch.Write();
   std::cout << "done." << std::endl;
 }
 
@@ -1023,9 +1027,10 @@ void MasterPortfolio::EmitInfo() {
   double dblNet {};
   std::for_each(
     m_mapUnderlyingWithStrategies.begin(), m_mapUnderlyingWithStrategies.end(),
-    [&dblNet](mapUnderlyingWithStrategies_t::value_type& vt){
+    [this,&dblNet](mapUnderlyingWithStrategies_t::value_type& vt){
       UnderlyingWithStrategies& uws( vt.second );
       dblNet += uws.EmitInfo();
+      EmitRisk( vt.first, uws );
     } );
   std::cout << "Active Portfolios net: " << dblNet << std::endl;
 
@@ -1044,6 +1049,103 @@ void MasterPortfolio::EmitInfo() {
     << std::endl;
 }
 
+// scenario risk of the live combos: underlying price x iv shift x days forward
+void MasterPortfolio::EmitRisk( const std::string& sUnderlying, UnderlyingWithStrategies& uws ) {
+
+  using RiskGrid = ou::tf::option::RiskGrid;
+  Risk& risk( uws.risk );
+
+  if ( uws.mapStrategyActive.empty() && risk.mapCombo.empty() ) return;
+
+  const double price = uws.pUnderlying->GetWatch()->LastTrade().Price();
+  if ( 0.0 >= price ) return;
+
+  const ptime dtNow = ou::TimeSource::GlobalInstance().External();
+
+  static const double dblRecentre( 0.025 ); // fraction of price
+  static const boost::posix_time::time_duration tdRecentre( boost::posix_time::minutes( 15 ) );
+
+  if ( !risk.pGrid ) {
+    risk.pGrid = std::make_unique<RiskGrid>( 1 );
+  }
+
+  if (
+       ( 0.0 == risk.dblCentre )
+    || ( dblRecentre < ( std::abs( price - risk.dblCentre ) / risk.dblCentre ) )
+    || ( tdRecentre < ( dtNow - risk.dtOrigin ) )
+  ) {
+    risk.dblCentre = price;
+    risk.dtOrigin = dtNow;
+
+    RiskGrid::Axes axes;
+    for ( int ix = -10; ix <= 10; ix++ ) {
+      axes.vPrice.push_back( price * ( 1.0 + 0.01 * ix ) );
+    }
+    axes.vVolShift = { -0.10, -0.05, 0.0, 0.05, 0.10 }; // Risk::ixVolUnchanged is the 0.0
+    axes.vYearsForward = { 0.0, 1.0 / 365.0, 5.0 / 365.0 }; // Risk::ixYearsNow is the 0.0
+    axes.rate = m_fedrate.ValueAt( boost::posix_time::hours( 24 * 30 ) ) / 100.0;
+    risk.pGrid->Set( axes );
+
+    for ( Risk::mapCombo_t::value_type& vt: risk.mapCombo ) {
+      vt.second.vLeg.clear(); // time to expiry moves with the origin, resubmit every combo, with current iv
+    }
+  }
+
+  Risk::vLeg_t vLeg;
+
+  for ( mapStrategy_t::value_type& vt: uws.mapStrategyActive ) {
+    vt.second->pManageStrategy->RiskGridLegs( risk.dtOrigin, vLeg );
+    Risk::mapCombo_t::iterator iter = risk.mapCombo.find( vt.first );
+    if ( risk.mapCombo.end() == iter ) {
+      if ( !vLeg.empty() ) {
+        const RiskGrid::idCombo_t id = risk.pGrid->AddCombo( vLeg );
+        risk.mapCombo.emplace( vt.first, Risk::Combo{ id, vLeg } );
+      }
+    }
+    else {
+      if ( vLeg.empty() ) {
+        risk.pGrid->DeleteCombo( iter->second.idCombo );
+        risk.mapCombo.erase( iter );
+      }
+      else {
+        // iv moves with every greek update, so only position changes resubmit a combo,
+        //   iv is refreshed for all at the re-centre, the vol axis covers the drift in between
+        if ( !RiskGrid::SamePosition( vLeg, iter->second.vLeg ) ) {
+          risk.pGrid->UpdateCombo( iter->second.idCombo, vLeg );
+          iter->second.vLeg = vLeg;
+        }
+      }
+    }
+  }
+
+  // combos which have closed out of the active set
+  Risk::mapCombo_t::iterator iter = risk.mapCombo.begin();
+  while ( risk.mapCombo.end() != iter ) {
+    if ( uws.mapStrategyActive.end() == uws.mapStrategyActive.find( iter->first ) ) {
+      risk.pGrid->DeleteCombo( iter->second.idCombo );
+      iter = risk.mapCombo.erase( iter );
+    }
+    else ++iter;
+  }
+
+  if ( risk.mapCombo.empty() ) return;
+
+  risk.pGrid->Recalc();
+
+  const RiskGrid::vValue_t& vPL( risk.pGrid->PL() );
+  const RiskGrid::vValue_t& vMargin( risk.pGrid->Margin() );
+  const auto minmax = std::minmax_element( vPL.begin(), vPL.end() );
+
+  std::cout
+    << "Risk " << sUnderlying
+    << ": combos=" << risk.mapCombo.size()
+    << ",centre=" << risk.dblCentre
+    << ",worst=" << *minmax.first
+    << ",best=" << *minmax.second
+    << ",margin=" << vMargin[ risk.pGrid->MarginIndex( Risk::ixYearsNow, Risk::ixVolUnchanged ) ]
+    << std::endl;
+}
+
 void MasterPortfolio::EmitIV() {
   std::for_each(
     m_mapUnderlyingWithStrategies.begin(), m_mapUnderlyingWithStrategies.end(),
@@ -41,6 +41,8 @@
 #include <TFIQFeed/Provider.h>
 #include <TFInteractiveBrokers/IBTWS.h>
 
+#include <TFOptions/RiskGrid.h>
+
 #include <TFOptionCombos/SpreadSpecs.h>
 
 #include "Underlying.h"
@@ -202,6 +204,23 @@ private:
     ou::tf::PivotSet setPivots;
   };
 
+  struct Risk { // scenario grid over the active combos of an underlying
+    using idCombo_t = ou::tf::option::RiskGrid::idCombo_t;
+    using vLeg_t = ou::tf::option::RiskGrid::vLeg_t;
+    struct Combo {
+      idCombo_t idCombo;
+      vLeg_t vLeg; // as last submitted to the grid
+    };
+    using mapCombo_t = std::map<idPortfolio_t,Combo>;
+    static constexpr size_t ixYearsNow = 0; // grid coordinates of the unshifted scenario, see EmitRisk axes
+    static constexpr size_t ixVolUnchanged = 2;
+    std::unique_ptr<ou::tf::option::RiskGrid> pGrid;
+    double dblCentre; // underlying price at the centre of the price axis
+    ptime dtOrigin; // time to expiry of the legs is measured from here
+    mapCombo_t mapCombo;
+    Risk(): dblCentre {} {}
+  };
+
   using pUnderlying_t = std::unique_ptr<Underlying>;
   using pStrategy_t = std::unique_ptr<Strategy>;
   using mapStrategy_t = std::map<idPortfolio_t,pStrategy_t>;
@@ -215,6 +234,7 @@ private:
     mapStrategy_t mapStrategyClosed;
     ou::tf::TreeItem* pti;
     Statistics statistics;
+    Risk risk;
     ou::tf::Bars m_barsHistory;
     std::atomic_uint32_t m_nQuery;
 
@@ -247,11 +267,11 @@ private:
       }
     }
 
-    void SaveSeries( const std::string& sPrefix ) {
-      pUnderlying->SaveSeries( sPrefix );
+    void CollectSeries( ou::tf::HDF5WriteBatch& batch, const std::string& sPrefix ) {
+      pUnderlying->CollectSeries( batch, sPrefix );
       for ( mapStrategy_t::value_type& vt: mapStrategyActive ) {
         pStrategy_t& pStrategy( vt.second );
-        pStrategy->pManageStrategy->SaveSeries( sPrefix );
+        pStrategy->pManageStrategy->CollectSeries( batch, sPrefix );
       }
     }
     double EmitInfo() {
@@ -351,6 +371,8 @@ private:
   void Add_ManageStrategy_ToTree( const idPortfolio_t&, pManageStrategy_t );
   void AddAsActiveStrategy( UnderlyingWithStrategies&, pStrategy_t&&, const idPortfolio_t& idPortfolioStrategy );
 
+  void EmitRisk( const std::string& sUnderlying, UnderlyingWithStrategies& );
+
   template<typename Archive>
   void save( Archive& ar, const unsigned int version ) const {
   }
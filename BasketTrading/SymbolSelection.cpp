@@ -21,7 +21,7 @@
 #include <vector>
 #include <iostream>
 
-#include <TFBitsNPieces/InstrumentFilter.h>
+#include <TFBitsNPieces/BarScreener.h>
 #include <TFBitsNPieces/ReadCboeWeeklyOptionsCsv.h>
 
 #include <TFIndicators/Darvas.h>
@@ -72,71 +72,49 @@ public:
   operator ou::tf::Bar::volume_t() { return std::floor( dblEmaVolume ); };
 };
 
-template<typename Scenario, typename Function>
-void Process( ptime dtBegin, ptime dtEnd, size_t nMinBars, const setSymbols_t& setSymbols, Function fCheck ) {
-
-  struct data_t {
-    ou::tf::Bar::volume_t volumeEma;
-    size_t nEnteredFilter;
-    size_t nPassedFilter;
-    data_t()
-      : volumeEma {}, nEnteredFilter {}, nPassedFilter {}
-      {}
-  };
-
-  data_t data;
-
-  try {
-    ou::tf::InstrumentFilter<data_t,ou::tf::Bars> filter(
-      "/bar/86400/",
-      dtBegin, dtEnd,
-      200, data, //  need to figure out where 200 comes from, and the relation to nMinBars (=> 200sma)
-      []( data_t&, const std::string& sPath, const std::string& sGroup )->bool{ // Use Group
-        return true;
-      },
-      [nMinBars, dtEnd, &setSymbols]( data_t& data, const std::string& sObject, const ou::tf::Bars& bars )->bool{ // Filter
-        //  std::cout << sObjectName << std::endl;
-        data.nEnteredFilter++;
-        bool bReturn( false );
-        if ( nMinBars <= bars.Size() ) {
-            ou::tf::Bars::const_iterator iterVolume = bars.end() - nMinBars;
-            data.volumeEma = std::for_each( iterVolume, bars.end(), VolumeEma() );
-            if ( ( 1000000 < data.volumeEma )
-              && ( 30.0 <=  bars.last().Close() )
-              && ( 500.0 >= bars.last().Close() )  // provides SPY at 4xx
-              && ( dtEnd.date() == bars.last().DateTime().date() )
-              && ( 120 < bars.Size() )
-              ) {
-              data.nPassedFilter++;
-              bReturn = true;
-            }
-        }
-        if ( !bReturn ) {
-          setSymbols_t::const_iterator iterSymbol = setSymbols.find( sObject );
-          if ( setSymbols.end() != iterSymbol ) {
-            bReturn = true;
+template<typename Scenario>
+using Screener = ou::tf::BarScreener<Scenario>;
+
+// the liquidity filter, symbols in setSymbols are passed regardless
+//   runs on the screener's pool threads, so reads only its arguments and the (unchanging) set
+template<typename Scenario>
+Screener<Scenario> MakeScreener( ptime dtEnd, size_t nMinBars, const setSymbols_t& setSymbols ) {
+  return Screener<Scenario>(
+    [nMinBars, dtEnd, &setSymbols]( const std::string& sPath, const std::string& sObject, const ou::tf::Bars& bars )->typename Screener<Scenario>::pInfo_t {
+      bool bPassed( false );
+      ou::tf::Bar::volume_t volumeEma {};
+      if ( nMinBars <= bars.Size() ) {
+          ou::tf::Bars::const_iterator iterVolume = bars.end() - nMinBars;
+          volumeEma = std::for_each( iterVolume, bars.end(), VolumeEma() );
+          if ( ( 1000000 < volumeEma )
+            && ( 30.0 <=  bars.last().Close() )
+            && ( 500.0 >= bars.last().Close() )  // provides SPY at 4xx
+            && ( dtEnd.date() == bars.last().DateTime().date() )
+            && ( 120 < bars.Size() )
+            ) {
+            bPassed = true;
           }
+      }
+      if ( !bPassed ) {
+        setSymbols_t::const_iterator iterSymbol = setSymbols.find( sObject );
+        if ( setSymbols.end() == iterSymbol ) {
+          return nullptr;
         }
-        return bReturn;
-      },
-      [&fCheck]( data_t& data, const std::string& sPath, const std::string& sObjectName, const ou::tf::Bars& bars ){ // Result
-
-        double hv = std::for_each( bars.at( bars.Size() - 20 ), bars.end(), ou::HistoricalVolatility() );
-        Scenario ii( sObjectName, sPath, bars.last(), data.volumeEma, hv );
-        //CheckForDarvas( bars.begin(), bars.end(), ii, fSelected );
-        //if ( "GLD" == sObjectName ) {
-          fCheck( bars, ii );
-        //}
-        //          CheckFor10Percent( ii, bars.end() - 20, bars.end() );
-        //          CheckForVolatility( ii, bars.end() - 20, bars.end() );
-        //          CheckForRange( ii, bars.end() - m_nMinPivotBars, bars.end() );
       }
-      );
+      double hv = std::for_each( bars.at( bars.Size() - 20 ), bars.end(), ou::HistoricalVolatility() );
+      return std::make_unique<Scenario>( sObject, sPath, bars.last(), volumeEma, hv );
+    } );
+}
+
+template<typename Scenario>
+void Process( Screener<Scenario>& screener, ptime dtBegin, ptime dtEnd ) {
 
-    std::cout << "Items Checked: " << data.nEnteredFilter << ", Items passed: " << data.nPassedFilter << std::endl;
+  try {
+    //  need to figure out where 200 comes from, and the relation to nMinBars (=> 200sma)
+    screener.Run( "/bar/86400/", dtBegin, dtEnd, 200 );
   }
   catch ( std::runtime_error& e ) {
-    std::cout << "SymbolSelection - InstrumentFilter - " << e.what() << std::endl;
+    std::cout << "SymbolSelection - BarScreener - " << e.what() << std::endl;
   }
   catch (... ) {
     std::cout << "SymbolSelection - Unknown Error - " << std::endl;
@@ -161,13 +139,23 @@ SymbolSelection::SymbolSelection( const ptime dtLast, const setSymbols_t& setSym
 {
   std::cout << "Darvas: AT=Aggressive Trigger, CT=Conservative Trigger, BO=Break Out Alert, stop=recommended stop" << std::endl;
 
-  m_dtDarvasTrigger = m_dtLast - gregorian::date_duration( 8 );
+  m_dtDarvasTrigger = m_dtLast - boost::gregorian::date_duration( 8 );
+
+  Screener<IIDarvas> screener( MakeScreener<IIDarvas>( m_dtLast, m_nMinBars, setSymbols ) );
+  Screener<IIDarvas>::idCriterion_t idDarvas = screener.Add(
+    Screener<IIDarvas>::Criterion(
+      "Darvas", Screener<IIDarvas>::EOrder::Largest, 0,
+      [this]( const ou::tf::Bars& bars, IIDarvas& ii, double& dblScore )->bool{
+        dblScore = 0.0; // no preference amongst those triggered, so listed by name
+        return CheckForDarvas( bars, ii );
+      } ) );
+
+  Process( screener, m_dtOneYearAgo, m_dtLast );
 
-  namespace ph = std::placeholders;
-  Process<IIDarvas>(
-    m_dtOneYearAgo, m_dtLast, m_nMinBars, setSymbols,
-    std::bind( &SymbolSelection::CheckForDarvas, this, ph::_1, ph::_2, fSelected )
-  );
+  for ( const Screener<IIDarvas>::Ranked& ranked: screener.Ranking( idDarvas ) ) {
+    fSelected( *ranked.pInfo );
+    std::cout << ranked.pInfo->sReport << std::endl;
+  }
 
 }
 
@@ -201,14 +189,13 @@ SymbolSelection::SymbolSelection( const ptime dtLast, const setSymbols_t& setSym
 
     std::cout << "SignalGenerator running eod and building output ..." << std::endl;
 
-    size_t nSelected {};
-
-    namespace ph = std::placeholders;
-    Process<IIPivot>(
-      m_dtOneYearAgo, m_dtLast, m_nMinBars, setSymbols,
-      [&fSelected,&mapSymbol,&nSelected](const ou::tf::Bars& bars, IIPivot& ii){
-        mapSymbol_t::const_iterator citer = mapSymbol.find( ii.sName );
-        if ( mapSymbol.end() != citer ) {
+    Screener<IIPivot> screener( MakeScreener<IIPivot>( m_dtLast, m_nMinBars, setSymbols ) );
+    Screener<IIPivot>::idCriterion_t idPivot = screener.Add(
+      Screener<IIPivot>::Criterion(
+        "Pivot", Screener<IIPivot>::EOrder::Largest, 0,
+        [&mapSymbol](const ou::tf::Bars& bars, IIPivot& ii, double& dblScore )->bool{
+          mapSymbol_t::const_iterator citer = mapSymbol.find( ii.sName );
+          if ( mapSymbol.end() == citer ) return false;
           //const ou::tf::cboe::csv::UnderlyingInfo& ui( citer->second );
           ou::tf::statistics::Pivot pivot( bars );
           pivot.Points( ii.dblR2, ii.dblR1, ii.dblPV, ii.dblS1, ii.dblS2 );
@@ -216,11 +203,17 @@ SymbolSelection::SymbolSelection( const ptime dtLast, const setSymbols_t& setSym
           ii.dblProbabilityAboveAndDown = pivot.ItemOfInterest( ou::tf::statistics::Pivot::EItemsOfInterest::BtwnPVR1_X_Down );
           ii.dblProbabilityBelowAndUp   = pivot.ItemOfInterest( ou::tf::statistics::Pivot::EItemsOfInterest::BtwnPVS1_X_Up );
           ii.dblProbabilityBelowAndDown = pivot.ItemOfInterest( ou::tf::statistics::Pivot::EItemsOfInterest::BtwnPVS1_X_Down );
-          nSelected++;
-          fSelected( ii );
-        }
-      }
-    );
+          dblScore = 0.0; // all are selected, listed by name
+          return true;
+        } ) );
+
+    Process( screener, m_dtOneYearAgo, m_dtLast );
+
+    const Screener<IIPivot>::vRanked_t& vRanked( screener.Ranking( idPivot ) );
+    size_t nSelected( vRanked.size() );
+    for ( const Screener<IIPivot>::Ranked& ranked: vRanked ) {
+      fSelected( *ranked.pInfo );
+    }
 
     std::cout << "SignalGenerator Complete, " << nSelected << " selected." << std::endl;
   }
@@ -244,7 +237,7 @@ public:
   operator double() { return m_dblSumOfPrices / m_nNumberOfValues; };
 };
 
-void SymbolSelection::CheckForRange( citerBars begin, citerBars end, const InstrumentInfo& ii ) {
+bool SymbolSelection::CheckForRange( citerBars begin, citerBars end, double& dblRatio ) {
   citerBars iter1( begin );
   int cnt( 0 );
   int cntAbove( 0 );
@@ -270,22 +263,16 @@ void SymbolSelection::CheckForRange( citerBars begin, citerBars end, const Instr
     ++iter1;
   }
 
+  if ( ( 0 == cntAbove ) || ( 0 == cntBelow ) ) return false;
+
   double avgAbove = dblAbove / cntAbove;
   double avgBelow = dblBelow / cntBelow;
 
-  int diffCnt = cntAbove - cntBelow;  // minimize this
+  //int diffCnt = cntAbove - cntBelow;  // minimize this
   double dblRatioAboveBelow = 0.5 - ( avgAbove / ( avgAbove + avgBelow ) ); // minimize this
 
-  //m_mapRangeRanking.insert( mapRangeRanking_t::value_type( diffCnt, ii ) );
-  std::cout
-    << ii.sName << ","
-    << diffCnt << ","
-    << dblRatioAboveBelow << ","
-    << avgAbove << ","
-    << avgBelow << ","
-//    << avgAbove + avgBelow << ","
-    << dblRange
-    << std::endl;
+  dblRatio = std::abs( dblRatioAboveBelow );
+  return true;
 }
 
 struct CalcMaxDate {
@@ -307,22 +294,6 @@ private:
   double dblMax;
 };
 
-//
-// ProcessPivots
-//
-
-// taken from scanner
-
-void SymbolSelection::WrapUpPivots( setInstrumentInfo_t& selected ) {
-  int cnt( 35 );  // select 35 symbols ( => < 3% weighting by symbol )
-  for ( mapPivotRanking_t::const_reverse_iterator iter = m_mapPivotRanking.rbegin(); iter!= m_mapPivotRanking.rend(); ++iter ) {
-    selected.insert( iter->second );
-    --cnt;
-    if ( 0 == cnt ) break;
-  }
-  m_mapPivotRanking.clear();
-}
-
 //
 // ProcessDarvas
 //
@@ -386,7 +357,8 @@ double ProcessDarvas::StopValue( void ) {
   return m_dblStop;
 }
 
-void SymbolSelection::CheckForDarvas( const ou::tf::Bars& bars, IIDarvas& ii, fSelectedDarvas_t& fSelected ) {
+bool SymbolSelection::CheckForDarvas( const ou::tf::Bars& bars, IIDarvas& ii ) const {
+  bool bTrigger( false );  // wait for trigger on final day
   size_t nTriggerWindow( 10 );
   ptime dtDayOfMax = std::for_each( bars.begin(), bars.end(), CalcMaxDate() );
   //citerBars iterLast( end - 1 );
@@ -400,75 +372,27 @@ void SymbolSelection::CheckForDarvas( const ou::tf::Bars& bars, IIDarvas& ii, fS
     ProcessDarvas darvas( ss, nTriggerWindow );
     //size_t ix = end - nTriggerWindow;
     citerBars iterTriggerBegin = bars.end() - nTriggerWindow;
-    bool bTrigger;  // wait for trigger on final day
     for ( citerBars iter = iterTriggerBegin; iter != bars.end(); ++iter ) {
       bTrigger = darvas.Calc( *iter );  // final day only is needed
     }
 
     if ( bTrigger ) {
       ii.dblStop = darvas.StopValue();
-      //m_psetSymbols->insert( ii );
-      fSelected( ii );
-      std::cout << ss.str() << std::endl;
+      ii.sReport = ss.str();
     }
   }
+  return bTrigger;
 }
 
-void SymbolSelection::CheckFor10Percent( citerBars begin, citerBars end, const InstrumentInfo& ii ) {
+bool SymbolSelection::CheckFor10Percent( citerBars begin, citerBars end, double& dblReturn ) {
   double dblAveragePrice = std::for_each( begin, end, AveragePrice() );
   citerBars iterLast( end - 1 );
   if ( 25.0 < dblAveragePrice ) {
-    mapRankingPos_t::iterator iterPos;
-    mapRankingNeg_t::iterator iterNeg;
     //double dblReturn = ( m_bars.Last()->m_dblClose - m_bars.Last()->m_dblOpen ) / m_bars.Last()->m_dblClose;
-    double dblReturn = ( iterLast->Close() - iterLast->Open() ) / iterLast->Close();
-    if ( m_nMaxInList > m_mapMaxPositives.size() ) {
-      m_mapMaxPositives.insert( pairRanking_t( dblReturn, ii ) );  // need to insert the path instead
-    }
-    else {
-      iterPos = m_mapMaxPositives.begin();
-      if ( dblReturn > iterPos->first ) {
-        m_mapMaxPositives.erase( iterPos );
-        m_mapMaxPositives.insert( pairRanking_t( dblReturn, ii ) ); // need to insert the path instead
-      }
-    }
-    if ( m_nMaxInList > m_mapMaxNegatives.size() ) {
-      m_mapMaxNegatives.insert( pairRanking_t( dblReturn, ii ) );// need to insert the path instead
-    }
-    else {
-      iterNeg = m_mapMaxNegatives.begin();
-      if ( dblReturn < iterNeg->first ) {
-        m_mapMaxNegatives.erase( iterNeg );
-        m_mapMaxNegatives.insert( pairRanking_t( dblReturn, ii ) );// need to insert the path instead
-      }
-    }
+    dblReturn = ( iterLast->Close() - iterLast->Open() ) / iterLast->Close();
+    return true;
   }
-}
-
-void SymbolSelection::WrapUp10Percent( setInstrumentInfo_t& selected ) {
-  std::cout << "Positives: " << std::endl;
-  mapRankingPos_t::iterator iterPos;
-  for ( iterPos = m_mapMaxPositives.begin(); iterPos != m_mapMaxPositives.end(); ++iterPos ) {
-//    size_t pos = (iterPos->second).find_last_of( "/" );
-//    std::string sSymbolName = (iterPos->second).substr( pos + 1 );
-//    std::cout << " " << sSymbolName << "=" << iterPos->first << std::endl;
-    std::cout << iterPos->second.sName << ": " << iterPos->first << std::endl;
-//    if ( NULL != OnAddSymbol ) OnAddSymbol( sSymbolName, iterPos->second, "10%+" );
-    selected.insert( iterPos->second );
-  }
-  m_mapMaxPositives.clear();
-
-  std::cout << "Negatives: " << std::endl;
-  mapRankingNeg_t::iterator iterNeg;
-  for ( iterNeg = m_mapMaxNegatives.begin(); iterNeg != m_mapMaxNegatives.end(); ++iterNeg ) {
-//    size_t pos = (iterNeg->second).find_last_of( "/" );
-//    std::string sSymbolName = (iterNeg->second).substr( pos + 1 );
-//    std::cout << " " << sSymbolName << "=" << iterNeg->first << std::endl;
-    std::cout << " " << iterNeg->second.sName << ": " << iterNeg->first << std::endl;
-//    if ( NULL != OnAddSymbol ) OnAddSymbol( sSymbolName, iterNeg->second, "10%-" );
-    selected.insert( iterNeg->second );
-  }
-  m_mapMaxNegatives.clear();
+  return false;
 }
 
 class AverageVolatility {
@@ -507,35 +431,11 @@ public:
   };
 };
 
-void SymbolSelection::CheckForVolatility( citerBars begin, citerBars end, const InstrumentInfo& ii ) {
+bool SymbolSelection::CheckForVolatility( citerBars begin, citerBars end, double& dblVolatility ) {
   double dblAveragePrice = std::for_each( begin, end, AveragePrice() );
-  citerBars iterLast( end - 1 );
   if ( 25.0 < dblAveragePrice ) {
-    double dblAverageVolatility = std::for_each( begin, end, AverageVolatility() );
-    mapRankingPos_t::iterator iterPos;
-    if ( m_nMaxInList > m_mapMaxVolatility.size() ) {
-      m_mapMaxVolatility.insert( pairRanking_t( dblAverageVolatility, ii ) );
-    }
-    else {
-      iterPos = m_mapMaxVolatility.begin();
-      if ( dblAverageVolatility > iterPos->first ) {
-        m_mapMaxVolatility.erase( iterPos );
-        m_mapMaxVolatility.insert( pairRanking_t( dblAverageVolatility, ii ) );
-      }
-    }
-  }
-}
-
-void SymbolSelection::WrapUpVolatility( setInstrumentInfo_t& selected ) {
-  std::cout << "Volatiles: " << std::endl;
-  mapRankingPos_t::iterator iterPos;
-  for ( iterPos = m_mapMaxVolatility.begin(); iterPos != m_mapMaxVolatility.end(); ++iterPos ) {
-//    size_t pos = (iterPos->second).find_last_of( "/" );
-//    std::string sSymbolName = (iterPos->second).substr( pos + 1 );;
-//    cout << " " << sSymbolName << "=" << iterPos->first << endl;
-    std::cout << " " << iterPos->second.sName << ": " << iterPos->first << std::endl;
-//    if ( NULL != OnAddSymbol ) OnAddSymbol( sSymbolName, iterPos->second, "Volatile" );
-    selected.insert( iterPos->second );
+    dblVolatility = std::for_each( begin, end, AverageVolatility() );
+    return true;
   }
-  m_mapMaxVolatility.clear();
+  return false;
 }
\ No newline at end of file
@@ -16,7 +16,6 @@
 
 // Project: BasketTrading
 
-#include <map>
 #include <set>
 #include <functional>
 
@@ -64,6 +63,7 @@ struct InstrumentInfo {
 
 struct IIDarvas: InstrumentInfo {
   double dblStop;  // calculated stop price, if any
+  std::string sReport; // triggers found, emitted once the scan completes
   IIDarvas( const std::string& sName, const std::string& sPath, const ou::tf::Bar& bar,
     volume_t volumeEma_, double dblDailyHistoricalVolatility )
     : InstrumentInfo( sName, sPath, bar, volumeEma_, dblDailyHistoricalVolatility ), dblStop{}
@@ -199,38 +199,14 @@ private:
   ptime m_dt26WeeksAgo;
   ptime m_dtDateOfFirstBar;
 
-  using mapPivotRanking_t = std::multimap<boost::uint32_t,InstrumentInfo>;
-  mapPivotRanking_t m_mapPivotRanking;
-
-  using mapRangeRanking_t = std::multimap<int,InstrumentInfo>;
-  mapRangeRanking_t m_mapRangeRanking;
-
-  struct MaxNegativesCompare {
-    bool operator() ( double dbl1, double dbl2 ) const {
-      return dbl2 < dbl1; // reverse form of operator so most negative at end of list
-    }
-  };
-
-  using mapRankingPos_t = std::multimap<double, InstrumentInfo>;
-  using mapRankingNeg_t = std::multimap<double, InstrumentInfo, MaxNegativesCompare>;
-  using pairRanking_t = std::pair<double,InstrumentInfo>;
-
-  static const unsigned short m_nMaxInList = 10;  // maximum of 10 items in each list
-  mapRankingPos_t m_mapMaxPositives;
-  mapRankingNeg_t m_mapMaxNegatives;
-
-  mapRankingPos_t m_mapMaxVolatility;
-
   using citerBars = ou::tf::Bars::const_iterator;
 
-  void CheckForDarvas( const ou::tf::Bars&, IIDarvas&, fSelectedDarvas_t& );
-  void CheckFor10Percent( citerBars begin, citerBars end, const InstrumentInfo& );
-  void CheckForVolatility( citerBars begin, citerBars end, const InstrumentInfo& );
-  void CheckForRange( citerBars begin, citerBars end, const InstrumentInfo& );
-
-  void WrapUp10Percent( setInstrumentInfo_t& selected );
-  void WrapUpVolatility( setInstrumentInfo_t& selected );
-  void WrapUpPivots( setInstrumentInfo_t& selected );
+  // scoring functions for ou::tf::BarScreener criteria, these run concurrently across symbols,
+  //   so write only to the InstrumentInfo handed in
+  bool CheckForDarvas( const ou::tf::Bars&, IIDarvas& ) const;
+  static bool CheckFor10Percent( citerBars begin, citerBars end, double& dblReturn ); // rank both ends, 10 in each list
+  static bool CheckForVolatility( citerBars begin, citerBars end, double& dblVolatility ); // rank largest
+  static bool CheckForRange( citerBars begin, citerBars end, double& dblRatio ); // rank smallest
 
 };
 
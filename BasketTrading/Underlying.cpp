@@ -88,8 +88,8 @@ void Underlying::SetPivots( double dblR2, double dblR1, double dblPV, double dbl
     << std::endl;
 }
 
-void Underlying::SaveSeries( const std::string& sPrefix ) {
-  m_pWatch->SaveSeries( sPrefix );
+void Underlying::CollectSeries( ou::tf::HDF5WriteBatch& batch, const std::string& sPrefix ) {
+  m_pWatch->CollectSeries( batch, sPrefix );
 }
 
 void Underlying::ReadDailyBars( const std::string& sDailyBarPath ) {
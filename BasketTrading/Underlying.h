@@ -73,7 +73,7 @@ public:
   pPortfolio_t GetPortfolio() { return m_pPortfolio; }
   pChartDataView_t GetChartDataView() { return m_pChartDataView; }
 
-  void SaveSeries( const std::string& sPrefix );
+  void CollectSeries( ou::tf::HDF5WriteBatch&, const std::string& sPrefix );
 
   // TODO: will need two mapChain types:
   //   1) basic for passing to strategy
@@ -0,0 +1,184 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    main.cpp
+ * Author:  raymond@burkholder.net
+ * Project: ChainLookupBench
+ * Created: October 19, 2026 21:40 PM
+ */
+
+
+/*
+  * cost of building an option chain and of the strike selection family, over
+  *   the std::map keyed chain Chain used to be, with iterator walks for the selections
+  *   Chain, with contiguous per strike records and the StrikeIndex
+  * chains are evenly spaced (the direct step lookup) and uneven (the binary search)
+  * usage: ChainLookupBench [strikes=400] [lookups=20000000]
+*/
+
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <stdexcept>
+#include <iostream>
+
+#include <OUCommon/Bench.h>
+
+#include <TFOptions/Chain.h>
+
+namespace {
+
+  using Chain = ou::tf::option::Chain<ou::tf::option::chain::OptionName>;
+
+  // the selections as they were written against the map
+  struct MapChain {
+    using mapChain_t = std::map<double, Chain::strike_t>;
+    mapChain_t m_mapChain;
+
+    void SetIQFeedNameCall( double strike, const std::string& sName ) {
+      m_mapChain[ strike ].call.sIQFeedSymbolName = sName;
+    }
+    void SetIQFeedNamePut( double strike, const std::string& sName ) {
+      m_mapChain[ strike ].put.sIQFeedSymbolName = sName;
+    }
+    double Put_Itm( double value ) const {
+      mapChain_t::const_iterator iter = m_mapChain.upper_bound( value );
+      if ( m_mapChain.end() == iter ) throw std::runtime_error( "Put_Itm not found" );
+      return iter->first;
+    }
+    double Call_ItmAtm( double value ) const {
+      mapChain_t::const_iterator iter = m_mapChain.lower_bound( value );
+      if ( m_mapChain.end() == iter ) throw std::runtime_error( "Call_ItmAtm not found" );
+      if ( value != iter->first ) {
+        if ( m_mapChain.begin() == iter ) throw std::runtime_error( "Call_ItmAtm at begin of chain" );
+        --iter;
+      }
+      return iter->first;
+    }
+    double Atm( double value ) const {
+      mapChain_t::const_iterator iter = m_mapChain.lower_bound( value );
+      if ( m_mapChain.end() == iter ) throw std::runtime_error( "Atm not found" );
+      if ( ( value == iter->first ) || ( m_mapChain.begin() == iter ) ) return value;
+      const double upper( iter->first );
+      --iter;
+      return ( ( upper - value ) < ( value - iter->first ) ) ? upper : iter->first;
+    }
+    const Chain::strike_t& GetExistingStrike( double strike ) const {
+      return m_mapChain.find( strike )->second;
+    }
+  };
+
+  using ou::bench::steady_t;
+  using ou::bench::Elapsed;
+  using ou::bench::Report;
+  using ou::bench::Run;
+
+  // strikes arrive in feed order, not sorted
+  std::vector<double> Strikes( size_t nStrikes, bool bEven, std::mt19937_64& rng ) {
+    std::vector<double> vStrike;
+    vStrike.reserve( nStrikes );
+    double strike( 200.0 );
+    for ( size_t ix = 0; ix < nStrikes; ix++ ) {
+      vStrike.push_back( strike );
+      strike += bEven ? 1.0 : ( ( ( nStrikes / 4 ) < ix ) && ( ( 3 * nStrikes / 4 ) > ix ) ? 1.0 : 5.0 );
+    }
+    std::shuffle( vStrike.begin(), vStrike.end(), rng );
+    return vStrike;
+  }
+
+  void Bench( const std::string& sLabel, const std::vector<double>& vStrike, size_t nLookups, std::mt19937_64& rng ) {
+
+    std::cout << sLabel << ": " << vStrike.size() << " strikes" << std::endl;
+
+    std::vector<std::string> vName;
+    vName.reserve( vStrike.size() );
+    for ( const double strike: vStrike ) {
+      vName.emplace_back( "SPY2611" + std::to_string( (int)( strike * 1000 ) ) );
+    }
+
+    const size_t nBuilds( std::max<size_t>( 1, 2000000 / vStrike.size() ) );
+
+    MapChain map;
+    {
+      steady_t::time_point start = steady_t::now();
+      for ( size_t n = 0; n < nBuilds; n++ ) {
+        map = MapChain();
+        for ( size_t ix = 0; ix < vStrike.size(); ix++ ) {
+          map.SetIQFeedNameCall( vStrike[ ix ], vName[ ix ] );
+          map.SetIQFeedNamePut( vStrike[ ix ], vName[ ix ] );
+        }
+      }
+      Report( "  build std::map", Elapsed( start ), nBuilds * vStrike.size(), map.m_mapChain.size() );
+    }
+
+    std::unique_ptr<Chain> pChain; // Chain is move constructed only
+    {
+      steady_t::time_point start = steady_t::now();
+      for ( size_t n = 0; n < nBuilds; n++ ) {
+        pChain = std::make_unique<Chain>();
+        for ( size_t ix = 0; ix < vStrike.size(); ix++ ) {
+          pChain->SetIQFeedNameCall( vStrike[ ix ], vName[ ix ] );
+          pChain->SetIQFeedNamePut( vStrike[ ix ], vName[ ix ] );
+        }
+      }
+      Report( "  build Chain", Elapsed( start ), nBuilds * vStrike.size(), pChain->Size() );
+    }
+    const Chain& chain( *pChain );
+
+    // underlying prices wander inside the chain, as a quote stream does
+    const double lo( map.m_mapChain.begin()->first + 0.01 );
+    const double hi( map.m_mapChain.rbegin()->first - 0.01 );
+    std::vector<double> vStream( nLookups );
+    {
+      std::uniform_real_distribution<double> any( lo, hi );
+      std::normal_distribution<double> step( 0.0, 0.05 );
+      double price( any( rng ) );
+      for ( double& value: vStream ) {
+        price = std::min( hi, std::max( lo, price + step( rng ) ) );
+        value = price;
+      }
+    }
+
+    Run( "  Put_Itm std::map", vStream, [&]( double value ){ return map.Put_Itm( value ); } );
+    Run( "  Put_Itm Chain", vStream, [&]( double value ){ return chain.Put_Itm( value ); } );
+    Run( "  Call_ItmAtm std::map", vStream, [&]( double value ){ return map.Call_ItmAtm( value ); } );
+    Run( "  Call_ItmAtm Chain", vStream, [&]( double value ){ return chain.Call_ItmAtm( value ); } );
+    Run( "  Atm std::map", vStream, [&]( double value ){ return map.Atm( value ); } );
+    Run( "  Atm Chain", vStream, [&]( double value ){ return chain.Atm( value ); } );
+    Run( "  Atm + strike std::map", vStream,
+      [&]( double value ){ return (double)map.GetExistingStrike( map.Atm( value ) ).call.sIQFeedSymbolName.size(); } );
+    Run( "  Atm + strike Chain", vStream,
+      [&]( double value ){ return (double)chain.GetExistingStrike( chain.Atm( value ) ).call.sIQFeedSymbolName.size(); } );
+  }
+
+} // namespace anonymous
+
+int main( int argc, char* argv[] ) {
+
+  const size_t nStrikes = ( 1 < argc ) ? std::stoul( argv[ 1 ] ) : 400;
+  const size_t nLookups = ( 2 < argc ) ? std::stoul( argv[ 2 ] ) : 20000000;
+
+  std::cout << "ChainLookupBench: " << nStrikes << " strikes, " << nLookups << " lookups" << std::endl;
+
+  std::mt19937_64 rng( 42 );
+
+  Bench( "even", Strikes( nStrikes, true, rng ), nLookups, rng );
+  Bench( "uneven", Strikes( nStrikes, false, rng ), nLookups, rng );
+
+  return 0;
+}
@@ -32,6 +32,7 @@ namespace po = boost::program_options;
 namespace {
   static const std::string sChoice_SymbolName("symbol_name" );
   static const std::string sChoice_StopTime("stop_time" );
+  static const std::string sChoice_CapturePath("capture_path" );
 
   template<typename T>
   bool parse( const std::string& sFileName, po::variables_map& vm, const std::string& name, bool bRequired, T& dest ) {
@@ -62,6 +63,7 @@ bool Load( const std::string& sFileName, Choices& choices ) {
     config.add_options()
       ( sChoice_SymbolName.c_str(), po::value<std::string>( &choices.m_sSymbolName ), "symbol name" )
       ( sChoice_StopTime.c_str(),   po::value<std::string>( &choices.m_sStopTime ), "stop time HH:mm:ss UTC" )
+      ( sChoice_CapturePath.c_str(), po::value<std::string>( &choices.m_sCapturePath ), "directory for raw feed capture" )
       ;
     po::variables_map vm;
 
@@ -80,6 +82,8 @@ bool Load( const std::string& sFileName, Choices& choices ) {
       bOk &= parse<std::string>( sFileName, vm, sChoice_StopTime, true, choices.m_sStopTime );
       choices.m_tdStopTime = boost::posix_time::duration_from_string( choices.m_sStopTime );
 
+      parse<std::string>( sFileName, vm, sChoice_CapturePath, false, choices.m_sCapturePath );
+
     }
 
   }
@@ -32,6 +32,8 @@ struct Choices {
 
   std::string m_sStopTime;
   boost::posix_time::time_duration m_tdStopTime;
+
+  std::string m_sCapturePath; // optional, raw iqfeed lines are captured here for replay
 };
 
 bool Load( const std::string& sFileName, Choices& );
@@ -45,12 +45,18 @@ Process::Process(
 , m_ixDepthsByOrder_Writing( 1 )
 , m_sPathName( sSaveValuesRoot + "/" + sTimeStamp )
 {
+  if ( !m_choices.m_sCapturePath.empty() ) {
+    const std::string sPrefix( m_choices.m_sCapturePath + "/" + sTimeStamp + "-" + m_choices.m_sSymbolName );
+    m_pCaptureL1 = std::make_unique<ou::capture::Writer>( sPrefix + ".5009.cap", "iqfeed 5009 " + m_choices.m_sSymbolName );
+    m_pCaptureL2 = std::make_unique<ou::capture::Writer>( sPrefix + ".9200.cap", "iqfeed 9200 " + m_choices.m_sSymbolName );
+  }
   StartIQFeed();
 }
 
 Process::~Process() {
 
   if ( m_pDispatch ) {
+    m_pDispatch->Capture( nullptr );
     m_pDispatch->Disconnect();
   }
 
@@ -63,14 +69,19 @@ Process::~Process() {
 
   m_pComposeInstrumentIQFeed.reset();
 
+  m_piqfeed->Capture( nullptr );
   m_piqfeed->Disconnect();
   m_piqfeed.reset();
+
+  m_pCaptureL1.reset(); // writes the index
+  m_pCaptureL2.reset();
 }
 
 // need control c handler to terminate, as this is an ongoing process
 
 void Process::StartIQFeed() {
   m_piqfeed = ou::tf::iqfeed::Provider::Factory();
+  m_piqfeed->Capture( m_pCaptureL1.get() );
 
   m_piqfeed->OnConnected.Add( MakeDelegate( this, &Process::HandleIQFeedConnected ) );
   m_piqfeed->Connect();
@@ -136,6 +147,7 @@ void Process::StartWatch() {
   );
 
   m_pWatch->StartWatch();
+  m_pDispatch->Capture( m_pCaptureL2.get() );
   m_pDispatch->Connect();
 }
 
@@ -30,6 +30,8 @@
 
 #include <TFIQFeed/Level2/Symbols.hpp>
 
+#include <OUCommon/Capture.h>
+
 #include <TFTrading/Watch.h>
 #include <TFTrading/Instrument.h>
 
@@ -86,6 +88,10 @@ private:
   ou::tf::iqfeed::l2::OrderBased m_OrderBased; // direct access
   std::unique_ptr<ou::tf::iqfeed::l2::Symbols> m_pDispatch;
 
+  // raw lines as received, level 1 (port 5009) and level 2 (port 9200), when capture_path is set
+  std::unique_ptr<ou::capture::Writer> m_pCaptureL1;
+  std::unique_ptr<ou::capture::Writer> m_pCaptureL2;
+
   void StartIQFeed();
   void HandleIQFeedConnected( int );
   void ConstructUnderlying();
@@ -600,6 +600,12 @@ void AppComboTrading::BuildFrameOptionCombo() {
   m_pFOC->SetPosition( point );
   m_pFOC->Show();
 
+  m_pPortfolioGreekSandbox = std::make_shared<ou::tf::PortfolioGreek>(
+    idPortfolio_t( "sandboxes" ), ou::tf::PortfolioGreek::idAccountOwner_t( "none" ), idPortfolio_t( "self" ),
+    ou::tf::Portfolio::EPortfolioType::Standard, "USD", "sum of sandbox portfolios"
+    );
+  m_pPortfolioGreekSandbox->OnGreekUpdate.Add( MakeDelegate( this, &AppComboTrading::HandleSandboxGreekUpdate ) );
+
   HandleNewPanelOptionCombo( idPortfolio_t( "sandbox" ), "experimenting with option combinations" );
 
   m_pFOC->Layout();
@@ -629,6 +635,7 @@ AppComboTrading::pPanelOptionCombo_t AppComboTrading::HandleNewPanelOptionCombo(
           ou::tf::Portfolio::EPortfolioType::Standard, "USD", sDescription
         ) );
         poc.SetPortfolioGreek( pPortfolioGreek );
+        m_pPortfolioGreekSandbox->AddSubPortfolio( pPortfolioGreek );
 
         m_mapPortfoliosSandbox.insert( mapPortfoliosSandbox_t::value_type( pPortfolioGreek->Id(), structPortfolioSandbox( &poc ) ) );
       }
@@ -1025,6 +1032,17 @@ void AppComboTrading::HandleGuiRefresh( wxTimerEvent& event ) {
       vt.second.pT->UpdateGui();
     }
     );
+  if ( m_pPortfolioGreekSandbox ) {
+    m_pPortfolioGreekSandbox->Publish(); // greek/pl changes since the last refresh, propagated to each panel
+  }
+}
+
+void AppComboTrading::HandleSandboxGreekUpdate( const ou::tf::PortfolioGreek& portfolio ) {
+  const ou::tf::PortfolioGreek::Exposure& exposure( portfolio.GetExposure() );
+  m_pFOC->SetTitle(
+    wxString::Format( "Option Combo Sandbox - delta %0.2f gamma %0.4f theta %0.2f vega %0.2f",
+      exposure.dblDelta, exposure.dblGamma, exposure.dblTheta, exposure.dblVega )
+    );
 }
 
 void AppComboTrading::LookupDescription( const std::string& sSymbolName, std::string& sDescription ) {
@@ -1412,6 +1430,9 @@ void AppComboTrading::LoadState() {
 void AppComboTrading::OnClose( wxCloseEvent& event ) {
 
   m_timerGuiRefresh.Stop();
+  if ( m_pPortfolioGreekSandbox ) {
+    m_pPortfolioGreekSandbox->OnGreekUpdate.Remove( MakeDelegate( this, &AppComboTrading::HandleSandboxGreekUpdate ) );
+  }
 
   SaveState();
 
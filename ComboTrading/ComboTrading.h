@@ -135,6 +135,7 @@ private:
 
   mapPortfoliosTrading_t m_mapPortfoliosTrading;
   mapPortfoliosSandbox_t m_mapPortfoliosSandbox;
+  ou::tf::PortfolioGreek::pPortfolioGreek_t m_pPortfolioGreekSandbox; // reporting level over the sandbox panels
 
   ou::tf::PanelPortfolioPosition* m_pLastPPP;  // helps getting new positions to correct window
 
@@ -242,6 +243,7 @@ private:
   void HandleRegisterRows( ou::db::Session& session );
 
   void HandleGuiRefresh( wxTimerEvent& event );
+  void HandleSandboxGreekUpdate( const ou::tf::PortfolioGreek& );
 
   void HandlePortfolioLoad( pPortfolio_t& pPortfolio );
   void HandlePositionLoad( pPosition_t& pPosition );
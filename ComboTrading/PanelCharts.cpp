@@ -26,6 +26,8 @@
 
 #include <TFOptions/Option.h>
 
+#include <TFHDF5TimeSeries/HDF5WriteBatch.h>
+
 #include <TFVuTrading/WinChartView.h>
 #include <TFVuTrading/NotebookOptionChains.h>
 
@@ -573,12 +575,14 @@ void PanelCharts::OnWindowDestroy( wxWindowDestroyEvent& event ) {
 }
 
 void PanelCharts::SaveSeries( const std::string& sPrefix, const std::string& sDaily ) {
+  ou::tf::HDF5WriteBatch batch;
   std::for_each( m_mapInstrumentEntry.begin(), m_mapInstrumentEntry.end(),
-    [&sPrefix,&sDaily](mapInstrumentEntry_t::value_type& vt) {
+    [&sPrefix,&sDaily,&batch](mapInstrumentEntry_t::value_type& vt) {
       InstrumentEntry& entry( vt.second );
       entry.m_pWatch->EmitValues();
-      entry.m_pWatch->SaveSeries( sPrefix, sDaily );
+      entry.m_pWatch->CollectSeries( batch, sPrefix, sDaily );
     });
+  batch.Write();
 }
 
 wxBitmap PanelCharts::GetBitmapResource( const wxString& name ) {
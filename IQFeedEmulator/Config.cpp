@@ -0,0 +1,134 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Config.cpp
+ * Author:  raymond@burkholder.net
+ * Project: IQFeedEmulator
+ * Created: October 19, 2026 18:50:00
+ */
+
+#include <fstream>
+#include <exception>
+
+#include <boost/log/trivial.hpp>
+
+#include <boost/program_options.hpp>
+namespace po = boost::program_options;
+
+#include "Config.hpp"
+
+namespace {
+  static const std::string sChoice_Symbol( "symbol" );
+  static const std::string sChoice_InvalidSymbol( "invalid_symbol" );
+  static const std::string sChoice_PortLevel1( "port_l1" );
+  static const std::string sChoice_PortLevel2( "port_l2" );
+  static const std::string sChoice_PortHistory( "port_history" );
+  static const std::string sChoice_RateLevel1( "rate_l1" );
+  static const std::string sChoice_RateLevel2( "rate_l2" );
+  static const std::string sChoice_ReplayLevel1( "replay_l1" );
+  static const std::string sChoice_ReplayLevel2( "replay_l2" );
+  static const std::string sChoice_Seed( "seed" );
+  static const std::string sChoice_OrdersPerSide( "orders_per_side" );
+  static const std::string sChoice_HistoryCount( "history_count" );
+  static const std::string sChoice_HistoryLimit( "history_limit" );
+  static const std::string sChoice_ReportSeconds( "report_seconds" );
+  static const std::string sChoice_Threads( "threads" );
+
+  template<typename T>
+  bool parse( const std::string& sFileName, po::variables_map& vm, const std::string& name, bool bOptional, T& dest ) {
+    bool bOk = true;
+    if ( 0 < vm.count( name ) ) {
+      dest = std::move( vm[name].as<T>() );
+    }
+    else {
+      if ( !bOptional ) {
+        BOOST_LOG_TRIVIAL(error) << sFileName << " missing '" << name << "='";
+        bOk = false;
+      }
+    }
+  return bOk;
+  }
+}
+
+namespace config {
+
+bool Load( const std::string& sFileName, Choices& choices ) {
+
+  bool bOk( true );
+
+  try {
+
+    po::options_description config( "iqfeed emulator config" );
+    config.add_options()
+      ( sChoice_Symbol.c_str(), po::value<vName_t>( &choices.m_vSymbol ), "symbol" )
+      ( sChoice_InvalidSymbol.c_str(), po::value<vName_t>( &choices.m_vInvalidSymbol ), "invalid history symbol" )
+      ( sChoice_PortLevel1.c_str(), po::value<uint16_t>( &choices.m_nPortLevel1 ), "level 1 port" )
+      ( sChoice_PortLevel2.c_str(), po::value<uint16_t>( &choices.m_nPortLevel2 ), "level 2 port" )
+      ( sChoice_PortHistory.c_str(), po::value<uint16_t>( &choices.m_nPortHistory ), "history port" )
+      ( sChoice_RateLevel1.c_str(), po::value<double>( &choices.m_dblRateLevel1 ), "level 1 messages/s per connection, 0 saturates" )
+      ( sChoice_RateLevel2.c_str(), po::value<double>( &choices.m_dblRateLevel2 ), "level 2 messages/s per connection, 0 saturates" )
+      ( sChoice_ReplayLevel1.c_str(), po::value<std::string>( &choices.m_sReplayLevel1 ), "level 1 recorded lines" )
+      ( sChoice_ReplayLevel2.c_str(), po::value<std::string>( &choices.m_sReplayLevel2 ), "level 2 recorded lines" )
+      ( sChoice_Seed.c_str(), po::value<uint32_t>( &choices.m_nSeed ), "synthetic stream seed" )
+      ( sChoice_OrdersPerSide.c_str(), po::value<uint32_t>( &choices.m_nOrdersPerSide ), "level 2 resting orders per side" )
+      ( sChoice_HistoryCount.c_str(), po::value<uint32_t>( &choices.m_nHistoryCount ), "history datums for a request of 0" )
+      ( sChoice_HistoryLimit.c_str(), po::value<uint32_t>( &choices.m_nHistoryLimit ), "history requests per second, 0 for no limit" )
+      ( sChoice_ReportSeconds.c_str(), po::value<uint32_t>( &choices.m_nReportSeconds ), "report interval" )
+      ( sChoice_Threads.c_str(), po::value<uint32_t>( &choices.m_nThreads ), "io threads" )
+      ;
+    po::variables_map vm;
+
+    std::ifstream ifs( sFileName.c_str() );
+
+    if ( !ifs ) {
+      BOOST_LOG_TRIVIAL(info) << "iqfeed emulator config file " << sFileName << " does not exist, using defaults";
+    }
+    else {
+      po::store( po::parse_config_file( ifs, config), vm );
+
+      bOk &= parse<vName_t>( sFileName, vm, sChoice_Symbol, true, choices.m_vSymbol );
+      bOk &= parse<vName_t>( sFileName, vm, sChoice_InvalidSymbol, true, choices.m_vInvalidSymbol );
+      bOk &= parse<uint16_t>( sFileName, vm, sChoice_PortLevel1, true, choices.m_nPortLevel1 );
+      bOk &= parse<uint16_t>( sFileName, vm, sChoice_PortLevel2, true, choices.m_nPortLevel2 );
+      bOk &= parse<uint16_t>( sFileName, vm, sChoice_PortHistory, true, choices.m_nPortHistory );
+      bOk &= parse<double>( sFileName, vm, sChoice_RateLevel1, true, choices.m_dblRateLevel1 );
+      bOk &= parse<double>( sFileName, vm, sChoice_RateLevel2, true, choices.m_dblRateLevel2 );
+      bOk &= parse<std::string>( sFileName, vm, sChoice_ReplayLevel1, true, choices.m_sReplayLevel1 );
+      bOk &= parse<std::string>( sFileName, vm, sChoice_ReplayLevel2, true, choices.m_sReplayLevel2 );
+      bOk &= parse<uint32_t>( sFileName, vm, sChoice_Seed, true, choices.m_nSeed );
+      bOk &= parse<uint32_t>( sFileName, vm, sChoice_OrdersPerSide, true, choices.m_nOrdersPerSide );
+      bOk &= parse<uint32_t>( sFileName, vm, sChoice_HistoryCount, true, choices.m_nHistoryCount );
+      bOk &= parse<uint32_t>( sFileName, vm, sChoice_HistoryLimit, true, choices.m_nHistoryLimit );
+      bOk &= parse<uint32_t>( sFileName, vm, sChoice_ReportSeconds, true, choices.m_nReportSeconds );
+      bOk &= parse<uint32_t>( sFileName, vm, sChoice_Threads, true, choices.m_nThreads );
+
+      if ( ( 0.0 > choices.m_dblRateLevel1 ) || ( 0.0 > choices.m_dblRateLevel2 ) ) {
+        BOOST_LOG_TRIVIAL(error) << sFileName << " rates are 0 or positive";
+        bOk = false;
+      }
+      if ( 0 == choices.m_nThreads ) choices.m_nThreads = 1;
+    }
+
+  }
+  catch( std::exception& e ) {
+    BOOST_LOG_TRIVIAL(error) << sFileName << " parse error: " << e.what();
+    bOk = false;
+  }
+
+  return bOk;
+
+}
+
+} // namespace config
@@ -0,0 +1,65 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Config.hpp
+ * Author:  raymond@burkholder.net
+ * Project: IQFeedEmulator
+ * Created: October 19, 2026 18:50:00
+ */
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <cstdint>
+
+namespace config {
+
+using vName_t = std::vector<std::string>; // program options won't work with std::set
+
+struct Choices {
+
+  vName_t m_vSymbol;          // symbols which may be watched, empty for any
+  vName_t m_vInvalidSymbol;   // history requests answered with 'Invalid symbol'
+
+  uint16_t m_nPortLevel1;     // 5009
+  uint16_t m_nPortLevel2;     // 9200
+  uint16_t m_nPortHistory;    // 9100, history and lookup
+
+  double m_dblRateLevel1;     // messages per second per connection, 0 to saturate
+  double m_dblRateLevel2;
+
+  std::string m_sReplayLevel1; // recorded lines, replaces the synthetic stream when supplied
+  std::string m_sReplayLevel2;
+
+  uint32_t m_nSeed;           // synthetic streams are repeatable for a given seed
+  uint32_t m_nOrdersPerSide;  // resting orders in each synthetic level 2 book
+  uint32_t m_nHistoryCount;   // bars or ticks when a request asks for 0
+  uint32_t m_nHistoryLimit;   // history requests per second across connections, 0 for no limit
+  uint32_t m_nReportSeconds;  // throughput report interval
+  uint32_t m_nThreads;
+
+  Choices()
+  : m_nPortLevel1( 5009 ), m_nPortLevel2( 9200 ), m_nPortHistory( 9100 )
+  , m_dblRateLevel1( 1000.0 ), m_dblRateLevel2( 1000.0 )
+  , m_nSeed( 1 ), m_nOrdersPerSide( 20 ), m_nHistoryCount( 250 ), m_nHistoryLimit( 0 )
+  , m_nReportSeconds( 5 ), m_nThreads( 1 )
+  {}
+
+};
+
+bool Load( const std::string& sFileName, Choices& );
+
+} // namespace config
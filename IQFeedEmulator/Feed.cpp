@@ -0,0 +1,141 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Feed.cpp
+ * Author:  raymond@burkholder.net
+ * Project: IQFeedEmulator
+ * Created: October 19, 2026 19:05:00
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <functional>
+
+#include <boost/date_time/gregorian/gregorian.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include "Feed.hpp"
+
+Feed::Feed( const config::Choices& choices, const std::string& sReplay, const std::string& sName )
+: m_choices( choices )
+, m_bReplay( false )
+{
+  m_setSymbol.insert( m_choices.m_vSymbol.begin(), m_choices.m_vSymbol.end() );
+  if ( !sReplay.empty() ) {
+    Load( sReplay, sName );
+    m_bReplay = true;
+  }
+}
+
+// recorded lines are grouped by the symbol in field 2, and keep their order within a symbol
+//   level 1: Q and P lines, recorded with the update fields selected by TFIQFeed
+//   level 2: 3, 4, 5 and 6 lines
+//   other lines, such as system messages and fundamentals, are skipped
+
+void Feed::Load( const std::string& sFileName, const std::string& sName ) {
+
+  std::ifstream ifs( sFileName );
+  if ( !ifs ) {
+    throw std::runtime_error( sName + " can't open " + sFileName );
+  }
+
+  size_t nLines {};
+  std::string sLine;
+  while ( std::getline( ifs, sLine ) ) {
+    if ( !sLine.empty() && ( '\r' == sLine.back() ) ) sLine.pop_back();
+    if ( 2 > sLine.size() || ( ',' != sLine[ 1 ] ) ) continue;
+    switch ( sLine[ 0 ] ) {
+      case 'Q': case 'P':
+      case '3': case '4': case '5': case '6':
+        {
+          const std::string sSymbol( Field( sLine, 2 ) );
+          if ( !sSymbol.empty() && ( m_setSymbol.empty() || ( m_setSymbol.end() != m_setSymbol.find( sSymbol ) ) ) ) {
+            m_mapReplay[ sSymbol ].emplace_back( sLine + "\r\n" );
+            nLines++;
+          }
+        }
+        break;
+      default:
+        break;
+    }
+  }
+
+  std::cout
+    << sName << " replay " << sFileName << ": "
+    << nLines << " lines, "
+    << m_mapReplay.size() << " symbols"
+    << std::endl;
+}
+
+bool Feed::Valid( const std::string& sSymbol ) const {
+  if ( m_bReplay ) {
+    return m_mapReplay.end() != m_mapReplay.find( sSymbol );
+  }
+  else {
+    return m_setSymbol.empty() || ( m_setSymbol.end() != m_setSymbol.find( sSymbol ) );
+  }
+}
+
+const Feed::vLine_t* Feed::Recorded( const std::string& sSymbol ) const {
+  mapReplay_t::const_iterator iter = m_mapReplay.find( sSymbol );
+  return ( m_mapReplay.end() == iter ) ? nullptr : &iter->second;
+}
+
+uint32_t Feed::Seed( const std::string& sSymbol ) const {
+  return ::Seed( sSymbol, m_choices.m_nSeed );
+}
+
+double Feed::Price( const std::string& sSymbol ) const {
+  return 10.0 + ( Seed( sSymbol ) % 49000 ) / 100.0;
+}
+
+std::string Feed::Field( const std::string& sLine, size_t ix ) {
+  size_t begin {};
+  while ( 1 < ix ) {
+    begin = sLine.find( ',', begin );
+    if ( std::string::npos == begin ) return std::string();
+    begin++;
+    ix--;
+  }
+  const size_t end = sLine.find( ',', begin );
+  return sLine.substr( begin, ( std::string::npos == end ) ? std::string::npos : end - begin );
+}
+
+uint32_t Seed( const std::string& sSymbol, uint32_t nSeed ) {
+  uint32_t hash( 2166136261u ); // fnv-1a
+  for ( const char ch: sSymbol ) {
+    hash ^= (uint8_t)ch;
+    hash *= 16777619u;
+  }
+  return hash ^ nSeed;
+}
+
+std::string TimeOfDay() {
+  const boost::posix_time::time_duration td( boost::posix_time::microsec_clock::local_time().time_of_day() );
+  char sz[ 32 ];
+  snprintf( sz, sizeof( sz ), "%02d:%02d:%02d.%06d",
+    (int)td.hours(), (int)td.minutes(), (int)td.seconds(), (int)( td.total_microseconds() % 1000000 ) );
+  return sz;
+}
+
+std::string Date() {
+  const boost::gregorian::date date( boost::gregorian::day_clock::local_day() );
+  char sz[ 12 ];
+  snprintf( sz, sizeof( sz ), "%04u-%02u-%02u", // clamped, so the widths are known
+    (unsigned int)date.year() % 10000u, (unsigned int)date.month() % 100u, (unsigned int)date.day() % 100u );
+  return sz;
+}
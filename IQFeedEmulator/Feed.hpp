@@ -0,0 +1,75 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Feed.hpp
+ * Author:  raymond@burkholder.net
+ * Project: IQFeedEmulator
+ * Created: October 19, 2026 19:05:00
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "Config.hpp"
+
+// state shared by the handlers of the level 1 and level 2 ports
+//   which symbols may be watched, the seed, and recorded lines indexed by symbol
+// loaded once at startup, read-only afterwards
+
+class Feed {
+public:
+
+  using vLine_t = std::vector<std::string>; // each with its line terminator
+
+  Feed( const config::Choices&, const std::string& sReplay, const std::string& sName );
+
+  bool Replaying() const { return m_bReplay; }
+  bool Valid( const std::string& sSymbol ) const;
+  const vLine_t* Recorded( const std::string& sSymbol ) const; // nullptr when not replaying or not recorded
+
+  uint32_t Seed( const std::string& sSymbol ) const; // per symbol seed, repeatable across runs
+  double Price( const std::string& sSymbol ) const;  // synthetic starting price
+
+  const config::Choices& Choices() const { return m_choices; }
+
+  static std::string Field( const std::string& sLine, size_t ix ); // 1 based, as in IQFBaseMessage
+
+protected:
+private:
+
+  using setSymbol_t = std::unordered_set<std::string>;
+  using mapReplay_t = std::unordered_map<std::string, vLine_t>;
+
+  const config::Choices& m_choices;
+
+  bool m_bReplay;
+  setSymbol_t m_setSymbol;
+  mapReplay_t m_mapReplay;
+
+  void Load( const std::string& sFileName, const std::string& sName );
+
+};
+
+uint32_t Seed( const std::string& sSymbol, uint32_t nSeed ); // repeatable across runs, std::hash is not required to be
+
+// time stamps in the formats used by the feed
+
+std::string TimeOfDay(); // HH:MM:SS.ffffff, local time of the emulator, for latency measurement in the client
+std::string Date();      // YYYY-MM-DD
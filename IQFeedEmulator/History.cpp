@@ -0,0 +1,285 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    History.cpp
+ * Author:  raymond@burkholder.net
+ * Project: IQFeedEmulator
+ * Created: October 19, 2026 19:35:00
+ */
+
+#include <cstdio>
+#include <random>
+#include <algorithm>
+
+#include <boost/date_time/gregorian/gregorian.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include "Feed.hpp"
+#include "History.hpp"
+
+namespace {
+
+  namespace pt = boost::posix_time;
+  namespace gregorian = boost::gregorian;
+
+  // a subset of the iqfeed tables, enough for SymbolLookup's keyword matches and the emulated fundamentals
+  static const char* rszListedMarket[] = {
+    "LM,LS,5,NASDAQ,Nasdaq Stock Market,5,NASDAQ,",
+    "LM,LS,7,NYSE,New York Stock Exchange,7,NYSE,",
+    "LM,LS,11,NYSE_ARCA,NYSE Archipelago,11,NYSE_ARCA,",
+    "LM,LS,12,NYSE_AMERICAN,NYSE American,12,NYSE_AMERICAN,",
+    "LM,LS,14,OPRA,OPRA System,14,OPRA,",
+    "LM,LS,30,CBOT,Chicago Board Of Trade,30,CBOT,",
+    "LM,LS,34,CME,Chicago Mercantile Exchange,34,CME,",
+    "LM,LS,36,NYMEX,New York Mercantile Exchange,36,NYMEX,",
+    "LM,LS,44,COMEX,Commodity Exchange,44,COMEX,",
+    "LM,LS,50,CBOE,Chicago Board Options Exchange,50,CBOE,",
+    "LM,LS,74,FXCM,FXCM Forex,74,FXCM,",
+    nullptr
+  };
+
+  static const char* rszSecurityType[] = {
+    "ST,LS,1,EQUITY,Equity,",
+    "ST,LS,2,IEOPTION,Index/Equity Option,",
+    "ST,LS,3,MUTUAL,Mutual Fund,",
+    "ST,LS,4,MONEY,Money Market Fund,",
+    "ST,LS,5,BONDS,Bond,",
+    "ST,LS,6,INDEX,Index,",
+    "ST,LS,7,MKTSTATS,Market Statistic,",
+    "ST,LS,8,FUTURE,Future,",
+    "ST,LS,9,FOPTION,Future Option,",
+    "ST,LS,10,SPREAD,Future Spread,",
+    "ST,LS,11,SPOT,Spot,",
+    "ST,LS,12,FORWARD,Forward,",
+    "ST,LS,13,CALC,Calculated,",
+    "ST,LS,16,FOREX,Foreign Exchange,",
+    nullptr
+  };
+
+  static const char* rszTradeCondition[] = {
+    "TC,LS,1,REGULAR,Normal Trade,",
+    "TC,LS,2,ACQ,Acquisition,",
+    "TC,LS,3,CASHM,Cash Only Market,",
+    "TC,LS,23,ODD,Odd Lot Trade,",
+    "TC,LS,135,NON_UPDATE_LH,Does Not Update Last or High/Low,",
+    nullptr
+  };
+
+  void Table( const char* rsz[], const char* szEnd, std::string& sOut ) {
+    for ( const char** psz = rsz; nullptr != *psz; psz++ ) {
+      sOut += *psz;
+      sOut += "\r\n";
+    }
+    sOut += szEnd;
+  }
+
+  unsigned int Number( const std::string& s ) {
+    return s.empty() ? 0 : (unsigned int)std::strtoul( s.c_str(), nullptr, 10 );
+  }
+
+  void Stamp( const pt::ptime& dt, char* sz, size_t n ) { // YYYY-MM-DD HH:MM:SS
+    const gregorian::date date( dt.date() );
+    const pt::time_duration td( dt.time_of_day() );
+    snprintf( sz, n, "%04u-%02u-%02u %02u:%02u:%02u", // clamped, so the widths are known
+      (unsigned int)date.year() % 10000u, (unsigned int)date.month() % 100u, (unsigned int)date.day() % 100u,
+      (unsigned int)td.hours() % 100u, (unsigned int)td.minutes() % 100u, (unsigned int)td.seconds() % 100u );
+  }
+
+}
+
+class History::Client: public Handler {
+public:
+
+  Client( History& history ): m_history( history ) {}
+
+  void Line( Session& session, const std::string& sLine ) override {
+    const std::string sCommand( Feed::Field( sLine, 1 ) );
+    std::string sOut;
+    if ( "S" == sCommand ) {
+      if ( "SET PROTOCOL" == Feed::Field( sLine, 2 ) ) {
+        sOut = "S,CURRENT PROTOCOL,6.2,\r\n";
+      }
+    }
+    else if ( "SLM" == sCommand ) Table( rszListedMarket, "LM,!ENDMSG!,\r\n", sOut );
+    else if ( "SST" == sCommand ) Table( rszSecurityType, "ST,!ENDMSG!,\r\n", sOut );
+    else if ( "STC" == sCommand ) Table( rszTradeCondition, "TC,!ENDMSG!,\r\n", sOut );
+    else if ( "SBF" == sCommand ) SymbolsByFilter( sOut );
+    else if ( ( 3 == sCommand.size() ) && ( 'H' == sCommand[ 0 ] ) ) {
+      Request( sCommand, sLine, sOut );
+    }
+    if ( !sOut.empty() ) session.Send( sOut );
+  }
+
+protected:
+private:
+
+  History& m_history;
+
+  void SymbolsByFilter( std::string& sOut ) {
+    const config::vName_t& vSymbol( m_history.m_choices.m_vSymbol );
+    if ( vSymbol.empty() ) {
+      sOut = "BF,E,!NO_DATA!,\r\n";
+    }
+    else {
+      for ( const std::string& sSymbol: vSymbol ) {
+        sOut += "BF,LS," + sSymbol + ",5,1,EMULATED " + sSymbol + "\r\n";
+      }
+      sOut += "BF,!ENDMSG!,\r\n";
+    }
+  }
+
+  void Request( const std::string& sCommand, const std::string& sLine, std::string& sOut ) {
+
+    const std::string sSymbol( Feed::Field( sLine, 2 ) );
+    const std::string sId( sLine.substr( sLine.rfind( ',' ) + 1 ) ); // the request id prefixes each response
+    const uint32_t nDefault( std::max<uint32_t>( 1, m_history.m_choices.m_nHistoryCount ) );
+
+    if ( !m_history.Admit() ) {
+      sOut = sId + ",E,Too many simultaneous history requests.,\r\n" + sId + ",!ENDMSG!,\r\n";
+      return;
+    }
+
+    if ( m_history.m_setInvalid.end() != m_history.m_setInvalid.find( sSymbol ) ) {
+      sOut = sId + ",E,Invalid symbol.,\r\n" + sId + ",!ENDMSG!,\r\n";
+      return;
+    }
+
+    // HDX,sym,n,dir,id  HIX,sym,i,n,dir,id  HID,sym,i,days,...,id  HTX,sym,n,dir,id  HTD,sym,days,...,id  HTT,sym,begin,end,...,id
+    std::mt19937 rng( Seed( sSymbol, m_history.m_choices.m_nSeed ) );
+    const pt::ptime now( pt::second_clock::local_time() );
+
+    if ( "HDX" == sCommand ) {
+      const uint32_t n( Number( Feed::Field( sLine, 3 ) ) );
+      EndOfDays( sId, rng, now, ( 0 == n ) ? nDefault : n, sOut );
+    }
+    else if ( ( "HIX" == sCommand ) || ( "HID" == sCommand ) ) {
+      const uint32_t nSeconds( std::max<uint32_t>( 1, Number( Feed::Field( sLine, 3 ) ) ) );
+      const uint32_t n( Number( Feed::Field( sLine, 4 ) ) );
+      uint32_t nIntervals( ( 0 == n ) ? nDefault : n );
+      if ( "HID" == sCommand ) { // n is days
+        nIntervals = std::min<uint32_t>( nDefault, std::max<uint32_t>( 1, 23400 / nSeconds ) ) * std::max<uint32_t>( 1, n );
+      }
+      Intervals( sId, rng, now, nSeconds, nIntervals, sOut );
+    }
+    else if ( ( "HTX" == sCommand ) || ( "HTD" == sCommand ) || ( "HTT" == sCommand ) ) {
+      const uint32_t n( Number( Feed::Field( sLine, 3 ) ) );
+      uint32_t nTicks( nDefault );
+      if ( "HTX" == sCommand ) nTicks = ( 0 == n ) ? nDefault : n;
+      if ( "HTD" == sCommand ) nTicks = nDefault * std::max<uint32_t>( 1, n );
+      Ticks( sId, rng, now, nTicks, sOut );
+    }
+    else {
+      sOut = sId + ",E,Unknown request.,\r\n";
+    }
+
+    sOut += sId + ",!ENDMSG!,\r\n";
+  }
+
+  // E,YYYY-MM-DD HH:MM:SS,high,low,open,close,volume,open interest,
+  void EndOfDays( const std::string& sId, std::mt19937& rng, const pt::ptime& now, uint32_t n, std::string& sOut ) {
+    gregorian::date date( now.date() );
+    std::vector<gregorian::date> vDate;
+    vDate.reserve( n );
+    while ( vDate.size() < n ) {
+      date -= gregorian::days( 1 );
+      const gregorian::greg_weekday wd( date.day_of_week() );
+      if ( ( gregorian::Saturday != wd ) && ( gregorian::Sunday != wd ) ) vDate.push_back( date );
+    }
+    double dblClose( 10.0 + ( rng() % 49000 ) / 100.0 );
+    char szStamp[ 24 ];
+    char sz[ 160 ];
+    for ( std::vector<gregorian::date>::reverse_iterator iter = vDate.rbegin(); vDate.rend() != iter; iter++ ) {
+      const double dblOpen( dblClose );
+      dblClose = std::max( 0.10, dblOpen * ( 1.0 + ( (int)( rng() % 401 ) - 200 ) / 10000.0 ) );
+      const double dblHigh( std::max( dblOpen, dblClose ) * ( 1.0 + ( rng() % 100 ) / 10000.0 ) );
+      const double dblLow( std::min( dblOpen, dblClose ) * ( 1.0 - ( rng() % 100 ) / 10000.0 ) );
+      Stamp( pt::ptime( *iter ), szStamp, sizeof( szStamp ) );
+      const int nLen = snprintf( sz, sizeof( sz ), "%s,%s,%.2f,%.2f,%.2f,%.2f,%u,0,\r\n",
+        sId.c_str(), szStamp, dblHigh, dblLow, dblOpen, dblClose, (unsigned int)( 100000 + ( rng() % 900000 ) ) );
+      sOut.append( sz, std::min<size_t>( nLen, sizeof( sz ) - 1 ) );
+    }
+  }
+
+  // I,YYYY-MM-DD HH:MM:SS,high,low,open,close,total volume,period volume,
+  void Intervals( const std::string& sId, std::mt19937& rng, const pt::ptime& now, uint32_t nSeconds, uint32_t n, std::string& sOut ) {
+    const pt::ptime dtEnd( now.date(), pt::seconds( ( now.time_of_day().total_seconds() / nSeconds ) * nSeconds ) );
+    pt::ptime dt( dtEnd - pt::seconds( (long)nSeconds * n ) );
+    double dblClose( 10.0 + ( rng() % 49000 ) / 100.0 );
+    uint64_t nTotal {};
+    char szStamp[ 24 ];
+    char sz[ 160 ];
+    for ( uint32_t ix = 0; ix < n; ix++ ) {
+      dt += pt::seconds( nSeconds ); // stamped at the end of the interval
+      const double dblOpen( dblClose );
+      dblClose = std::max( 0.10, dblOpen + 0.01 * ( (int)( rng() % 21 ) - 10 ) );
+      const double dblHigh( std::max( dblOpen, dblClose ) + 0.01 * ( rng() % 5 ) );
+      const double dblLow( std::max( 0.01, std::min( dblOpen, dblClose ) - 0.01 * ( rng() % 5 ) ) );
+      const uint32_t nVolume( 100 * ( 1 + ( rng() % 100 ) ) );
+      nTotal += nVolume;
+      Stamp( dt, szStamp, sizeof( szStamp ) );
+      const int nLen = snprintf( sz, sizeof( sz ), "%s,%s,%.2f,%.2f,%.2f,%.2f,%llu,%u,\r\n",
+        sId.c_str(), szStamp, dblHigh, dblLow, dblOpen, dblClose, (unsigned long long)nTotal, nVolume );
+      sOut.append( sz, std::min<size_t>( nLen, sizeof( sz ) - 1 ) );
+    }
+  }
+
+  // D,YYYY-MM-DD HH:MM:SS,last,last size,total volume,bid,ask,tick id,bid size,ask size,basis,
+  void Ticks( const std::string& sId, std::mt19937& rng, const pt::ptime& now, uint32_t n, std::string& sOut ) {
+    pt::ptime dt( now - pt::seconds( n ) );
+    double dblBid( 10.0 + ( rng() % 49000 ) / 100.0 );
+    uint64_t nTotal {};
+    char szStamp[ 24 ];
+    char sz[ 192 ];
+    for ( uint32_t ix = 0; ix < n; ix++ ) {
+      dt += pt::seconds( 1 );
+      dblBid = std::max( 0.01, dblBid + 0.01 * ( (int)( rng() % 3 ) - 1 ) );
+      const double dblAsk( dblBid + 0.01 );
+      const uint32_t r( rng() );
+      const double dblLast( ( 0 == ( r & 1 ) ) ? dblBid : dblAsk );
+      const uint32_t nSize( 100 * ( 1 + ( ( r >> 1 ) % 5 ) ) );
+      nTotal += nSize;
+      Stamp( dt, szStamp, sizeof( szStamp ) );
+      const int nLen = snprintf( sz, sizeof( sz ), "%s,%s,%.2f,%u,%llu,%.2f,%.2f,%u,%u,%u,C,\r\n",
+        sId.c_str(), szStamp, dblLast, nSize, (unsigned long long)nTotal, dblBid, dblAsk,
+        ix + 1, 100 * ( 1 + ( ( r >> 4 ) % 10 ) ), 100 * ( 1 + ( ( r >> 8 ) % 10 ) ) );
+      sOut.append( sz, std::min<size_t>( nLen, sizeof( sz ) - 1 ) );
+    }
+  }
+
+};
+
+History::History( const config::Choices& choices )
+: m_choices( choices )
+, m_tpWindow( clock_t::now() )
+, m_nInWindow {}
+{
+  m_setInvalid.insert( m_choices.m_vInvalidSymbol.begin(), m_choices.m_vInvalidSymbol.end() );
+}
+
+std::unique_ptr<Handler> History::Construct() {
+  return std::make_unique<Client>( *this );
+}
+
+bool History::Admit() {
+  if ( 0 == m_choices.m_nHistoryLimit ) return true;
+  std::lock_guard<std::mutex> lock( m_mutex );
+  const clock_t::time_point now( clock_t::now() );
+  if ( std::chrono::seconds( 1 ) <= ( now - m_tpWindow ) ) {
+    m_tpWindow = now;
+    m_nInWindow = 0;
+  }
+  m_nInWindow++;
+  return m_nInWindow <= m_choices.m_nHistoryLimit;
+}
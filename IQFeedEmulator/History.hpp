@@ -0,0 +1,65 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    History.hpp
+ * Author:  raymond@burkholder.net
+ * Project: IQFeedEmulator
+ * Created: October 19, 2026 19:35:00
+ */
+
+#pragma once
+
+#include <mutex>
+#include <memory>
+#include <chrono>
+#include <unordered_set>
+
+#include "Server.hpp"
+#include "Config.hpp"
+
+// port 9100: history requests from HistoryQuery<T>, and table lookups from SymbolLookup
+//   S,SET PROTOCOL is acknowledged, SLM, SST and STC answer with tables consistent with the level 1 fundamentals
+//   SBF answers with the configured symbols
+//   HDX, HIX, HID, HTX, HTD and HTT answer with synthetic datums, oldest first, then !ENDMSG!
+//   configured invalid symbols are answered with 'Invalid symbol.'
+// with a request limit, requests beyond it in a second are refused as iqfeed does, for exercising client pacing
+// responses are written in full, history is not paced by the message rate
+
+class History {
+public:
+
+  History( const config::Choices& );
+
+  std::unique_ptr<Handler> Construct(); // one per connection
+
+protected:
+private:
+
+  class Client;
+
+  using setSymbol_t = std::unordered_set<std::string>;
+  using clock_t = std::chrono::steady_clock;
+
+  const config::Choices& m_choices;
+
+  setSymbol_t m_setInvalid;
+
+  std::mutex m_mutex; // the window is shared by all connections
+  clock_t::time_point m_tpWindow;
+  uint32_t m_nInWindow;
+
+  bool Admit(); // false when over the request limit
+
+};
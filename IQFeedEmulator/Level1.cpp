@@ -0,0 +1,233 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Level1.cpp
+ * Author:  raymond@burkholder.net
+ * Project: IQFeedEmulator
+ * Created: October 19, 2026 19:15:00
+ */
+
+#include <cstdio>
+#include <random>
+#include <iostream>
+#include <algorithm>
+
+#include "Level1.hpp"
+
+namespace {
+
+  // as in TFIQFeed/Messages.h, IQFDynamicFeedMessage::selector
+  static const std::string sSelector( "Symbol,Total Volume,Bid,Ask,Bid Size,Ask Size,Number of Trades Today,Most Recent Trade,Most Recent Trade Size,Most Recent Trade Time,Most Recent Trade Conditions,Most Recent Trade Market Center,Message Contents,Most Recent Trade Aggressor,Open Interest" );
+
+  static const std::string sProtocol( "6.2" );
+
+  // exchange 5 (hex) and security type 1 are in the tables served on the lookup port
+  static const size_t nFundamentalFields = 58;
+
+}
+
+class Level1::Client: public Handler {
+public:
+
+  Client( const Feed& feed ): m_feed( feed ), m_ixNext {} {}
+
+  void Connected( Session& session ) override {
+    session.Send( "S,SERVER CONNECTED,\r\n" );
+    session.Send( "S,CUST,real_time,127.0.0.1,60002,emulator,6.2.0.25,0,,,\r\n" );
+  }
+
+  void Line( Session& session, const std::string& sLine ) override {
+    switch ( sLine[ 0 ] ) {
+      case 'S':
+        Command( session, sLine );
+        break;
+      case 'w':
+      case 't':
+        Watch( session, sLine.substr( 1 ), 't' == sLine[ 0 ] );
+        break;
+      case 'r':
+        Unwatch( sLine.substr( 1 ) );
+        break;
+      default:
+        break;
+    }
+  }
+
+  size_t Generate( std::string& sOut, size_t nMax ) override {
+    if ( m_vWatch.empty() ) return 0;
+    const std::string sTime( TimeOfDay() ); // one stamp per batch, the batch is written at once
+    for ( size_t ix = 0; ix < nMax; ix++ ) {
+      if ( m_vWatch.size() <= m_ixNext ) m_ixNext = 0;
+      Watched& watched( m_vWatch[ m_ixNext++ ] );
+      if ( nullptr == watched.pvRecorded ) Update( watched, sTime, sOut );
+      else {
+        sOut += (*watched.pvRecorded)[ watched.ixRecorded++ ];
+        if ( watched.pvRecorded->size() == watched.ixRecorded ) watched.ixRecorded = 0;
+      }
+    }
+    return nMax;
+  }
+
+protected:
+private:
+
+  struct Watched {
+    std::string sSymbol;
+    bool bTradesOnly;
+    std::mt19937 rng;
+    double dblBid;
+    double dblAsk;
+    double dblLast;
+    uint32_t nBidSize;
+    uint32_t nAskSize;
+    uint32_t nLastSize;
+    uint64_t nVolume;
+    uint32_t nTrades;
+    const Feed::vLine_t* pvRecorded;
+    size_t ixRecorded;
+    Watched( const std::string& sSymbol_, bool bTradesOnly_, uint32_t seed, double dblPrice )
+    : sSymbol( sSymbol_ ), bTradesOnly( bTradesOnly_ ), rng( seed )
+    , dblBid( dblPrice - 0.01 ), dblAsk( dblPrice ), dblLast( dblPrice )
+    , nBidSize( 100 ), nAskSize( 100 ), nLastSize( 100 ), nVolume {}, nTrades {}
+    , pvRecorded( nullptr ), ixRecorded {}
+    {}
+  };
+  using vWatched_t = std::vector<Watched>;
+
+  const Feed& m_feed;
+
+  vWatched_t m_vWatch;
+  size_t m_ixNext; // round robin across the watched symbols
+
+  void Command( Session& session, const std::string& sLine ) {
+    const std::string sCommand( Feed::Field( sLine, 2 ) );
+    if ( "SET PROTOCOL" == sCommand ) {
+      session.Send( "S,CURRENT PROTOCOL," + sProtocol + ",\r\n" );
+    }
+    else if ( "SELECT UPDATE FIELDS" == sCommand ) {
+      const std::string sFields( sLine.substr( std::string( "S,SELECT UPDATE FIELDS," ).size() ) );
+      if ( sSelector != sFields ) {
+        std::cout << "Level1 update fields differ from the emulated fields: " << sFields << std::endl;
+      }
+      session.Send( "S,CURRENT UPDATE FIELDNAMES," + sSelector + "\r\n" );
+    }
+    // TIMESTAMPSOFF, KEY, NEWSON and others need no answer
+  }
+
+  void Watch( Session& session, const std::string& sSymbol, bool bTradesOnly ) {
+    if ( !m_feed.Valid( sSymbol ) ) {
+      session.Send( "n," + sSymbol + "\r\n" );
+      return;
+    }
+    vWatched_t::iterator iter = Find( sSymbol );
+    if ( m_vWatch.end() == iter ) {
+      m_vWatch.emplace_back( Watched( sSymbol, bTradesOnly, m_feed.Seed( sSymbol ), m_feed.Price( sSymbol ) ) );
+      iter = m_vWatch.end() - 1;
+      iter->pvRecorded = m_feed.Recorded( sSymbol );
+    }
+    else {
+      iter->bTradesOnly = bTradesOnly;
+    }
+    std::string sOut;
+    Fundamental( *iter, sOut );
+    Message( 'P', *iter, "", TimeOfDay(), sOut );
+    session.Send( sOut );
+    session.Pump();
+  }
+
+  void Unwatch( const std::string& sSymbol ) {
+    vWatched_t::iterator iter = Find( sSymbol );
+    if ( m_vWatch.end() != iter ) m_vWatch.erase( iter );
+  }
+
+  vWatched_t::iterator Find( const std::string& sSymbol ) {
+    return std::find_if(
+      m_vWatch.begin(), m_vWatch.end(),
+      [&sSymbol]( const Watched& watched ){ return sSymbol == watched.sSymbol; } );
+  }
+
+  void Fundamental( const Watched& watched, std::string& sOut ) {
+    std::vector<std::string> vField( nFundamentalFields + 1 );
+    vField[  1 ] = "F";
+    vField[  2 ] = watched.sSymbol;
+    vField[  3 ] = "5";       // exchange id, hex
+    vField[ 19 ] = "EMULATED " + watched.sSymbol;
+    vField[ 31 ] = "14";      // format code
+    vField[ 32 ] = "2";       // precision
+    vField[ 35 ] = "1";       // security type, EQUITY
+    vField[ 36 ] = "5";       // listed market
+    vField[ 50 ] = "09:30:00";
+    vField[ 51 ] = "16:00:00";
+    vField[ 53 ] = "1";       // contract size
+    vField[ 55 ] = "0.01";    // tick size
+    for ( size_t ix = 1; ix <= nFundamentalFields; ix++ ) {
+      sOut += vField[ ix ];
+      sOut += ',';
+    }
+    sOut += "\r\n";
+  }
+
+  // a quote on one side, or a trade at the bid or ask, about one in four
+  void Update( Watched& watched, const std::string& sTime, std::string& sOut ) {
+    const uint32_t r( watched.rng() );
+    if ( watched.bTradesOnly || ( 0 == ( r & 0x3 ) ) ) {
+      const bool bBuy( 0 != ( r & 0x4 ) );
+      watched.dblLast = bBuy ? watched.dblAsk : watched.dblBid;
+      watched.nLastSize = 100 * ( 1 + ( ( r >> 8 ) % 5 ) );
+      watched.nVolume += watched.nLastSize;
+      watched.nTrades++;
+      Message( 'Q', watched, "C", sTime, sOut, bBuy ? '1' : '3' );
+    }
+    else {
+      const int nStep( (int)( ( r >> 4 ) % 3 ) - 1 ); // -1, 0, +1 tick
+      const uint32_t nSize( 100 * ( 1 + ( ( r >> 8 ) % 10 ) ) );
+      if ( 0 == ( r & 0x4 ) ) {
+        watched.dblBid = std::max( 0.01, watched.dblBid + 0.01 * nStep );
+        watched.nBidSize = nSize;
+        if ( watched.dblAsk <= watched.dblBid ) watched.dblAsk = watched.dblBid + 0.01;
+        Message( 'Q', watched, "b", sTime, sOut );
+      }
+      else {
+        watched.dblAsk = std::max( 0.02, watched.dblAsk + 0.01 * nStep );
+        watched.nAskSize = nSize;
+        if ( watched.dblBid >= watched.dblAsk ) watched.dblBid = watched.dblAsk - 0.01;
+        Message( 'Q', watched, "a", sTime, sOut );
+      }
+    }
+  }
+
+  // the field order of sSelector
+  void Message( char chType, const Watched& watched, const char* szContents, const std::string& sTime, std::string& sOut, char chAggressor = '0' ) {
+    char sz[ 256 ];
+    const int n = snprintf(
+      sz, sizeof( sz ),
+      "%c,%s,%llu,%.2f,%.2f,%u,%u,%u,%.2f,%u,%s,01,11,%s,%c,,\r\n",
+      chType, watched.sSymbol.c_str(),
+      (unsigned long long)watched.nVolume,
+      watched.dblBid, watched.dblAsk, watched.nBidSize, watched.nAskSize,
+      watched.nTrades, watched.dblLast, watched.nLastSize,
+      sTime.c_str(), szContents, chAggressor );
+    if ( 0 < n ) sOut.append( sz, std::min<size_t>( n, sizeof( sz ) - 1 ) );
+  }
+
+};
+
+Level1::Level1( const config::Choices& choices )
+: m_feed( choices, choices.m_sReplayLevel1, "Level1" )
+{}
+
+std::unique_ptr<Handler> Level1::Construct() {
+  return std::make_unique<Client>( m_feed );
+}
@@ -0,0 +1,49 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Level1.hpp
+ * Author:  raymond@burkholder.net
+ * Project: IQFeedEmulator
+ * Created: October 19, 2026 19:15:00
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "Feed.hpp"
+#include "Server.hpp"
+
+// port 5009: the watch protocol used by IQFeed<T>
+//   S,SERVER CONNECTED and S,CUST on connect, protocol 6.2 and the dynamic update fields are acknowledged
+//   w<symbol> and t<symbol> answer with a fundamental and a summary, then updates stream
+//   r<symbol> ends a watch, an unknown symbol is answered with n,<symbol>
+// updates are a random walk per symbol, or the recorded lines for the symbol, looped
+
+class Level1 {
+public:
+
+  Level1( const config::Choices& );
+
+  std::unique_ptr<Handler> Construct(); // one per connection
+
+protected:
+private:
+
+  class Client;
+
+  Feed m_feed;
+
+};
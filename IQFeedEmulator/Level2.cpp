@@ -0,0 +1,211 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Level2.cpp
+ * Author:  raymond@burkholder.net
+ * Project: IQFeedEmulator
+ * Created: October 19, 2026 19:25:00
+ */
+
+#include <cstdio>
+#include <random>
+#include <algorithm>
+
+#include "Level2.hpp"
+
+class Level2::Client: public Handler {
+public:
+
+  Client( const Feed& feed ): m_feed( feed ), m_ixNext {}, m_nOrderId( 1000 ), m_nPriority {} {}
+
+  void Connected( Session& session ) override {
+    session.Send( "S,SERVER CONNECTED,\r\n" );
+  }
+
+  void Line( Session& session, const std::string& sLine ) override {
+    const std::string sCommand( Feed::Field( sLine, 1 ) );
+    if ( "S" == sCommand ) {
+      if ( "SET PROTOCOL" == Feed::Field( sLine, 2 ) ) {
+        session.Send( "S,CURRENT PROTOCOL,6.2,\r\n" );
+      }
+    }
+    else if ( "WOR" == sCommand ) {
+      Watch( session, Feed::Field( sLine, 2 ) );
+    }
+    else if ( "ROR" == sCommand ) {
+      Unwatch( session, Feed::Field( sLine, 2 ) );
+    }
+    else if ( "WPL" == sCommand ) {
+      session.Send( "q," + Feed::Field( sLine, 2 ) + ",\r\n" );
+    }
+  }
+
+  size_t Generate( std::string& sOut, size_t nMax ) override {
+    if ( m_vWatch.empty() ) return 0;
+    const std::string sTime( TimeOfDay() );
+    const std::string sDate( Date() );
+    for ( size_t ix = 0; ix < nMax; ix++ ) {
+      if ( m_vWatch.size() <= m_ixNext ) m_ixNext = 0;
+      Watched& watched( m_vWatch[ m_ixNext++ ] );
+      if ( nullptr == watched.pvRecorded ) Update( watched, sTime, sDate, sOut );
+      else {
+        sOut += (*watched.pvRecorded)[ watched.ixRecorded++ ];
+        if ( watched.pvRecorded->size() == watched.ixRecorded ) watched.ixRecorded = 0;
+      }
+    }
+    return nMax;
+  }
+
+protected:
+private:
+
+  struct Order {
+    uint64_t nOrderId;
+    char chSide; // A: ask, B: bid
+    double dblPrice;
+    uint32_t nQuantity;
+    uint64_t nPriority;
+    bool bLive; // false between its delete and its replacement's add
+  };
+  using vOrder_t = std::vector<Order>;
+
+  struct Watched {
+    std::string sSymbol;
+    std::mt19937 rng;
+    double dblMid;
+    vOrder_t vOrder;
+    const Feed::vLine_t* pvRecorded;
+    size_t ixRecorded;
+    Watched( const std::string& sSymbol_, uint32_t seed, double dblPrice )
+    : sSymbol( sSymbol_ ), rng( seed ), dblMid( dblPrice ), pvRecorded( nullptr ), ixRecorded {} {}
+  };
+  using vWatched_t = std::vector<Watched>;
+
+  const Feed& m_feed;
+
+  vWatched_t m_vWatch;
+  size_t m_ixNext;
+
+  uint64_t m_nOrderId;
+  uint64_t m_nPriority;
+
+  void Watch( Session& session, const std::string& sSymbol ) {
+    if ( !m_feed.Valid( sSymbol ) ) {
+      session.Send( "n," + sSymbol + ",\r\n" );
+      return;
+    }
+    vWatched_t::iterator iter = Find( sSymbol );
+    if ( m_vWatch.end() != iter ) return;
+    m_vWatch.emplace_back( Watched( sSymbol, m_feed.Seed( sSymbol ), m_feed.Price( sSymbol ) ) );
+    Watched& watched( m_vWatch.back() );
+    watched.pvRecorded = m_feed.Recorded( sSymbol );
+    if ( nullptr == watched.pvRecorded ) {
+      const std::string sTime( TimeOfDay() );
+      const std::string sDate( Date() );
+      std::string sOut;
+      const uint32_t nOrders( std::max<uint32_t>( 1, m_feed.Choices().m_nOrdersPerSide ) );
+      for ( uint32_t ix = 0; ix < nOrders; ix++ ) {
+        for ( const char chSide: { 'B', 'A' } ) {
+          watched.vOrder.emplace_back( NewOrder( watched, chSide ) );
+          Arrival( '6', watched, watched.vOrder.back(), sTime, sDate, sOut );
+        }
+      }
+      session.Send( sOut );
+    }
+    session.Pump();
+  }
+
+  void Unwatch( Session& session, const std::string& sSymbol ) {
+    vWatched_t::iterator iter = Find( sSymbol );
+    if ( m_vWatch.end() != iter ) {
+      m_vWatch.erase( iter );
+      session.Send( "S,CLEAR DEPTH," + sSymbol + ",B,\r\n" );
+      session.Send( "S,CLEAR DEPTH," + sSymbol + ",A,\r\n" );
+    }
+  }
+
+  vWatched_t::iterator Find( const std::string& sSymbol ) {
+    return std::find_if(
+      m_vWatch.begin(), m_vWatch.end(),
+      [&sSymbol]( const Watched& watched ){ return sSymbol == watched.sSymbol; } );
+  }
+
+  Order NewOrder( Watched& watched, char chSide ) {
+    const uint32_t r( watched.rng() );
+    const double dblOffset( 0.01 * ( 1 + ( r % 10 ) ) ); // within ten ticks of the mid
+    Order order;
+    order.nOrderId = ++m_nOrderId;
+    order.chSide = chSide;
+    order.dblPrice = ( 'B' == chSide ) ? std::max( 0.01, watched.dblMid - dblOffset ) : watched.dblMid + dblOffset;
+    order.nQuantity = 1 + ( ( r >> 8 ) % 50 );
+    order.nPriority = ++m_nPriority;
+    order.bLive = true;
+    return order;
+  }
+
+  // half the messages modify a resting order, the rest cycle one: a delete, then an add on the same side at a new price
+  void Update( Watched& watched, const std::string& sTime, const std::string& sDate, std::string& sOut ) {
+    const uint32_t r( watched.rng() );
+    Order& order( watched.vOrder[ ( r >> 4 ) % watched.vOrder.size() ] );
+    if ( !order.bLive ) {
+      order.bLive = true;
+      Arrival( '3', watched, order, sTime, sDate, sOut );
+    }
+    else {
+      if ( 0 == ( r & 0x2 ) ) {
+        order.nQuantity = 1 + ( ( r >> 16 ) % 50 );
+        Arrival( '4', watched, order, sTime, sDate, sOut );
+      }
+      else {
+        Delete( watched, order, sTime, sDate, sOut );
+        watched.dblMid = std::max( 0.20, watched.dblMid + 0.01 * ( (int)( ( r >> 12 ) % 3 ) - 1 ) ); // the book drifts
+        order = NewOrder( watched, order.chSide );
+        order.bLive = false;
+      }
+    }
+  }
+
+  // 3, 4 and 6: type,symbol,orderid,mmid,side,price,quantity,priority,precision,time,date,
+  void Arrival( char chType, const Watched& watched, const Order& order, const std::string& sTime, const std::string& sDate, std::string& sOut ) {
+    char sz[ 192 ];
+    const int n = snprintf(
+      sz, sizeof( sz ),
+      "%c,%s,%llu,,%c,%.2f,%u,%llu,2,%s,%s,\r\n",
+      chType, watched.sSymbol.c_str(), (unsigned long long)order.nOrderId,
+      order.chSide, order.dblPrice, order.nQuantity, (unsigned long long)order.nPriority,
+      sTime.c_str(), sDate.c_str() );
+    if ( 0 < n ) sOut.append( sz, std::min<size_t>( n, sizeof( sz ) - 1 ) );
+  }
+
+  // 5: type,symbol,orderid,mmid,side,time,date,
+  void Delete( const Watched& watched, const Order& order, const std::string& sTime, const std::string& sDate, std::string& sOut ) {
+    char sz[ 128 ];
+    const int n = snprintf(
+      sz, sizeof( sz ),
+      "5,%s,%llu,,%c,%s,%s,\r\n",
+      watched.sSymbol.c_str(), (unsigned long long)order.nOrderId, order.chSide,
+      sTime.c_str(), sDate.c_str() );
+    if ( 0 < n ) sOut.append( sz, std::min<size_t>( n, sizeof( sz ) - 1 ) );
+  }
+
+};
+
+Level2::Level2( const config::Choices& choices )
+: m_feed( choices, choices.m_sReplayLevel2, "Level2" )
+{}
+
+std::unique_ptr<Handler> Level2::Construct() {
+  return std::make_unique<Client>( m_feed );
+}
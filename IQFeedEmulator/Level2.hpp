@@ -0,0 +1,50 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Level2.hpp
+ * Author:  raymond@burkholder.net
+ * Project: IQFeedEmulator
+ * Created: October 19, 2026 19:25:00
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "Feed.hpp"
+#include "Server.hpp"
+
+// port 9200: the market by order protocol used by l2::Dispatcher
+//   S,SERVER CONNECTED on connect, protocol 6.2 is acknowledged
+//   WOR,<symbol> answers with a summary of the book, then adds, updates and deletes stream
+//   ROR,<symbol> ends a watch and clears the book, WPL is answered with no depth available
+// the synthetic book keeps a fixed number of resting orders on each side,
+//   or the recorded lines for the symbol are looped
+
+class Level2 {
+public:
+
+  Level2( const config::Choices& );
+
+  std::unique_ptr<Handler> Construct(); // one per connection
+
+protected:
+private:
+
+  class Client;
+
+  Feed m_feed;
+
+};
@@ -0,0 +1,195 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Server.cpp
+ * Author:  raymond@burkholder.net
+ * Project: IQFeedEmulator
+ * Created: October 19, 2026 18:55:00
+ */
+
+#include <iostream>
+
+#include <boost/asio/write.hpp>
+#include <boost/asio/dispatch.hpp>
+#include <boost/asio/read_until.hpp>
+
+#include "Server.hpp"
+
+namespace asio = boost::asio;
+using tcp = boost::asio::ip::tcp;
+
+// ==== Session
+
+Session::Session( tcp::socket&& socket, std::unique_ptr<Handler> pHandler, double dblRate, Stats& stats )
+: m_socket( std::move( socket ) )
+, m_timer( m_socket.get_executor() )
+, m_pHandler( std::move( pHandler ) )
+, m_stats( stats )
+, m_dblRate( dblRate )
+, m_bWriting( false ), m_bTimer( false ), m_bIdle( true ), m_bClosed( false )
+, m_nSinceBase {}
+{
+  boost::system::error_code ec;
+  m_socket.set_option( tcp::no_delay( true ), ec );
+}
+
+Session::~Session() {
+}
+
+void Session::Start() { // from the acceptor, move onto the strand
+  asio::dispatch(
+    m_socket.get_executor(),
+    [this, self = shared_from_this()](){
+      m_stats.nConnections++;
+      m_pHandler->Connected( *this );
+      Read();
+      Write();
+    } );
+}
+
+void Session::Send( const std::string& s ) {
+  m_sResponse += s;
+  Write();
+}
+
+void Session::Pump() {
+  if ( m_bIdle ) {
+    m_bIdle = false;
+    m_tpBase = clock_t::now();
+    m_nSinceBase = 0;
+  }
+  Write();
+}
+
+void Session::Read() {
+  asio::async_read_until(
+    m_socket, m_bufRead, '\n',
+    [this, self = shared_from_this()]( const boost::system::error_code& ec, size_t ){
+      if ( ec ) {
+        Close();
+      }
+      else {
+        std::string sLine;
+        std::istream is( &m_bufRead );
+        std::getline( is, sLine );
+        if ( !sLine.empty() && ( '\r' == sLine.back() ) ) sLine.pop_back();
+        m_stats.nLinesIn++;
+        if ( !sLine.empty() ) m_pHandler->Line( *this, sLine );
+        if ( !m_bClosed ) Read();
+      }
+    } );
+}
+
+void Session::Write() {
+
+  if ( m_bWriting || m_bClosed ) return;
+
+  m_sWrite.clear();
+  std::swap( m_sWrite, m_sResponse );
+
+  size_t nGenerated {};
+  if ( !m_bIdle && !m_bTimer ) {
+    size_t nDue( nBatch );
+    if ( 0.0 < m_dblRate ) {
+      const double dblElapsed( std::chrono::duration<double>( clock_t::now() - m_tpBase ).count() );
+      const uint64_t nAllowed( (uint64_t)( m_dblRate * dblElapsed ) );
+      nDue = ( nAllowed > m_nSinceBase ) ? std::min<uint64_t>( nBatch, nAllowed - m_nSinceBase ) : 0;
+      if ( 0 == nDue ) { // wake when the next message is due
+        const clock_t::time_point tpDue(
+          m_tpBase + std::chrono::duration_cast<clock_t::duration>( std::chrono::duration<double>( ( m_nSinceBase + 1 ) / m_dblRate ) ) );
+        m_bTimer = true;
+        m_timer.expires_at( tpDue );
+        m_timer.async_wait(
+          [this, self = shared_from_this()]( const boost::system::error_code& ec ){
+            m_bTimer = false;
+            if ( !ec ) Write();
+          } );
+      }
+    }
+    if ( 0 < nDue ) {
+      nGenerated = m_pHandler->Generate( m_sWrite, nDue );
+      if ( 0 == nGenerated ) m_bIdle = true; // nothing watched
+      m_nSinceBase += nGenerated;
+    }
+  }
+
+  if ( m_sWrite.empty() ) return;
+
+  m_bWriting = true;
+  asio::async_write(
+    m_socket, asio::buffer( m_sWrite ),
+    [this, self = shared_from_this(), nGenerated]( const boost::system::error_code& ec, size_t nBytes ){
+      m_bWriting = false;
+      if ( ec ) {
+        Close();
+      }
+      else {
+        m_stats.nMessagesOut += nGenerated;
+        m_stats.nBytesOut += nBytes;
+        Write();
+      }
+    } );
+}
+
+void Session::Close() {
+  if ( !m_bClosed ) {
+    m_bClosed = true;
+    m_stats.nConnections--;
+    boost::system::error_code ec;
+    m_timer.cancel();
+    m_socket.shutdown( tcp::socket::shutdown_both, ec );
+    m_socket.close( ec );
+  }
+}
+
+// ==== Server
+
+Server::Server( asio::io_context& context, const std::string& sName, uint16_t nPort, double dblRate, fHandler_t&& fHandler )
+: m_context( context )
+, m_acceptor( context )
+, m_sName( sName )
+, m_dblRate( dblRate )
+, m_fHandler( std::move( fHandler ) )
+{
+  const tcp::endpoint endpoint( asio::ip::address_v4::loopback(), nPort ); // iqfeed only listens locally
+  m_acceptor.open( endpoint.protocol() );
+  m_acceptor.set_option( tcp::acceptor::reuse_address( true ) );
+  m_acceptor.bind( endpoint ); // throws if the port is in use, such as by iqconnect
+  m_acceptor.listen();
+  std::cout << m_sName << " listening on " << nPort << std::endl;
+  Accept();
+}
+
+Server::~Server() {
+  boost::system::error_code ec;
+  m_acceptor.close( ec );
+}
+
+void Server::Accept() {
+  m_acceptor.async_accept(
+    asio::make_strand( m_context ),
+    [this]( const boost::system::error_code& ec, tcp::socket socket ){
+      if ( ec ) {
+        if ( asio::error::operation_aborted != ec ) {
+          std::cout << m_sName << " accept error: " << ec.message() << std::endl;
+          Accept();
+        }
+      }
+      else {
+        std::make_shared<Session>( std::move( socket ), m_fHandler(), m_dblRate, m_stats )->Start();
+        Accept();
+      }
+    } );
+}
@@ -0,0 +1,132 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Server.hpp
+ * Author:  raymond@burkholder.net
+ * Project: IQFeedEmulator
+ * Created: October 19, 2026 18:55:00
+ */
+
+#pragma once
+
+#include <deque>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+
+#include <boost/asio/strand.hpp>
+#include <boost/asio/streambuf.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/io_context.hpp>
+
+// one listening port, serving a line based protocol
+//   commands from the client are handed to a Handler, one per connection
+//   responses to commands are written ahead of streamed traffic
+//   the handler generates streamed traffic on demand, paced at a rate per connection, 0 to saturate
+// a connection's reads, writes and timer run on its own strand
+
+class Session;
+
+class Handler {
+public:
+  virtual ~Handler() {}
+  virtual void Connected( Session& ) {}
+  virtual void Line( Session&, const std::string& ) = 0; // without the line terminator
+  virtual size_t Generate( std::string& /* sOut */, size_t /* nMax */ ) { return 0; } // appends up to nMax messages, returns the count
+};
+
+struct Stats {
+  std::atomic<uint64_t> nConnections;
+  std::atomic<uint64_t> nLinesIn;
+  std::atomic<uint64_t> nMessagesOut; // generated traffic
+  std::atomic<uint64_t> nBytesOut;    // includes responses
+  Stats(): nConnections {}, nLinesIn {}, nMessagesOut {}, nBytesOut {} {}
+};
+
+class Session: public std::enable_shared_from_this<Session> {
+public:
+
+  Session( boost::asio::ip::tcp::socket&&, std::unique_ptr<Handler>, double dblRate, Stats& );
+  ~Session();
+
+  void Start();
+
+  // for use by the handler, from within Connected or Line
+  void Send( const std::string& ); // a response, terminated by the caller
+  void Pump(); // the handler has traffic to generate, such as after a watch
+
+protected:
+private:
+
+  using clock_t = std::chrono::steady_clock;
+
+  static constexpr size_t nBatch = 256; // messages per write while saturating
+
+  boost::asio::ip::tcp::socket m_socket;
+  boost::asio::steady_timer m_timer;
+  boost::asio::streambuf m_bufRead;
+
+  std::unique_ptr<Handler> m_pHandler;
+  Stats& m_stats;
+
+  const double m_dblRate;
+
+  std::string m_sResponse; // queued responses
+  std::string m_sWrite;    // in flight
+
+  bool m_bWriting;
+  bool m_bTimer;
+  bool m_bIdle;    // nothing to generate, the pacing baseline restarts on the next Pump
+  bool m_bClosed;
+
+  clock_t::time_point m_tpBase;
+  uint64_t m_nSinceBase;
+
+  void Read();
+  void Write();
+  void Close();
+
+};
+
+class Server {
+public:
+
+  using fHandler_t = std::function<std::unique_ptr<Handler>()>;
+
+  Server( boost::asio::io_context&, const std::string& sName, uint16_t nPort, double dblRate, fHandler_t&& );
+  ~Server();
+
+  const std::string& Name() const { return m_sName; }
+  const Stats& GetStats() const { return m_stats; }
+
+protected:
+private:
+
+  boost::asio::io_context& m_context;
+  boost::asio::ip::tcp::acceptor m_acceptor;
+
+  const std::string m_sName;
+  const double m_dblRate;
+  fHandler_t m_fHandler;
+
+  Stats m_stats;
+
+  void Accept();
+
+};
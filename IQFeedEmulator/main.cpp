@@ -0,0 +1,132 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    main.cpp
+ * Author:  raymond@burkholder.net
+ * Project: IQFeedEmulator
+ * Created: October 19, 2026 19:50:00
+ */
+
+#include <memory>
+#include <vector>
+#include <iostream>
+
+#include <boost/asio/signal_set.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/thread/thread.hpp>
+
+#include "Config.hpp"
+#include "Server.hpp"
+#include "Level1.hpp"
+#include "Level2.hpp"
+#include "History.hpp"
+
+/*
+  * stands in for iqconnect on localhost, for load and latency testing of the TFIQFeed clients
+  * level 1 on 5009, level 2 on 9200, history and lookups on 9100
+  * synthetic or recorded streams, paced per connection, or saturating
+  * run on a machine without iqconnect, or change the ports in the config file
+*/
+
+namespace {
+
+  struct Report {
+    const Server& server;
+    uint64_t nMessages;
+    uint64_t nBytes;
+    Report( const Server& server_ ): server( server_ ), nMessages {}, nBytes {} {}
+  };
+  using vReport_t = std::vector<Report>;
+
+  void Arm( boost::asio::steady_timer& timer, uint32_t nSeconds, vReport_t& vReport ) {
+    timer.expires_after( std::chrono::seconds( nSeconds ) );
+    timer.async_wait(
+      [&timer, nSeconds, &vReport]( const boost::system::error_code& ec ){
+        if ( ec ) return;
+        for ( Report& report: vReport ) {
+          const Stats& stats( report.server.GetStats() );
+          const uint64_t nMessages( stats.nMessagesOut.load() );
+          const uint64_t nBytes( stats.nBytesOut.load() );
+          const uint64_t nConnections( stats.nConnections.load() );
+          if ( ( 0 == nConnections ) && ( nBytes == report.nBytes ) ) continue; // quiet
+          std::cout
+            << report.server.Name() << ": "
+            << nConnections << " connections, "
+            << stats.nLinesIn.load() << " commands, "
+            << ( nMessages - report.nMessages ) / nSeconds << " msg/s, "
+            << ( nBytes - report.nBytes ) / nSeconds / 1024 << " KiB/s"
+            << std::endl;
+          report.nMessages = nMessages;
+          report.nBytes = nBytes;
+        }
+        Arm( timer, nSeconds, vReport );
+      } );
+  }
+
+}
+
+int main( int argc, char* argv[] ) {
+
+  const std::string sConfigFileName( ( 1 < argc ) ? argv[ 1 ] : "iqfeedemulator.cfg" );
+
+  config::Choices choices;
+
+  if ( Load( sConfigFileName, choices ) ) {
+  }
+  else {
+    return EXIT_FAILURE;
+  }
+
+  boost::asio::io_context context;
+
+  try {
+
+    Level1 level1( choices );
+    Level2 level2( choices );
+    History history( choices );
+
+    Server serverLevel1( context, "Level1", choices.m_nPortLevel1, choices.m_dblRateLevel1, [&level1](){ return level1.Construct(); } );
+    Server serverLevel2( context, "Level2", choices.m_nPortLevel2, choices.m_dblRateLevel2, [&level2](){ return level2.Construct(); } );
+    Server serverHistory( context, "History", choices.m_nPortHistory, 0.0, [&history](){ return history.Construct(); } );
+
+    vReport_t vReport { Report( serverLevel1 ), Report( serverLevel2 ), Report( serverHistory ) };
+    boost::asio::steady_timer timerReport( context );
+    if ( 0 < choices.m_nReportSeconds ) {
+      Arm( timerReport, choices.m_nReportSeconds, vReport );
+    }
+
+    // https://www.boost.org/doc/libs/1_79_0/doc/html/boost_asio/reference/signal_set.html
+    boost::asio::signal_set signals( context, SIGINT );
+    signals.async_wait(
+      [&context](const boost::system::error_code&, int signal_number){
+        std::cout << "signal " << signal_number << ", stopping" << std::endl;
+        context.stop();
+      } );
+
+    boost::thread_group threads;
+    for ( uint32_t ix = 1; ix < choices.m_nThreads; ix++ ) {
+      threads.create_thread( [&context](){ context.run(); } );
+    }
+    context.run();
+    threads.join_all();
+
+  }
+  catch ( const std::exception& e ) {
+    std::cout << "IQFeedEmulator: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
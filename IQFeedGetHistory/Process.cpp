@@ -18,7 +18,6 @@
 #include <TFIQFeed/LoadMktSymbols.h>
 
 #include <TFHDF5TimeSeries/HDF5DataManager.h>
-#include <TFHDF5TimeSeries/HDF5WriteTimeSeries.h>
 
 #include "Process.h"
 
@@ -34,8 +33,7 @@ Process::Process(
   ou::tf::iqfeed::InMemoryMktSymbolList& list,
   const std::string& sPrefixPath,
 	size_t nDatums )
-: ou::tf::iqfeed::HistoryBulkQuery<Process>(),
-	m_list( list ),
+: m_list( list ),
   m_sPrefixPath( sPrefixPath ), m_nDatums( nDatums )
   //m_cntBars( 25 )
 //  m_cntBars( 0 ) // 2013/09/17
@@ -93,68 +91,83 @@ void Process::Start() {
   m_list.SelectSymbolsByExchange( m_vExchanges.begin(), m_vExchanges.end(), SelectSymbols( setSelected ) );
   std::cout << "# symbols selected: " << setSelected.size() << std::endl;
 
-  SetMaxSimultaneousQueries( 15 );
-  SetSymbols( setSelected.begin(), setSelected.end() );
-  DailyBars( m_nDatums );
-  Block();
+  m_pBatch = MakeBatch();
+
+  using HistoryDownloader = ou::tf::iqfeed::HistoryDownloader;
+  HistoryDownloader::Config config;
+  config.nConnections = 15;
+  HistoryDownloader downloader(
+    config,
+    [this]( const std::string& sSymbol, HistoryDownloader::pBars_t pBars ){ OnBars( sSymbol, pBars ); },
+    [this]( const std::string& sSymbol, const std::string& sReason ){ OnFailed( sSymbol, sReason ); }
+    );
+  downloader.Start();
+  for ( const std::string& sSymbol: setSelected ) {
+    downloader.EndOfDay( sSymbol, m_nDatums );
+  }
+  downloader.Wait();
+  downloader.Stop();
+  downloader.Summary();
+
+  pBatch_t pBatch; // the remainder
+  {
+    boost::mutex::scoped_lock lock( m_mutexProcessResults );
+    pBatch.swap( m_pBatch );
+  }
+  Write( *pBatch );
 
   std::cout << "Process complete." << std::endl;
 
 }
 
-void Process::OnBars( inherited_t::structResultBar* bars ) {
-
-  // warning:  this section is re-entrant from multiple threads
-
-  // save the data
-
-  boost::mutex::scoped_lock lock( m_mutexProcessResults );
-
-  assert( bars->sSymbol.length() > 0 );
+Process::pBatch_t Process::MakeBatch() const {
+  // series are handed over, no snapshot work for a pool
+  //   daily bars keep their prior storage: chunks of 64, not compressed
+  return std::make_unique<ou::tf::HDF5WriteBatch>( 64, 1, true, 0 );
+}
 
-  std::cout << bars->sSymbol << ": " << bars->bars.Size();
+void Process::Write( ou::tf::HDF5WriteBatch& batch ) {
+  boost::mutex::scoped_lock lock( m_mutexWrite );
+  batch.Write();
+}
 
-  if ( 0 != bars->bars.Size() ) {
+void Process::OnBars( const std::string& sSymbol, ou::tf::iqfeed::HistoryDownloader::pBars_t pBars ) {
 
-    std::string sPath;
+  // warning:  this section is re-entrant from multiple threads
 
-    ou::tf::HDF5DataManager::DailyBarPath( bars->sSymbol, sPath );  // build hierarchical path based upon symbol name
+  // save the data, a full batch is swapped out and written while the connections continue into a fresh one
 
-    ou::tf::HDF5DataManager dm( ou::tf::HDF5DataManager::RDWR );
-    ou::tf::HDF5WriteTimeSeries<ou::tf::Bars> wts( dm, false, true, 0, 64 );
-    wts.Write( sPath, &bars->bars );
-  }
+  assert( sSymbol.length() > 0 );
 
-  ReQueueBars( bars );
+  pBatch_t pBatch;
 
-  std::cout << "." << std::endl;
+  {
+    boost::mutex::scoped_lock lock( m_mutexProcessResults );
 
-}
+    std::cout << sSymbol << ": " << pBars->Size() << std::endl;
 
-void Process::OnTicks( inherited_t::structResultTicks* ticks ) {
+    if ( 0 != pBars->Size() ) {
 
-  boost::mutex::scoped_lock lock( m_mutexProcessResults );
+      std::string sPath;
 
-  assert( ticks->sSymbol.length() > 0 );
+      ou::tf::HDF5DataManager::DailyBarPath( sSymbol, sPath );  // build hierarchical path based upon symbol name
 
-  ou::tf::HDF5DataManager dm( ou::tf::HDF5DataManager::RDWR );
+      m_pBatch->Add<ou::tf::Bars>(
+        sSymbol, sPath, pBars,
+        ou::tf::HDF5WriteBatch::Attributes( ou::tf::Bar::Signature(), ou::tf::keytypes::EProviderIQF ) );
 
-  if ( 0 != ticks->trades.Size() ) {
-    std::string sPath( "/optionables/trade/" + ticks->sSymbol );
-    ou::tf::HDF5WriteTimeSeries<ou::tf::Trades> wtst( dm );
-    wtst.Write( sPath, &ticks->trades );
+      if ( m_nSymbolsPerWrite <= m_pBatch->Size() ) {
+        pBatch.swap( m_pBatch );
+        m_pBatch = MakeBatch();
+      }
+    }
   }
 
-  if ( 0 != ticks->quotes.Size() ) {
-    std::string sPath( "/optionables/quote/" + ticks->sSymbol );
-    ou::tf::HDF5WriteTimeSeries<ou::tf::Quotes> wtsq( dm );
-    wtsq.Write( sPath, &ticks->quotes );
-  }
+  if ( pBatch ) Write( *pBatch );
 
-  ReQueueTicks( ticks );
 }
 
-void Process::OnCompletion() {
-  std::cout << "Downloads complete." << std::endl;
+void Process::OnFailed( const std::string& sSymbol, const std::string& sReason ) {
+  boost::mutex::scoped_lock lock( m_mutexProcessResults );
+  std::cout << sSymbol << ": failed, " << sReason << std::endl;
 }
-
@@ -22,21 +22,19 @@
 */
 
 #include <set>
+#include <memory>
 #include <string>
 
 #include <boost/thread/mutex.hpp>
 #include <boost/thread/locks.hpp>
 
-#include <TFIQFeed/HistoryBulkQuery.h>
+#include <TFIQFeed/HistoryDownloader.h>
 #include <TFIQFeed/InMemoryMktSymbolList.h>
 
-class Process:
-  public ou::tf::iqfeed::HistoryBulkQuery<Process>
-{
-  friend ou::tf::iqfeed::HistoryBulkQuery<Process>;
-public:
+#include <TFHDF5TimeSeries/HDF5WriteBatch.h>
 
-  typedef ou::tf::iqfeed::HistoryBulkQuery<Process> inherited_t;
+class Process {
+public:
 
   Process(
     ou::tf::iqfeed::InMemoryMktSymbolList&,
@@ -48,28 +46,24 @@ public:
 
 protected:
 
-  // CRTP from HistoryBulkQuery<CProcess>
-  void OnBars( inherited_t::structResultBar* bars );
-  void OnTicks( inherited_t::structResultTicks* ticks );
-  void OnCompletion();
-
-  void OnBarsForDarvas( inherited_t::structResultBar* bars );
-
-  // CRTP prototypes
-  //void OnHistoryConnected( structQueryState* pqs );  // optional
-  //void OnHistoryDisconnected( structQueryState* pqs ); // optional
-  //void OnHistoryError( structQueryState* pqs, size_t e ); // optional
-  //void OnHistorySendDone( structQueryState* pqs ); // otional
-  //void OnHistoryTickDataPoint( structQueryState* pqs, ou::tf::iqfeed::HistoryStructs::structTickDataPoint* pDP ); // for per tick processing
-  //void OnHistoryIntervalData( structQueryState* pqs, ou::tf::iqfeed::HistoryStructs::structInterval* pDP ); // for per bar processing
-  //void OnHistorySummaryData( structQueryState* pqs, ou::tf::iqfeed::HistoryStructs::structSummary* pDP ); // for per bar processing
-  //void OnHistoryRequestDone( structQueryState* pqs ); // for processing finished ticks, bars
+  // from HistoryDownloader, re-entrant from the connection threads
+  void OnBars( const std::string& sSymbol, ou::tf::iqfeed::HistoryDownloader::pBars_t );
+  void OnFailed( const std::string& sSymbol, const std::string& sReason );
 
 private:
 
+  using pBatch_t = std::unique_ptr<ou::tf::HDF5WriteBatch>;
+
   ou::tf::iqfeed::InMemoryMktSymbolList& m_list;
 
-  boost::mutex m_mutexProcessResults;
+  boost::mutex m_mutexProcessResults; // the open batch
+  boost::mutex m_mutexWrite; // one batch at a time into the file
+
+  pBatch_t m_pBatch; // bars accumulate here, and are written each m_nSymbolsPerWrite symbols
+  static const size_t m_nSymbolsPerWrite = 250;
+
+  pBatch_t MakeBatch() const;
+  void Write( ou::tf::HDF5WriteBatch& );
 
   std::string m_sPrefixPath;
   const size_t m_nDatums;
@@ -29,6 +29,8 @@ using namespace boost::gregorian;
 #include <OUCommon/ReadSicCodeList.h>
 #include <OUCommon/ReadNaicsToSicCodeList.h>
 
+#include <TFIQFeed/MktSymbolSnapshot.h>
+
 #include "IQFeedMarketSymbols.h"
 
 IMPLEMENT_APP(AppIQFeedMarketSymbols)
@@ -156,6 +158,9 @@ void AppIQFeedMarketSymbols::HandleObtainNewIQFeedSymbolListRemote() {
   ou::tf::iqfeed::LoadMktSymbols( m_listIQFeedSymbols, ou::tf::iqfeed::MktSymbolLoadType::Download, true );
   std::cout << "Saving Binary File ... " << std::endl;
   m_listIQFeedSymbols.SaveToFile( ou::tf::iqfeed::detail::sFileNameMarketSymbolsBinary );
+  std::cout << "Saving Snapshot ... " << std::endl;
+  ou::tf::iqfeed::MktSymbolSnapshot::Write(
+    m_listIQFeedSymbols, ou::tf::iqfeed::detail::sFileNameMarketSymbolsSnapshot, ou::tf::iqfeed::detail::sFileNameMarketSymbolsBinary );
   std::cout << " ... done." << std::endl;
 }
 
@@ -173,6 +178,9 @@ void AppIQFeedMarketSymbols::HandleObtainNewIQFeedSymbolListLocal() {
   ou::tf::iqfeed::LoadMktSymbols( m_listIQFeedSymbols, ou::tf::iqfeed::MktSymbolLoadType::LoadTextFromDisk, false );
   std::cout << "Saving Binary File ... " << std::endl;
   m_listIQFeedSymbols.SaveToFile( ou::tf::iqfeed::detail::sFileNameMarketSymbolsBinary );
+  std::cout << "Saving Snapshot ... " << std::endl;
+  ou::tf::iqfeed::MktSymbolSnapshot::Write(
+    m_listIQFeedSymbols, ou::tf::iqfeed::detail::sFileNameMarketSymbolsSnapshot, ou::tf::iqfeed::detail::sFileNameMarketSymbolsBinary );
   std::cout << " ... done." << std::endl;
 }
 
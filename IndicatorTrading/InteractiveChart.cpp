@@ -33,6 +33,8 @@
 #include <TFOptions/Chains.h>
 #include <TFOptions/GatherOptions.h>
 
+#include <TFHDF5TimeSeries/HDF5WriteBatch.h>
+
 #include <TFVuTrading/TreeItem.hpp>
 
 #include "Config.h"
@@ -870,15 +872,17 @@ void InteractiveChart::HandleBarCompletionPriceDn( const ou::tf::Bar& bar ) {
 }
 
 void InteractiveChart::SaveWatch( const std::string& sPrefix ) {
-  m_pPositionUnderlying->GetWatch()->SaveSeries( sPrefix );
+  ou::tf::HDF5WriteBatch batch;
+  m_pPositionUnderlying->GetWatch()->CollectSeries( batch, sPrefix );
   //for ( mapStrikes_t::value_type& strike: m_mapStrikes ) {
   //  for ( mapOptionTracker_t::value_type& tracker: strike.second ) {
   //    tracker.second->SaveWatch( sPrefix );
   //  }
   //}
   for ( umapOptions_t::value_type& entry: m_umapOptionsRegistered ) {
-    entry.second->SaveSeries( sPrefix );
+    entry.second->CollectSeries( batch, sPrefix );
   }
+  batch.Write();
 }
 
 void InteractiveChart::EmitOptions() {
@@ -0,0 +1,238 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    main.cpp
+ * Author:  raymond@burkholder.net
+ * Project: LadderModelCheck
+ * Created: October 19, 2026 22:30 PM
+ */
+
+
+/*
+  * LadderModel, headless, against a synthetic book
+  *   checks: rows reported by Swap match the book, coalescing, a change and change back is not reported,
+  *     updates outside the window are counted, and a feed thread writing while the gui thread swaps
+  *     leaves the rows equal to the book after the final swap
+  *   bench: feed side updates/s, and the Swap cost for a refresh with few and with many levels dirty
+  * prints each failure, exits non zero on any
+  * usage: LadderModelCheck [updates=20000000]
+*/
+
+#include <map>
+#include <atomic>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <iostream>
+
+#include <OUCommon/Bench.h>
+
+#include <TFVuTrading/MarketDepth/LadderModel.hpp>
+
+namespace {
+
+  using LadderModel = ou::tf::l2::LadderModel;
+
+  size_t cntFailed {};
+
+  void Check( bool bOk, const std::string& sWhat ) {
+    if ( !bOk ) {
+      std::cout << "failed: " << sWhat << std::endl;
+      cntFailed++;
+    }
+  }
+
+  struct Row {
+    uint32_t ask;
+    uint32_t bid;
+    bool operator==( const Row& rhs ) const { return ( ask == rhs.ask ) && ( bid == rhs.bid ); }
+  };
+  using mapRow_t = std::map<int,Row>; // price index -> sizes, as the gui would show them
+
+  // the rows as the gui holds them, updated from each Swap
+  struct Ladder {
+    mapRow_t mapRow;
+    size_t Refresh( LadderModel& model ) {
+      return model.Swap( [this]( int ix, uint32_t ask, uint32_t bid ){ mapRow[ ix ] = Row{ ask, bid }; } );
+    }
+  };
+
+  bool Same( const mapRow_t& book, const mapRow_t& rows ) {
+    for ( const mapRow_t::value_type& vt: book ) {
+      const Row row( ( rows.end() == rows.find( vt.first ) ) ? Row{ 0, 0 } : rows.find( vt.first )->second );
+      if ( !( vt.second == row ) ) return false;
+    }
+    for ( const mapRow_t::value_type& vt: rows ) {
+      const Row row( ( book.end() == book.find( vt.first ) ) ? Row{ 0, 0 } : book.find( vt.first )->second );
+      if ( !( vt.second == row ) ) return false;
+    }
+    return true;
+  }
+
+  // a book around a mid price index, asks above, bids below
+  void Build( LadderModel& model, mapRow_t& book, int ixMid, int nDepth ) {
+    for ( int ix = 1; ix <= nDepth; ix++ ) {
+      model.SetAsk( ixMid + ix, 100 * ix );
+      model.SetBid( ixMid - ix, 100 * ix );
+      book[ ixMid + ix ].ask = 100 * ix;
+      book[ ixMid - ix ].bid = 100 * ix;
+    }
+  }
+
+  void CheckRows() {
+    LadderModel model( 1024 );
+    mapRow_t book;
+    Ladder ladder;
+
+    model.SetAsk( 10000, 0 ); // first update fixes the window, centered here
+    Build( model, book, 10000, 20 );
+    Check( 40 == ladder.Refresh( model ), "first swap reports each populated level" );
+    Check( Same( book, ladder.mapRow ), "rows match the book after the first swap" );
+    Check( 0 == ladder.Refresh( model ), "nothing reported without updates" );
+
+    for ( int n = 0; n < 10; n++ ) model.SetAsk( 10005, 1000 + n ); // coalesced
+    book[ 10005 ].ask = 1009;
+    Check( 1 == ladder.Refresh( model ), "many updates to a level report once" );
+    Check( Same( book, ladder.mapRow ), "rows hold the last of the coalesced updates" );
+
+    model.SetBid( 9990, 7 );
+    model.SetBid( 9990, book[ 9990 ].bid ); // changed, and changed back
+    Check( 0 == ladder.Refresh( model ), "a change and change back is not reported" );
+
+    model.SetAsk( 10001, 0 ); // level cleared
+    book[ 10001 ].ask = 0;
+    model.SetBid( 9999, 0 );
+    book[ 9999 ].bid = 0;
+    Check( 2 == ladder.Refresh( model ), "cleared levels are reported" );
+    Check( Same( book, ladder.mapRow ), "rows match after levels clear" );
+
+    const LadderModel::Stats before( model.GetStats() );
+    model.SetAsk( 10000 + 600, 1 ); // window is 1024 wide, centered on 10000
+    model.SetBid( 10000 - 600, 1 );
+    const LadderModel::Stats after( model.GetStats() );
+    Check( 2 == ( after.nOutOfRange - before.nOutOfRange ), "updates outside the window are counted" );
+    Check( 0 == ladder.Refresh( model ), "updates outside the window are not reported" );
+
+    model.SetAsk( 10000 - 512, 3 ); // the lowest and highest levels in the window, each end of the dirty words
+    model.SetAsk( 10000 + 511, 4 );
+    book[ 10000 - 512 ].ask = 3;
+    book[ 10000 + 511 ].ask = 4;
+    Check( 2 == ladder.Refresh( model ), "levels at the edges of the window are reported" );
+    Check( Same( book, ladder.mapRow ), "rows match at the edges of the window" );
+  }
+
+  // feed thread walks a book while the gui thread swaps, the rows must end equal to the book
+  void CheckConcurrent( size_t nUpdates ) {
+    LadderModel model( 4096 );
+    mapRow_t book; // written by the feed thread only, read after join
+    Ladder ladder;
+
+    model.SetAsk( 50000, 0 );
+    std::atomic<bool> bDone( false );
+
+    std::thread threadFeed(
+      [&model,&book,&bDone,nUpdates](){
+        std::mt19937_64 rng( 7 );
+        std::uniform_int_distribution<int> level( -200, 200 );
+        std::uniform_int_distribution<uint32_t> size( 0, 5000 );
+        for ( size_t n = 0; n < nUpdates; n++ ) {
+          const int ix( 50000 + level( rng ) );
+          const uint32_t volume( size( rng ) );
+          if ( 0 == ( n & 1 ) ) {
+            model.SetAsk( ix, volume );
+            book[ ix ].ask = volume;
+          }
+          else {
+            model.SetBid( ix, volume );
+            book[ ix ].bid = volume;
+          }
+        }
+        bDone.store( true, std::memory_order_release );
+      } );
+
+    size_t nSwaps {};
+    while ( !bDone.load( std::memory_order_acquire ) ) {
+      ladder.Refresh( model );
+      nSwaps++;
+    }
+    threadFeed.join();
+    ladder.Refresh( model ); // picks up what the last concurrent swap missed
+
+    Check( Same( book, ladder.mapRow ), "rows match the book after concurrent updates" );
+    Check( 0 < nSwaps, "swaps ran while the feed was writing" );
+  }
+
+  void Bench( size_t nUpdates ) {
+
+    LadderModel model;
+    model.SetAsk( 100000, 0 );
+
+    std::vector<int> vIndex( nUpdates );
+    {
+      std::mt19937_64 rng( 42 );
+      std::normal_distribution<double> level( 0.0, 40.0 ); // activity clusters around the inside
+      for ( int& ix: vIndex ) ix = 100000 + (int)level( rng );
+    }
+
+    uint32_t volume {};
+    ou::bench::Run( "SetAsk/SetBid", vIndex,
+      [&model,&volume]( int ix )->size_t{
+        if ( 0 == ( ++volume & 1 ) ) model.SetAsk( ix, volume );
+        else model.SetBid( ix, volume );
+        return 1;
+      } );
+
+    size_t nRows {};
+    auto f = [&nRows]( int, uint32_t, uint32_t ){ nRows++; };
+
+    // a refresh after a burst touching many levels, then a quiet one, as on a gui timer
+    std::vector<int> vRefresh( 1000 );
+    ou::bench::Run( "Swap, burst of 1000 updates", vRefresh,
+      [&model,&f,&vIndex]( int n )->size_t{
+        for ( size_t ix = 0; ix < 1000; ix++ ) model.SetAsk( vIndex[ ix ], (uint32_t)( n + ix ) );
+        return model.Swap( f );
+      } );
+    ou::bench::Run( "Swap, quiet", vRefresh,
+      [&model,&f]( int )->size_t{ return model.Swap( f ); } );
+
+    const LadderModel::Stats stats( model.GetStats() );
+    std::cout
+      << "updates=" << stats.nUpdates
+      << ",outofrange=" << stats.nOutOfRange
+      << ",swaps=" << stats.nSwaps
+      << ",reported=" << stats.nReported
+      << std::endl;
+  }
+
+} // namespace anon
+
+int main( int argc, char* argv[] ) {
+
+  const size_t nUpdates = ( 1 < argc ) ? std::stoul( argv[ 1 ] ) : 20000000;
+
+  CheckRows();
+  CheckConcurrent( nUpdates / 10 );
+
+  if ( 0 != cntFailed ) {
+    std::cout << "LadderModelCheck: " << cntFailed << " failed" << std::endl;
+    return 1;
+  }
+
+  std::cout << "LadderModelCheck: ok" << std::endl;
+  Bench( nUpdates );
+
+  return 0;
+}
@@ -0,0 +1,283 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    main.cpp
+ * Author:  raymond@burkholder.net
+ * Project: Level2FeatureBench
+ * Created: October 19, 2026 22:10 PM
+ */
+
+/*
+  * throughput of the level 2 feature vector set, FeatureSet vs FeatureEngine
+  * a synthetic order book stream is built up front, then replayed through each
+  * FeatureSet with the csv line per change, as rdaf/l2 emits it, over the first 50000 events
+  * FeatureEngine with the binary FeatureStream, dropping when behind, and waiting when behind
+  * usage: Level2FeatureBench [events=2000000] [levels=10] [directory=.]
+*/
+
+#include <random>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <functional>
+
+#include <TFIQFeed/Level2/FeatureSet.hpp>
+#include <TFIQFeed/Level2/FeatureEngine.hpp>
+#include <TFIQFeed/Level2/FeatureStream.hpp>
+
+namespace {
+
+  using EOp = ou::tf::iqfeed::l2::EOp;
+  using ESide = ou::tf::iqfeed::l2::FeatureEngine::ESide;
+
+  enum class EKind: uint8_t { None, Limit, Market, Cancel };
+
+  struct Event {
+    ESide side;
+    EOp op;
+    EKind kind;
+    unsigned int ix;
+    ou::tf::Depth depth;
+  };
+  using vEvent_t = std::vector<Event>;
+
+  // a random walk of a book, n levels a side, one tick apart with gaps
+  //   most of the traffic is size changes near the top, inserts and deletes shift the levels
+  vEvent_t Build( size_t nEvents, size_t nLevels ) {
+
+    vEvent_t vEvent;
+    vEvent.reserve( nEvents );
+
+    std::mt19937_64 rng( 20261019 );
+    std::geometric_distribution<unsigned int> level( 0.35 );
+    std::uniform_int_distribution<int> percent( 0, 99 );
+    std::uniform_int_distribution<int> volume( 1, 50 );
+    std::uniform_int_distribution<int> gap( 1, 2 );
+    std::exponential_distribution<double> arrival( 1.0 / 10.0 ); // mean 10us
+
+    const double tick( 0.25 );
+    std::vector<double> vAsk( nLevels + 1 ), vBid( nLevels + 1 );
+    std::vector<int> vAskVolume( nLevels + 1 ), vBidVolume( nLevels + 1 );
+
+    ptime dt( boost::gregorian::date( 2026, 10, 19 ), boost::posix_time::hours( 13 ) + boost::posix_time::minutes( 30 ) );
+    double dblMicroseconds {};
+
+    auto next = [&]()->ptime {
+      dblMicroseconds += arrival( rng ) + 1.0;
+      return dt + boost::posix_time::microseconds( (int64_t)dblMicroseconds );
+    };
+
+    // initial book
+    for ( unsigned int ix = 1; ix <= nLevels; ix++ ) {
+      vAsk[ ix ] = 4000.00 + ix * tick;
+      vBid[ ix ] = 4000.00 - ( ix - 1 ) * tick;
+      vAskVolume[ ix ] = volume( rng );
+      vBidVolume[ ix ] = volume( rng );
+      vEvent.push_back( Event{ ESide::Ask, EOp::Insert, EKind::None, ix, ou::tf::Depth( next(), vAsk[ ix ], vAskVolume[ ix ] ) } );
+      vEvent.push_back( Event{ ESide::Bid, EOp::Insert, EKind::None, ix, ou::tf::Depth( next(), vBid[ ix ], vBidVolume[ ix ] ) } );
+    }
+
+    while ( nEvents > vEvent.size() ) {
+
+      const bool bAsk( 0 == percent( rng ) % 2 );
+      std::vector<double>& vPrice( bAsk ? vAsk : vBid );
+      std::vector<int>& vVolume( bAsk ? vAskVolume : vBidVolume );
+      const double direction( bAsk ? 1.0 : -1.0 );
+      const ESide side( bAsk ? ESide::Ask : ESide::Bid );
+
+      const unsigned int ix( std::min<unsigned int>( nLevels, 1 + level( rng ) ) );
+      const int choice( percent( rng ) );
+
+      if ( 60 > choice ) { // size change
+        const int nVolume( volume( rng ) );
+        const bool bIncrease( nVolume > vVolume[ ix ] );
+        vVolume[ ix ] = nVolume;
+        vEvent.push_back( Event{ side, bIncrease ? EOp::Increase : EOp::Decrease, bIncrease ? EKind::Limit : EKind::Cancel, ix, ou::tf::Depth( next(), vPrice[ ix ], nVolume ) } );
+      }
+      else
+      if ( 80 > choice ) { // new level at ix, price between ix - 1 and ix
+        double price;
+        if ( 1 == ix ) {
+          price = vPrice[ 1 ] - direction * tick * gap( rng );
+          if ( bAsk ? ( price <= vBid[ 1 ] ) : ( price >= vAsk[ 1 ] ) ) continue; // would cross
+        }
+        else {
+          if ( std::abs( vPrice[ ix ] - vPrice[ ix - 1 ] ) < 1.5 * tick ) continue; // no room
+          price = vPrice[ ix - 1 ] + direction * tick;
+        }
+        for ( unsigned int jx = nLevels; jx > ix; jx-- ) {
+          vPrice[ jx ] = vPrice[ jx - 1 ];
+          vVolume[ jx ] = vVolume[ jx - 1 ];
+        }
+        vPrice[ ix ] = price;
+        vVolume[ ix ] = volume( rng );
+        vEvent.push_back( Event{ side, EOp::Insert, EKind::Limit, ix, ou::tf::Depth( next(), price, vVolume[ ix ] ) } );
+      }
+      else { // level removed, a deeper level comes into view
+        const ptime dtEvent( next() );
+        vEvent.push_back( Event{ side, EOp::Delete, ( 1 == ix ) ? EKind::Market : EKind::Cancel, ix, ou::tf::Depth( dtEvent, vPrice[ ix ], 0 ) } );
+        for ( unsigned int jx = ix; jx < nLevels; jx++ ) {
+          vPrice[ jx ] = vPrice[ jx + 1 ];
+          vVolume[ jx ] = vVolume[ jx + 1 ];
+        }
+        vPrice[ nLevels ] = vPrice[ nLevels - 1 ] + direction * tick * gap( rng );
+        vVolume[ nLevels ] = volume( rng );
+        vEvent.push_back( Event{ side, EOp::Insert, EKind::None, (unsigned int)nLevels, ou::tf::Depth( dtEvent, vPrice[ nLevels ], vVolume[ nLevels ] ) } );
+      }
+    }
+
+    return vEvent;
+  }
+
+  // same call pattern as the book change lambdas in rdaf/l2/StrategyFutures.cpp
+  template<typename Features>
+  void Apply( Features& features, const Event& event ) {
+    if ( ESide::Ask == event.side ) {
+      features.HandleBookChangesAsk( event.op, event.ix, event.depth );
+      switch ( event.kind ) {
+        case EKind::Limit:  features.Ask_IncLimit(  event.ix, event.depth ); break;
+        case EKind::Market: features.Ask_IncMarket( event.ix, event.depth ); break;
+        case EKind::Cancel: features.Ask_IncCancel( event.ix, event.depth ); break;
+        case EKind::None: break;
+      }
+    }
+    else {
+      features.HandleBookChangesBid( event.op, event.ix, event.depth );
+      switch ( event.kind ) {
+        case EKind::Limit:  features.Bid_IncLimit(  event.ix, event.depth ); break;
+        case EKind::Market: features.Bid_IncMarket( event.ix, event.depth ); break;
+        case EKind::Cancel: features.Bid_IncCancel( event.ix, event.depth ); break;
+        case EKind::None: break;
+      }
+    }
+  }
+
+  void Report( const std::string& sName, size_t nEvents, std::chrono::steady_clock::duration duration ) {
+    const double dblSeconds( std::chrono::duration<double>( duration ).count() );
+    std::cout
+      << std::left << std::setw( 34 ) << sName << std::right
+      << std::fixed << std::setprecision( 0 )
+      << std::setw( 12 ) << nEvents / dblSeconds << " events/s"
+      << std::setprecision( 1 )
+      << std::setw( 10 ) << 1e9 * dblSeconds / nEvents << " ns/event"
+      << std::endl;
+  }
+
+  void Time( const std::string& sName, const vEvent_t& vEvent, std::function<void( const Event& )>&& f ) {
+    const auto begin( std::chrono::steady_clock::now() );
+    for ( const Event& event: vEvent ) f( event );
+    Report( sName, vEvent.size(), std::chrono::steady_clock::now() - begin );
+  }
+
+  // prices and sizes of the active levels should agree after every change
+  size_t Compare( const vEvent_t& vEvent, size_t nLevels ) {
+    ou::tf::iqfeed::l2::FeatureSet fs;
+    ou::tf::iqfeed::l2::FeatureEngine fe;
+    fs.Set( nLevels );
+    fe.Set( nLevels );
+    size_t nMismatch {};
+    for ( const Event& event: vEvent ) {
+      Apply( fs, event );
+      Apply( fe, event );
+      for ( unsigned int ix = 1; ix <= nLevels; ix++ ) {
+        const auto& level( fs.FVS()[ ix ] );
+        if ( level.ask.bActive != fe.Active( ESide::Ask, ix ) ) nMismatch++;
+        else if ( level.ask.bActive && ( ( level.ask.v1.price != fe.Price( ESide::Ask, ix ) ) || ( level.ask.v1.volume != fe.Volume( ESide::Ask, ix ) ) ) ) nMismatch++;
+        if ( level.bid.bActive != fe.Active( ESide::Bid, ix ) ) nMismatch++;
+        else if ( level.bid.bActive && ( ( level.bid.v1.price != fe.Price( ESide::Bid, ix ) ) || ( level.bid.v1.volume != fe.Volume( ESide::Bid, ix ) ) ) ) nMismatch++;
+      }
+    }
+    return nMismatch;
+  }
+
+}
+
+int main( int argc, char* argv[] ) {
+
+  const size_t nEvents( ( 1 < argc ) ? std::stoul( argv[ 1 ] ) : 2000000 );
+  const size_t nLevels( ( 2 < argc ) ? std::stoul( argv[ 2 ] ) : 10 );
+  const std::string sDirectory( ( 3 < argc ) ? argv[ 3 ] : "." );
+
+  std::cout << "building " << nEvents << " events, " << nLevels << " levels" << std::endl;
+  const vEvent_t vEvent( Build( nEvents, nLevels ) );
+
+  std::cout << "level mismatches: " << Compare( vEvent, nLevels ) << std::endl;
+
+  {
+    ou::tf::iqfeed::l2::FeatureSet fs;
+    fs.Set( nLevels );
+    Time( "FeatureSet", vEvent, [&fs]( const Event& event ){ Apply( fs, event ); } );
+  }
+
+  {
+    ou::tf::iqfeed::l2::FeatureSet fs;
+    fs.Set( nLevels );
+    std::ofstream stream( sDirectory + "/fvs.csv", std::ios_base::trunc );
+    stream << "datetime," << fs.Header() << std::endl;
+    const vEvent_t vPrefix( vEvent.begin(), vEvent.begin() + std::min<size_t>( vEvent.size(), 50000 ) ); // slow
+    Time( "FeatureSet + csv", vPrefix,
+      [&fs,&stream]( const Event& event ){
+        Apply( fs, event );
+        stream
+          << boost::posix_time::to_iso_string( event.depth.DateTime() )
+          << ',' << fs
+          << std::endl;
+      } );
+  }
+
+  {
+    ou::tf::iqfeed::l2::FeatureEngine fe;
+    fe.Set( nLevels );
+    Time( "FeatureEngine", vEvent, [&fe]( const Event& event ){ Apply( fe, event ); } );
+  }
+
+  {
+    ou::tf::iqfeed::l2::FeatureEngine fe;
+    fe.Set( nLevels );
+    std::vector<float> vRow( fe.Columns() );
+    Time( "FeatureEngine + Fill", vEvent,
+      [&fe,&vRow]( const Event& event ){
+        Apply( fe, event );
+        fe.Fill( vRow.data() );
+      } );
+  }
+
+  for ( const bool bWait: { false, true } ) {
+    ou::tf::iqfeed::l2::FeatureEngine fe;
+    fe.Set( nLevels );
+    ou::tf::iqfeed::l2::FeatureStream::Config config;
+    config.bWait = bWait;
+    ou::tf::iqfeed::l2::FeatureStream stream( fe, config );
+    stream.Open( sDirectory + "/fvs.bin" );
+    Time( bWait ? "FeatureEngine + FeatureStream wait" : "FeatureEngine + FeatureStream", vEvent,
+      [&fe,&stream]( const Event& event ){
+        Apply( fe, event );
+        stream.Append( event.depth.DateTime(), event.side, event.op, event.ix );
+      } );
+    const auto begin( std::chrono::steady_clock::now() );
+    stream.Close();
+    const double dblClose( std::chrono::duration<double>( std::chrono::steady_clock::now() - begin ).count() );
+    const ou::tf::iqfeed::l2::FeatureStream::Stats stats( stream.GetStats() );
+    std::cout
+      << "  records " << stats.nRecords << ", dropped " << stats.nDropped
+      << ", blocks " << stats.nBlocks << ", close " << std::setprecision( 3 ) << dblClose << "s"
+      << std::endl;
+  }
+
+  return 0;
+}
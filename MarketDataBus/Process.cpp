@@ -0,0 +1,136 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Process.cpp
+ * Author:  raymond@burkholder.net
+ * Project: MarketDataBus
+ * Created: October 19, 2026 22:40 PM
+ */
+
+#include <iostream>
+
+#include <boost/asio/post.hpp>
+
+#include "Process.hpp"
+
+Process::Process( boost::asio::io_context& context )
+: m_context( context )
+, m_bFinished( false )
+, m_bL2Connected( false )
+{
+  m_piqfeed = ou::tf::iqfeed::Provider::Factory();
+  m_piqfeed->OnConnected.Add( MakeDelegate( this, &Process::HandleIQFeedConnected ) );
+  m_piqfeed->Connect();
+}
+
+Process::~Process() {
+  Finish();
+  m_piqfeed.reset();
+}
+
+// m_pL2 and m_pPublisher are only touched on m_context, alongside Poll and Finish
+void Process::HandleIQFeedConnected( int ) {
+  boost::asio::post( m_context, [this](){ Connected(); } );
+}
+
+void Process::Connected() {
+
+  if ( m_bFinished ) return;
+
+  m_pL2 = std::make_unique<ou::tf::iqfeed::l2::Symbols>(
+    [this](){
+      m_bL2Connected.store( true, std::memory_order_release );
+      std::cout << "level 2 connected" << std::endl;
+    } );
+  m_pL2->Connect();
+
+  m_pPublisher = std::make_unique<ou::tf::bus::Publisher>(
+    [this]( const std::string& sSymbol, uint32_t nStreams, ou::tf::bus::Ring& ring ){
+      Start( sSymbol, nStreams, ring );
+    } );
+
+  std::cout << "iqfeed connected, publishing" << std::endl;
+}
+
+void Process::Poll() {
+  if ( m_pPublisher && m_bL2Connected.load( std::memory_order_acquire ) ) {
+    m_pPublisher->Poll();
+  }
+}
+
+void Process::Start( const std::string& sSymbol, uint32_t nStreams, ou::tf::bus::Ring& ring ) {
+
+  mapSubscription_t::iterator iter = m_mapSubscription.find( sSymbol );
+  if ( m_mapSubscription.end() == iter ) {
+    iter = m_mapSubscription.emplace(
+      std::piecewise_construct, std::forward_as_tuple( sSymbol ), std::forward_as_tuple( sSymbol, ring ) ).first;
+  }
+  Subscription& sub( iter->second );
+
+  ou::tf::ProviderInterfaceBase& provider( *m_piqfeed ); // handlers are public on the base
+
+  if ( ( ou::tf::bus::EStream::quote & nStreams ) && !sub.bQuote ) {
+    sub.bQuote = true;
+    provider.AddQuoteHandler( sub.pInstrument, MakeDelegate( &sub, &Subscription::HandleQuote ) );
+  }
+  if ( ( ou::tf::bus::EStream::trade & nStreams ) && !sub.bTrade ) {
+    sub.bTrade = true;
+    provider.AddTradeHandler( sub.pInstrument, MakeDelegate( &sub, &Subscription::HandleTrade ) );
+  }
+
+  // a symbol is either market maker based (equities) or order based (futures), the first request decides
+  if ( !sub.bDepth ) {
+    if ( ou::tf::bus::EStream::depthbyorder & nStreams ) {
+      sub.bDepth = true;
+      m_pL2->WatchAdd(
+        sSymbol,
+        [&ring]( const ou::tf::DepthByOrder& depth ){ ring.Publish( depth ); } );
+    }
+    else
+    if ( ou::tf::bus::EStream::depthbymm & nStreams ) {
+      sub.bDepth = true;
+      m_pL2->WatchAdd(
+        sSymbol,
+        [&ring]( const ou::tf::DepthByMM& depth ){ ring.Publish( depth ); } );
+    }
+  }
+
+  std::cout << "publishing " << sSymbol << std::endl;
+}
+
+void Process::Finish() {
+
+  m_bFinished = true;
+
+  for ( mapSubscription_t::value_type& vt: m_mapSubscription ) {
+    Subscription& sub( vt.second );
+    ou::tf::ProviderInterfaceBase& provider( *m_piqfeed );
+    if ( sub.bQuote ) provider.RemoveQuoteHandler( sub.pInstrument, MakeDelegate( &sub, &Subscription::HandleQuote ) );
+    if ( sub.bTrade ) provider.RemoveTradeHandler( sub.pInstrument, MakeDelegate( &sub, &Subscription::HandleTrade ) );
+    if ( sub.bDepth ) m_pL2->WatchDel( vt.first );
+  }
+
+  if ( m_pL2 ) {
+    m_pL2->Disconnect();
+    m_pL2.reset();
+  }
+
+  m_mapSubscription.clear();
+  m_pPublisher.reset(); // removes the rings
+
+  if ( m_piqfeed ) {
+    m_piqfeed->Disconnect();
+  }
+}
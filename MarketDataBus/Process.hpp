@@ -0,0 +1,83 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Process.hpp
+ * Author:  raymond@burkholder.net
+ * Project: MarketDataBus
+ * Created: October 19, 2026 22:40 PM
+ */
+
+#pragma once
+
+// one IQFeed connection, level 1 and level 2, published to the shared memory bus
+//   strategies attach with ou::tf::bus::Provider in place of the iqfeed provider
+
+#include <map>
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include <boost/asio/io_context.hpp>
+
+#include <TFIQFeed/Provider.h>
+#include <TFIQFeed/Level2/Symbols.hpp>
+
+#include <TFTrading/Instrument.h>
+
+#include <TFBus/Publisher.hpp>
+
+class Process {
+public:
+
+  Process( boost::asio::io_context& ); // connect handling is posted here, Poll and Finish are called from it
+  ~Process();
+
+  void Poll(); // picks up new requests from readers
+  void Finish(); // stop watches, remove the rings
+
+protected:
+private:
+
+  boost::asio::io_context& m_context;
+
+  using pIQFeed_t = ou::tf::iqfeed::Provider::pProvider_t;
+  pIQFeed_t m_piqfeed;
+
+  bool m_bFinished;
+  std::atomic<bool> m_bL2Connected; // set on the level 2 thread
+  std::unique_ptr<ou::tf::iqfeed::l2::Symbols> m_pL2;
+
+  std::unique_ptr<ou::tf::bus::Publisher> m_pPublisher;
+
+  struct Subscription {
+    ou::tf::Instrument::pInstrument_t pInstrument;
+    ou::tf::bus::Ring& ring;
+    bool bQuote;
+    bool bTrade;
+    bool bDepth;
+    Subscription( const std::string& sSymbol, ou::tf::bus::Ring& ring_ )
+    : pInstrument( std::make_shared<ou::tf::Instrument>( sSymbol ) ), ring( ring_ )
+    , bQuote( false ), bTrade( false ), bDepth( false ) {}
+    void HandleQuote( const ou::tf::Quote& quote ) { ring.Publish( quote ); }
+    void HandleTrade( const ou::tf::Trade& trade ) { ring.Publish( trade ); }
+  };
+  using mapSubscription_t = std::map<std::string,Subscription>;
+  mapSubscription_t m_mapSubscription;
+
+  void HandleIQFeedConnected( int ); // iqfeed thread
+  void Connected();
+  void Start( const std::string& sSymbol, uint32_t nStreams, ou::tf::bus::Ring& );
+
+};
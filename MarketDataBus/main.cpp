@@ -0,0 +1,87 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    main.cpp
+ * Author:  raymond@burkholder.net
+ * Project: MarketDataBus
+ * Created: October 19, 2026 22:40 PM
+ */
+
+/*
+  * single upstream IQFeed connection, parsed once
+  * level 1 and level 2 written to per symbol shared memory rings (lib/TFBus)
+  * symbols are started on request from readers (ou::tf::bus::Provider)
+  * console based, control-c to stop
+*/
+
+#include <iostream>
+#include <functional>
+
+#include <boost/asio/signal_set.hpp>
+#include <boost/asio/deadline_timer.hpp>
+#include <boost/asio/executor_work_guard.hpp>
+
+#include "Process.hpp"
+
+int main() {
+
+  boost::asio::io_context m_context;
+  std::unique_ptr<boost::asio::executor_work_guard<boost::asio::io_context::executor_type> > m_pWork
+    = std::make_unique<boost::asio::executor_work_guard<boost::asio::io_context::executor_type> >( boost::asio::make_work_guard( m_context) );
+
+  boost::asio::deadline_timer timerPoll( m_context );
+
+  boost::asio::signal_set signals( m_context, SIGINT );
+
+  Process process( m_context );
+
+  signals.async_wait(
+    [&process,&timerPoll,&m_pWork](const boost::system::error_code& error_code, int signal_number){
+      std::cout
+        << "signal"
+        << "(" << error_code.category().name()
+        << "," << error_code.value()
+        << "," << signal_number
+        << "): "
+        << error_code.message()
+        << std::endl;
+
+      if ( SIGINT == signal_number) {
+        timerPoll.cancel();
+        m_pWork->reset();
+        process.Finish();
+      }
+    } );
+
+  using fPoll_t = std::function<void(const boost::system::error_code&)>;
+
+  fPoll_t fPoll = [&process,&timerPoll,&fPoll]( const boost::system::error_code& error_code ){
+    if ( 0 == error_code.value() ) {
+      process.Poll();
+      timerPoll.expires_from_now( boost::posix_time::milliseconds( 250 ) );
+      timerPoll.async_wait( fPoll );
+    }
+  };
+
+  timerPoll.expires_from_now( boost::posix_time::milliseconds( 250 ) );
+  timerPoll.async_wait( fPoll );
+
+  m_context.run();
+
+  signals.clear();
+  signals.cancel();
+
+  return EXIT_SUCCESS;
+}
@@ -16,12 +16,18 @@
 
 #define FUSION_MAX_VECTOR_SIZE 13
 
+#include <map>
+#include <limits>
+#include <vector>
+#include <functional>
+
 #include <wx/bitmap.h>
 
 #include <boost/foreach.hpp>
 #include <boost/thread.hpp>  // separate thread background merge processing
 #include <boost/bind/bind.hpp>
 #include <boost/asio.hpp>
+#include <boost/fusion/include/for_each.hpp>
 
 #include <TFTrading/InstrumentManager.h>
 #include <TFTrading/AccountManager.h>
@@ -29,6 +35,8 @@
 #include <TFTrading/PortfolioManager.h>
 
 #include <OUGP/Population.h>
+#include <OUGP/Program.h>
+#include <OUGP/Evaluator.h>
 #include <TFGP/NodeTimeSeries.h>
 
 #include "OptimizeStrategy.h"
@@ -71,6 +79,67 @@ bool AppOptimizeStrategy::OnInit( void ) {
 
 }
 
+namespace {
+
+// one run of the strategy, which does not trade, records the value of each time series terminal
+//   at each decision tick, ie each point at which the strategy evaluates its signals
+//   decision ticks depend upon the data and the session times only, not upon trading,
+//   so every individual's backtest sees the same sequence of them
+struct Recorder {
+  Recorder( void ): m_nTicks( 0 ) {}
+  void Init( ou::tf::Instrument::pInstrument_t pInstrument ) {  // run synchronously
+    StrategyEquity::registrations_t registrations; // static component, terminals are bound before it goes away
+    m_sw.Init(
+      registrations,
+      pInstrument, date( 2012, 7, 22 ), "/app/semiauto/2012-Jul-22 18:08:14.285807",
+      fastdelegate::MakeDelegate( this, &Recorder::Sample ),
+      fastdelegate::MakeDelegate( this, &Recorder::Neutral ) );
+    boost::fusion::for_each( m_nodes, Bind( *this ) );
+    m_vColumn.resize( m_vSample.size() );
+  }
+  void Run( void ) {
+    m_sw.Start();
+    std::cout << "Recorder: " << m_nTicks << " decision ticks, " << m_vColumn.size() << " columns" << std::endl;
+  }
+  size_t Ticks( void ) const { return m_nTicks; }
+  const double* Column( const std::string& sName ) const { // named as the terminal's ToString
+    mapColumn_t::const_iterator iter = m_mapColumn.find( sName );
+    return ( m_mapColumn.end() == iter ) ? 0 : m_vColumn[ iter->second ].data();
+  }
+private:
+  struct Bind {
+    Recorder& m_recorder;
+    Bind( Recorder& recorder ): m_recorder( recorder ) {}
+    template<typename N>
+    void operator()( N& node ) const {
+      node.PreProcess();
+      std::stringstream ss;
+      node.ToString( ss );
+      m_recorder.m_mapColumn[ ss.str() ] = m_recorder.m_vSample.size();
+      m_recorder.m_vSample.push_back( [&node]()->double{
+        return ( 0 == node.TimeSeries()->Size() ) ? std::numeric_limits<double>::quiet_NaN() : node.EvaluateDouble(); // no value yet
+      } );
+    }
+  };
+  bool Sample( void ) {
+    for ( size_t ix = 0; ix < m_vSample.size(); ix++ ) {
+      m_vColumn[ ix ].push_back( m_vSample[ ix ]() );
+    }
+    m_nTicks++;
+    return false;
+  }
+  bool Neutral( void ) { return false; }
+  StrategyEquity::NodeTypesTimeSeries_t m_nodes; // one of each terminal
+  std::vector<std::function<double()> > m_vSample;
+  typedef std::map<std::string,size_t> mapColumn_t;
+  mapColumn_t m_mapColumn;
+  std::vector<std::vector<double> > m_vColumn;
+  size_t m_nTicks;
+  StrategyWrapper m_sw;
+};  // struct Recorder
+
+} // namespace anon
+
 void AppOptimizeStrategy::Optimizer( void ) {
   //m_sim->SetGroupDirectory( "/semiauto/2011-Sep-23 19:17:48.252497" );
 // ->  m_pProvider->SetGroupDirectory( "/app/semiauto/2011-Nov-06 18:54:22.184889" );
@@ -130,10 +199,12 @@ void AppOptimizeStrategy::Optimizer( void ) {
 
   struct ProcessIndividual {
     ProcessIndividual( ou::gp::Individual& ind, pInstrument_t pInstrument )
-      : m_ind( ind ), m_pInstrument( pInstrument ), m_pswStrategy( new StrategyWrapper )
+      : m_ind( ind ), m_pInstrument( pInstrument ), m_pswStrategy( new StrategyWrapper ),
+        m_ixLong( 0 ), m_ixShort( 0 )
     {
     }
     ~ProcessIndividual( void ) {
+      delete m_pswStrategy;
     }
     void Init( void ) {  // run synchronously
       // /app/semiauto/2012-Jul-22 18:08:14.285807
@@ -145,11 +216,28 @@ void AppOptimizeStrategy::Optimizer( void ) {
       m_pswStrategy->Init( 
         m_registrations,
         m_pInstrument, date( 2012, 7, 22 ), "/app/semiauto/2012-Jul-22 18:08:14.285807",
-        fastdelegate::MakeDelegate( m_ind.m_Signals.rnLong, &ou::gp::RootNode::EvaluateBoolean ),
-        fastdelegate::MakeDelegate( m_ind.m_Signals.rnShort, &ou::gp::RootNode::EvaluateBoolean ) );
-      const_cast<ou::gp::Individual&>(m_ind).m_Signals.EachSignal( PreProcessNodes() );
+        fastdelegate::MakeDelegate( this, &ProcessIndividual::Long ),
+        fastdelegate::MakeDelegate( this, &ProcessIndividual::Short ) );
+      const_cast<ou::gp::Individual&>(m_ind).m_Signals.EachSignal( PreProcessNodes() ); // names the terminals
       m_ind.TreeToString( m_ind.m_ssFormula );
     }
+    const ou::gp::RootNode& TreeLong( void ) const { return *m_ind.m_Signals.rnLong; }
+    const ou::gp::RootNode& TreeShort( void ) const { return *m_ind.m_Signals.rnShort; }
+    void Append( const double* pLong, const double* pShort, size_t n ) { // signals, by decision tick, from the evaluator
+      for ( size_t ix = 0; ix < n; ix++ ) {
+        m_vLong.push_back( 0.0 != pLong[ ix ] );
+        m_vShort.push_back( 0.0 != pShort[ ix ] );
+      }
+    }
+    void Compile( size_t nTicks, const ou::gp::Program::fInput_t& fInput ) { // signals from the trees compiled on their own
+      ou::gp::Program programLong( TreeLong() );
+      ou::gp::Program programShort( TreeShort() );
+      std::vector<double> vLong( nTicks );
+      std::vector<double> vShort( nTicks );
+      programLong.Run( nTicks, fInput, vLong.data() );
+      programShort.Run( nTicks, fInput, vShort.data() );
+      Append( vLong.data(), vShort.data(), nTicks );
+    }
     void Run( void ) { // run asynchronously
       m_pswStrategy->Start(); 
       std::stringstream ss;
@@ -163,59 +251,114 @@ void AppOptimizeStrategy::Optimizer( void ) {
     ou::gp::Individual& m_ind;
     pInstrument_t m_pInstrument;
     StrategyWrapper* m_pswStrategy;
+    std::vector<bool> m_vLong;
+    std::vector<bool> m_vShort;
+    size_t m_ixLong;
+    size_t m_ixShort;
+    // replayed in the order the strategy asks for them, matching the recording
+    bool Long( void ) { return ( m_ixLong < m_vLong.size() ) ? m_vLong[ m_ixLong++ ] : false; }
+    bool Short( void ) { return ( m_ixShort < m_vShort.size() ) ? m_vShort[ m_ixShort++ ] : false; }
   };  // struct ProcessIndividual
 
   std::vector<ProcessIndividual*> vpi;
 
-  // http://boost.2283326.n4.nabble.com/Is-thread-pool-using-asio-and-thread-group-working-as-intended-td4552297.html
-  // set up some threads for running the strategy
+  Recorder recorder;
+  recorder.Init( m_pInstrument );
+  recorder.Run();
+
+  const size_t nTicks( recorder.Ticks() );
+  const size_t nChunk( 4096 ); // ticks per Evaluate, memory is unique subtrees * nChunk
+  const double dblShared( 0.75 ); // unique/added nodes at or below which the evaluator is used
+
+  // columns for a chunk of decision ticks
+  auto fInput = [&recorder]( size_t ixBegin ){
+    return [&recorder,ixBegin]( const std::string& sName )->const double* {
+      const double* pColumn( recorder.Column( sName ) );
+      return ( 0 == pColumn ) ? 0 : pColumn + ixBegin;
+    };
+  };
+
+  // persistent pool, one thread per hardware thread, shared by all generations
+  ou::gp::Evaluator evaluator;
+
     while ( pop.MakeNewGeneration() ) {
       std::cout << "==== N:" << pop.m_nNew << ",E:" << pop.m_nElites << ",R:" << pop.m_nReproductions << ",X:" << pop.m_nCrossOvers << " ====" << std::endl;
       const vGeneration_t& gen( pop.CurrentGeneration() );
 
-      boost::asio::io_service srvc;
-      boost::thread_group threads;
+      BOOST_FOREACH( const ou::gp::Individual& ind, gen ) {
+          
+        if ( ind.IsComputed() ) {
+          std::cout 
+            << "Computed: " 
+            << ind.m_dblRawFitness << std::endl
+            << ind.m_ssFormula.str() << std::endl;
+          std::cout << "---- " << ind.m_id << " ----------------------------" << std::endl;
+        }
+        else {
+          ou::gp::Individual& i( const_cast<ou::gp::Individual&>( ind ) );
+          i.SetComputed();
+          ProcessIndividual* ppi( new ProcessIndividual( i, m_pInstrument ) );
+          vpi.push_back( ppi );
+          ppi->Init();
+          //std::cout << ind.m_ssFormula.str() << std::endl;
+        }
+      }
+
+      bool bOk( true );
 
-      {
+      bool bShared( true );
 
-        boost::asio::io_service::work work( srvc );  // keep things running while real work arrives
-        for ( std::size_t ix = 0; ix < 12; ix++ ) {
-          threads.create_thread( boost::bind( &boost::asio::io_service::run, &srvc ) ); // add handlers
+      // signals of the new individuals, a subtree shared amongst them is computed once per chunk
+      try {
+        evaluator.Reset( std::min( nChunk, nTicks ), fInput( 0 ) );
+        std::vector<std::pair<ou::gp::Evaluator::id_t,ou::gp::Evaluator::id_t> > vId;
+        for ( ProcessIndividual* ppi: vpi ) {
+          vId.push_back( std::make_pair( evaluator.Add( ppi->TreeLong() ), evaluator.Add( ppi->TreeShort() ) ) );
         }
+        std::cout << "Evaluator: " << evaluator.NodesAdded() << " nodes, " << evaluator.NodesUnique() << " unique" << std::endl;
+        // with little sharing, each individual runs its own compiled programs with the backtest instead
+        bShared = ( 0 == evaluator.NodesAdded() ) || ( ( (double) evaluator.NodesUnique() / evaluator.NodesAdded() ) <= dblShared );
+        for ( size_t ixBegin = 0; bShared && ( ixBegin < nTicks ); ixBegin += nChunk ) {
+          const size_t n( std::min( nChunk, nTicks - ixBegin ) );
+          if ( 0 != ixBegin ) evaluator.Rebind( n, fInput( ixBegin ) );
+          evaluator.Evaluate();
+          for ( size_t ix = 0; ix < vpi.size(); ix++ ) {
+            vpi[ ix ]->Append( evaluator.Result( vId[ ix ].first ), evaluator.Result( vId[ ix ].second ), n );
+          }
+        }
+      }
+      catch ( const std::exception& e ) {
+        std::cout << "Optimizer signals: " << e.what() << std::endl;
+        bOk = false;
+      }
 
-        BOOST_FOREACH( const ou::gp::Individual& ind, gen ) {
-          
-          if ( ind.IsComputed() ) {
-            std::cout 
-              << "Computed: " 
-              << ind.m_dblRawFitness << std::endl
-              << ind.m_ssFormula.str() << std::endl;
-            std::cout << "---- " << ind.m_id << " ----------------------------" << std::endl;
+      // backtests, with the signals replayed
+      if ( bOk ) {
+        const ou::gp::Program::fInput_t fColumn( fInput( 0 ) );
+        for ( ProcessIndividual* ppi: vpi ) {
+          if ( bShared ) {
+            evaluator.Post( [ppi](){ ppi->Run(); } );
           }
           else {
-            ou::gp::Individual& i( const_cast<ou::gp::Individual&>( ind ) );
-            i.SetComputed();
-            //ProcessIndividual pi( i, m_pInstrument );
-            ProcessIndividual* ppi( new ProcessIndividual( i, m_pInstrument ) );
-            vpi.push_back( ppi );
-            ppi->Init();
-            //std::cout << ind.m_ssFormula.str() << std::endl;
-  //          pi.Run();  // can't run asynchronously due to singleton managers and singleton hdf5 manager
-            srvc.post( boost::bind( &ProcessIndividual::Run, ppi ) );  
+            evaluator.Post( [ppi,nTicks,&fColumn](){ ppi->Compile( nTicks, fColumn ); ppi->Run(); } );
           }
         }
-
+        try {
+          evaluator.Wait();  // wait for all work to complete
+        }
+        catch ( const std::exception& e ) {
+          std::cout << "Optimizer backtest: " << e.what() << std::endl;
+          bOk = false;
+        }
       }
 
-      // at some point, add the above Formula strings to master table, so random calcs which match prior randoms aren't computed
-
-      threads.join_all();  // wait for all work to complete
-
       for ( std::vector<ProcessIndividual*>::iterator iter = vpi.begin(); vpi.end() != iter; iter++ ) {
         delete *iter;
       }
       vpi.clear();
 
+      if ( !bOk ) break;
+
       pop.CalcFitness();
 
       // optimization:
@@ -0,0 +1,192 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    main.cpp
+ * Author:  raymond@burkholder.net
+ * Project: PhemexTradesBench
+ * Created: October 19, 2026 23:10 PM
+ */
+
+
+/*
+  * replays a capture of phemex websocket messages through gateway::trades::decode
+  *   the lines are read into memory first, so only the decode is timed
+  *   reports messages/s and trades/s, and the count of declined messages (heartbeat and watch responses, ...)
+  * with no capture file, a synthetic capture is written, replayed, and removed:
+  *   trades messages of 1 to 20 trades with heartbeat responses interleaved,
+  *   the decoded trades and declined messages are checked against what was written
+  * usage: PhemexTradesBench [capture file] [passes=5]
+  *        PhemexTradesBench - [messages=200000]
+*/
+
+#include <string>
+#include <random>
+#include <vector>
+#include <cstdio>
+#include <iostream>
+#include <stdexcept>
+
+#include <OUCommon/Bench.h>
+#include <OUCommon/Capture.h>
+
+#include <TFPhemex/GatewayTrades.hpp>
+
+namespace {
+
+  namespace trades = ou::tf::phemex::gateway::trades;
+
+  using vLine_t = std::vector<std::string>;
+
+  struct Synthetic {
+    size_t nMessages;
+    size_t nTrades;
+    size_t nOther;
+  };
+
+  Synthetic Synthesize( const std::string& sFileName, size_t nMessages ) {
+
+    Synthetic synthetic {};
+
+    std::mt19937_64 rng( 11 );
+    std::uniform_int_distribution<int> trades( 1, 20 );
+    std::uniform_int_distribution<int> heartbeat( 0, 49 );
+    std::uniform_int_distribution<uint64_t> price( 190000000, 210000000 ); // scaled, priceEp
+    std::uniform_int_distribution<uint64_t> quantity( 1, 5000 );
+
+    ou::capture::Writer writer( sFileName, "PhemexTradesBench synthetic" );
+
+    std::string sLine;
+    uint64_t sequence( 1000000 );
+    uint64_t time_stamp( 1666000000000000000 );
+    int64_t usTime( ou::capture::Now() );
+
+    for ( size_t ix = 0; ix < nMessages; ix++ ) {
+      if ( 0 == heartbeat( rng ) ) {
+        sLine = "{\"error\":null,\"id\":" + std::to_string( ix ) + ",\"result\":\"pong\"}";
+        synthetic.nOther++;
+      }
+      else {
+        sLine = "{\"sequence\":" + std::to_string( ++sequence ) + ",\"symbol\":\"BTCUSD\",\"trades\":[";
+        const int n( trades( rng ) );
+        for ( int ixTrade = 0; ixTrade < n; ixTrade++ ) {
+          if ( 0 != ixTrade ) sLine += ',';
+          time_stamp += 1000000;
+          sLine += "[" + std::to_string( time_stamp )
+                + ( ( 0 == ( ixTrade & 1 ) ) ? ",\"Buy\"," : ",\"Sell\"," )
+                + std::to_string( price( rng ) ) + "," + std::to_string( quantity( rng ) ) + "]";
+        }
+        sLine += "],\"type\":\"incremental\"}";
+        synthetic.nTrades += n;
+      }
+      usTime += 50;
+      writer.Append( usTime, sLine.data(), sLine.size() );
+      synthetic.nMessages++;
+    }
+
+    return synthetic;
+  }
+
+  vLine_t Load( const std::string& sFileName ) {
+    ou::capture::Reader reader( sFileName );
+    std::cout << "capture: " << sFileName << " '" << reader.Label() << "', " << reader.Blocks() << " blocks" << std::endl;
+    vLine_t vLine;
+    int64_t usTime;
+    const unsigned char* pLine;
+    size_t nSize;
+    while ( reader.Next( usTime, pLine, nSize ) ) {
+      vLine.emplace_back( reinterpret_cast<const char*>( pLine ), nSize );
+    }
+    return vLine;
+  }
+
+  struct Result {
+    size_t nTrades;
+    size_t nDeclined;
+  };
+
+  Result Replay( const vLine_t& vLine, size_t nPasses ) {
+
+    Result result {};
+    trades::message message; // re-used, as the Provider does
+
+    for ( size_t ixPass = 0; ixPass < nPasses; ixPass++ ) {
+      size_t nTrades {};
+      size_t nDeclined {};
+      ou::bench::steady_t::time_point start = ou::bench::steady_t::now();
+      for ( const std::string& sLine: vLine ) {
+        if ( trades::decode( sLine, message ) ) nTrades += message.trades.size();
+        else nDeclined++;
+      }
+      const double dblSeconds( ou::bench::Elapsed( start ) );
+      ou::bench::Report( "trades::decode, pass " + std::to_string( ixPass + 1 ), dblSeconds, vLine.size(), nTrades );
+      std::cout
+        << "  " << (size_t)( vLine.size() / dblSeconds ) << " messages/s, "
+        << (size_t)( nTrades / dblSeconds ) << " trades/s, "
+        << nDeclined << " declined"
+        << std::endl;
+      result.nTrades = nTrades;
+      result.nDeclined = nDeclined;
+    }
+
+    return result;
+  }
+
+} // namespace anon
+
+int main( int argc, char* argv[] ) {
+
+  const bool bSynthetic = ( 1 == argc ) || ( std::string( "-" ) == argv[ 1 ] );
+  const size_t nArg = ( 2 < argc ) ? std::stoul( argv[ 2 ] ) : 0;
+
+  try {
+    if ( bSynthetic ) {
+      const std::string sFileName( "PhemexTradesBench.cap" );
+      const Synthetic synthetic = Synthesize( sFileName, ( 0 == nArg ) ? 200000 : nArg );
+      const vLine_t vLine = Load( sFileName );
+      std::remove( sFileName.c_str() );
+
+      const Result result = Replay( vLine, 5 );
+
+      size_t cntFailed {};
+      if ( synthetic.nMessages != vLine.size() ) {
+        std::cout << "failed: replayed " << vLine.size() << " of " << synthetic.nMessages << " messages" << std::endl;
+        cntFailed++;
+      }
+      if ( synthetic.nTrades != result.nTrades ) {
+        std::cout << "failed: decoded " << result.nTrades << " of " << synthetic.nTrades << " trades" << std::endl;
+        cntFailed++;
+      }
+      if ( synthetic.nOther != result.nDeclined ) {
+        std::cout << "failed: declined " << result.nDeclined << " of " << synthetic.nOther << " other messages" << std::endl;
+        cntFailed++;
+      }
+      if ( 0 != cntFailed ) {
+        std::cout << "PhemexTradesBench: " << cntFailed << " failed" << std::endl;
+        return 1;
+      }
+      std::cout << "PhemexTradesBench: ok" << std::endl;
+    }
+    else {
+      const vLine_t vLine = Load( argv[ 1 ] );
+      Replay( vLine, ( 0 == nArg ) ? 5 : nArg );
+    }
+  }
+  catch ( const std::runtime_error& e ) {
+    std::cout << "PhemexTradesBench: " << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
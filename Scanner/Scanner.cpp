@@ -20,8 +20,6 @@
 
 #include <TFStatistics/Pivot.h>
 
-#include <TFBitsNPieces/InstrumentFilter.h>
-
 #include "Scanner.h"
 
 IMPLEMENT_APP(AppScanner)
@@ -100,7 +98,6 @@ bool AppScanner::HandleCallBackUseGroup( s_t&, const std::string& sPath, const s
 bool AppScanner::HandleCallBackFilter( s_t& data, const std::string& sObject, const ou::tf::Bars& bars ) {
 
   bool b( false );
-  data.nEnteredFilter++;
   data.nAverageVolume = std::for_each( bars.begin(), bars.end(), AverageVolume() );
 //  std::cout << sObject << ": " << bars.Last()->DateTime() << " - " << m_dtEnd << std::endl;
   if ( ( 1000000 < data.nAverageVolume )
@@ -109,7 +106,6 @@ bool AppScanner::HandleCallBackFilter( s_t& data, const std::string& sObject, co
     && ( m_nMinBarCount <= bars.Size() )
     && ( m_dtEnd.date() == bars.last().DateTime().date() )
     ) {
-      data.nPassedFilter++;
       b = true;
   }
   return b;
@@ -124,6 +120,9 @@ void AppScanner::HandleCallBackResults( s_t& data, const std::string& sPath, con
 
   ou::tf::statistics::Pivot pivot( bars );
 
+  data.nEnteredFilter = m_pScanStats->nEnteredFilter; // running counts, results arrive in symbol order
+  data.nPassedFilter  = m_pScanStats->nPassedFilter;
+
   data.nPVCrossings      = pivot.ItemOfInterest( ou::tf::statistics::Pivot::EItemsOfInterest::CrossPV );
   data.nUpAndR1Crossings = pivot.ItemOfInterest( ou::tf::statistics::Pivot::EItemsOfInterest::BtwnPVR1_X_Up );
   data.nDnAndS1Crossings = pivot.ItemOfInterest( ou::tf::statistics::Pivot::EItemsOfInterest::BtwnPVS1_X_Down );
@@ -148,17 +147,20 @@ void AppScanner::ScanBars() {
   m_nMinBarCount = 20;  // tie this approx to the date range below
   s_t s;
   try {
-    ou::tf::InstrumentFilter<s_t,ou::tf::Bars> filter(
+    scanner_t scanner(
       "/bar/86400",
       m_dtBegin, m_dtEnd, 20, s,
       std::bind( &AppScanner::HandleCallBackUseGroup, this, ph::_1, ph::_2, ph::_3 ),
       std::bind( &AppScanner::HandleCallBackFilter,   this, ph::_1, ph::_2, ph::_3 ),
       std::bind( &AppScanner::HandleCallBackResults,  this, ph::_1, ph::_2, ph::_3, ph::_4 )
       );
+    m_pScanStats = &scanner.GetStats();
+    scanner.Run();
   }
   catch( ... ) {
     std::cout << "Scan Problems" << std::endl;
   }
+  m_pScanStats = nullptr; // the scanner is gone, on either path
   std::cout << "Scan Complete" << std::endl;
 }
 
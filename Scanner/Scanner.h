@@ -24,6 +24,7 @@
 #include <TFVuTrading/PanelLogging.h>
 
 #include <TFBitsNPieces/FrameWork01.h>
+#include <TFBitsNPieces/InstrumentScanner.h>
 
 class AppScanner:
   public wxApp, public ou::tf::FrameWork01<AppScanner> {
@@ -62,6 +63,9 @@ private:
     {};
   };
 
+  using scanner_t = ou::tf::InstrumentScanner<s_t,ou::tf::Bars>;
+  const scanner_t::Stats* m_pScanStats; // valid during ScanBars
+
   void HandleMenuActionScan();
   void ScanBars();
   bool HandleCallBackUseGroup( s_t&, const std::string& sPath, const std::string& sGroup );
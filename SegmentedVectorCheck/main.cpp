@@ -0,0 +1,113 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    main.cpp
+ * Author:  raymond@burkholder.net
+ * Project: SegmentedVectorCheck
+ * Created: October 19, 2026 22:40 PM
+ */
+
+/*
+  * iterators of SegmentedVector, and the TimeSeries cursor built on them, as the series grows
+  *   segments hold 64, 128, 256, ... elements, each check crosses at least one boundary
+  *   an iterator made while the storage ends on a boundary has no segment under it yet
+  *     it must pick up the segment allocated by a later push_back
+  * prints each failure, exits non zero on any
+  * usage: SegmentedVectorCheck
+*/
+
+#include <string>
+#include <iostream>
+
+#include <TFTimeSeries/TimeSeries.h>
+
+namespace {
+
+  size_t cntFailed {};
+
+  void Check( bool bOk, const std::string& sWhat ) {
+    if ( !bOk ) {
+      std::cout << "failed: " << sWhat << std::endl;
+      cntFailed++;
+    }
+  }
+
+  // end() taken on each boundary, appended to, then dereferenced and walked
+  void CheckEndOnBoundary() {
+    ou::tf::SegmentedVector<int> v;
+    for ( int boundary: { 0, 64, 192, 448 } ) {
+      while ( (int) v.size() < boundary ) v.push_back( (int) v.size() );
+      ou::tf::SegmentedVector<int>::iterator iter( v.end() );
+      v.push_back( boundary );
+      v.push_back( boundary + 1 );
+      Check( boundary == *iter, "end() on boundary " + std::to_string( boundary ) + " sees next push_back" );
+      ++iter;
+      Check( boundary + 1 == *iter, "increment from end() on boundary " + std::to_string( boundary ) );
+      ++iter;
+      Check( v.end() == iter, "reaches end() after boundary " + std::to_string( boundary ) );
+    }
+  }
+
+  // one iterator follows the appends, one element behind, across several segments
+  void CheckFollowWhileAppending() {
+    ou::tf::SegmentedVector<int> v;
+    v.push_back( 0 );
+    ou::tf::SegmentedVector<int>::const_iterator iter( v.cbegin() );
+    for ( int ix = 1; ix < 1000; ix++ ) {
+      v.push_back( ix );
+      ++iter;
+      if ( ix != *iter ) {
+        Check( false, "follow at " + std::to_string( ix ) );
+        break;
+      }
+    }
+  }
+
+  // TimeSeries::Next runs off the end on a boundary, the series grows, Next continues
+  void CheckTimeSeriesNext() {
+    ou::tf::Trades trades;
+    const ou::tf::Trade::dt_t dt( boost::posix_time::microsec_clock::universal_time() );
+    auto append = [&trades,&dt](){
+      const size_t ix( trades.Size() );
+      trades.Append( ou::tf::Trade( dt + boost::posix_time::microseconds( ix ), 100.0 + ix, ix ) );
+    };
+    while ( trades.Size() < 64 ) append();
+    size_t n {};
+    for ( const ou::tf::Trade* p = trades.First(); nullptr != p; p = trades.Next() ) n++;
+    Check( 64 == n, "Next visits the first segment" );
+    append(); // 64, passed over by the cursor sitting at end(), as with std::vector
+    append(); // 65
+    const ou::tf::Trade* p( trades.Next() );
+    Check( ( nullptr != p ) && ( 65 == p->Volume() ), "Next after growth past the boundary" );
+    Check( nullptr == trades.Next(), "Next at end after growth" );
+  }
+
+} // namespace anon
+
+int main() {
+
+  CheckEndOnBoundary();
+  CheckFollowWhileAppending();
+  CheckTimeSeriesNext();
+
+  if ( 0 == cntFailed ) {
+    std::cout << "SegmentedVectorCheck: ok" << std::endl;
+    return 0;
+  }
+  else {
+    std::cout << "SegmentedVectorCheck: " << cntFailed << " failed" << std::endl;
+    return 1;
+  }
+}
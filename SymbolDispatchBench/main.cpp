@@ -0,0 +1,171 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    main.cpp
+ * Author:  raymond@burkholder.net
+ * Project: SymbolDispatchBench
+ * Created: October 19, 2026 23:55 PM
+ */
+
+/*
+  * cost of resolving an instrument to its per instrument state, across a universe of symbols
+  * instruments are constructed up front, each is interned on construction
+  * a random stream of instrument references is then resolved through
+  *   std::map by name, as ProviderInterface did
+  *   std::unordered_map by name, as option::Engine did
+  *   InternVector by Instrument::GetInternId, as both now do
+  * and the handler add/remove round trip through a ProviderInterface, which is now id indexed,
+  *   against the by name GetSymbol which remains for the feed side
+  * usage: SymbolDispatchBench [symbols=5000] [lookups=20000000]
+*/
+
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+#include <iostream>
+#include <unordered_map>
+
+#include <OUCommon/Bench.h>
+
+#include <TFTrading/Instrument.h>
+#include <TFTrading/InstrumentIntern.h>
+#include <TFTrading/ProviderInterface.h>
+
+namespace {
+
+  using pInstrument_t = ou::tf::Instrument::pInstrument_t;
+  using vInstrument_t = std::vector<pInstrument_t>;
+
+  class BenchSymbol: public ou::tf::Symbol<BenchSymbol> {
+  public:
+    BenchSymbol( pInstrument_t pInstrument ): ou::tf::Symbol<BenchSymbol>( pInstrument ) {}
+  };
+
+  class BenchProvider: public ou::tf::ProviderInterface<BenchProvider,BenchSymbol> {
+  public:
+    BenchProvider() {
+      m_sName = "bench";
+      m_nID = ou::tf::keytypes::EProviderSimulator;
+    }
+  protected:
+    virtual pSymbol_t NewCSymbol( pInstrument_t pInstrument ) {
+      pSymbol_t pSymbol( new BenchSymbol( pInstrument ) );
+      AddCSymbol( pSymbol );
+      return pSymbol;
+    }
+  };
+
+  struct Handler {
+    size_t nQuotes {};
+    void HandleQuote( const ou::tf::Quote& ) { nQuotes++; }
+  };
+
+  // option like names, so they share long prefixes, as an option chain does
+  std::string Name( size_t ix ) {
+    static const char* rUnderlying[] = { "SPY", "QQQ", "IWM", "GLD", "TLT", "AAPL", "MSFT", "NVDA" };
+    const size_t nUnderlying = sizeof( rUnderlying ) / sizeof( rUnderlying[ 0 ] );
+    return std::string( rUnderlying[ ix % nUnderlying ] ) + "-20261120-" + ( ( 0 == ( ix & 1 ) ) ? "C-" : "P-" ) + std::to_string( 100000 + ix );
+  }
+
+  using ou::bench::steady_t;
+  using ou::bench::Elapsed;
+  using ou::bench::Report;
+  using ou::bench::Run;
+
+} // namespace anonymous
+
+int main( int argc, char* argv[] ) {
+
+  const size_t nSymbols = ( 1 < argc ) ? std::stoul( argv[ 1 ] ) : 5000;
+  const size_t nLookups = ( 2 < argc ) ? std::stoul( argv[ 2 ] ) : 20000000;
+
+  std::cout << "SymbolDispatchBench: " << nSymbols << " symbols, " << nLookups << " lookups" << std::endl;
+
+  vInstrument_t vInstrument;
+  vInstrument.reserve( nSymbols );
+  {
+    steady_t::time_point start = steady_t::now();
+    for ( size_t ix = 0; ix < nSymbols; ix++ ) {
+      vInstrument.emplace_back(
+        std::make_shared<ou::tf::Instrument>( Name( ix ), ou::tf::InstrumentType::Option, "SMART" ) );
+    }
+    Report( "construct + intern", Elapsed( start ), nSymbols, ou::tf::InstrumentIntern::Instance().Size() );
+  }
+
+  // per instrument state, the address stands in for a symbol or watch
+  std::vector<size_t> vState( nSymbols );
+
+  std::map<std::string, size_t*> mapByName;
+  std::unordered_map<std::string, size_t*> umapByName;
+  ou::tf::InternVector<size_t*> vById;
+  for ( size_t ix = 0; ix < nSymbols; ix++ ) {
+    const pInstrument_t& pInstrument( vInstrument[ ix ] );
+    mapByName.emplace( pInstrument->GetInstrumentName(), &vState[ ix ] );
+    umapByName.emplace( pInstrument->GetInstrumentName(), &vState[ ix ] );
+    vById.Slot( pInstrument->GetInternId() ) = &vState[ ix ];
+  }
+
+  // skewed, as a feed is: a few symbols carry most of the traffic
+  std::vector<uint32_t> vStream( nLookups );
+  {
+    std::mt19937_64 rng( 42 );
+    std::geometric_distribution<uint32_t> hot( 0.01 );
+    std::uniform_int_distribution<uint32_t> any( 0, nSymbols - 1 );
+    for ( uint32_t& ix: vStream ) {
+      ix = ( 0 == ( rng() & 1 ) ) ? ( hot( rng ) % nSymbols ) : any( rng );
+    }
+  }
+
+  Run( "std::map by name", vStream,
+    [&]( uint32_t ix )->size_t{ return ++( *mapByName.find( vInstrument[ ix ]->GetInstrumentName() )->second ); } );
+
+  Run( "std::unordered_map by name", vStream,
+    [&]( uint32_t ix )->size_t{ return ++( *umapByName.find( vInstrument[ ix ]->GetInstrumentName() )->second ); } );
+
+  Run( "InternVector by id", vStream,
+    [&]( uint32_t ix )->size_t{ return ++( *vById.Get( vInstrument[ ix ]->GetInternId() ) ); } );
+
+  Run( "InstrumentIntern::Find", vStream, // a name from the wire, at the api boundary
+    [&]( uint32_t ix )->size_t{
+      ou::tf::InstrumentIntern::id_t id {};
+      ou::tf::InstrumentIntern::Instance().Find( vInstrument[ ix ]->GetInstrumentName(), id );
+      return id;
+    } );
+
+  // through the provider
+  BenchProvider provider;
+  Handler handler;
+  for ( const pInstrument_t& pInstrument: vInstrument ) {
+    provider.AddQuoteHandler( pInstrument, MakeDelegate( &handler, &Handler::HandleQuote ) );
+  }
+
+  const std::vector<uint32_t> vStreamShort( vStream.begin(), vStream.begin() + std::min<size_t>( nLookups, 2000000 ) );
+
+  Run( "provider GetSymbol by name", vStreamShort,
+    [&]( uint32_t ix )->size_t{ return provider.GetSymbol( vInstrument[ ix ]->GetInstrumentName() )->GetQuoteHandlerCount(); } );
+
+  Run( "provider GetSymbol by inst", vStreamShort,
+    [&]( uint32_t ix )->size_t{ return provider.GetSymbol( vInstrument[ ix ] )->GetQuoteHandlerCount(); } );
+
+  Run( "provider add/remove handler", vStreamShort,
+    [&]( uint32_t ix )->size_t{
+      provider.AddQuoteHandler( vInstrument[ ix ], MakeDelegate( &handler, &Handler::HandleQuote ) );
+      provider.RemoveQuoteHandler( vInstrument[ ix ], MakeDelegate( &handler, &Handler::HandleQuote ) );
+      return 1;
+    } );
+
+  return 0;
+}
@@ -332,17 +332,15 @@ void Server_impl::InstrumentToOption( pInstrument_t pInstrument ) {
 
   pOption_t pOption = std::make_shared<ou::tf::option::Option>( pInstrument, m_pProviderIQFeed );
 
-  BuiltOption* pBuiltOption( nullptr );
   {
     std::scoped_lock<std::mutex> lock( m_mutexChainPopulate );
     m_nOptionsLoaded++;
     mapChains_t::iterator iterChain = ou::tf::option::GetChain( m_mapChains, pOption );
-    pBuiltOption = ou::tf::option::UpdateOption<chain_t,BuiltOption>( iterChain->second, pOption );
+    BuiltOption* pBuiltOption = ou::tf::option::UpdateOption<chain_t,BuiltOption>( iterChain->second, pOption );
+    assert( pBuiltOption );
+    pBuiltOption->pOption = pOption; // strikes are contiguous, the other thread's insert may move this one
   }
 
-  assert( pBuiltOption );
-  pBuiltOption->pOption = pOption;
-
   if ( m_fOptionLoadingState ) {
     m_nOptionsLoadedReportingInterval--;
     if ( 0 == m_nOptionsLoadedReportingInterval ) {
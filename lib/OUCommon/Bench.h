@@ -0,0 +1,64 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Bench.h
+ * Author:  raymond@burkholder.net
+ * Project: OUCommon
+ * Created: October 19, 2026 22:15 PM
+ */
+
+
+#pragma once
+
+// timing for the console bench apps, each stage is a named line:
+//   name, seconds, ns per operation, and a check value which keeps the work from being optimized away
+
+#include <chrono>
+#include <string>
+#include <iomanip>
+#include <iostream>
+
+namespace ou { // One Unified
+namespace bench {
+
+using steady_t = std::chrono::steady_clock;
+
+inline double Elapsed( steady_t::time_point start ) { // seconds
+  return std::chrono::duration<double>( steady_t::now() - start ).count();
+}
+
+template<typename Check>
+void Report( const std::string& sName, double dblSeconds, size_t n, Check check ) {
+  std::cout
+    << std::left << std::setw( 30 ) << sName << std::right
+    << std::fixed << std::setprecision( 3 ) << std::setw( 8 ) << dblSeconds << "s "
+    << std::setprecision( 1 ) << std::setw( 8 ) << ( 1e9 * dblSeconds / n ) << " ns/op "
+    << "(" << check << ")"
+    << std::endl;
+}
+
+// f( const element& ) returns a value, summed into the check
+template<typename Stream, typename F>
+void Run( const std::string& sName, const Stream& stream, F&& f ) {
+  decltype( f( *stream.begin() ) ) check {};
+  steady_t::time_point start = steady_t::now();
+  for ( const auto& element: stream ) {
+    check += f( element );
+  }
+  Report( sName, Elapsed( start ), stream.size(), check );
+}
+
+} // namespace bench
+} // namespace ou
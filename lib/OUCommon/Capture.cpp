@@ -0,0 +1,444 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Capture.cpp
+ * Author:  raymond@burkholder.net
+ * Project: OUCommon
+ * Created: October 19, 2026 23:00 PM
+ */
+
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <algorithm>
+
+#include <zlib.h>
+
+#include "Capture.h"
+
+namespace {
+
+  const char c_rchMagicFile[ 8 ] = { 'O', 'U', 'C', 'A', 'P', '0', '0', '1' };
+  const uint32_t c_nMagicBlock = 0x42435551; // "OUCB"
+  const uint32_t c_nMagicIndex = 0x58435551; // "OUCX"
+
+  const size_t c_nBlockHeader = 4 + 4 + 4 + 4 + 8 + 8;
+  const size_t c_nIndexEntry = 8 + 8 + 8;
+  const size_t c_nTrailer = 4 + 4 + 8;
+
+  const size_t c_nSpare = 4; // recycled block buffers
+
+  // integers are written in host order, which is little endian on the supported platforms
+  template<typename T>
+  void Store( unsigned char*& p, T value ) {
+    std::memcpy( p, &value, sizeof( T ) );
+    p += sizeof( T );
+  }
+
+  template<typename T>
+  T Fetch( const unsigned char*& p ) {
+    T value;
+    std::memcpy( &value, p, sizeof( T ) );
+    p += sizeof( T );
+    return value;
+  }
+
+  inline void PutVarint( std::vector<unsigned char>& v, uint64_t n ) {
+    while ( 0x80 <= n ) {
+      v.push_back( (unsigned char)( n | 0x80 ) );
+      n >>= 7;
+    }
+    v.push_back( (unsigned char)n );
+  }
+
+  inline bool GetVarint( const unsigned char*& p, const unsigned char* pEnd, uint64_t& n ) {
+    n = 0;
+    for ( unsigned int shift = 0; shift < 64; shift += 7 ) {
+      if ( p == pEnd ) return false;
+      const unsigned char ch( *p++ );
+      n |= (uint64_t)( ch & 0x7f ) << shift;
+      if ( 0 == ( ch & 0x80 ) ) return true;
+    }
+    return false;
+  }
+
+}
+
+namespace ou { // One Unified
+namespace capture {
+
+// ==== Writer
+
+Writer::Writer( const std::string& sFileName, const std::string& sLabel )
+: m_pFile( std::fopen( sFileName.c_str(), "wb" ) )
+, m_sFileName( sFileName )
+, m_nLines {}, m_nBytesRaw {}
+, m_bStop( false )
+, m_nOffset {}, m_nBlocks {}
+{
+  if ( nullptr == m_pFile ) {
+    throw std::runtime_error( "capture::Writer can not create " + sFileName );
+  }
+
+  std::vector<unsigned char> v( sizeof( c_rchMagicFile ) + 8 + 4 );
+  unsigned char* p( v.data() );
+  std::memcpy( p, c_rchMagicFile, sizeof( c_rchMagicFile ) );
+  p += sizeof( c_rchMagicFile );
+  Store<int64_t>( p, Now() );
+  Store<uint32_t>( p, sLabel.size() );
+  Put( v.data(), v.size() );
+  Put( sLabel.data(), sLabel.size() );
+
+  m_block.vRaw.reserve( c_nBlockSize + 4096 );
+
+  m_thread = std::thread( [this](){ Worker(); } );
+}
+
+Writer::~Writer() {
+
+  Flush();
+  {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    m_bStop = true;
+  }
+  m_cv.notify_one();
+  m_thread.join();
+
+  const uint64_t nIndex( m_nOffset );
+  std::vector<unsigned char> v( m_vIndex.size() * c_nIndexEntry + c_nTrailer );
+  unsigned char* p( v.data() );
+  for ( const Index& index: m_vIndex ) {
+    Store<uint64_t>( p, index.nOffset );
+    Store<int64_t>( p, index.usFirst );
+    Store<uint64_t>( p, index.nFirstLine );
+  }
+  Store<uint32_t>( p, c_nMagicIndex );
+  Store<uint32_t>( p, m_vIndex.size() );
+  Store<uint64_t>( p, nIndex );
+  Put( v.data(), v.size() );
+
+  std::fclose( m_pFile );
+  m_pFile = nullptr;
+}
+
+void Writer::Append( int64_t usTime, const void* pLine, size_t nSize ) {
+
+  if ( 0 != m_block.nLines ) {
+    if ( ( c_nBlockSize <= m_block.vRaw.size() ) || ( c_usBlockAge <= ( usTime - m_block.usFirst ) ) ) {
+      Flush();
+    }
+  }
+
+  if ( 0 == m_block.nLines ) {
+    m_block.usFirst = m_block.usLast = usTime;
+    m_block.nFirstLine = m_nLines;
+  }
+
+  // the system clock may step back, times in the file do not
+  const int64_t usDelta( std::max<int64_t>( 0, usTime - m_block.usLast ) );
+  m_block.usLast += usDelta;
+
+  PutVarint( m_block.vRaw, usDelta );
+  PutVarint( m_block.vRaw, nSize );
+  const unsigned char* p( reinterpret_cast<const unsigned char*>( pLine ) );
+  m_block.vRaw.insert( m_block.vRaw.end(), p, p + nSize );
+
+  m_block.nLines++;
+  m_nLines++;
+  m_nBytesRaw += nSize;
+}
+
+void Writer::Flush() {
+
+  if ( 0 == m_block.nLines ) return;
+
+  std::vector<unsigned char> vRaw;
+  {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    if ( !m_vSpare.empty() ) {
+      vRaw.swap( m_vSpare.back() );
+      m_vSpare.pop_back();
+    }
+    m_dequeFull.emplace_back( std::move( m_block ) );
+  }
+  m_cv.notify_one();
+
+  m_block = Block();
+  m_block.vRaw.swap( vRaw );
+  if ( m_block.vRaw.capacity() < c_nBlockSize ) { // until the spares are circulating
+    m_block.vRaw.reserve( c_nBlockSize + 4096 );
+  }
+}
+
+Writer::Stats Writer::GetStats() const {
+  Stats stats;
+  stats.nLines = m_nLines;
+  stats.nBytesRaw = m_nBytesRaw;
+  std::lock_guard<std::mutex> lock( m_mutex );
+  stats.nBytesFile = m_nOffset;
+  stats.nBlocks = m_nBlocks;
+  return stats;
+}
+
+void Writer::Worker() {
+  for ( ;; ) {
+    Block block;
+    {
+      std::unique_lock<std::mutex> lock( m_mutex );
+      m_cv.wait( lock, [this]{ return m_bStop || !m_dequeFull.empty(); } );
+      if ( m_dequeFull.empty() ) break; // stopped, and drained
+      block = std::move( m_dequeFull.front() );
+      m_dequeFull.pop_front();
+    }
+    Write( block );
+    block.vRaw.clear();
+    {
+      std::lock_guard<std::mutex> lock( m_mutex );
+      if ( c_nSpare > m_vSpare.size() ) {
+        m_vSpare.emplace_back( std::move( block.vRaw ) );
+      }
+    }
+  }
+}
+
+void Writer::Write( const Block& block ) {
+
+  uLongf nCompressed( compressBound( block.vRaw.size() ) );
+  m_vCompressed.resize( c_nBlockHeader + nCompressed );
+
+  const bool bCompressed(
+    ( Z_OK == compress2( m_vCompressed.data() + c_nBlockHeader, &nCompressed, block.vRaw.data(), block.vRaw.size(), Z_BEST_SPEED ) )
+    && ( nCompressed < block.vRaw.size() ) );
+  const size_t nStored( bCompressed ? nCompressed : block.vRaw.size() );
+
+  unsigned char* p( m_vCompressed.data() );
+  Store<uint32_t>( p, c_nMagicBlock );
+  Store<uint32_t>( p, block.vRaw.size() );
+  Store<uint32_t>( p, nStored );
+  Store<uint32_t>( p, block.nLines );
+  Store<int64_t>( p, block.usFirst );
+  Store<uint64_t>( p, block.nFirstLine );
+
+  const uint64_t nOffset( m_nOffset );
+  if ( bCompressed ) {
+    Put( m_vCompressed.data(), c_nBlockHeader + nStored );
+  }
+  else {
+    Put( m_vCompressed.data(), c_nBlockHeader );
+    Put( block.vRaw.data(), nStored );
+  }
+
+  m_vIndex.emplace_back( Index{ nOffset, block.usFirst, block.nFirstLine } );
+
+  std::lock_guard<std::mutex> lock( m_mutex );
+  m_nBlocks++;
+}
+
+void Writer::Put( const void* p, size_t n ) { // constructor, worker thread, destructor
+  if ( n != std::fwrite( p, 1, n, m_pFile ) ) {
+    std::cerr << "capture::Writer " << m_sFileName << " write failed" << std::endl;
+  }
+  m_nOffset += n; // offsets stay consistent with what was intended
+}
+
+// ==== Reader
+
+Reader::Reader( const std::string& sFileName )
+: m_pFile( std::fopen( sFileName.c_str(), "rb" ) )
+, m_usCreated {}
+, m_nFirstBlock {}
+, m_bIndexed( false )
+, m_ixBlock {}
+, m_pCursor( nullptr ), m_pEnd( nullptr )
+, m_usTime {}
+{
+  if ( nullptr == m_pFile ) {
+    throw std::runtime_error( "capture::Reader can not open " + sFileName );
+  }
+
+  unsigned char rch[ sizeof( c_rchMagicFile ) + 8 + 4 ];
+  if ( ( sizeof( rch ) != std::fread( rch, 1, sizeof( rch ), m_pFile ) )
+    || ( 0 != std::memcmp( rch, c_rchMagicFile, sizeof( c_rchMagicFile ) ) )
+  ) {
+    std::fclose( m_pFile );
+    throw std::runtime_error( "capture::Reader " + sFileName + " is not a capture file" );
+  }
+  const unsigned char* p( rch + sizeof( c_rchMagicFile ) );
+  m_usCreated = Fetch<int64_t>( p );
+  m_sLabel.resize( Fetch<uint32_t>( p ) );
+  if ( m_sLabel.size() != std::fread( &m_sLabel[ 0 ], 1, m_sLabel.size(), m_pFile ) ) {
+    std::fclose( m_pFile );
+    throw std::runtime_error( "capture::Reader " + sFileName + " is truncated" );
+  }
+  m_nFirstBlock = sizeof( rch ) + m_sLabel.size();
+
+  std::fseek( m_pFile, 0, SEEK_END );
+  const uint64_t nEnd( std::ftell( m_pFile ) );
+
+  // the trailer and index, when the writer closed cleanly
+  if ( ( m_nFirstBlock + c_nTrailer ) <= nEnd ) {
+    unsigned char rchTrailer[ c_nTrailer ];
+    std::fseek( m_pFile, nEnd - c_nTrailer, SEEK_SET );
+    if ( c_nTrailer == std::fread( rchTrailer, 1, c_nTrailer, m_pFile ) ) {
+      const unsigned char* pTrailer( rchTrailer );
+      const uint32_t nMagic( Fetch<uint32_t>( pTrailer ) );
+      const uint32_t nBlocks( Fetch<uint32_t>( pTrailer ) );
+      const uint64_t nIndex( Fetch<uint64_t>( pTrailer ) );
+      if ( ( c_nMagicIndex == nMagic ) && ( ( nIndex + nBlocks * c_nIndexEntry + c_nTrailer ) == nEnd ) ) {
+        std::vector<unsigned char> v( nBlocks * c_nIndexEntry );
+        std::fseek( m_pFile, nIndex, SEEK_SET );
+        if ( v.size() == std::fread( v.data(), 1, v.size(), m_pFile ) ) {
+          const unsigned char* pIndex( v.data() );
+          m_vIndex.resize( nBlocks );
+          for ( Index& index: m_vIndex ) {
+            index.nOffset = Fetch<uint64_t>( pIndex );
+            index.usFirst = Fetch<int64_t>( pIndex );
+            index.nFirstLine = Fetch<uint64_t>( pIndex );
+          }
+          m_bIndexed = true;
+        }
+      }
+    }
+  }
+
+  if ( !m_bIndexed ) {
+    ScanIndex( nEnd );
+  }
+}
+
+Reader::~Reader() {
+  std::fclose( m_pFile );
+}
+
+bool Reader::ScanIndex( uint64_t nEnd ) { // walk the block headers, stop at a partial block
+  m_vIndex.clear();
+  uint64_t nOffset( m_nFirstBlock );
+  unsigned char rch[ c_nBlockHeader ];
+  while ( ( nOffset + c_nBlockHeader ) <= nEnd ) {
+    std::fseek( m_pFile, nOffset, SEEK_SET );
+    if ( c_nBlockHeader != std::fread( rch, 1, c_nBlockHeader, m_pFile ) ) break;
+    const unsigned char* p( rch );
+    if ( c_nMagicBlock != Fetch<uint32_t>( p ) ) break;
+    Fetch<uint32_t>( p ); // raw size
+    const uint32_t nStored( Fetch<uint32_t>( p ) );
+    Fetch<uint32_t>( p ); // lines
+    const int64_t usFirst( Fetch<int64_t>( p ) );
+    const uint64_t nFirstLine( Fetch<uint64_t>( p ) );
+    if ( nEnd < ( nOffset + c_nBlockHeader + nStored ) ) break;
+    m_vIndex.emplace_back( Index{ nOffset, usFirst, nFirstLine } );
+    nOffset += c_nBlockHeader + nStored;
+  }
+  return !m_vIndex.empty();
+}
+
+bool Reader::Load( size_t ixBlock ) {
+
+  m_pCursor = m_pEnd = nullptr;
+
+  unsigned char rch[ c_nBlockHeader ];
+  std::fseek( m_pFile, m_vIndex[ ixBlock ].nOffset, SEEK_SET );
+  if ( c_nBlockHeader != std::fread( rch, 1, c_nBlockHeader, m_pFile ) ) return false;
+  const unsigned char* p( rch );
+  if ( c_nMagicBlock != Fetch<uint32_t>( p ) ) return false;
+  const uint32_t nRaw( Fetch<uint32_t>( p ) );
+  const uint32_t nStored( Fetch<uint32_t>( p ) );
+  Fetch<uint32_t>( p ); // lines
+  m_usTime = Fetch<int64_t>( p ); // the first line's delta is zero
+
+  if ( nStored == nRaw ) {
+    m_vRaw.resize( nRaw );
+    if ( nRaw != std::fread( m_vRaw.data(), 1, nRaw, m_pFile ) ) return false;
+  }
+  else {
+    m_vStored.resize( nStored );
+    if ( nStored != std::fread( m_vStored.data(), 1, nStored, m_pFile ) ) return false;
+    m_vRaw.resize( nRaw );
+    uLongf nSize( nRaw );
+    if ( ( Z_OK != uncompress( m_vRaw.data(), &nSize, m_vStored.data(), nStored ) ) || ( nRaw != nSize ) ) return false;
+  }
+
+  m_pCursor = m_vRaw.data();
+  m_pEnd = m_pCursor + nRaw;
+  return true;
+}
+
+bool Reader::Next( int64_t& usTime, const unsigned char*& pLine, size_t& nSize ) {
+
+  while ( m_pCursor == m_pEnd ) {
+    if ( m_vIndex.size() <= m_ixBlock ) return false;
+    if ( !Load( m_ixBlock++ ) ) {
+      m_ixBlock = m_vIndex.size();
+      return false;
+    }
+  }
+
+  uint64_t usDelta;
+  uint64_t nLength;
+  if ( !GetVarint( m_pCursor, m_pEnd, usDelta )
+    || !GetVarint( m_pCursor, m_pEnd, nLength )
+    || ( (uint64_t)( m_pEnd - m_pCursor ) < nLength )
+  ) { // corrupt block
+    m_pCursor = m_pEnd = nullptr;
+    m_ixBlock = m_vIndex.size();
+    return false;
+  }
+
+  m_usTime += usDelta;
+  usTime = m_usTime;
+  pLine = m_pCursor;
+  nSize = nLength;
+  m_pCursor += nLength;
+  return true;
+}
+
+void Reader::Seek( int64_t usTime ) {
+
+  // the last block starting at or before usTime
+  std::vector<Index>::const_iterator iter = std::upper_bound(
+    m_vIndex.begin(), m_vIndex.end(), usTime,
+    []( int64_t us, const Index& index ){ return us < index.usFirst; } );
+  m_ixBlock = ( m_vIndex.begin() == iter ) ? 0 : ( iter - m_vIndex.begin() - 1 );
+  m_pCursor = m_pEnd = nullptr;
+
+  // then step over the earlier lines, leaving the cursor on the first line at or after usTime
+  for ( ;; ) {
+    const unsigned char* pCursor( m_pCursor );
+    const int64_t usPrior( m_usTime );
+    const size_t ixBlock( m_ixBlock );
+    int64_t us;
+    const unsigned char* p;
+    size_t n;
+    if ( !Next( us, p, n ) ) break;
+    if ( usTime <= us ) {
+      if ( ixBlock == m_ixBlock ) { // same block, back up one line
+        m_pCursor = pCursor;
+        m_usTime = usPrior;
+      }
+      else { // the line opened a block, reload it
+        m_ixBlock = ixBlock;
+        m_pCursor = m_pEnd = nullptr;
+      }
+      break;
+    }
+  }
+}
+
+void Reader::Rewind() {
+  m_ixBlock = 0;
+  m_pCursor = m_pEnd = nullptr;
+}
+
+} // namespace capture
+} // namespace ou
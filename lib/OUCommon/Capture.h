@@ -0,0 +1,169 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Capture.h
+ * Author:  raymond@burkholder.net
+ * Project: OUCommon
+ * Created: October 19, 2026 23:00 PM
+ */
+
+#pragma once
+
+// capture of the raw lines a Network<> delivers to its parser, for replay through the same parser
+//   the network thread only appends to an in-memory block, a worker thread compresses and writes
+//   a block is handed off at c_nBlockSize, or once a second of lines has accumulated
+//
+// file layout, integers little endian:
+//   header:  "OUCAP001", int64 created (us since epoch), u32 label size, label
+//   block:   u32 'OUCB', u32 raw size, u32 stored size (equal to raw: not compressed),
+//            u32 line count, int64 time of first line (us), u64 number of first line, payload
+//   payload: for each line, varint time since the prior line (us), varint size, bytes (no cr/lf)
+//   index:   for each block, u64 file offset, int64 time of first line, u64 number of first line
+//   trailer: u32 'OUCX', u32 block count, u64 file offset of the index
+// index and trailer are written on close, the Reader scans the blocks when they are missing,
+//   a partially written last block is ignored
+
+#include <mutex>
+#include <deque>
+#include <string>
+#include <thread>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <condition_variable>
+
+namespace ou { // One Unified
+namespace capture {
+
+inline int64_t Now() { // us since epoch
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::system_clock::now().time_since_epoch() ).count();
+}
+
+class Writer {
+public:
+
+  static const size_t c_nBlockSize = 256 * 1024;
+  static const int64_t c_usBlockAge = 1000000;
+
+  struct Stats {
+    uint64_t nLines;
+    uint64_t nBytesRaw;  // line content
+    uint64_t nBytesFile;
+    uint64_t nBlocks;
+  };
+
+  Writer( const std::string& sFileName, const std::string& sLabel ); // throws std::runtime_error
+  ~Writer(); // remaining lines, index, trailer
+
+  // network thread, a single thread per Writer
+  void Append( int64_t usTime, const void* pLine, size_t nSize );
+  void Flush(); // hand off the lines accumulated so far
+
+  Stats GetStats() const; // once destroyed, or from the appending thread
+
+protected:
+private:
+
+  struct Block {
+    int64_t usFirst;
+    int64_t usLast;
+    uint64_t nFirstLine;
+    uint32_t nLines;
+    std::vector<unsigned char> vRaw;
+    Block(): usFirst {}, usLast {}, nFirstLine {}, nLines {} {}
+  };
+
+  struct Index {
+    uint64_t nOffset;
+    int64_t usFirst;
+    uint64_t nFirstLine;
+  };
+
+  std::FILE* m_pFile;
+  const std::string m_sFileName;
+
+  Block m_block; // being filled, network thread
+  uint64_t m_nLines;
+  uint64_t m_nBytesRaw;
+
+  // worker thread
+  mutable std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::deque<Block> m_dequeFull;
+  std::vector<std::vector<unsigned char> > m_vSpare; // recycled block buffers
+  bool m_bStop;
+
+  std::vector<unsigned char> m_vCompressed;
+  std::vector<Index> m_vIndex;
+  uint64_t m_nOffset;
+  uint64_t m_nBlocks;
+
+  std::thread m_thread;
+
+  void Worker();
+  void Write( const Block& );
+  void Put( const void*, size_t );
+};
+
+class Reader {
+public:
+
+  Reader( const std::string& sFileName ); // throws std::runtime_error
+  ~Reader();
+
+  const std::string& Label() const { return m_sLabel; }
+  int64_t Created() const { return m_usCreated; }
+  size_t Blocks() const { return m_vIndex.size(); }
+  bool Indexed() const { return m_bIndexed; } // false: closed uncleanly, the index was rebuilt by a scan
+
+  // false at the end, pLine remains valid until the next call
+  bool Next( int64_t& usTime, const unsigned char*& pLine, size_t& nSize );
+
+  void Seek( int64_t usTime ); // Next then returns the first line at or after usTime
+  void Rewind();
+
+protected:
+private:
+
+  struct Index {
+    uint64_t nOffset;
+    int64_t usFirst;
+    uint64_t nFirstLine;
+  };
+
+  std::FILE* m_pFile;
+
+  std::string m_sLabel;
+  int64_t m_usCreated;
+  uint64_t m_nFirstBlock; // file offset
+
+  bool m_bIndexed;
+  std::vector<Index> m_vIndex;
+  size_t m_ixBlock; // next block to load
+
+  std::vector<unsigned char> m_vRaw;
+  std::vector<unsigned char> m_vStored;
+  const unsigned char* m_pCursor;
+  const unsigned char* m_pEnd;
+  int64_t m_usTime; // of the prior line
+
+  bool Load( size_t ixBlock );
+  bool ScanIndex( uint64_t nEnd );
+};
+
+} // namespace capture
+} // namespace ou
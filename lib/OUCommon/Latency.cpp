@@ -0,0 +1,294 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Latency.cpp
+ * Author:  raymond@burkholder.net
+ * Project: OUCommon
+ * Created: October 19, 2026 20:10 PM
+ */
+
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <algorithm>
+
+#include "Latency.h"
+
+namespace ou { // One Unified
+namespace latency {
+
+namespace {
+
+  struct Entry {
+    tick_t tDelta; // since the previous mark
+    tick_t tTotal; // since the read
+    uint32_t idSymbol;
+    EStage stage;
+  };
+
+  // single producer, the owning thread, single consumer, the collector
+  class Ring {
+  public:
+
+    static const size_t nSize = 1 << 14;
+
+    Ring(): m_head {}, m_tail {}, m_nDropped {} {}
+
+    void Push( const Entry& entry ) {
+      const size_t head( m_head.load( std::memory_order_relaxed ) );
+      if ( nSize == ( head - m_tail.load( std::memory_order_acquire ) ) ) {
+        m_nDropped.fetch_add( 1, std::memory_order_relaxed );
+      }
+      else {
+        m_rEntry[ head & ( nSize - 1 ) ] = entry;
+        m_head.store( head + 1, std::memory_order_release );
+      }
+    }
+
+    template<typename F>
+    void Pop( F&& f ) {
+      size_t tail( m_tail.load( std::memory_order_relaxed ) );
+      const size_t head( m_head.load( std::memory_order_acquire ) );
+      while ( head != tail ) {
+        f( m_rEntry[ tail & ( nSize - 1 ) ] );
+        tail++;
+      }
+      m_tail.store( tail, std::memory_order_release );
+    }
+
+    uint64_t Dropped() { return m_nDropped.exchange( 0, std::memory_order_relaxed ); }
+
+  private:
+    std::array<Entry, nSize> m_rEntry;
+    std::atomic<size_t> m_head;
+    std::atomic<size_t> m_tail;
+    std::atomic<uint64_t> m_nDropped;
+  };
+
+  using pRing_t = std::shared_ptr<Ring>;
+
+  // rings outlive their threads, so entries recorded before a thread exits are still drained
+  std::mutex mutexRegistry;
+  std::vector<pRing_t> vRing;
+
+  thread_local pRing_t t_pRing;
+
+  std::mutex mutexSymbol;
+  std::unordered_map<std::string, uint32_t> mapSymbol;
+  std::vector<std::string> vSymbol( 1, "" ); // id 0 is no symbol
+
+  double dblNsPerTick {};
+
+  const char* rszStage[] = { "line", "parse", "dispatch", "decode", "strand", "watch", "callback" };
+
+  void Calibrate() {
+    const tick_t t0( Ticks() );
+    const std::chrono::steady_clock::time_point tp0( std::chrono::steady_clock::now() );
+    std::this_thread::sleep_for( std::chrono::milliseconds( 50 ) );
+    const tick_t t1( Ticks() );
+    const std::chrono::steady_clock::time_point tp1( std::chrono::steady_clock::now() );
+    dblNsPerTick = std::chrono::duration<double, std::nano>( tp1 - tp0 ).count() / (double)( t1 - t0 );
+  }
+
+  size_t HighBit( uint64_t n ) { // n is not 0
+#if defined(__GNUC__)
+    return 63 - __builtin_clzll( n );
+#else
+    size_t ix {};
+    while ( n >>= 1 ) ix++;
+    return ix;
+#endif
+  }
+
+} // namespace anonymous
+
+namespace detail {
+
+  std::atomic<bool> g_bEnabled( false );
+  thread_local Trace t_trace;
+
+  void Record( EStage stage, tick_t now ) {
+    if ( !t_pRing ) {
+      t_pRing = std::make_shared<Ring>();
+      std::lock_guard<std::mutex> lock( mutexRegistry );
+      vRing.push_back( t_pRing );
+    }
+    t_pRing->Push( Entry{ now - t_trace.tLast, now - t_trace.tOrigin, t_trace.idSymbol, stage } );
+    t_trace.tLast = now;
+  }
+
+} // namespace detail
+
+uint32_t Intern( const std::string& sSymbol ) {
+  std::lock_guard<std::mutex> lock( mutexSymbol );
+  auto result = mapSymbol.emplace( sSymbol, (uint32_t)vSymbol.size() );
+  if ( result.second ) vSymbol.push_back( sSymbol );
+  return result.first->second;
+}
+
+// ==== Histogram
+
+size_t Histogram::Index( uint64_t ns ) {
+  if ( nSub > ns ) return ns;
+  const size_t exponent( HighBit( ns ) );
+  if ( nMaxExponent < exponent ) return nBuckets - 1;
+  const size_t sub( ( ns >> ( exponent - nSubBits ) ) & ( nSub - 1 ) );
+  return ( exponent - nSubBits + 1 ) * nSub + sub;
+}
+
+uint64_t Histogram::Upper( size_t ix ) {
+  if ( nSub > ix ) return ix;
+  const size_t exponent( ix / nSub + nSubBits - 1 );
+  const uint64_t width( uint64_t( 1 ) << ( exponent - nSubBits ) );
+  return ( nSub + ix % nSub ) * width + width - 1;
+}
+
+uint64_t Histogram::Percentile( double dblPercent ) const {
+  if ( 0 == m_nCount ) return 0;
+  const uint64_t nTarget( std::max<uint64_t>( 1, (uint64_t)( dblPercent / 100.0 * m_nCount + 0.5 ) ) );
+  uint64_t nSum {};
+  for ( size_t ix = 0; ix < nBuckets; ix++ ) {
+    nSum += m_rBucket[ ix ];
+    if ( nSum >= nTarget ) return std::min( Upper( ix ), m_nMax );
+  }
+  return m_nMax;
+}
+
+// ==== Collector
+
+Collector::Collector()
+: m_bRunning( false ), m_nDropped {}
+{}
+
+Collector::~Collector() {
+  Stop();
+}
+
+void Collector::Start( std::chrono::milliseconds msDrain, std::chrono::seconds sReport ) {
+  std::unique_lock<std::mutex> lock( m_mutex );
+  if ( m_bRunning ) return;
+  if ( 0.0 == dblNsPerTick ) Calibrate();
+  m_bRunning = true;
+  detail::g_bEnabled.store( true, std::memory_order_relaxed );
+  m_pThread = std::make_unique<std::thread>(
+    [this, msDrain, sReport](){
+      std::chrono::steady_clock::time_point tpReport( std::chrono::steady_clock::now() + sReport );
+      std::unique_lock<std::mutex> lock( m_mutex );
+      while ( m_bRunning ) {
+        m_cv.wait_for( lock, msDrain );
+        Drain();
+        if ( ( 0 < sReport.count() ) && ( std::chrono::steady_clock::now() >= tpReport ) ) {
+          lock.unlock();
+          Dump( std::cout );
+          lock.lock();
+          tpReport += sReport;
+        }
+      }
+    } );
+}
+
+void Collector::Stop() {
+  {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    if ( !m_bRunning ) return;
+    m_bRunning = false;
+    detail::g_bEnabled.store( false, std::memory_order_relaxed );
+  }
+  m_cv.notify_one();
+  m_pThread->join();
+  m_pThread.reset();
+}
+
+void Collector::Drain() {
+
+  std::vector<pRing_t> vRingCopy;
+  {
+    std::lock_guard<std::mutex> lock( mutexRegistry );
+    vRingCopy = vRing;
+  }
+
+  for ( pRing_t& pRing: vRingCopy ) {
+    pRing->Pop(
+      [this]( const Entry& entry ){
+        m_rStage[ (size_t)entry.stage ].Record( (uint64_t)( entry.tDelta * dblNsPerTick ) );
+        if ( EStage::Callback == entry.stage ) {
+          const uint64_t ns( entry.tTotal * dblNsPerTick );
+          m_total.Record( ns );
+          if ( 0 != entry.idSymbol ) m_mapSymbol[ entry.idSymbol ].Record( ns );
+        }
+      } );
+    m_nDropped += pRing->Dropped();
+  }
+}
+
+void Collector::Reset() {
+  std::lock_guard<std::mutex> lock( m_mutex );
+  Drain();
+  for ( Histogram& histogram: m_rStage ) histogram.Reset();
+  m_total.Reset();
+  m_mapSymbol.clear();
+  m_nDropped = 0;
+}
+
+void Collector::Dump( std::ostream& os, size_t nSymbols ) {
+
+  std::lock_guard<std::mutex> lock( m_mutex );
+  Drain();
+
+  auto line = [&os]( const std::string& sName, const Histogram& histogram ){
+    os
+      << std::setw( 12 ) << std::left << sName << std::right
+      << std::setw( 10 ) << histogram.Count()
+      << std::fixed << std::setprecision( 2 )
+      << std::setw( 10 ) << histogram.Mean() / 1000.0
+      << std::setw( 10 ) << histogram.Percentile( 50.0 ) / 1000.0
+      << std::setw( 10 ) << histogram.Percentile( 90.0 ) / 1000.0
+      << std::setw( 10 ) << histogram.Percentile( 99.0 ) / 1000.0
+      << std::setw( 10 ) << histogram.Percentile( 99.9 ) / 1000.0
+      << std::setw( 10 ) << histogram.Max() / 1000.0
+      << std::defaultfloat
+      << std::endl;
+  };
+
+  os
+    << "latency (us)     count      mean       p50       p90       p99     p99.9       max"
+    << std::endl;
+  for ( size_t ix = 0; ix < (size_t)EStage::_Count; ix++ ) {
+    if ( 0 < m_rStage[ ix ].Count() ) line( rszStage[ ix ], m_rStage[ ix ] );
+  }
+  line( "read->cb", m_total );
+
+  if ( 0 < nSymbols && !m_mapSymbol.empty() ) {
+    using vWorst_t = std::vector<std::pair<uint64_t, uint32_t> >; // p99, symbol id
+    vWorst_t vWorst;
+    vWorst.reserve( m_mapSymbol.size() );
+    for ( const mapSymbol_t::value_type& vt: m_mapSymbol ) {
+      vWorst.emplace_back( vt.second.Percentile( 99.0 ), vt.first );
+    }
+    const size_t n( std::min( nSymbols, vWorst.size() ) );
+    std::partial_sort( vWorst.begin(), vWorst.begin() + n, vWorst.end(), std::greater<vWorst_t::value_type>() );
+    std::lock_guard<std::mutex> lockSymbol( mutexSymbol );
+    for ( size_t ix = 0; ix < n; ix++ ) {
+      line( vSymbol[ vWorst[ ix ].second ], m_mapSymbol[ vWorst[ ix ].second ] );
+    }
+  }
+
+  if ( 0 < m_nDropped ) {
+    os << "latency: " << m_nDropped << " marks dropped, rings were full" << std::endl;
+  }
+}
+
+} // namespace latency
+} // namespace ou
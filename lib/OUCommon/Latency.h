@@ -0,0 +1,183 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Latency.h
+ * Author:  raymond@burkholder.net
+ * Project: OUCommon
+ * Created: October 19, 2026 20:10 PM
+ */
+
+#pragma once
+
+// tick to callback latency tracing
+//   a trace begins when a read completes in Network, and is carried by the thread handling the line
+//   each stage marks a timestamp, the time since the previous mark is recorded against the stage
+//   a mark at Callback also records the time since the read against the symbol
+//   records go into a ring per thread, without locks, and are drained into histograms by a Collector
+// tracing is off until a Collector is started, when off a mark costs a thread local test
+// timestamps are the cpu time stamp counter on x86, the steady clock elsewhere
+
+#include <array>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <ostream>
+#include <unordered_map>
+#include <condition_variable>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#endif
+
+namespace ou { // One Unified
+namespace latency {
+
+enum class EStage: uint8_t {
+  Line,     // split out of the read buffer, handed to the owner
+  Parse,    // fields delimited
+  Dispatch, // symbol found
+  Decode,   // symbol state updated, quote or trade built
+  Strand,   // picked up after a post to the symbol's strand
+  Watch,    // Watch handler entered
+  Callback, // strategy callback returned
+  _Count
+};
+
+using tick_t = uint64_t;
+
+inline tick_t Ticks() {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+  return __rdtsc();
+#else
+  return std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+}
+
+struct Trace {
+  tick_t tOrigin; // 0 when no trace is in progress
+  tick_t tLast;
+  uint32_t idSymbol;
+  Trace(): tOrigin {}, tLast {}, idSymbol {} {}
+};
+
+namespace detail {
+  extern std::atomic<bool> g_bEnabled;
+  extern thread_local Trace t_trace;
+  void Record( EStage, tick_t );
+}
+
+inline bool Enabled() { return detail::g_bEnabled.load( std::memory_order_relaxed ); }
+
+inline void Begin( tick_t tOrigin ) { // 0 leaves tracing off for the line
+  detail::t_trace.tOrigin = detail::t_trace.tLast = tOrigin;
+  detail::t_trace.idSymbol = 0;
+}
+
+inline void Mark( EStage stage ) {
+  if ( 0 != detail::t_trace.tOrigin ) detail::Record( stage, Ticks() );
+}
+
+inline void Tag( uint32_t idSymbol ) { detail::t_trace.idSymbol = idSymbol; }
+inline void End() { detail::t_trace.tOrigin = 0; }
+
+// carry a trace across a post to a strand
+inline Trace Capture() { return detail::t_trace; }
+inline void Resume( const Trace& trace ) { detail::t_trace = trace; }
+
+uint32_t Intern( const std::string& sSymbol ); // id for Tag, 0 is no symbol
+
+// log-linear buckets, 16 per power of two, about 6% resolution, nanoseconds
+class Histogram {
+public:
+
+  Histogram(): m_nCount {}, m_nMax {}, m_dblSum {} { m_rBucket.fill( 0 ); }
+
+  void Record( uint64_t ns ) {
+    m_rBucket[ Index( ns ) ]++;
+    m_nCount++;
+    if ( ns > m_nMax ) m_nMax = ns;
+    m_dblSum += ns;
+  }
+
+  uint64_t Count() const { return m_nCount; }
+  uint64_t Max() const { return m_nMax; }
+  double Mean() const { return ( 0 == m_nCount ) ? 0.0 : m_dblSum / m_nCount; }
+  uint64_t Percentile( double dblPercent ) const; // upper edge of the bucket holding the percentile
+
+  void Reset() { m_rBucket.fill( 0 ); m_nCount = m_nMax = 0; m_dblSum = 0.0; }
+
+protected:
+private:
+
+  static const size_t nSubBits = 4;
+  static const size_t nSub = 1 << nSubBits;
+  static const size_t nMaxExponent = 40; // about 18 minutes
+  static const size_t nBuckets = ( nMaxExponent - nSubBits + 2 ) * nSub;
+
+  std::array<uint64_t, nBuckets> m_rBucket;
+  uint64_t m_nCount;
+  uint64_t m_nMax;
+  double m_dblSum;
+
+  static size_t Index( uint64_t ns );
+  static uint64_t Upper( size_t ix );
+
+};
+
+// enables tracing while running, drains the per thread rings into histograms
+//   per stage, and per symbol for read to callback
+//   Dump on demand, or every report interval to std::cout from the drain thread
+// one collector at a time
+
+class Collector {
+public:
+
+  Collector();
+  ~Collector();
+
+  void Start( std::chrono::milliseconds msDrain = std::chrono::milliseconds( 100 ), std::chrono::seconds sReport = std::chrono::seconds( 0 ) );
+  void Stop();
+
+  void Dump( std::ostream&, size_t nSymbols = 20 ); // symbols with the worst p99 first
+  void Reset();
+
+protected:
+private:
+
+  using mapSymbol_t = std::unordered_map<uint32_t, Histogram>;
+
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  bool m_bRunning;
+  std::unique_ptr<std::thread> m_pThread;
+
+  std::array<Histogram, (size_t)EStage::_Count> m_rStage;
+  Histogram m_total;
+  mapSymbol_t m_mapSymbol;
+  uint64_t m_nDropped;
+
+  void Drain(); // m_mutex is held
+
+};
+
+} // namespace latency
+} // namespace ou
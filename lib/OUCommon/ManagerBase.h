@@ -32,6 +32,7 @@
 
 //#include "Database.h"
 #include <OUSqlite/Session.h>
+#include <OUSqlite/WriteBehind.h>
 
 namespace ou {
 namespace db { // Database
@@ -72,8 +73,11 @@ template<class K, class R, class Q>
 void ManagerBase<T>::UpdateRecord( const K& key, const R& row, const std::string& sWhere ) {
 
   if ( nullptr != m_pSession ) {
-    Q q( const_cast<R&>( row ), key );
-    typename ou::db::QueryFields<Q>::pQueryFields_t pQueryUpdate = m_pSession->Update<Q>( q ).Where( sWhere );
+    m_pSession->Journal().Exclusive( // in order with journaled updates, outside of the writer's batch
+      [&key,&row,&sWhere]( ou::db::Session& session ){
+        Q q( const_cast<R&>( row ), key );
+        typename ou::db::QueryFields<Q>::pQueryFields_t pQueryUpdate = session.Update<Q>( q ).Where( sWhere );
+      } );
   }
 
 }
@@ -91,8 +95,11 @@ void ManagerBase<T>::UpdateRecord( const K& key, const R& row, const M& map, con
   }
 
   if ( nullptr != m_pSession ) {
-    Q q( const_cast<R&>( row ), key );
-    typename ou::db::QueryFields<Q>::pQueryFields_t pQueryUpdate = m_pSession->Update<Q>( q ).Where( sWhere );
+    m_pSession->Journal().Exclusive( // in order with journaled updates, outside of the writer's batch
+      [&key,&row,&sWhere]( ou::db::Session& session ){
+        Q q( const_cast<R&>( row ), key );
+        typename ou::db::QueryFields<Q>::pQueryFields_t pQueryUpdate = session.Update<Q>( q ).Where( sWhere );
+      } );
   }
 
 }
@@ -102,8 +109,11 @@ template<class K, class Q> // K:key, Q:query
 void ManagerBase<T>::DeleteRecord( const K& key, const std::string& sWhere ) {
 
   if ( nullptr != m_pSession ) {
-    Q q( key );
-    typename ou::db::QueryFields<Q>::pQueryFields_t pQueryDelete = m_pSession->Delete<Q>( q ).Where( sWhere );
+    m_pSession->Journal().Exclusive( // in order with journaled updates, outside of the writer's batch
+      [&key,&sWhere]( ou::db::Session& session ){
+        Q q( key );
+        typename ou::db::QueryFields<Q>::pQueryFields_t pQueryDelete = session.Delete<Q>( q ).Where( sWhere );
+      } );
   }
 
 }
@@ -121,8 +131,11 @@ void ManagerBase<T>::DeleteRecord( const K& key, M& map, const std::string& sWhe
   }
 
   if ( nullptr != m_pSession ) {
-    Q q( key );
-    typename ou::db::QueryFields<Q>::pQueryFields_t pQueryDelete = m_pSession->Delete<Q>( q ).Where( sWhere );
+    m_pSession->Journal().Exclusive( // in order with journaled updates, outside of the writer's batch
+      [&key,&sWhere]( ou::db::Session& session ){
+        Q q( key );
+        typename ou::db::QueryFields<Q>::pQueryFields_t pQueryDelete = session.Delete<Q>( q ).Where( sWhere );
+      } );
   }
   map.erase( iter );
 
@@ -13,8 +13,11 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
 #include <string>
 #include <vector>
+#include <chrono>
 #include <cassert>
 
 #include <boost/asio.hpp>  // class outbound processing
@@ -26,6 +29,8 @@
 
 #include <OUCommon/Debug.h>
 
+#include "Latency.h"
+#include "Capture.h"
 #include "ReusableBuffers.h"
 
 // example timeout code
@@ -101,6 +106,15 @@ public:
   void Send( const std::string&, bool bNotifyOnDone = false ); // string being sent out to network
   void GiveBackBuffer( linebuffer_t* p ) { m_reposLineBuffers.CheckInL( p ); };  // parsed buffer being given back to accept more parsed network traffic
 
+  // lines received are also appended to the capture, nullptr to stop
+  //   the Writer needs to outlive the connection, or be cleared before being destroyed
+  void Capture( ou::capture::Writer* pCapture ) { m_pCapture.store( pCapture, std::memory_order_release ); }
+
+  // in place of Connect: lines from a capture file are handed to OnNetworkLineBuffer on the asio thread
+  //   dblSpeed: 1.0 at the captured pace, N for N times faster, 0.0 as fast as the lines are consumed
+  //   Send is discarded, end of file is reported as a disconnect
+  void Replay( const std::string& sFileName, double dblSpeed = 1.0 ); // throws std::runtime_error on a bad file
+
 protected:
 
   // CRTP based dummy callbacks
@@ -148,6 +162,18 @@ private:
   size_t m_cntSends;
   size_t m_cntBytesTransferred_send;
 
+  std::atomic<ou::capture::Writer*> m_pCapture;
+
+  std::unique_ptr<ou::capture::Reader> m_pReplay;
+  std::atomic<bool> m_bReplay; // written on the asio thread by ReplayDone, read by Disconnect/Send from others
+  bool m_bReplayPending; // a line has been read, and awaits its time
+  double m_dblReplaySpeed;
+  int64_t m_usReplayBase; // captured time of the first line
+  std::chrono::steady_clock::time_point m_tpReplayBase; // when the first line was replayed
+  int64_t m_usReplayLine;
+  const unsigned char* m_pReplayLine;
+  size_t m_nReplayLine;
+
   void OnConnectDone( const boost::system::error_code& error );
   void OnNetDisconnecting( void);
   void OnSendDoneCommon( const boost::system::error_code& error, std::size_t bytes_transferred, linebuffer_t* );
@@ -158,6 +184,9 @@ private:
 
   void AsioThread( void );
 
+  void ReplayLines();
+  void ReplayDone();
+
   void CommonConstruction( void );
   void OnTimeOut( void );
 
@@ -226,6 +255,13 @@ Network<ownerT,charT>::Network( const ipaddress_t& sAddress, port_t nPort )
 
 template <typename ownerT, typename charT>
 void Network<ownerT,charT>::CommonConstruction() {
+  m_pCapture.store( nullptr, std::memory_order_relaxed );
+  m_bReplay = false;
+  m_bReplayPending = false;
+  m_dblReplaySpeed = 1.0;
+  m_usReplayBase = m_usReplayLine = 0;
+  m_pReplayLine = nullptr;
+  m_nReplayLine = 0;
   m_pline = m_reposLineBuffers.CheckOutL();  // have a receiving line ready
   m_pline->clear();
   m_pwork = new boost::asio::io_service::work(m_io);  // keep the asio service running
@@ -379,6 +415,14 @@ void Network<ownerT,charT>::OnConnectDone( const boost::system::error_code& erro
 template <typename ownerT, typename charT>
 void Network<ownerT,charT>::Disconnect() {
 
+  if ( m_bReplay ) {
+    if ( NS_CONNECTED == m_stateNetwork ) {
+      m_stateNetwork = NS_DISCONNECTING; // the asio thread finishes the replay
+      m_io.post( boost::bind( &Network::ReplayLines, this ) );
+    }
+    return;
+  }
+
   if ( NS_DISCONNECTED != m_stateNetwork ) {
     //m_psocket->cancel();  //  boost::asio::error::operation_aborted, boost::asio::error::operation_not_supported on xp
     switch ( m_stateNetwork ) {
@@ -471,6 +515,11 @@ void Network<ownerT,charT>::OnReadDone( const boost::system::error_code& error,
   else {
     assert( ( NS_CONNECTED == m_stateNetwork ) || ( NS_DISCONNECTING == m_stateNetwork) );
 
+    const ou::latency::tick_t tRead( ou::latency::Enabled() ? ou::latency::Ticks() : 0 ); // origin of each line's trace
+
+    ou::capture::Writer* pCapture( m_pCapture.load( std::memory_order_acquire ) );
+    const int64_t usCapture( ( nullptr == pCapture ) ? 0 : ou::capture::Now() ); // one stamp for the read
+
     ++m_cntAsyncReads;
     m_cntBytesTransferred_input += bytes_transferred;
 
@@ -487,7 +536,12 @@ void Network<ownerT,charT>::OnReadDone( const boost::system::error_code& error,
 //        OutputDebugString( "Network::ReadHandler: have a 0x00 character.\n" );
       }
       if ( 0x0a == ch ) {
+        if ( nullptr != pCapture ) {
+          pCapture->Append( usCapture, m_pline->data(), m_pline->size() );
+        }
         // send the buffer off
+        ou::latency::Begin( tRead );
+        ou::latency::Mark( ou::latency::EStage::Line );
         try {
           if ( &Network<ownerT, charT>::OnNetworkLineBuffer != &ownerT::OnNetworkLineBuffer ) {
             static_cast<ownerT*>( this )->OnNetworkLineBuffer( m_pline );
@@ -499,6 +553,7 @@ void Network<ownerT,charT>::OnReadDone( const boost::system::error_code& error,
         catch(...) {
           std::cerr << "Network<>::OnReadDone default exception handler" << std::endl;
         }
+        ou::latency::End();
         ++m_cntLinesProcessed;
         // and allocate another buffer
         m_pline = m_reposLineBuffers.CheckOutL();
@@ -529,6 +584,11 @@ void Network<ownerT,charT>::OnReadDone( const boost::system::error_code& error,
 template <typename ownerT, typename charT>
 void Network<ownerT,charT>::Send( const std::string& send, bool bNotifyOnDone ) {
 
+  if ( m_bReplay ) {
+    ++m_cntSends; // nothing on the other end
+    return;
+  }
+
   if ( NS_CONNECTED == m_stateNetwork ) {
     //InterlockedIncrement( &m_cntActiveSends );
     boost::interprocess::ipcdetail::atomic_inc32( &m_cntActiveSends );
@@ -620,4 +680,117 @@ void Network<ownerT,charT>::OnSendDoneNoNotify(
   OnSendDoneCommon( error, bytes_transferred, pbuffer );
 }
 
+//
+// Replay
+//
+
+template <typename ownerT, typename charT>
+void Network<ownerT,charT>::Replay( const std::string& sFileName, double dblSpeed ) {
+
+  assert( NS_DISCONNECTED == m_stateNetwork );
+
+  m_pReplay = std::make_unique<ou::capture::Reader>( sFileName );
+  m_bReplay = true;
+  m_bReplayPending = false;
+  m_dblReplaySpeed = dblSpeed;
+  m_usReplayBase = 0;
+
+  m_stateNetwork = NS_CONNECTED;
+
+  m_io.post(
+    [this](){
+      if ( &Network<ownerT, charT>::OnNetworkConnected != &ownerT::OnNetworkConnected ) {
+        static_cast<ownerT*>( this )->OnNetworkConnected();
+      }
+      ReplayLines();
+    } );
+}
+
+//
+// ReplayLines
+// on the asio thread, a batch at a time, so a disconnect is not held up
+//
+
+template <typename ownerT, typename charT>
+void Network<ownerT,charT>::ReplayLines() {
+
+  static const size_t c_nBatch = 1024;
+
+  if ( !m_pReplay ) return; // already done, a timer or post was outstanding
+  if ( NS_CONNECTED != m_stateNetwork ) {
+    ReplayDone();
+    return;
+  }
+
+  for ( size_t nLines = 0; nLines < c_nBatch; nLines++ ) {
+
+    if ( !m_bReplayPending ) {
+      if ( !m_pReplay->Next( m_usReplayLine, m_pReplayLine, m_nReplayLine ) ) {
+        ReplayDone();
+        return;
+      }
+      m_bReplayPending = true;
+      if ( 0 == m_usReplayBase ) {
+        m_usReplayBase = m_usReplayLine;
+        m_tpReplayBase = std::chrono::steady_clock::now();
+      }
+    }
+
+    if ( 0.0 < m_dblReplaySpeed ) {
+      const std::chrono::steady_clock::time_point tpDue(
+        m_tpReplayBase
+        + std::chrono::microseconds( (int64_t)( ( m_usReplayLine - m_usReplayBase ) / m_dblReplaySpeed ) ) );
+      const std::chrono::steady_clock::time_point tpNow( std::chrono::steady_clock::now() );
+      if ( tpNow < tpDue ) {
+        const int64_t usWait( std::chrono::duration_cast<std::chrono::microseconds>( tpDue - tpNow ).count() );
+        m_timer.expires_from_now( boost::posix_time::microseconds( usWait ) );
+        m_timer.async_wait(
+          [this]( const boost::system::error_code& error ){
+            if ( !error ) ReplayLines(); // cancelled on destruction, the disconnect finishes the replay
+          } );
+        return;
+      }
+    }
+
+    m_pline->assign( m_pReplayLine, m_pReplayLine + m_nReplayLine );
+    m_bReplayPending = false;
+
+    // traced as in OnReadDone, each replayed line is its own read
+    ou::latency::Begin( ou::latency::Enabled() ? ou::latency::Ticks() : 0 );
+    ou::latency::Mark( ou::latency::EStage::Line );
+    try {
+      if ( &Network<ownerT, charT>::OnNetworkLineBuffer != &ownerT::OnNetworkLineBuffer ) {
+        static_cast<ownerT*>( this )->OnNetworkLineBuffer( m_pline );
+      }
+    }
+    catch( const std::logic_error& e ) {
+      std::cerr << "Network<>::ReplayLines caught: " << e.what() << std::endl;
+    }
+    catch(...) {
+      std::cerr << "Network<>::ReplayLines default exception handler" << std::endl;
+    }
+    ou::latency::End();
+    ++m_cntLinesProcessed;
+    m_pline = m_reposLineBuffers.CheckOutL();
+    m_pline->clear();
+  }
+
+  m_io.post( boost::bind( &Network::ReplayLines, this ) );
+}
+
+//
+// ReplayDone
+//
+
+template <typename ownerT, typename charT>
+void Network<ownerT,charT>::ReplayDone() {
+  m_pReplay.reset();
+  m_bReplay = false;
+  m_bReplayPending = false;
+  m_stateNetwork = NS_DISCONNECTED;
+  if ( &Network<ownerT, charT>::OnNetworkDisconnected != &ownerT::OnNetworkDisconnected ) {
+    static_cast<ownerT*>( this )->OnNetworkDisconnected();
+  }
+}
+
 } // ou
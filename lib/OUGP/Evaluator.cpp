@@ -0,0 +1,229 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+#include <algorithm>
+
+#include <boost/functional/hash.hpp>
+
+#include "Program.h"
+#include "Evaluator.h"
+
+namespace ou { // One Unified
+namespace gp { // genetic programming
+
+size_t Evaluator::KeyHash::operator()( const Key& key ) const {
+  size_t seed( 0 );
+  boost::hash_combine( seed, (int)key.op );
+  boost::hash_combine( seed, key.constant );
+  boost::hash_combine( seed, key.sInput );
+  boost::hash_combine( seed, key.left );
+  boost::hash_combine( seed, key.right );
+  return seed;
+}
+
+Evaluator::Evaluator( size_t nThreads )
+  : m_nTicks( 0 ), m_cntNodesAdded( 0 ),
+    m_srvcWork( boost::asio::make_work_guard( m_srvc ) ),
+    m_cntOutstanding( 0 )
+{
+  if ( 0 == nThreads ) nThreads = std::max<size_t>( 1, boost::thread::hardware_concurrency() );
+  for ( size_t ix = 0; ix < nThreads; ix++ ) {
+    m_threads.create_thread( [this](){ m_srvc.run(); } );
+  }
+}
+
+Evaluator::~Evaluator( void ) {
+  m_srvcWork.reset();
+  m_threads.join_all();
+}
+
+void Evaluator::Reset( size_t nTicks, fInput_t&& fInput ) {
+  Wait();
+  m_vEntry.clear();
+  m_mapKey.clear();
+  m_cntNodesAdded = 0;
+  m_nTicks = nTicks;
+  m_fInput = std::move( fInput );
+}
+
+void Evaluator::Rebind( size_t nTicks, fInput_t&& fInput ) {
+  Wait();
+  for ( Entry& entry: m_vEntry ) {
+    entry.bComputed = false;
+    entry.pInput = 0;
+  }
+  m_nTicks = nTicks;
+  m_fInput = std::move( fInput );
+}
+
+Evaluator::id_t Evaluator::Intern( const Key& key, unsigned int nLevel ) {
+  m_cntNodesAdded++;
+  mapKey_t::iterator iter = m_mapKey.find( key );
+  if ( m_mapKey.end() != iter ) {
+    return iter->second;
+  }
+  id_t id( m_vEntry.size() );
+  m_vEntry.emplace_back( Entry( key, nLevel ) );
+  m_mapKey.emplace( key, id );
+  return id;
+}
+
+Evaluator::id_t Evaluator::Add( const Node& node_ ) {
+
+  Node& node( const_cast<Node&>( node_ ) ); // child accessors are non-const
+
+  Key key;
+  key.op = node.Op();
+  key.constant = 0.0;
+  key.left = key.right = npos;
+
+  unsigned int nLevel( 0 );
+
+  switch ( key.op ) {
+    case OpCode::Unknown:
+      {
+        std::stringstream ss;
+        node.ToString( ss );
+        throw std::runtime_error( "Evaluator::Add no OpCode for " + ss.str() );
+      }
+      break;
+    case OpCode::Root:
+      return Add( node.ChildCenter() ); // root is a pass through
+      break;
+    case OpCode::DoubleConstant:
+      key.constant = node.Constant();
+      break;
+    case OpCode::Input:
+      {
+        std::stringstream ss;
+        node.ToString( ss );
+        key.sInput = ss.str();
+      }
+      break;
+    default:
+      break;
+  }
+
+  switch ( node.NodeCount() ) {
+    case 0:
+      break;
+    case 1:
+      key.left = Add( node.ChildCenter() );
+      nLevel = m_vEntry[ key.left ].nLevel + 1;
+      break;
+    case 2:
+      key.left = Add( node.ChildLeft() );
+      key.right = Add( node.ChildRight() );
+      switch ( key.op ) {
+        case OpCode::BoolAnd:
+        case OpCode::BoolOr:
+        case OpCode::DoubleAdd:
+        case OpCode::DoubleMlt:
+          if ( key.right < key.left ) std::swap( key.left, key.right ); // commutative, canonical order shares more
+          break;
+        default:
+          break;
+      }
+      nLevel = std::max( m_vEntry[ key.left ].nLevel, m_vEntry[ key.right ].nLevel ) + 1;
+      break;
+  }
+
+  return Intern( key, nLevel );
+}
+
+void Evaluator::Evaluate( void ) {
+
+  // group pending entries by level, children are always at a lower level
+  std::vector<std::vector<id_t> > vLevels;
+  for ( id_t id = 0; id < m_vEntry.size(); id++ ) {
+    const Entry& entry( m_vEntry[ id ] );
+    if ( !entry.bComputed ) {
+      if ( vLevels.size() <= entry.nLevel ) vLevels.resize( entry.nLevel + 1 );
+      vLevels[ entry.nLevel ].push_back( id );
+    }
+  }
+
+  for ( const std::vector<id_t>& vLevel: vLevels ) {
+    for ( const id_t id: vLevel ) {
+      Entry* pEntry( &m_vEntry[ id ] ); // m_vEntry is not resized during Evaluate
+      if ( OpCode::Input == pEntry->key.op ) {
+        try {
+          Compute( *pEntry ); // column lookup only, done inline
+        }
+        catch (...) {
+          Failed( std::current_exception() ); // rethrown by Wait, once posted work has drained
+        }
+      }
+      else {
+        Post( [this,pEntry](){ Compute( *pEntry ); } );
+      }
+    }
+    Wait();
+  }
+}
+
+const double* Evaluator::Result( id_t id ) const {
+  const Entry& entry( m_vEntry.at( id ) );
+  if ( !entry.bComputed ) {
+    throw std::runtime_error( "Evaluator::Result not evaluated" );
+  }
+  return ( OpCode::Input == entry.key.op ) ? entry.pInput : entry.vResult.data();
+}
+
+void Evaluator::Compute( Entry& entry ) {
+
+  const size_t n( m_nTicks );
+  const Key& key( entry.key );
+
+  if ( OpCode::Input == key.op ) {
+    entry.pInput = m_fInput ? m_fInput( key.sInput ) : 0;
+    if ( 0 == entry.pInput ) {
+      throw std::runtime_error( "Evaluator::Compute no column for " + key.sInput );
+    }
+    entry.bComputed = true;
+    return;
+  }
+
+  entry.vResult.resize( n );
+  double* r( entry.vResult.data() );
+  const double* a( ( npos == key.left )  ? 0 : Result( key.left ) );
+  const double* b( ( npos == key.right ) ? 0 : Result( key.right ) );
+
+  Program::Apply( key.op, key.constant, a, b, r, n );
+
+  entry.bComputed = true;
+}
+
+void Evaluator::Failed( std::exception_ptr pException ) {
+  std::lock_guard<std::mutex> lock( m_mutex );
+  if ( !m_pException ) m_pException = pException;
+}
+
+void Evaluator::Done( void ) {
+  std::lock_guard<std::mutex> lock( m_mutex );
+  if ( 0 == --m_cntOutstanding ) m_cvDone.notify_all();
+}
+
+void Evaluator::Wait( void ) {
+  std::unique_lock<std::mutex> lock( m_mutex );
+  m_cvDone.wait( lock, [this]{ return 0 == m_cntOutstanding; } );
+  if ( m_pException ) {
+    std::exception_ptr pException( m_pException );
+    m_pException = nullptr;
+    std::rethrow_exception( pException );
+  }
+}
+
+} // namespace gp
+} // namespace ou
@@ -0,0 +1,142 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+#pragma once
+
+#include <mutex>
+#include <limits>
+#include <exception>
+#include <string>
+#include <vector>
+#include <functional>
+#include <unordered_map>
+#include <condition_variable>
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/thread/thread.hpp>
+
+#include "Node.h"
+
+namespace ou { // One Unified
+namespace gp { // genetic programming
+
+// evaluates the trees of a population over a block of ticks
+//   identical subtrees, across all individuals, are hash-consed to a single entry,
+//     so a shared subexpression is computed once per block, not once per individual
+//   each entry holds its output as an array over the block (booleans as 0.0/1.0)
+//   entries are computed level by level (terminals first) on a persistent thread pool
+//   cached entries remain valid across generations until Reset supplies a new block
+//   Rebind keeps the entries and recomputes them over another block, so a long series
+//     is evaluated a chunk at a time, with memory bounded by entries * chunk
+//   the pool is available to callers for per Individual work through Post/Wait,
+//     the first exception thrown by posted work is rethrown by Wait
+
+class Evaluator {
+public:
+
+  using id_t = size_t;
+  static const id_t npos = std::numeric_limits<id_t>::max();
+
+  using fInput_t = std::function<const double*( const std::string& )>; // column of values for a series name, 0 if unknown
+
+  Evaluator( size_t nThreads = 0 ); // 0: one thread per hardware thread
+  ~Evaluator( void );
+
+  void Reset( size_t nTicks, fInput_t&& ); // new block of ticks, drops all cached entries
+  void Rebind( size_t nTicks, fInput_t&& ); // new block of ticks, keeps the entries, all are recomputed by Evaluate
+
+  id_t Add( const Node& ); // returns the entry for the tree, throws on node without an OpCode
+  void Evaluate( void ); // computes entries added since last Evaluate
+  const double* Result( id_t ) const;
+
+  size_t Ticks( void ) const { return m_nTicks; };
+  size_t NodesAdded( void ) const { return m_cntNodesAdded; };
+  size_t NodesUnique( void ) const { return m_vEntry.size(); };
+
+  template<typename F>
+  void Post( F&& f ) { // general work on the pool, complete with Wait
+    {
+      std::lock_guard<std::mutex> lock( m_mutex );
+      m_cntOutstanding++;
+    }
+    boost::asio::post( m_srvc, [this,f=std::forward<F>(f)]() mutable {
+      try {
+        f();
+      }
+      catch (...) {
+        Failed( std::current_exception() );
+      }
+      Done();
+    } );
+  }
+
+  void Wait( void ); // rethrows the first exception from posted work
+
+protected:
+private:
+
+  struct Key {
+    OpCode::E op;
+    double constant;
+    std::string sInput;
+    id_t left;
+    id_t right;
+    bool operator==( const Key& rhs ) const {
+      return ( op == rhs.op ) && ( constant == rhs.constant ) && ( left == rhs.left ) && ( right == rhs.right ) && ( sInput == rhs.sInput );
+    }
+  };
+
+  struct KeyHash {
+    size_t operator()( const Key& ) const;
+  };
+
+  struct Entry {
+    Key key;
+    unsigned int nLevel;
+    bool bComputed;
+    const double* pInput; // OpCode::Input refers to the caller's column
+    std::vector<double> vResult;
+    Entry( const Key& key_, unsigned int nLevel_ ): key( key_ ), nLevel( nLevel_ ), bComputed( false ), pInput( 0 ) {};
+  };
+
+  using vEntry_t = std::vector<Entry>;
+  vEntry_t m_vEntry;
+
+  using mapKey_t = std::unordered_map<Key, id_t, KeyHash>;
+  mapKey_t m_mapKey;
+
+  size_t m_nTicks;
+  fInput_t m_fInput;
+  size_t m_cntNodesAdded;
+
+  boost::asio::io_context m_srvc;
+  boost::thread_group m_threads;
+  boost::asio::executor_work_guard<boost::asio::io_context::executor_type> m_srvcWork;
+
+  std::mutex m_mutex;
+  std::condition_variable m_cvDone;
+  size_t m_cntOutstanding;
+  std::exception_ptr m_pException; // first failure since the last Wait
+
+  id_t Intern( const Key&, unsigned int nLevel );
+  void Compute( Entry& );
+  void Failed( std::exception_ptr );
+  void Done( void );
+
+};
+
+} // namespace gp
+} // namespace ou
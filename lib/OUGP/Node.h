@@ -36,6 +36,16 @@ namespace FactoryType {
   enum E { All = 0, Terminals, Nodes, Count };
 }
 
+namespace OpCode { // node semantics, used by Evaluator to share and batch evaluate subtrees
+  enum E {
+    Unknown = 0, Root,
+    BoolFalse, BoolTrue, BoolNot, BoolAnd, BoolOr,
+    CompareGT, CompareGE, CompareLT, CompareLE,
+    DoubleZero, DoubleConstant, DoubleAbs, DoubleAdd, DoubleSub, DoubleMlt, DoubleDvd,
+    Input, // time series terminal, identified by ToString
+    Count };
+}
+
 class Node {
 public:
 
@@ -62,6 +72,9 @@ public:
   virtual bool EvaluateBoolean( void ) { throw std::logic_error( "EvaluateBoolean no override" ); };
   virtual double EvaluateDouble( void ) { throw std::logic_error( "EvaluateDouble no override" ); };
 
+  virtual OpCode::E Op( void ) const { return OpCode::Unknown; };
+  virtual double Constant( void ) const { return 0.0; }; // value of OpCode::DoubleConstant
+
   Node& Parent( void ) { assert( 0 != m_pParent ); return *m_pParent; };
 
   // maybe use union here or change names to suit
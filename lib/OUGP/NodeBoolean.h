@@ -26,6 +26,7 @@ public:
   NodeBooleanFalse( void );
   ~NodeBooleanFalse( void );
   void ToString( std::stringstream& ss ) const { ss << "false"; };
+  OpCode::E Op( void ) const { return OpCode::BoolFalse; };
   bool EvaluateBoolean( void ) { return false; };
 protected:
 private:
@@ -36,6 +37,7 @@ public:
   NodeBooleanTrue( void );
   ~NodeBooleanTrue( void );
   void ToString( std::stringstream& ss ) const { ss << "true"; };
+  OpCode::E Op( void ) const { return OpCode::BoolTrue; };
   bool EvaluateBoolean( void ) { return true; };
 protected:
 private:
@@ -46,6 +48,7 @@ public:
   NodeBooleanNot( void );
   ~NodeBooleanNot( void );
   void ToString( std::stringstream& ss ) const { ss << "!"; };
+  OpCode::E Op( void ) const { return OpCode::BoolNot; };
   bool EvaluateBoolean( void );
 protected:
 private:
@@ -56,6 +59,7 @@ public:
   NodeBooleanAnd( void );
   ~NodeBooleanAnd( void );
   void ToString( std::stringstream& ss ) const { ss << "&&"; };
+  OpCode::E Op( void ) const { return OpCode::BoolAnd; };
   bool EvaluateBoolean( void );
 protected:
 private:
@@ -66,6 +70,7 @@ public:
   NodeBooleanOr( void );
   ~NodeBooleanOr( void );
   void ToString( std::stringstream& ss ) const { ss << "||"; };
+  OpCode::E Op( void ) const { return OpCode::BoolOr; };
   bool EvaluateBoolean( void );
 protected:
 private:
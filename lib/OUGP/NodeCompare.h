@@ -35,6 +35,7 @@ public:
   NodeCompareGT( void );
   ~NodeCompareGT( void );
   void ToString( std::stringstream& ss ) const { ss << ">"; };
+  OpCode::E Op( void ) const { return OpCode::CompareGT; };
   bool EvaluateBoolean( void );
 protected:
 private:
@@ -45,6 +46,7 @@ public:
   NodeCompareGE( void );
   ~NodeCompareGE( void );
   void ToString( std::stringstream& ss ) const { ss << ">="; };
+  OpCode::E Op( void ) const { return OpCode::CompareGE; };
   bool EvaluateBoolean( void );
 protected:
 private:
@@ -55,6 +57,7 @@ public:
   NodeCompareLT( void );
   ~NodeCompareLT( void );
   void ToString( std::stringstream& ss ) const { ss << "<"; };
+  OpCode::E Op( void ) const { return OpCode::CompareLT; };
   bool EvaluateBoolean( void );
 protected:
 private:
@@ -65,6 +68,7 @@ public:
   NodeCompareLE( void );
   ~NodeCompareLE( void );
   void ToString( std::stringstream& ss ) const { ss << "<="; };
+  OpCode::E Op( void ) const { return OpCode::CompareLE; };
   bool EvaluateBoolean( void );
 protected:
 private:
@@ -29,6 +29,7 @@ public:
   NodeDoubleZero( void );
   ~NodeDoubleZero( void );
   void ToString( std::stringstream& ss ) const { ss << "0.0"; };
+  OpCode::E Op( void ) const { return OpCode::DoubleZero; };
   double EvaluateDouble( void );
 protected:
 private:
@@ -41,6 +42,8 @@ public:
   NodeDoubleRandom& operator=( const NodeDoubleRandom& rhs );
   ~NodeDoubleRandom( void );
   void ToString( std::stringstream& ss ) const { ss << m_val; };
+  OpCode::E Op( void ) const { return OpCode::DoubleConstant; };
+  double Constant( void ) const { return m_val; };
   double EvaluateDouble( void );
 protected:
 private:
@@ -54,6 +57,7 @@ public:
   NodeDoubleAbs& operator=( const NodeDoubleAbs& rhs );
   ~NodeDoubleAbs( void );
   void ToString( std::stringstream& ss ) const { ss << "abs"; };
+  OpCode::E Op( void ) const { return OpCode::DoubleAbs; };
   double EvaluateDouble( void );
 protected:
 private:
@@ -64,6 +68,7 @@ public:
   NodeDoubleAdd( void );
   ~NodeDoubleAdd( void );
   void ToString( std::stringstream& ss ) const { ss << "+"; };
+  OpCode::E Op( void ) const { return OpCode::DoubleAdd; };
   double EvaluateDouble( void );
 protected:
 private:
@@ -74,6 +79,7 @@ public:
   NodeDoubleSub( void );
   ~NodeDoubleSub( void );
   void ToString( std::stringstream& ss ) const { ss << "-"; };
+  OpCode::E Op( void ) const { return OpCode::DoubleSub; };
   double EvaluateDouble( void );
 protected:
 private:
@@ -84,6 +90,7 @@ public:
   NodeDoubleMlt( void );
   ~NodeDoubleMlt( void );
   void ToString( std::stringstream& ss ) const { ss << "*"; };
+  OpCode::E Op( void ) const { return OpCode::DoubleMlt; };
   double EvaluateDouble( void );
 protected:
 private:
@@ -94,6 +101,7 @@ public:
   NodeDoubleDvd( void );
   ~NodeDoubleDvd( void );
   void ToString( std::stringstream& ss ) const { ss << "/"; };
+  OpCode::E Op( void ) const { return OpCode::DoubleDvd; };
   double EvaluateDouble( void );
 protected:
 private:
@@ -0,0 +1,283 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Program.cpp
+ * Author:  raymond@burkholder.net
+ * Project: OUGP
+ * Created: October 19, 2026 13:05 PM
+ */
+
+#include <cmath>
+#include <algorithm>
+
+#include "Program.h"
+
+namespace ou { // One Unified
+namespace gp { // genetic programming
+
+namespace {
+  const char* rszOpCode[] = {
+    "Unknown", "Root",
+    "BoolFalse", "BoolTrue", "BoolNot", "BoolAnd", "BoolOr",
+    "CompareGT", "CompareGE", "CompareLT", "CompareLE",
+    "DoubleZero", "DoubleConstant", "DoubleAbs", "DoubleAdd", "DoubleSub", "DoubleMlt", "DoubleDvd",
+    "Input"
+  };
+}
+
+Program::Program( void )
+: m_nRegisters( 0 ), m_opResult( 0 )
+{}
+
+Program::Program( const Node& node )
+: m_nRegisters( 0 ), m_opResult( 0 )
+{
+  Compile( node );
+}
+
+Program::~Program( void ) {}
+
+void Program::Compile( const Node& node ) {
+
+  m_vInstr.clear();
+  m_vInput.clear();
+  m_vConstant.clear();
+  m_vPending.clear();
+  m_nRegisters = 0;
+
+  Ref refResult = Emit( const_cast<Node&>( node ), 0 ); // child accessors are non-const
+
+  for ( const Pending& pending: m_vPending ) {
+    m_vInstr.emplace_back( Instr( pending.op, Resolve( pending.dst ), Resolve( pending.a ), Resolve( pending.b ) ) );
+  }
+  m_vPending.clear();
+  m_opResult = Resolve( refResult );
+
+  m_vRegister.assign( m_nRegisters * nBlock, 0.0 );
+  m_vConstantFill.resize( m_vConstant.size() * nBlock );
+  for ( size_t ix = 0; ix < m_vConstant.size(); ix++ ) {
+    std::fill( m_vConstantFill.begin() + ix * nBlock, m_vConstantFill.begin() + ( ix + 1 ) * nBlock, m_vConstant[ ix ] );
+  }
+
+  m_vOperand.resize( m_nRegisters + m_vInput.size() + m_vConstant.size() );
+  for ( size_t ix = 0; ix < m_nRegisters; ix++ ) {
+    m_vOperand[ ix ] = m_vRegister.data() + ix * nBlock;
+  }
+  for ( size_t ix = 0; ix < m_vConstant.size(); ix++ ) {
+    m_vOperand[ m_nRegisters + m_vInput.size() + ix ] = m_vConstantFill.data() + ix * nBlock;
+  }
+}
+
+Program::Ref Program::AddInput( const std::string& sInput ) {
+  vInput_t::const_iterator iter = std::find( m_vInput.begin(), m_vInput.end(), sInput );
+  if ( m_vInput.end() == iter ) {
+    m_vInput.push_back( sInput );
+    iter = m_vInput.end() - 1;
+  }
+  return Ref { Space::Input, (operand_t) ( iter - m_vInput.begin() ) };
+}
+
+Program::Ref Program::AddConstant( double constant ) {
+  std::vector<double>::const_iterator iter = std::find( m_vConstant.begin(), m_vConstant.end(), constant );
+  if ( m_vConstant.end() == iter ) {
+    m_vConstant.push_back( constant );
+    iter = m_vConstant.end() - 1;
+  }
+  return Ref { Space::Constant, (operand_t) ( iter - m_vConstant.begin() ) };
+}
+
+Program::operand_t Program::Resolve( const Ref& ref ) const {
+  switch ( ref.space ) {
+    case Space::Register:
+      return ref.ix;
+      break;
+    case Space::Input:
+      return m_nRegisters + ref.ix;
+      break;
+    case Space::Constant:
+      return m_nRegisters + m_vInput.size() + ref.ix;
+      break;
+  }
+  return 0;
+}
+
+Program::Ref Program::Emit( Node& node, operand_t nReg ) {
+
+  const OpCode::E op( node.Op() );
+
+  switch ( op ) {
+    case OpCode::Unknown:
+      {
+        std::stringstream ss;
+        node.ToString( ss );
+        throw std::runtime_error( "Program::Emit no OpCode for " + ss.str() );
+      }
+      break;
+    case OpCode::Root:
+      return Emit( node.ChildCenter(), nReg ); // root is a pass through
+      break;
+    case OpCode::BoolFalse:
+    case OpCode::DoubleZero:
+      return AddConstant( 0.0 );
+      break;
+    case OpCode::BoolTrue:
+      return AddConstant( 1.0 );
+      break;
+    case OpCode::DoubleConstant:
+      return AddConstant( node.Constant() );
+      break;
+    case OpCode::Input:
+      {
+        std::stringstream ss;
+        node.ToString( ss );
+        return AddInput( ss.str() );
+      }
+      break;
+    default:
+      break;
+  }
+
+  Ref a, b;
+  switch ( node.NodeCount() ) {
+    case 1:
+      a = b = Emit( node.ChildCenter(), nReg );
+      break;
+    case 2:
+      a = Emit( node.ChildLeft(), nReg );
+      b = Emit( node.ChildRight(), ( Space::Register == a.space ) ? nReg + 1 : nReg ); // left result stays live in nReg
+      break;
+    default:
+      throw std::logic_error( "Program::Emit operator without children" );
+      break;
+  }
+
+  if ( ( Space::Constant == a.space ) && ( Space::Constant == b.space ) ) { // fold
+    double r;
+    Apply( op, 0.0, &m_vConstant[ a.ix ], &m_vConstant[ b.ix ], &r, 1 );
+    return AddConstant( r );
+  }
+
+  // the destination may alias an operand, kernels are element wise so this is safe
+  Ref dst { Space::Register, nReg };
+  m_nRegisters = std::max<size_t>( m_nRegisters, nReg + 1 );
+  m_vPending.push_back( Pending { op, dst, a, b } );
+  return dst;
+}
+
+void Program::Run( size_t nTicks, const fInput_t& fInput, double* pResult ) {
+  std::vector<const double*> vColumn;
+  vColumn.reserve( m_vInput.size() );
+  for ( const std::string& sInput: m_vInput ) {
+    const double* pColumn( fInput ? fInput( sInput ) : 0 );
+    if ( 0 == pColumn ) {
+      throw std::runtime_error( "Program::Run no column for " + sInput );
+    }
+    vColumn.push_back( pColumn );
+  }
+  Run( nTicks, vColumn, pResult );
+}
+
+void Program::Run( size_t nTicks, const std::vector<const double*>& vColumn, double* pResult ) {
+
+  if ( vColumn.size() != m_vInput.size() ) {
+    throw std::runtime_error( "Program::Run column count does not match Inputs" );
+  }
+
+  const double** rOperand( m_vOperand.data() );
+  const double** rInput( rOperand + m_nRegisters );
+  double* rRegister( m_vRegister.data() );
+
+  for ( size_t ixStart = 0; ixStart < nTicks; ixStart += nBlock ) {
+    const size_t n( std::min<size_t>( nBlock, nTicks - ixStart ) );
+    for ( size_t ix = 0; ix < vColumn.size(); ix++ ) {
+      rInput[ ix ] = vColumn[ ix ] + ixStart;
+    }
+    for ( const Instr& instr: m_vInstr ) {
+      Apply( instr.op, 0.0, rOperand[ instr.a ], rOperand[ instr.b ], rRegister + instr.dst * nBlock, n );
+    }
+    std::copy( rOperand[ m_opResult ], rOperand[ m_opResult ] + n, pResult + ixStart );
+  }
+}
+
+void Program::ToString( std::stringstream& ss ) const {
+  for ( size_t ix = 0; ix < m_vInput.size(); ix++ ) {
+    ss << "o" << m_nRegisters + ix << " = " << m_vInput[ ix ] << std::endl;
+  }
+  for ( size_t ix = 0; ix < m_vConstant.size(); ix++ ) {
+    ss << "o" << m_nRegisters + m_vInput.size() + ix << " = " << m_vConstant[ ix ] << std::endl;
+  }
+  for ( const Instr& instr: m_vInstr ) {
+    ss << "o" << instr.dst << " = " << rszOpCode[ instr.op ] << " o" << instr.a << " o" << instr.b << std::endl;
+  }
+  ss << "result o" << m_opResult << std::endl;
+}
+
+void Program::Apply( OpCode::E op, double constant, const double* a, const double* b, double* r, size_t n ) {
+
+  switch ( op ) {
+    case OpCode::BoolFalse:
+    case OpCode::DoubleZero:
+      std::fill( r, r + n, 0.0 );
+      break;
+    case OpCode::BoolTrue:
+      std::fill( r, r + n, 1.0 );
+      break;
+    case OpCode::DoubleConstant:
+      std::fill( r, r + n, constant );
+      break;
+    case OpCode::BoolNot:
+      for ( size_t ix = 0; ix < n; ix++ ) r[ ix ] = ( 0.0 == a[ ix ] ) ? 1.0 : 0.0;
+      break;
+    case OpCode::BoolAnd:
+      for ( size_t ix = 0; ix < n; ix++ ) r[ ix ] = ( ( 0.0 != a[ ix ] ) && ( 0.0 != b[ ix ] ) ) ? 1.0 : 0.0;
+      break;
+    case OpCode::BoolOr:
+      for ( size_t ix = 0; ix < n; ix++ ) r[ ix ] = ( ( 0.0 != a[ ix ] ) || ( 0.0 != b[ ix ] ) ) ? 1.0 : 0.0;
+      break;
+    case OpCode::CompareGT:
+      for ( size_t ix = 0; ix < n; ix++ ) r[ ix ] = ( a[ ix ] > b[ ix ] ) ? 1.0 : 0.0;
+      break;
+    case OpCode::CompareGE:
+      for ( size_t ix = 0; ix < n; ix++ ) r[ ix ] = ( a[ ix ] >= b[ ix ] ) ? 1.0 : 0.0;
+      break;
+    case OpCode::CompareLT:
+      for ( size_t ix = 0; ix < n; ix++ ) r[ ix ] = ( a[ ix ] < b[ ix ] ) ? 1.0 : 0.0;
+      break;
+    case OpCode::CompareLE:
+      for ( size_t ix = 0; ix < n; ix++ ) r[ ix ] = ( a[ ix ] <= b[ ix ] ) ? 1.0 : 0.0;
+      break;
+    case OpCode::DoubleAbs:
+      for ( size_t ix = 0; ix < n; ix++ ) r[ ix ] = std::abs( a[ ix ] );
+      break;
+    case OpCode::DoubleAdd:
+      for ( size_t ix = 0; ix < n; ix++ ) r[ ix ] = a[ ix ] + b[ ix ];
+      break;
+    case OpCode::DoubleSub:
+      for ( size_t ix = 0; ix < n; ix++ ) r[ ix ] = a[ ix ] - b[ ix ];
+      break;
+    case OpCode::DoubleMlt:
+      for ( size_t ix = 0; ix < n; ix++ ) r[ ix ] = a[ ix ] * b[ ix ];
+      break;
+    case OpCode::DoubleDvd: // matches NodeDoubleDvd
+      for ( size_t ix = 0; ix < n; ix++ ) r[ ix ] = ( 0.0 == b[ ix ] ) ? HUGE_VAL : a[ ix ] / b[ ix ];
+      break;
+    default:
+      throw std::logic_error( "Program::Apply unhandled OpCode" );
+      break;
+  }
+}
+
+} // namespace gp
+} // namespace ou
@@ -0,0 +1,115 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Program.h
+ * Author:  raymond@burkholder.net
+ * Project: OUGP
+ * Created: October 19, 2026 13:05 PM
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <functional>
+
+#include "Node.h"
+
+namespace ou { // One Unified
+namespace gp { // genetic programming
+
+// a tree compiled to a linear register program, run over a block of ticks at a time
+//   instructions are in post order, each reads up to two operands and writes one register
+//   registers are allocated by stack height, so a tree needs at most depth + 1 of them
+//   operands index a single table: [ registers ][ input columns ][ constants ]
+//     inputs and constants never generate instructions, constants are filled once per Run
+//   booleans are carried as 0.0/1.0, the kernels are shared with Evaluator
+
+class Program {
+public:
+
+  using fInput_t = std::function<const double*( const std::string& )>; // column of values for a series name, 0 if unknown
+  using vInput_t = std::vector<std::string>;
+
+  static const size_t nBlock = 256; // ticks per pass, keeps the register file in L1
+
+  Program( void );
+  Program( const Node& );
+  Program( const Program& ) = delete; // m_vOperand points into this instance's own storage
+  Program( Program&& ) = delete;
+  Program& operator=( const Program& ) = delete;
+  Program& operator=( Program&& ) = delete;
+  ~Program( void );
+
+  void Compile( const Node& ); // throws on node without an OpCode
+
+  const vInput_t& Inputs( void ) const { return m_vInput; }; // series names referenced, in operand order
+  size_t Instructions( void ) const { return m_vInstr.size(); };
+  size_t Registers( void ) const { return m_nRegisters; };
+
+  void Run( size_t nTicks, const fInput_t&, double* pResult ); // pResult has nTicks entries
+  void Run( size_t nTicks, const std::vector<const double*>& vColumn, double* pResult ); // columns ordered as Inputs()
+
+  void ToString( std::stringstream& ) const; // listing, for diagnostics
+
+  // r[ix] = op( a[ix], b[ix] ), for ix in [0,n)
+  static void Apply( OpCode::E, double constant, const double* a, const double* b, double* r, size_t n );
+
+protected:
+private:
+
+  using operand_t = unsigned int;
+
+  struct Instr {
+    OpCode::E op;
+    operand_t dst;
+    operand_t a;
+    operand_t b;
+    Instr( OpCode::E op_, operand_t dst_, operand_t a_, operand_t b_ ): op( op_ ), dst( dst_ ), a( a_ ), b( b_ ) {};
+  };
+  using vInstr_t = std::vector<Instr>;
+  vInstr_t m_vInstr;
+
+  vInput_t m_vInput;
+  std::vector<double> m_vConstant;
+
+  // operands are resolved to a table index after compile, when the register count is known
+  enum class Space { Register, Input, Constant };
+  struct Ref {
+    Space space;
+    operand_t ix;
+  };
+  struct Pending {
+    OpCode::E op;
+    Ref dst, a, b;
+  };
+  std::vector<Pending> m_vPending;
+
+  size_t m_nRegisters;
+  operand_t m_opResult;
+
+  std::vector<double> m_vRegister; // nRegisters * nBlock, scratch, so one Run at a time per Program
+  std::vector<double> m_vConstantFill; // nConstants * nBlock, filled at Compile
+  std::vector<const double*> m_vOperand; // per block view of the operand table
+
+  Ref Emit( Node&, operand_t nReg ); // nReg: first free register
+  Ref AddInput( const std::string& );
+  Ref AddConstant( double );
+  operand_t Resolve( const Ref& ) const;
+
+};
+
+} // namespace gp
+} // namespace ou
@@ -36,6 +36,7 @@ public:
   const RootNode& operator=( const RootNode& rhs );
 
   void ToString( std::stringstream& ss ) const { ss << "root="; };
+  OpCode::E Op( void ) const { return OpCode::Root; };
   bool EvaluateBoolean( void );
 
   bool HasBooleanCandidates( void ) { return ( 0 != m_vBooleanCandidates.size() ); };  // should always be true
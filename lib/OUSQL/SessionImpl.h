@@ -39,12 +39,22 @@
 // Currently, the same physical structure needs to be re-used.  Structure is provided during statement construction,
 // not necessarily a good thing all the time.
 
+// 2026/10/19
+// Cached/CachedInsert/CachedUpdate/CachedDelete keep a prepared statement, and the structure it binds from,
+// per thread, query text and field type.  The supplied structure is copied in on each call.
+// Transaction brackets a run of statements in one begin/commit.
+
 
 #include <map>
+#include <mutex>
+#include <tuple>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
+#include <iostream>
 #include <typeinfo>
+#include <exception>
 #include <stdexcept>
 
 #include <boost/noncopyable.hpp>
@@ -324,6 +334,93 @@ public:
     m_db.ResetStatement( StatementState );
   }
 
+  // statement cache: prepared on first use, then reset and re-bound from a copy of f on each call
+  //   the returned query is ready for Execute (and Columns), and stays valid until
+  //   the next call with the same query text from the same thread
+  //   Reset a select not read to the end, otherwise it holds its read lock until the next use
+
+  template<class F>
+  typename QueryFields<F>::pQueryFields_t Cached( const std::string& sSqlQuery, const F& f ) {
+    CachedQuery<F>& cached( LocateCached<F>( sSqlQuery, f ) );
+    if ( !cached.pQuery ) {
+      cached.pQuery = SQL<F>( sSqlQuery, cached.f ).NoExecute();
+    }
+    return Rebind<F>( cached );
+  }
+
+  template<class F>
+  typename QueryFields<F>::pQueryFields_t CachedInsert( const F& f ) {
+    return CachedCompose<F, typename IDatabase::Action_Compose_Insert>( "insert", "", f );
+  }
+
+  template<class F>
+  typename QueryFields<F>::pQueryFields_t CachedUpdate( const std::string& sWhere, const F& f ) {
+    return CachedCompose<F, typename IDatabase::Action_Compose_Update>( "update", sWhere, f );
+  }
+
+  template<class F>
+  typename QueryFields<F>::pQueryFields_t CachedDelete( const std::string& sWhere, const F& f ) {
+    return CachedCompose<F, typename IDatabase::Action_Compose_Delete>( "delete", sWhere, f );
+  }
+
+  // begin on construction, commit with Commit() or at the end of scope, rollback when the scope exits by exception
+  //   scopes nest, only the outermost one issues begin and commit, a rollback anywhere rolls back the whole
+  //   the connection has one transaction, so other threads' scopes wait for the outermost one to finish
+  //   so don't Flush a WriteBehind from inside one, its writer would be waiting on this scope
+  class Transaction {
+  public:
+    explicit Transaction( session_t& session )
+    : m_session( session ), m_bOpen( false ), m_nUncaught( std::uncaught_exceptions() )
+    {
+      std::unique_lock<std::recursive_mutex> lock( m_session.m_mutexTransaction );
+      if ( 0 == m_session.m_nTransactionDepth ) {
+        m_session.ExecuteControl( "begin transaction" );
+        m_session.m_bRollback = false;
+      }
+      m_session.m_nTransactionDepth++;
+      m_bOpen = true;
+      lock.release(); // held until End
+    }
+    ~Transaction() {
+      try {
+        End( std::uncaught_exceptions() == m_nUncaught );
+      }
+      catch ( const std::exception& e ) {
+        std::string sError( "Transaction::~Transaction: " );
+        sError += e.what();
+        std::operator<<( std::cout, sError ) << std::endl; // qualified, ou::operator<< is a catch-all
+      }
+    }
+    void Commit() { End( true ); }
+    void Rollback() { End( false ); }
+  private:
+    session_t& m_session;
+    bool m_bOpen;
+    int m_nUncaught;
+    void End( bool bCommit ) {
+      if ( m_bOpen ) {
+        m_bOpen = false;
+        std::unique_lock<std::recursive_mutex> lock( m_session.m_mutexTransaction, std::adopt_lock );
+        if ( !bCommit ) m_session.m_bRollback = true;
+        m_session.m_nTransactionDepth--;
+        if ( 0 == m_session.m_nTransactionDepth ) {
+          if ( m_session.m_bRollback ) {
+            m_session.ExecuteControl( "rollback transaction" );
+          }
+          else {
+            try {
+              m_session.ExecuteControl( "commit transaction" );
+            }
+            catch ( ... ) {
+              m_session.ExecuteControl( "rollback transaction" );
+              throw;
+            }
+          }
+        }
+      }
+    }
+  };
+
   template<class F> // T: Table Class with TableDef member function
   QueryState<typename IDatabase::structStatementState, F, session_t>& RegisterTable( const std::string& sTableName ) {
 
@@ -417,6 +514,64 @@ public:
 
 protected:
 
+  struct CachedBase {
+    virtual ~CachedBase() {}
+  };
+
+  template<class F>
+  struct CachedQuery: public CachedBase {
+    F f; // the prepared statement binds from this copy
+    typename QueryFields<F>::pQueryFields_t pQuery;
+    explicit CachedQuery( const F& f_ ): f( f_ ) {}
+  };
+
+  template<class F>
+  CachedQuery<F>& LocateCached( const std::string& sKey, const F& f ) {
+    keyCached_t key( std::this_thread::get_id(), typeid( F ).name(), sKey );
+    std::unique_lock<std::mutex> lock( m_mutexCached );
+    typename mapCached_t::iterator iter = m_mapCached.find( key );
+    if ( m_mapCached.end() == iter ) {
+      iter = m_mapCached.emplace( key, std::make_unique<CachedQuery<F> >( f ) ).first;
+      return *static_cast<CachedQuery<F>*>( iter->second.get() );
+    }
+    lock.unlock(); // the entry belongs to this thread
+    CachedQuery<F>& cached( *static_cast<CachedQuery<F>*>( iter->second.get() ) );
+    cached.f = f;
+    return cached;
+  }
+
+  template<class F>
+  typename QueryFields<F>::pQueryFields_t Rebind( CachedQuery<F>& cached ) {
+    Reset( cached.pQuery );
+    Bind<F>( cached.pQuery );
+    return cached.pQuery;
+  }
+
+  template<class F, class Action>
+  typename QueryFields<F>::pQueryFields_t CachedCompose( const std::string& sAction, const std::string& sWhere, const F& f ) {
+    CachedQuery<F>& cached( LocateCached<F>( sAction + " " + sWhere, f ) );
+    if ( !cached.pQuery ) {
+      if ( sWhere.empty() ) {
+        cached.pQuery = ComposeSql<F, Action>( cached.f ).NoExecute();
+      }
+      else {
+        cached.pQuery = ComposeSql<F, Action>( cached.f ).Where( sWhere ).NoExecute();
+      }
+    }
+    return Rebind<F>( cached );
+  }
+
+  void ExecuteControl( const std::string& sSql ) { // begin, commit, rollback
+    typename QueryFields<NoBind>::pQueryFields_t pQuery( Cached<NoBind>( sSql, NoBind() ) );
+    Execute( pQuery );
+    Reset( pQuery );
+  }
+
+  void ClearCached() {
+    std::lock_guard<std::mutex> lock( m_mutexCached );
+    m_mapCached.clear();
+  }
+
   template<class F>
   const std::string& GetTableName() {
     std::string t( typeid( F ).name() );
@@ -460,11 +615,20 @@ private:
   typedef std::pair<std::string, std::string> mapFieldsToTable_pair_t;
   mapFieldsToTable_t m_mapFieldsToTable;
 
+  using keyCached_t = std::tuple<std::thread::id, std::string, std::string>; // thread, field type, query text
+  using mapCached_t = std::map<keyCached_t, std::unique_ptr<CachedBase> >;
+  mapCached_t m_mapCached;
+  std::mutex m_mutexCached; // guards the map, entries are used only by their own thread
+
+  std::recursive_mutex m_mutexTransaction; // held by the thread with an open Transaction
+  size_t m_nTransactionDepth;
+  bool m_bRollback;
+
 };
 
 // Constructor
 template<class IDatabase>
-SessionImpl<IDatabase>::SessionImpl(): m_bOpened( false ) {
+SessionImpl<IDatabase>::SessionImpl(): m_bOpened( false ), m_nTransactionDepth( 0 ), m_bRollback( false ) {
 }
 
 // Destructor
@@ -491,6 +655,7 @@ template<class IDatabase>
 void SessionImpl<IDatabase>::ImplClose() {
   if ( m_bOpened ) {
     m_bOpened = false;
+    ClearCached(); // cached statements are finalized prior to close
     m_db.SessionClose();
     // 2013/08/26 process memory doesn't appear to be relaimed after this
     //   trying again with addition of reset();
@@ -500,10 +665,11 @@ void SessionImpl<IDatabase>::ImplClose() {
 // CreateTables
 template<class IDatabase>
 void SessionImpl<IDatabase>::CreateTables() {
-  // todo: need to add a transaction around this set of instructions
+  Transaction transaction( *this );
   for ( mapTableDefs_iter_t iter = m_mapTableDefs.begin(); m_mapTableDefs.end() != iter; ++iter ) {
     Execute( iter->second );
   }
+  transaction.Commit();
   m_mapTableDefs.clear();
 }
 
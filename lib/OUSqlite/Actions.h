@@ -135,7 +135,7 @@ public:
   template<typename T>
   void Field( const std::string& sFieldName, T& var, const std::string& sFieldType = "" ) {
     ++m_index;
-    int rtn = Bind( var );
+    int rtn = Bind( var, boost::is_enum<T>() );
     if ( SQLITE_OK != rtn ) {
       std::string sErr( "Action_Bind_Values::Field::Bind: (" );
       sErr += boost::lexical_cast<std::string>( rtn );
@@ -144,6 +144,16 @@ public:
     }
   }
 
+  template<typename T, bool b> // is not enum
+  int Bind( const T& var, const boost::integral_constant<bool, b>& ) {
+    return Bind( var );
+  }
+
+  template<typename T>  // is enum, scoped ones don't convert implicitly
+  int Bind( const T& var, const boost::true_type& ) {
+    return Bind( static_cast<typename typeselect::chooser<sizeof(T),boost::is_signed<T>::value>::type>( var ) );
+  }
+
   void Key( const std::string& sFieldName ) { assert( false ); };  // kludge to provide for SessionImpl::QueryState::ProcessInQueryState::Bind
   void Constraint( const std::string& sFieldName, const std::string& sTableName, const std::string& sField2Name ) {
     assert( false ); };  // kludge to provide for SessionImpl::QueryState::ProcessInQueryState::Bind
@@ -13,16 +13,19 @@
  ************************************************************************/
 
 #include "Session.h"
+#include "WriteBehind.h"
 
 namespace ou {
 namespace db {
 
 Session::Session()
   : SessionImpl<ISqlite3>(),
-    SessionBase<SessionImpl<ISqlite3>, Session>() {
+    SessionBase<SessionImpl<ISqlite3>, Session>(),
+    m_pJournal( std::make_unique<WriteBehind>( *this ) ) {
 }
 
 Session::~Session() {
+  Close();  // while the journal and the delegates still exist
 }
 
 void Session::InitializeManagers() {
@@ -47,6 +50,7 @@ void Session::LoadTables() {
 
 void Session::DenitializeManagers() {
   OnDenitializeManagers( *this );
+  m_pJournal->Close();  // pending writes committed prior to ImplClose
 }
 
 } // db
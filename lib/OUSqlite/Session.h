@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <memory>
+
 #include <OUCommon/Delegate.h>
 
 #include <OUSQL/SessionImpl.h>
@@ -30,6 +32,8 @@
 namespace ou {
 namespace db {
 
+class WriteBehind;
+
 // this is an example of how to integrate everything together for session management.
 
 class Session:
@@ -56,8 +60,11 @@ public:
   void LoadTables();      // called by inherited SessionBase.h
   void DenitializeManagers();  // called by inherieted SessionBase.h
 
+  WriteBehind& Journal() { return *m_pJournal; }  // shared by the managers for their updates, see WriteBehind.h
+
 protected:
 private:
+  std::unique_ptr<WriteBehind> m_pJournal;
 };
 
 
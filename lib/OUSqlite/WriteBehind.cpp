@@ -0,0 +1,193 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    WriteBehind.cpp
+ * Author:  raymond@burkholder.net
+ * Project: OUSqlite
+ * Created: October 19, 2026 16:20 PM
+ */
+
+#include <iostream>
+#include <algorithm>
+
+#include "WriteBehind.h"
+
+namespace ou {
+namespace db {
+
+WriteBehind::WriteBehind( Session& session )
+: m_session( session )
+, m_eDurability( EDurability::Batched )
+, m_idWriter( std::thread::id() )
+, m_bStop( false )
+{}
+
+WriteBehind::~WriteBehind( void ) {
+  Close();
+}
+
+WriteBehind::LockWriter::LockWriter( WriteBehind& wb )
+: m_wb( wb ), m_lock( wb.m_mutexWriter, std::defer_lock )
+{
+  if ( !m_wb.Writing() ) {
+    m_lock.lock();
+    m_wb.m_idWriter.store( std::this_thread::get_id(), std::memory_order_release );
+  }
+}
+
+WriteBehind::LockWriter::~LockWriter( void ) {
+  if ( m_lock.owns_lock() ) {
+    m_wb.m_idWriter.store( std::thread::id(), std::memory_order_release );
+  }
+}
+
+void WriteBehind::Set( EDurability eDurability ) {
+  if ( ( EDurability::Batched == m_eDurability.load( std::memory_order_acquire ) ) && ( EDurability::Synchronous == eDurability ) ) {
+    Stop();
+  }
+  m_eDurability.store( eDurability, std::memory_order_release );
+}
+
+void WriteBehind::Post( fWrite_t&& fWrite ) {
+
+  if ( EDurability::Synchronous == m_eDurability.load( std::memory_order_acquire ) ) {
+    vWrite_t vWrite;
+    vWrite.emplace_back( std::move( fWrite ) );
+    Commit( vWrite );
+    std::lock_guard<std::mutex> lock( m_mutex );
+    m_stats.nPosted++;
+    m_stats.nCommitted++;
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    if ( !m_pThread ) {
+      Start();
+    }
+    m_vPending.emplace_back( std::move( fWrite ) );
+    m_stats.nPosted++;
+  }
+  m_cvPending.notify_one();
+}
+
+void WriteBehind::Start( void ) { // m_mutex is held
+  m_bStop = false;
+  m_pThread = std::make_unique<std::thread>( [this](){ Writer(); } );
+}
+
+void WriteBehind::Stop( void ) {
+  {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    if ( !m_pThread ) return;
+    m_bStop = true;
+  }
+  m_cvPending.notify_one();
+  m_pThread->join(); // the writer drains the queue before returning
+  std::lock_guard<std::mutex> lock( m_mutex );
+  m_pThread.reset();
+  m_bStop = false;
+}
+
+void WriteBehind::Writer( void ) {
+
+  vWrite_t vBatch;
+
+  std::unique_lock<std::mutex> lock( m_mutex );
+  while ( true ) {
+    m_cvPending.wait( lock, [this](){ return m_bStop || !m_vPending.empty(); } );
+    if ( m_vPending.empty() ) break; // stopped and drained
+    vBatch.swap( m_vPending ); // producers continue into the emptied vector
+    lock.unlock();
+
+    Commit( vBatch );
+
+    lock.lock();
+    m_stats.nCommitted += vBatch.size();
+    m_stats.nBatches++;
+    m_stats.nLargestBatch = std::max( m_stats.nLargestBatch, vBatch.size() );
+    vBatch.clear();
+    m_cvCommitted.notify_all();
+  }
+}
+
+void WriteBehind::Commit( vWrite_t& vWrite ) {
+
+  LockWriter lockWriter( *this );
+
+  size_t nErrors {};
+
+  std::unique_ptr<Session::Transaction> pTransaction;
+  if ( 1 < vWrite.size() ) { // a single record uses the implicit transaction
+    try {
+      pTransaction = std::make_unique<Session::Transaction>( m_session );
+    }
+    catch ( const std::exception& e ) {
+      std::cout << "WriteBehind::Commit begin: " << e.what() << std::endl;
+      nErrors++;
+    }
+  }
+
+  for ( fWrite_t& fWrite: vWrite ) {
+    try {
+      fWrite( m_session );
+    }
+    catch ( const std::exception& e ) {
+      std::cout << "WriteBehind::Commit record: " << e.what() << std::endl;
+      nErrors++;
+    }
+  }
+
+  try {
+    if ( pTransaction ) {
+      pTransaction->Commit(); // a failed record is logged, the others are kept
+    }
+  }
+  catch ( const std::exception& e ) {
+    std::cout << "WriteBehind::Commit commit: " << e.what() << std::endl;
+    nErrors++;
+  }
+
+  if ( 0 < nErrors ) {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    m_stats.nErrors += nErrors;
+  }
+}
+
+void WriteBehind::Flush( void ) {
+  std::unique_lock<std::mutex> lock( m_mutex );
+  const size_t nTarget( m_stats.nPosted );
+  m_cvCommitted.wait( lock, [this,nTarget](){ return nTarget <= m_stats.nCommitted; } );
+}
+
+void WriteBehind::Exclusive( const fWrite_t& fWrite ) {
+  if ( !Writing() ) {
+    Flush(); // from within a record, the flush would wait on the batch in progress
+  }
+  LockWriter lockWriter( *this );
+  fWrite( m_session );
+}
+
+void WriteBehind::Close( void ) {
+  Stop();
+}
+
+WriteBehind::Stats WriteBehind::GetStats( void ) const {
+  std::lock_guard<std::mutex> lock( m_mutex );
+  return m_stats;
+}
+
+} // db
+} // ou
@@ -0,0 +1,146 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    WriteBehind.h
+ * Author:  raymond@burkholder.net
+ * Project: OUSqlite
+ * Created: October 19, 2026 16:20 PM
+ */
+
+#pragma once
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <memory>
+#include <string>
+#include <vector>
+#include <functional>
+#include <condition_variable>
+
+#include "Session.h"
+
+namespace ou {
+namespace db {
+
+// write journal for a Session, so trading paths don't wait on the disk
+//   Batched: writes are queued, a writer thread commits whatever has accumulated as one transaction
+//   Synchronous: writes execute on the caller, each in its own implicit transaction, as before
+// statements come from the session's cache, so are prepared once per sql text and re-bound for each record
+// records are copied in, so the caller's structures may change as soon as Post returns
+// records are written in the order posted, across all managers sharing the session
+// statements run directly on the session go through Exclusive, so they never land in an open batch
+// a Synchronous Post, or an Exclusive, issued from within an Exclusive or a record runs inline on that thread
+// Batched trades durability for latency: records not yet committed are lost on a crash
+
+class WriteBehind {
+public:
+
+  enum class EDurability { Synchronous, Batched };
+
+  using fWrite_t = std::function<void( Session& )>;
+
+  struct Stats {
+    size_t nPosted;
+    size_t nCommitted;
+    size_t nBatches;
+    size_t nLargestBatch;
+    size_t nErrors;
+    Stats(): nPosted {}, nCommitted {}, nBatches {}, nLargestBatch {}, nErrors {} {}
+  };
+
+  WriteBehind( Session& );
+  ~WriteBehind( void );  // flushes
+
+  void Set( EDurability );  // flushes first when leaving Batched
+  EDurability Durability( void ) const { return m_eDurability.load( std::memory_order_acquire ); }
+
+  void Post( fWrite_t&& );
+
+  // F: struct with Fields, sWhere may be empty
+  template<class F>
+  void Post( const std::string& sSql, const std::string& sWhere, const F& );
+
+  template<class F>
+  void Insert( const F& );
+
+  void Flush( void );  // returns once everything posted so far has been committed
+  void Exclusive( const fWrite_t& );  // flush, then run on the caller with the writer held off, for GetLastRowId and direct statements
+  void Close( void );  // flush and stop the writer, prior to closing the session
+
+  Stats GetStats( void ) const;
+
+protected:
+private:
+
+  using vWrite_t = std::vector<fWrite_t>;
+
+  Session& m_session;
+
+  std::atomic<EDurability> m_eDurability; // Set on one thread, read by Post on others
+
+  mutable std::mutex m_mutex;  // guards the pending queue and the stats
+  std::condition_variable m_cvPending;
+  std::condition_variable m_cvCommitted;
+  vWrite_t m_vPending;
+
+  std::mutex m_mutexWriter;  // held while a batch, or an Exclusive, is using the session
+  std::atomic<std::thread::id> m_idWriter;  // the thread holding m_mutexWriter
+
+  // holds m_mutexWriter, unless this thread already does, in which case the write is a re-entry
+  class LockWriter {
+  public:
+    LockWriter( WriteBehind& );
+    ~LockWriter( void );
+  private:
+    WriteBehind& m_wb;
+    std::unique_lock<std::mutex> m_lock;
+  };
+
+  bool Writing( void ) const { return std::this_thread::get_id() == m_idWriter.load( std::memory_order_acquire ); }
+
+  std::unique_ptr<std::thread> m_pThread;
+  bool m_bStop;
+
+  Stats m_stats;
+
+  void Start( void );
+  void Stop( void );
+  void Writer( void );
+  void Commit( vWrite_t& );
+
+};
+
+template<class F>
+void WriteBehind::Post( const std::string& sSql, const std::string& sWhere, const F& f ) {
+  std::string sQuery( sWhere.empty() ? sSql : sSql + " WHERE " + sWhere );
+  Post( [sQuery,f]( Session& session ){
+    typename QueryFields<F>::pQueryFields_t pQuery( session.Cached<F>( sQuery, f ) );
+    session.Execute( pQuery );
+    session.Reset( pQuery );  // left idle, so the batch can commit
+  } );
+}
+
+template<class F>
+void WriteBehind::Insert( const F& f ) {
+  Post( [f]( Session& session ){
+    typename QueryFields<F>::pQueryFields_t pQuery( session.CachedInsert<F>( f ) );
+    session.Execute( pQuery );
+    session.Reset( pQuery );
+  } );
+}
+
+} // db
+} // ou
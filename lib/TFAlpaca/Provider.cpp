@@ -288,25 +288,25 @@ void Provider::TradeUpdates() {
       m_bConnected = true;
       ProviderInterfaceBase::OnConnected( 0 );
     },
-    [this]( std::string&& sMessage){ // fMessage_t
-      //std::cout << "order update message: " << sMessage << std::endl;
+    [this]( std::string_view svMessage ){ // fMessage_t
+      //std::cout << "order update message: " << svMessage << std::endl;
+      unsigned char buffer[ 4096 ]; // updates are small, so the dom usually lives on the stack
+      json::monotonic_resource mr( buffer, sizeof( buffer ) );
       json::error_code jec;
-      json::value jv = json::parse( sMessage, jec );
+      json::value jv = json::parse( svMessage, jec, &mr );
       if ( jec.failed() ) {
-        BOOST_LOG_TRIVIAL(error) << "provider/alpaca failed to parse web_socket stream: " << sMessage;
+        BOOST_LOG_TRIVIAL(error) << "provider/alpaca failed to parse web_socket stream: " << svMessage;
       }
       else {
 
         // TODO: encase in try/catch
 
-        struct Stream {
-          std::string sType;
-          json::object object;
-        } stream;
-
         json::object const& obj = jv.as_object();
-        extract( obj, stream.sType, "stream" );
-        extract( obj, stream.object, "data" );
+
+        struct Stream {
+          json::string_view sType;
+          json::object const& object; // refers into jv, rather than a copy
+        } stream { obj.at( "stream" ).as_string(), obj.at( "data" ).as_object() };
 
         // todo use kvm or spirit to parse
         bool bFound( false );
@@ -349,7 +349,7 @@ void Provider::TradeUpdates() {
           TradeUpdate( stream.object );
         }
         if ( !bFound ) {
-          BOOST_LOG_TRIVIAL(warning) << "provider/alpaca unknown order update message: " << sMessage << std::endl;
+          BOOST_LOG_TRIVIAL(warning) << "provider/alpaca unknown order update message: " << svMessage << std::endl;
         }
       }
     }
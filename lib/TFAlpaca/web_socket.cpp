@@ -255,13 +255,14 @@ void web_socket::on_read_auth(
     // The make_printable() function helps print a ConstBufferSequence
     //std::cout << "ws.on_read_auth: " << beast::make_printable( m_buffer.data() ) << std::endl;
 
-    std::string sMessage( beast::buffers_to_string( m_buffer.data() ) );
-    //std::cout << "ws.on_read_auth: " << sMessage << std::endl;
+    const auto buffer( m_buffer.data() ); // flat_buffer is contiguous, so no copy needed
+    std::string_view svMessage( static_cast<const char*>( buffer.data() ), buffer.size() );
+    //std::cout << "ws.on_read_auth: " << svMessage << std::endl;
 
     m_bConnected = true;
 
     if ( m_fConnected ) m_fConnected( true );
-    if ( m_fMessage ) m_fMessage( std::move( sMessage ) );
+    if ( m_fMessage ) m_fMessage( svMessage );
     m_buffer.clear();
 
     // wait for more reads
@@ -336,10 +337,11 @@ void web_socket::on_read_listen(
     // The make_printable() function helps print a ConstBufferSequence
     //std::cout << "ws.on_read_listen: " << beast::make_printable( m_buffer.data() ) << std::endl;
 
-    std::string sMessage( beast::buffers_to_string( m_buffer.data() ) );
-    //std::cout << "ws.on_read_listen: " << sMessage << std::endl;
+    const auto buffer( m_buffer.data() ); // flat_buffer is contiguous, so no copy needed
+    std::string_view svMessage( static_cast<const char*>( buffer.data() ), buffer.size() );
+    //std::cout << "ws.on_read_listen: " << svMessage << std::endl;
 
-    if ( m_fMessage ) m_fMessage( std::move( sMessage ) );
+    if ( m_fMessage ) m_fMessage( svMessage );
     m_buffer.clear();
 
     if ( m_bConnected ) {
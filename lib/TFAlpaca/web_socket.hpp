@@ -23,6 +23,7 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 #include <functional>
 
 #include <boost/beast/ssl.hpp>
@@ -55,7 +56,7 @@ public:
   ~web_socket();
 
   using fConnected_t = std::function<void(bool)>;
-  using fMessage_t = std::function<void(std::string&&)>;
+  using fMessage_t = std::function<void(std::string_view)>; // view into the read buffer, valid for the call only
 
   // Start the asynchronous operation
   void connect(
@@ -0,0 +1,269 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    BarScreener.h
+ * Author:  raymond@burkholder.net
+ * Project: TFBitsNPieces
+ * Created: October 19, 2026 23:10 PM
+ */
+
+#pragma once
+
+// ranks a universe of daily bar series against several criteria in one scan
+//   series are loaded once, by InstrumentScanner's reader thread
+//   for each symbol, on a pool thread:
+//     fCandidate builds the Info (or declines the symbol),
+//     then each criterion, in the order added, may score it, and may fill in its Info
+//   each pool thread keeps its own bounded heap per criterion, so scoring takes no locks,
+//   the heaps are merged when the scan completes
+// a ranking is best first, equal scores by symbol name, so is independent of thread timing
+// fCandidate and the criteria run concurrently for different symbols,
+//   they may read shared state, but should write only to the Info
+
+#include <mutex>
+#include <memory>
+#include <string>
+#include <vector>
+#include <utility>
+#include <iostream>
+#include <algorithm>
+#include <functional>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include <TFTimeSeries/TimeSeries.h>
+
+#include "InstrumentScanner.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+template<typename Info> // per symbol record, held by the rankings
+class BarScreener {
+public:
+
+  using pInfo_t = std::unique_ptr<Info>;
+  using pInfoConst_t = std::shared_ptr<const Info>;
+
+  // nullptr declines the symbol
+  using fCandidate_t = std::function<pInfo_t (const std::string& sPath, const std::string& sName, const ou::tf::Bars&)>;
+  // false: not ranked by this criterion
+  using fScore_t = std::function<bool (const ou::tf::Bars&, Info&, double& dblScore)>;
+
+  enum class EOrder { Largest, Smallest }; // which scores are kept
+
+  struct Criterion {
+    std::string sName;
+    EOrder order;
+    size_t nTop; // 0: keep every symbol scored
+    fScore_t fScore;
+    Criterion( const std::string& sName_, EOrder order_, size_t nTop_, fScore_t&& fScore_ )
+    : sName( sName_ ), order( order_ ), nTop( nTop_ ), fScore( std::move( fScore_ ) ) {}
+  };
+
+  using idCriterion_t = size_t;
+
+  struct Ranked {
+    double dblScore;
+    std::string sName;
+    pInfoConst_t pInfo; // shared amongst the criteria which ranked the symbol
+    Ranked( double dblScore_, const std::string& sName_, const pInfoConst_t& pInfo_ )
+    : dblScore( dblScore_ ), sName( sName_ ), pInfo( pInfo_ ) {}
+  };
+  using vRanked_t = std::vector<Ranked>;
+
+  struct Stats {
+    size_t nCandidates;
+    std::vector<size_t> vScored; // by criterion
+    Stats(): nCandidates {} {}
+  };
+
+  BarScreener( fCandidate_t&& fCandidate )
+  : m_fCandidate( std::move( fCandidate ) ), m_nRun {} {}
+
+  idCriterion_t Add( Criterion&& criterion ) { // before Run
+    m_vCriterion.emplace_back( std::move( criterion ) );
+    return m_vCriterion.size() - 1;
+  }
+
+  // blocks until the universe is scanned, rankings are then available
+  void Run(
+    const std::string& sPath, // eg "/bar/86400/"
+    boost::posix_time::ptime dtBegin, boost::posix_time::ptime dtEnd,
+    ou::tf::Bars::size_type nRequiredBars,
+    size_t nThreads = 0 // 0: one per hardware thread
+    );
+
+  const vRanked_t& Ranking( idCriterion_t id ) const { return m_vRanking.at( id ); }
+  const Criterion& GetCriterion( idCriterion_t id ) const { return m_vCriterion.at( id ); }
+  const Stats& GetStats() const { return m_stats; }
+
+protected:
+private:
+
+  struct Shard { // one per pool thread
+    size_t nCandidates;
+    std::vector<vRanked_t> vHeap; // by criterion
+    std::vector<size_t> vScored;
+    Shard( size_t nCriteria ): nCandidates {}, vHeap( nCriteria ), vScored( nCriteria ) {}
+  };
+  using pShard_t = std::unique_ptr<Shard>;
+
+  struct s_t {}; // InstrumentScanner per symbol state, unused
+  using scanner_t = ou::tf::InstrumentScanner<s_t,ou::tf::Bars>;
+
+  fCandidate_t m_fCandidate;
+  std::vector<Criterion> m_vCriterion;
+
+  size_t m_nRun; // distinguishes the pool threads of one Run from another
+  std::mutex m_mutexShard;
+  std::vector<pShard_t> m_vShard;
+
+  std::vector<vRanked_t> m_vRanking;
+  Stats m_stats;
+
+  bool Better( const Criterion& criterion, const Ranked& lhs, const Ranked& rhs ) const {
+    if ( lhs.dblScore != rhs.dblScore ) {
+      return ( EOrder::Largest == criterion.order ) ? ( lhs.dblScore > rhs.dblScore ) : ( lhs.dblScore < rhs.dblScore );
+    }
+    return lhs.sName < rhs.sName;
+  }
+
+  Shard& Local();
+  bool Screen( const std::string& sPath, const std::string& sName, const ou::tf::Bars& );
+  void Merge();
+};
+
+template<typename Info>
+void BarScreener<Info>::Run(
+  const std::string& sPath,
+  boost::posix_time::ptime dtBegin, boost::posix_time::ptime dtEnd,
+  ou::tf::Bars::size_type nRequiredBars,
+  size_t nThreads
+) {
+
+  m_nRun++;
+  m_vShard.clear();
+  m_vRanking.clear();
+  m_stats = Stats();
+
+  s_t s;
+  scanner_t scanner(
+    sPath, dtBegin, dtEnd, nRequiredBars, s,
+    []( s_t&, const std::string&, const std::string& )->bool{ // Use Group
+      return true;
+    },
+    nullptr, // Filter, replaced below
+    []( s_t&, const std::string&, const std::string&, const ou::tf::Bars& ){ // Result, already ranked
+    },
+    nThreads
+    );
+  scanner.SetFilterWithPath(
+    [this]( s_t&, const std::string& sObjectPath, const std::string& sName, const ou::tf::Bars& bars )->bool{ // on a pool thread
+      return Screen( sObjectPath, sName, bars );
+    } );
+  scanner.Run();
+
+  Merge();
+
+  std::cout << "BarScreener " << sPath << ": " << m_stats.nCandidates << " candidates";
+  for ( idCriterion_t id = 0; id < m_vCriterion.size(); id++ ) {
+    std::cout << ", " << m_vCriterion[ id ].sName << " " << m_stats.vScored[ id ] << " scored";
+  }
+  std::cout << std::endl;
+}
+
+template<typename Info>
+typename BarScreener<Info>::Shard& BarScreener<Info>::Local() {
+  static thread_local std::pair<std::pair<const BarScreener*,size_t>,Shard*> cache( { nullptr, 0 }, nullptr );
+  const std::pair<const BarScreener*,size_t> key( this, m_nRun );
+  if ( key != cache.first ) {
+    std::lock_guard<std::mutex> lock( m_mutexShard );
+    m_vShard.emplace_back( std::make_unique<Shard>( m_vCriterion.size() ) );
+    cache.first = key;
+    cache.second = m_vShard.back().get();
+  }
+  return *cache.second;
+}
+
+template<typename Info>
+bool BarScreener<Info>::Screen( const std::string& sPath, const std::string& sName, const ou::tf::Bars& bars ) {
+
+  pInfo_t pInfo( m_fCandidate( sPath, sName, bars ) );
+  if ( !pInfo ) return false;
+
+  Shard& shard( Local() );
+  shard.nCandidates++;
+
+  std::vector<std::pair<idCriterion_t,double> > vScore; // ranked once every criterion has had its say
+  for ( idCriterion_t id = 0; id < m_vCriterion.size(); id++ ) {
+    double dblScore {};
+    if ( m_vCriterion[ id ].fScore( bars, *pInfo, dblScore ) ) {
+      vScore.emplace_back( id, dblScore );
+    }
+  }
+  if ( vScore.empty() ) return false;
+
+  pInfoConst_t pShared( std::move( pInfo ) );
+  for ( const auto& score: vScore ) {
+    const Criterion& criterion( m_vCriterion[ score.first ] );
+    vRanked_t& heap( shard.vHeap[ score.first ] );
+    shard.vScored[ score.first ]++;
+    // a heap with the weakest kept symbol at the front
+    auto compare = [this,&criterion]( const Ranked& lhs, const Ranked& rhs ){ return Better( criterion, lhs, rhs ); };
+    Ranked ranked( score.second, sName, pShared );
+    if ( ( 0 == criterion.nTop ) || ( heap.size() < criterion.nTop ) ) {
+      heap.emplace_back( std::move( ranked ) );
+      if ( 0 != criterion.nTop ) std::push_heap( heap.begin(), heap.end(), compare );
+    }
+    else {
+      if ( Better( criterion, ranked, heap.front() ) ) {
+        std::pop_heap( heap.begin(), heap.end(), compare );
+        heap.back() = std::move( ranked );
+        std::push_heap( heap.begin(), heap.end(), compare );
+      }
+    }
+  }
+  return true;
+}
+
+template<typename Info>
+void BarScreener<Info>::Merge() {
+  m_stats.vScored.assign( m_vCriterion.size(), 0 );
+  m_vRanking.resize( m_vCriterion.size() );
+  for ( idCriterion_t id = 0; id < m_vCriterion.size(); id++ ) {
+    const Criterion& criterion( m_vCriterion[ id ] );
+    vRanked_t& ranking( m_vRanking[ id ] );
+    for ( pShard_t& pShard: m_vShard ) {
+      vRanked_t& heap( pShard->vHeap[ id ] );
+      std::move( heap.begin(), heap.end(), std::back_inserter( ranking ) );
+      heap.clear();
+      m_stats.vScored[ id ] += pShard->vScored[ id ];
+    }
+    std::sort(
+      ranking.begin(), ranking.end(),
+      [this,&criterion]( const Ranked& lhs, const Ranked& rhs ){ return Better( criterion, lhs, rhs ); } );
+    if ( ( 0 != criterion.nTop ) && ( criterion.nTop < ranking.size() ) ) {
+      ranking.erase( ranking.begin() + criterion.nTop, ranking.end() );
+    }
+  }
+  for ( pShard_t& pShard: m_vShard ) {
+    m_stats.nCandidates += pShard->nCandidates;
+  }
+  m_vShard.clear();
+}
+
+} // namespace tf
+} // namespace ou
@@ -16,72 +16,65 @@
 
 // Started 2012/10/14
 
-/*
+// Coding for writing to a sqlite database was originally stopped as it appeared to take about four to five hours
+// to update about a million records:  each insert was its own transaction.
+// 2026/10/19 rows are now written with the session's cached insert, nRowsPerTransaction to a transaction.
+// 2026/10/19 the file is parsed in parallel by MktSymbolIngest, rows are post processed before they are written.
 
-Coding for writing to a sqlite database was stopped as it appeared to take about four to five hours to update
-about a million records.
+#include <string>
+#include <algorithm>
 
-header file:
+#include <OUSqlite/Session.h>
 
-#include <TFTrading/DBOps.h>
-#include <TFIQFeed/ValidateMktSymbolLine.h>
+#include <TFIQFeed/MktSymbolIngest.h>
 
-  DBOps m_db;
-  trd_t m_trd;  // needs to be changed so that new structure can be used each time with prepared statement
-  ou::db::QueryFields<ou::tf::iqfeed::MarketSymbol::TableRowDef>::pQueryFields_t pInsertIQFeedSymbol;
+namespace ou { // One Unified
+namespace tf { // TradeFrame
 
-source file:
-#include <TFIQFeed/ParseMktSymbolDiskFile.h>
+class IQFeedSymbolFileToSqlite {
+public:
 
+  using trd_t = ou::tf::iqfeed::MarketSymbol::TableRowDef;
 
-  m_db.OnRegisterTables.Add( MakeDelegate( this, &AppCollectAndView::HandleRegisterTables ) );
-  m_db.OnRegisterRows.Add( MakeDelegate( this, &AppCollectAndView::HandleRegisterRows ) );
-  m_db.SetOnPopulateDatabaseHandler( MakeDelegate( this, &AppCollectAndView::HandlePopulateDatabase ) );
+  static const size_t nRowsPerTransaction = 10000;
 
-  m_db.Open( "cav.db" );
+  IQFeedSymbolFileToSqlite( ou::db::Session& session ): m_session( session ) {}
 
-  typedef ou::tf::iqfeed::ParseMktSymbolDiskFile diskfile_t;
-  diskfile_t diskfile;
-  ou::tf::iqfeed::ValidateMktSymbolLine validator;
-  diskfile.SetOnProcessLine( MakeDelegate( &validator, &ou::tf::iqfeed::ValidateMktSymbolLine::Parse<diskfile_t::iterator_t> ) );
-  validator.SetOnProcessLine( MakeDelegate( this, &AppCollectAndView::HandleParsedStructure ) );
-
-  pInsertIQFeedSymbol = m_db.Insert<ou::tf::iqfeed::MarketSymbol::TableRowDef>( m_trd ).NoExecute();
-
-  diskfile.Run();
-
-  validator.SetOnProcessHasOption( MakeDelegate( this, &AppCollectAndView::HandleUpdateHasOption ) );
-  validator.PostProcess();
-  validator.Summary();
-
-
-void AppCollectAndView::HandleParsedStructure( trd_t& trd ) {
-  m_trd = trd;
-  int i;
-  if ( "A" == trd.sSymbol ) {
-    i = 0;
+  // for the session's OnRegisterTables, OnRegisterRows
+  static void RegisterTable( ou::db::Session& session, const std::string& sTableName = "iqfeedsymbols" ) {
+    session.RegisterTable<ou::tf::iqfeed::MarketSymbol::TableCreateDef>( sTableName );
+  }
+  static void RegisterRow( ou::db::Session& session, const std::string& sTableName = "iqfeedsymbols" ) {
+    session.MapRowDefToTableName<trd_t>( sTableName );
   }
-  m_db.Reset( pInsertIQFeedSymbol );
-  m_db.Bind<ou::tf::iqfeed::MarketSymbol::TableRowDef>( pInsertIQFeedSymbol );
-  m_db.Execute( pInsertIQFeedSymbol );
-//  ou::db::QueryFields<ou::tf::iqfeed::MarketSymbol::TableRowDef>::pQueryFields_t pInsertIQFeedSymbol 
-//    = m_db.Insert<ou::tf::iqfeed::MarketSymbol::TableRowDef>( trd );
-}
-
-void AppCollectAndView::HandleUpdateHasOption( const std::string& ) {
-}
-
-void AppCollectAndView::HandleRegisterTables(  ou::db::Session& session ) {
-  session.RegisterTable<ou::tf::iqfeed::MarketSymbol::TableCreateDef>( "iqfeedsymbols" );
-}
-
-void AppCollectAndView::HandleRegisterRows(  ou::db::Session& session ) {
-  session.MapRowDefToTableName<ou::tf::iqfeed::MarketSymbol::TableRowDef>( "iqfeedsymbols" );
-}
-
 
+  size_t Load( const std::string& sFileName ) { // "mktsymbols_v2.txt", returns rows written
+
+    ou::tf::iqfeed::MktSymbolIngest ingest;
+    ingest.Run( sFileName );
+    ingest.Summary();
+
+    const ou::tf::iqfeed::MktSymbolIngest::vRow_t& vRow( ingest.Rows() );
+    size_t nRows {};
+    while ( nRows < vRow.size() ) {
+      ou::db::Session::Transaction transaction( m_session );
+      const size_t nEnd( std::min( vRow.size(), nRows + nRowsPerTransaction ) );
+      for ( ; nRows < nEnd; nRows++ ) {
+        ou::db::QueryFields<trd_t>::pQueryFields_t pInsert = m_session.CachedInsert<trd_t>( vRow[ nRows ] );
+        m_session.Execute( pInsert );
+      }
+      transaction.Commit();
+    }
+
+    return nRows;
+  }
 
+protected:
+private:
 
+  ou::db::Session& m_session;
 
-*/
+};
 
+} // namespace tf
+} // namespace ou
@@ -14,6 +14,10 @@
 
 #include "stdafx.h"
 
+#include <iostream>
+
+#include <TFIQFeed/MktSymbolSnapshot.h>
+
 #include "IQFeedSymbolListOps.h"
 
 namespace ou { // One Unified
@@ -53,6 +57,7 @@ void IQFeedSymbolListOps::WorkerObtainNewIQFeedSymbolListRemote( void ) {
   ou::tf::iqfeed::LoadMktSymbols( m_listIQFeedSymbols, ou::tf::iqfeed::MktSymbolLoadType::Download, true, iqfeed::detail::sFileNameMarketSymbolsText ); 
 	Status( "Saving Binary File ... " );
   m_listIQFeedSymbols.SaveToFile( iqfeed::detail::sFileNameMarketSymbolsBinary );
+  SaveSnapshot();
 	StatusDone();
 	Done( ccDone );
   m_fenceWorker.fetch_sub( 1, boost::memory_order_release );
@@ -73,6 +78,7 @@ void IQFeedSymbolListOps::WorkerObtainNewIQFeedSymbolListLocal( void ) {
   ou::tf::iqfeed::LoadMktSymbols( m_listIQFeedSymbols, ou::tf::iqfeed::MktSymbolLoadType::LoadTextFromDisk, false, iqfeed::detail::sFileNameMarketSymbolsText ); 
 	Status( "Saving Binary File ... " );
   m_listIQFeedSymbols.SaveToFile( iqfeed::detail::sFileNameMarketSymbolsBinary );
+  SaveSnapshot();
 	StatusDone();
 	Done( ccDone );
   m_fenceWorker.fetch_sub( 1, boost::memory_order_release );
@@ -89,13 +95,43 @@ void IQFeedSymbolListOps::LoadIQFeedSymbolList( void ) {
 }
 
 void IQFeedSymbolListOps::WorkerLoadIQFeedSymbolList( void ) {
-	Status( "Loading From Binary File ..." );
-  m_listIQFeedSymbols.LoadFromFile( iqfeed::detail::sFileNameMarketSymbolsBinary );
+  bool bLoaded( false );
+  try { // the snapshot skips archive parsing, the container is still built, from the mapped rows
+    ou::tf::iqfeed::MktSymbolSnapshot snapshot( iqfeed::detail::sFileNameMarketSymbolsSnapshot );
+    if ( snapshot.Current( iqfeed::detail::sFileNameMarketSymbolsBinary ) ) {
+      Status( "Loading From Snapshot ..." );
+      m_listIQFeedSymbols.Clear();
+      snapshot.Populate( m_listIQFeedSymbols );
+      bLoaded = true;
+    }
+    else {
+      std::cout << iqfeed::detail::sFileNameMarketSymbolsSnapshot << " is older than " << iqfeed::detail::sFileNameMarketSymbolsBinary << std::endl;
+    }
+  }
+  catch ( const std::runtime_error& e ) {
+    std::cout << e.what() << std::endl;
+  }
+  if ( !bLoaded ) {
+    Status( "Loading From Binary File ..." );
+    m_listIQFeedSymbols.LoadFromFile( iqfeed::detail::sFileNameMarketSymbolsBinary );
+    SaveSnapshot(); // faster next time
+  }
 	StatusDone();
 	Done( ccDone );
   m_fenceWorker.fetch_sub( 1, boost::memory_order_release );
 }
 
+void IQFeedSymbolListOps::SaveSnapshot( void ) {
+  Status( "Saving Snapshot ... " );
+  try {
+    ou::tf::iqfeed::MktSymbolSnapshot::Write(
+      m_listIQFeedSymbols, iqfeed::detail::sFileNameMarketSymbolsSnapshot, iqfeed::detail::sFileNameMarketSymbolsBinary );
+  }
+  catch ( const std::runtime_error& e ) {
+    std::cout << e.what() << std::endl;
+  }
+}
+
 void IQFeedSymbolListOps::SaveSymbolSubset( const std::string& sFileName, const ou::tf::iqfeed::InMemoryMktSymbolList& subset ) {
 	if ( 0 == m_fenceWorker.fetch_add( 1, boost::memory_order_acquire ) ) {
 	//  ou::tf::iqfeed::InMemoryMktSymbolList listIQFeedSymbols;
@@ -100,6 +100,8 @@ private:
   void WorkerObtainNewIQFeedSymbolListRemote();
   void WorkerObtainNewIQFeedSymbolListLocal();
   void WorkerLoadIQFeedSymbolList();
+
+  void SaveSnapshot();
 };
 
 } // namespace tf
@@ -0,0 +1,345 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    InstrumentScanner.h
+ * Author:  raymond@burkholder.net
+ * Project: TFBitsNPieces
+ * Created: October 19, 2026 14:20 PM
+ */
+
+#pragma once
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <iostream>
+#include <functional>
+#include <condition_variable>
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/thread/thread.hpp>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include <TFHDF5TimeSeries/HDF5DataManager.h>
+#include <TFHDF5TimeSeries/HDF5IterateGroups.h>
+#include <TFHDF5TimeSeries/HDF5TimeSeriesContainer.h>
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+// pipelined version of InstrumentFilter, for scanning a large universe
+//   1) group paths are enumerated once, on the calling thread
+//   2) a reader thread loads series, at most nPrefetch ahead of delivery
+//        (the hdf5 library is not thread safe, so reads are serialized on that one thread)
+//   3) the filter callback runs on a thread pool, each symbol with its own copy of S
+//   4) the result callback runs on the calling thread, in enumeration order,
+//        so output is deterministic regardless of thread timing
+// the filter callback must confine its writes to its S, the others are serial
+
+template<typename S, typename TS> // S=per symbol data structure, TS=time series type to be used
+class InstrumentScanner {
+public:
+
+  using cbUseGroup_t = std::function<bool (S&, const std::string&, const std::string&)>;  // use a particular group in HDF5
+  using cbFilter_t   = std::function<bool (S&, const std::string&, const TS&)>; // used for filtering on fields in the Time Series
+  using cbResult_t   = std::function<void (S&, const std::string&, const std::string&, const TS&)>;  // send the chosen filtered results back: structure, path, name, timeseries
+  using cbFilterPath_t = std::function<bool (S&, const std::string&, const std::string&, const TS&)>; // cbFilter_t, with the path: structure, path, name, timeseries
+
+  struct Stats {
+    size_t nEnumerated;
+    std::atomic<size_t> nRead; // progress, advanced by the pipeline
+    std::atomic<size_t> nFiltered;
+    size_t nEnteredFilter; // advanced in enumeration order, as results are delivered
+    size_t nPassedFilter;
+    size_t nDelivered;
+    double dblSymbolsPerSecond;
+    Stats(): nEnumerated {}, nRead {}, nFiltered {}, nEnteredFilter {}, nPassedFilter {}, nDelivered {}, dblSymbolsPerSecond {} {}
+  };
+
+  InstrumentScanner(
+    const std::string& sPath,
+    boost::posix_time::ptime dtBegin, boost::posix_time::ptime dtEnd,
+    typename TS::size_type nRequiredDays,
+    S&, // copied for each symbol, as found after cbUseGroup
+    cbUseGroup_t, cbFilter_t, cbResult_t,
+    size_t nThreads = 0, // 0: one per hardware thread
+    size_t nPrefetch = 256 // series held in memory ahead of delivery
+    );
+  ~InstrumentScanner( void );
+
+  void SetFilterWithPath( cbFilterPath_t&& cbFilter ) { m_cbFilterPath = std::move( cbFilter ); } // before Run, replaces cbFilter
+  void Run( void ); // blocks until all symbols are delivered
+
+  const Stats& GetStats( void ) const { return m_stats; }
+
+protected:
+private:
+
+  enum class EState { Pending, Skipped, Rejected, Accepted };
+
+  struct Item {
+    std::string sPath;
+    std::string sName;
+    S s;
+    TS ts;
+    EState state;
+    Item( const std::string& sPath_, const std::string& sName_, const S& s_ )
+    : sPath( sPath_ ), sName( sName_ ), s( s_ ), state( EState::Pending ) {}
+  };
+  using pItem_t = std::unique_ptr<Item>;
+  using vItem_t = std::vector<pItem_t>;
+  vItem_t m_vItem;
+
+  bool m_bSendThroughFilter;
+  S& m_struct;
+  typename TS::size_type m_nRequiredDays;
+  std::string m_sRootPath;
+  size_t m_nPrefetch;
+
+  boost::posix_time::ptime m_dtDate1;
+  boost::posix_time::ptime m_dtDate2;
+
+  cbUseGroup_t m_cbUseGroup;
+  cbFilter_t m_cbFilter;
+  cbFilterPath_t m_cbFilterPath;
+  cbResult_t m_cbResult;
+
+  Stats m_stats;
+
+  std::mutex m_mutex;
+  bool m_bStop; // reader leaves early, delivery has ended
+  std::condition_variable m_cvItemDone; // reader and pool to delivery
+  std::condition_variable m_cvDelivered; // delivery to reader, opens the prefetch window
+
+  boost::asio::io_context m_srvc;
+  boost::thread_group m_threads;
+  boost::asio::executor_work_guard<boost::asio::io_context::executor_type> m_srvcWork;
+
+  void HandleGroup( const std::string& sPath, const std::string& sObject );
+  void HandleObject( const std::string& sPath, const std::string& sObject );
+
+  void Read( void ); // reader thread
+  void Filter( Item& );
+  void Complete( Item&, EState );
+};
+
+template<typename S, typename TS>
+InstrumentScanner<S,TS>::InstrumentScanner(
+  const std::string& sPath, boost::posix_time::ptime dtBegin, boost::posix_time::ptime dtEnd,
+  typename TS::size_type nRequiredDays, S& struct_,
+  cbUseGroup_t cbUseGroup, cbFilter_t cbFilter, cbResult_t cbResult,
+  size_t nThreads, size_t nPrefetch )
+  : m_bSendThroughFilter( false ), m_struct( struct_ ),
+    m_nRequiredDays( nRequiredDays ), m_sRootPath( sPath ),
+    m_nPrefetch( std::max<size_t>( 1, nPrefetch ) ),
+    m_dtDate1( dtBegin ), m_dtDate2( dtEnd ),
+    m_cbUseGroup( cbUseGroup ), m_cbFilter( cbFilter ), m_cbResult( cbResult ),
+    m_bStop( false ),
+    m_srvcWork( boost::asio::make_work_guard( m_srvc ) )
+{
+  if ( dtBegin >= dtEnd ) {
+    throw std::runtime_error( "dtBegin >= dtEnd" );
+  }
+  if ( 0 == nThreads ) nThreads = std::max<size_t>( 1, boost::thread::hardware_concurrency() );
+  for ( size_t ix = 0; ix < nThreads; ix++ ) {
+    m_threads.create_thread( [this](){ m_srvc.run(); } );
+  }
+}
+
+template<typename S, typename TS>
+InstrumentScanner<S,TS>::~InstrumentScanner( void ) {
+  m_srvcWork.reset();
+  m_threads.join_all();
+}
+
+template<typename S, typename TS>
+void InstrumentScanner<S,TS>::Run( void ) {
+
+  namespace pt = boost::posix_time;
+
+  pt::ptime dtStart( pt::microsec_clock::universal_time() );
+
+  {
+    namespace ph = std::placeholders;
+    ou::tf::hdf5::IterateGroups ig(
+      m_sRootPath,
+      std::bind( &InstrumentScanner<S,TS>::HandleGroup, this, ph::_1, ph::_2 ),
+      std::bind( &InstrumentScanner<S,TS>::HandleObject, this, ph::_1, ph::_2 )
+      );
+  }
+  m_stats.nEnumerated = m_vItem.size();
+
+  std::cout
+    << "InstrumentScanner " << m_sRootPath << ": " << m_stats.nEnumerated << " symbols enumerated in "
+    << ( pt::microsec_clock::universal_time() - dtStart ) << std::endl;
+
+  // the reader is stopped and joined on every exit from the delivery loop, including by exception
+  struct Reader {
+    InstrumentScanner<S,TS>& scanner;
+    std::thread thread;
+    Reader( InstrumentScanner<S,TS>& scanner_ )
+    : scanner( scanner_ ), thread( &InstrumentScanner<S,TS>::Read, &scanner_ ) {}
+    ~Reader() {
+      {
+        std::lock_guard<std::mutex> lock( scanner.m_mutex );
+        scanner.m_bStop = true;
+      }
+      scanner.m_cvDelivered.notify_one();
+      thread.join();
+    }
+  };
+
+  m_bStop = false;
+  Reader reader( *this );
+
+  static const size_t nReportInterval( 1000 );
+
+  for ( pItem_t& pItem: m_vItem ) {
+    {
+      std::unique_lock<std::mutex> lock( m_mutex );
+      m_cvItemDone.wait( lock, [&pItem]{ return EState::Pending != pItem->state; } );
+    }
+    Item& item( *pItem );
+    switch ( item.state ) {
+      case EState::Accepted:
+        m_stats.nEnteredFilter++;
+        m_stats.nPassedFilter++;
+        try {
+          m_cbResult( item.s, item.sPath, item.sName, item.ts );
+        }
+        catch ( const std::exception& e ) {
+          std::cout << "InstrumentScanner::Run result " << item.sPath << " problem: " << e.what() << std::endl;
+        }
+        break;
+      case EState::Rejected:
+        m_stats.nEnteredFilter++;
+        break;
+      default:
+        break;
+    }
+    pItem.reset(); // release the series, and the S
+    {
+      std::lock_guard<std::mutex> lock( m_mutex );
+      m_stats.nDelivered++;
+    }
+    m_cvDelivered.notify_one();
+
+    if ( 0 == ( m_stats.nDelivered % nReportInterval ) ) {
+      double dblSeconds = (double)( pt::microsec_clock::universal_time() - dtStart ).total_microseconds() / 1000000.0;
+      std::cout
+        << "InstrumentScanner " << m_stats.nDelivered << "/" << m_stats.nEnumerated
+        << ", " << ( m_stats.nDelivered / dblSeconds ) << " symbols/s" << std::endl;
+    }
+  }
+
+  m_vItem.clear(); // all delivered, the reader is done with them
+
+  double dblSeconds = (double)( pt::microsec_clock::universal_time() - dtStart ).total_microseconds() / 1000000.0;
+  m_stats.dblSymbolsPerSecond = ( 0.0 < dblSeconds ) ? ( m_stats.nDelivered / dblSeconds ) : 0.0;
+
+  std::cout
+    << "InstrumentScanner " << m_sRootPath << ": "
+    << m_stats.nEnteredFilter << " entered filter, "
+    << m_stats.nPassedFilter << " passed, "
+    << m_stats.nDelivered << " in " << dblSeconds << "s, "
+    << m_stats.dblSymbolsPerSecond << " symbols/s" << std::endl;
+}
+
+template<typename S, typename TS>
+void InstrumentScanner<S,TS>::HandleGroup( const std::string& sPath, const std::string& sObjectName ) {
+  m_bSendThroughFilter = m_cbUseGroup( m_struct, sPath, sObjectName );
+}
+
+template<typename S, typename TS>
+void InstrumentScanner<S,TS>::HandleObject( const std::string& sPath, const std::string& sObjectName ) {
+  if ( m_bSendThroughFilter ) {
+    m_vItem.emplace_back( std::make_unique<Item>( sPath, sObjectName, m_struct ) );
+  }
+}
+
+template<typename S, typename TS>
+void InstrumentScanner<S,TS>::Read( void ) {
+
+  ou::tf::HDF5DataManager dm( ou::tf::HDF5DataManager::RO );
+
+  using container_t = typename ou::tf::HDF5TimeSeriesContainer<typename TS::datum_t>;
+
+  for ( size_t ix = 0; ix < m_vItem.size(); ix++ ) {
+    {
+      std::unique_lock<std::mutex> lock( m_mutex );
+      m_cvDelivered.wait( lock, [this,ix]{ return m_bStop || ( ( ix - m_stats.nDelivered ) < m_nPrefetch ); } );
+      if ( m_bStop ) break;
+    }
+    Item& item( *m_vItem[ ix ] ); // not released until after Complete
+    bool bEnough( false );
+    try {
+      container_t tsRepository( dm, item.sPath );
+      typename container_t::iterator begin, end;
+      begin = std::lower_bound( tsRepository.begin(), tsRepository.end(), m_dtDate1 );
+      end   = std::lower_bound( begin, tsRepository.end(), m_dtDate2 );
+      hsize_t cnt = end - begin;
+      if ( m_nRequiredDays <= cnt ) {
+        item.ts.Resize( cnt );
+        tsRepository.Read( begin, end, &item.ts );
+        bEnough = true;
+      }
+    }
+    catch ( H5::Exception& e ) {
+      std::cout << "InstrumentScanner::Read " << item.sPath << " H5::Exception " << e.getDetailMsg() << std::endl;
+    }
+    catch ( const std::exception& e ) {
+      std::cout << "InstrumentScanner::Read " << item.sPath << " problem: " << e.what() << std::endl;
+    }
+    m_stats.nRead++;
+    if ( bEnough ) {
+      Item* pItem( &item );
+      boost::asio::post( m_srvc, [this,pItem](){ Filter( *pItem ); } );
+    }
+    else {
+      Complete( item, EState::Skipped );
+    }
+  }
+}
+
+template<typename S, typename TS>
+void InstrumentScanner<S,TS>::Filter( Item& item ) {
+  bool bPassed( false );
+  try {
+    if ( m_cbFilterPath ) bPassed = m_cbFilterPath( item.s, item.sPath, item.sName, item.ts );
+    else bPassed = m_cbFilter( item.s, item.sName, item.ts );
+  }
+  catch ( const std::exception& e ) {
+    std::cout << "InstrumentScanner::Filter " << item.sPath << " problem: " << e.what() << std::endl;
+  }
+  m_stats.nFiltered++;
+  Complete( item, bPassed ? EState::Accepted : EState::Rejected );
+}
+
+template<typename S, typename TS>
+void InstrumentScanner<S,TS>::Complete( Item& item, EState state ) {
+  {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    item.state = state;
+  }
+  m_cvItemDone.notify_all();
+}
+
+} // namespace tf
+} // namespace ou
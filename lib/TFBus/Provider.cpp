@@ -0,0 +1,159 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Provider.cpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFBus
+ * Created: October 19, 2026 22:20 PM
+ */
+
+#include <algorithm>
+
+#include <boost/log/trivial.hpp>
+
+#include "Provider.hpp"
+
+namespace {
+  static const size_t c_nBatch = 256; // records per symbol per pass, so a busy symbol doesn't starve the others
+  static const unsigned int c_nSpin = 1024; // quiet passes before sleeping
+  static const std::chrono::microseconds c_usSleep( 50 );
+}
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace bus { // shared memory market data
+
+Provider::Provider()
+: ProviderInterface<Provider,Symbol>()
+, m_idUpstream( keytypes::EProviderIQF )
+, m_pvActive( std::make_shared<const vSymbol_t>() )
+, m_bPoll( false )
+{
+  m_sName = "bus"; // this needs to match provider used in the database
+  m_nID = keytypes::EProviderBus;
+  m_bProvidesQuotes = true;
+  m_bProvidesTrades = true;
+  m_bProvidesDepths = true;
+}
+
+Provider::~Provider() {
+  Disconnect();
+  if ( m_threadPoll.joinable() ) {
+    m_bPoll = false;
+    m_threadPoll.join();
+  }
+}
+
+Provider::pSymbol_t Provider::NewCSymbol( pInstrument_t pInstrument ) {
+  pSymbol_t pSymbol(
+    new Symbol(
+      pInstrument->GetInstrumentName( ID() ), pInstrument,
+      pInstrument->GetInstrumentName( m_idUpstream )
+      ) );
+  inherited_t::AddCSymbol( pSymbol );
+  return pSymbol;
+}
+
+void Provider::Connect() {
+  if ( !m_bConnected ) {
+    ProviderInterfaceBase::OnConnecting( 0 );
+    try {
+      m_pRequests = std::make_unique<Requests>();
+    }
+    catch ( const std::exception& e ) {
+      BOOST_LOG_TRIVIAL(error) << "bus::Provider " << e.what();
+      OnError( 0 );
+      return;
+    }
+    if ( !m_threadPoll.joinable() ) {
+      m_bPoll = true;
+      m_threadPoll = std::thread( [this](){ Poll(); } );
+    }
+    m_bConnected = true;
+    inherited_t::ConnectionComplete();
+    ProviderInterfaceBase::OnConnected( 0 );
+  }
+}
+
+void Provider::Disconnect() {
+  if ( m_bConnected ) {
+    ProviderInterfaceBase::OnDisconnecting( 0 );
+    inherited_t::Disconnecting();
+    m_bPoll = false;
+    if ( m_threadPoll.joinable() ) {
+      m_threadPoll.join();
+    }
+    m_pRequests.reset();
+    m_bConnected = false;
+    ProviderInterfaceBase::OnDisconnected( 0 );
+  }
+}
+
+void Provider::Start( pSymbol_t pSymbol, EStream stream ) {
+  m_pRequests->Request( pSymbol->RingName(), stream );
+  std::lock_guard<std::mutex> lock( m_mutexActive );
+  if ( 0 == pSymbol->m_nStreams ) {
+    auto pvActive = std::make_shared<vSymbol_t>( *m_pvActive );
+    pvActive->push_back( pSymbol );
+    std::atomic_store( &m_pvActive, pvSymbol_t( std::move( pvActive ) ) );
+  }
+  pSymbol->m_nStreams |= stream;
+}
+
+void Provider::Stop( pSymbol_t pSymbol, EStream stream ) {
+  // the request remains, the publisher carries on for other readers
+  std::lock_guard<std::mutex> lock( m_mutexActive );
+  pSymbol->m_nStreams &= ~stream;
+  if ( 0 == pSymbol->m_nStreams ) {
+    auto pvActive = std::make_shared<vSymbol_t>( *m_pvActive );
+    pvActive->erase( std::remove( pvActive->begin(), pvActive->end(), pSymbol ), pvActive->end() );
+    std::atomic_store( &m_pvActive, pvSymbol_t( std::move( pvActive ) ) );
+  }
+}
+
+void Provider::StartQuoteWatch( pSymbol_t pSymbol ) { Start( pSymbol, EStream::quote ); }
+void Provider::StopQuoteWatch( pSymbol_t pSymbol ) { Stop( pSymbol, EStream::quote ); }
+
+void Provider::StartTradeWatch( pSymbol_t pSymbol ) { Start( pSymbol, EStream::trade ); }
+void Provider::StopTradeWatch( pSymbol_t pSymbol ) { Stop( pSymbol, EStream::trade ); }
+
+void Provider::StartDepthByMMWatch( pSymbol_t pSymbol ) { Start( pSymbol, EStream::depthbymm ); }
+void Provider::StopDepthByMMWatch( pSymbol_t pSymbol ) { Stop( pSymbol, EStream::depthbymm ); }
+
+void Provider::StartDepthByOrderWatch( pSymbol_t pSymbol ) { Start( pSymbol, EStream::depthbyorder ); }
+void Provider::StopDepthByOrderWatch( pSymbol_t pSymbol ) { Stop( pSymbol, EStream::depthbyorder ); }
+
+void Provider::Poll() {
+  unsigned int nQuiet {};
+  while ( m_bPoll.load( std::memory_order_relaxed ) ) {
+    size_t nDispatched {};
+    const pvSymbol_t pvActive( std::atomic_load( &m_pvActive ) );
+    for ( const pSymbol_t& pSymbol: *pvActive ) {
+      nDispatched += pSymbol->Drain( c_nBatch );
+    }
+    if ( 0 < nDispatched ) {
+      nQuiet = 0;
+    }
+    else {
+      if ( c_nSpin <= ++nQuiet ) {
+        std::this_thread::sleep_for( c_usSleep );
+      }
+    }
+  }
+}
+
+} // namespace bus
+} // namespace tf
+} // namespace ou
@@ -0,0 +1,114 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Provider.hpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFBus
+ * Created: October 19, 2026 22:20 PM
+ */
+
+#pragma once
+
+// reader side of the bus: a ProviderInterface fed from the publisher's shared memory rings
+//   instruments are requested by their upstream provider name (IQFeed by default),
+//   so applications swap providers without changing instrument construction
+//   one poll thread drains the rings and calls the handlers, as a feed thread would,
+//     it spins briefly when the rings are quiet, then sleeps in short steps
+//   no fundamentals / summary messages, no order execution
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <TFTrading/ProviderInterface.h>
+
+#include "Symbol.hpp"
+#include "Requests.hpp"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace bus { // shared memory market data
+
+class Provider:
+  public ProviderInterface<Provider, Symbol>
+{
+public:
+
+  using pProvider_t = std::shared_ptr<Provider>;
+  using inherited_t = ProviderInterface<Provider,Symbol>;
+  using idSymbol_t = inherited_t::idSymbol_t;
+  using pSymbol_t = inherited_t::pSymbol_t;
+  using pInstrument_t = inherited_t::pInstrument_t;
+  using eidProvider_t = ou::tf::keytypes::eidProvider_t;
+
+  Provider(); // for auto construction by ProviderManager
+  virtual ~Provider();
+
+  static pProvider_t Factory() {
+    return std::make_shared<Provider>();
+  }
+
+  static pProvider_t Cast( inherited_t::pProvider_t pProvider ) {
+    return std::dynamic_pointer_cast<Provider>( pProvider );
+  }
+
+  void SetUpstream( eidProvider_t id ) { m_idUpstream = id; } // prior to adding handlers
+
+  virtual void Connect();
+  virtual void Disconnect();
+
+protected:
+
+  virtual void StartQuoteWatch( pSymbol_t pSymbol );
+  virtual void  StopQuoteWatch( pSymbol_t pSymbol );
+
+  virtual void StartTradeWatch( pSymbol_t pSymbol );
+  virtual void  StopTradeWatch( pSymbol_t pSymbol );
+
+  virtual void StartDepthByMMWatch( pSymbol_t pSymbol );
+  virtual void  StopDepthByMMWatch( pSymbol_t pSymbol );
+
+  virtual void StartDepthByOrderWatch( pSymbol_t pSymbol );
+  virtual void  StopDepthByOrderWatch( pSymbol_t pSymbol );
+
+  pSymbol_t NewCSymbol( pInstrument_t pInstrument );  // used by Add/Remove x handlers in base class
+
+private:
+
+  eidProvider_t m_idUpstream;
+
+  std::unique_ptr<Requests> m_pRequests;
+
+  using vSymbol_t = std::vector<pSymbol_t>;
+  using pvSymbol_t = std::shared_ptr<const vSymbol_t>;
+
+  std::mutex m_mutexActive; // serializes changes to m_pvActive
+  pvSymbol_t m_pvActive; // symbols with a stream, replaced as a whole, so the poll thread takes no lock
+
+  std::atomic<bool> m_bPoll;
+  std::thread m_threadPoll;
+
+  void Start( pSymbol_t, EStream );
+  void Stop( pSymbol_t, EStream );
+
+  void Poll();
+
+};
+
+} // namespace bus
+} // namespace tf
+} // namespace ou
@@ -0,0 +1,72 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Publisher.cpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFBus
+ * Created: October 19, 2026 21:50 PM
+ */
+
+#include <cassert>
+
+#include <boost/log/trivial.hpp>
+
+#include "Publisher.hpp"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace bus { // shared memory market data
+
+Publisher::Publisher( fStart_t&& fStart, uint32_t nSlots )
+: m_nSlots( nSlots )
+, m_fStart( std::move( fStart ) )
+, m_nGeneration( m_requests.Generation() - 1 ) // scan requests made before the publisher started
+{
+  assert( m_fStart );
+}
+
+Publisher::~Publisher() {
+  m_mapSymbol.clear(); // removes the segments
+}
+
+void Publisher::Poll() {
+
+  const uint32_t nGeneration( m_requests.Generation() );
+  if ( nGeneration == m_nGeneration ) return;
+  m_nGeneration = nGeneration;
+
+  m_requests.Scan(
+    [this]( const std::string& sSymbol, uint32_t nStreams ){
+      Served& served( m_mapSymbol[ sSymbol ] );
+      const uint32_t nNew( nStreams & ~served.nStreams );
+      if ( 0 != nNew ) {
+        try {
+          if ( !served.pRing ) {
+            served.pRing = Ring::Create( sSymbol, m_nSlots );
+          }
+          served.nStreams |= nNew;
+          BOOST_LOG_TRIVIAL(info) << "bus::Publisher " << sSymbol << " streams " << nNew;
+          m_fStart( sSymbol, nNew, *served.pRing );
+        }
+        catch ( const std::exception& e ) {
+          BOOST_LOG_TRIVIAL(error) << "bus::Publisher " << sSymbol << ": " << e.what();
+        }
+      }
+    } );
+}
+
+} // namespace bus
+} // namespace tf
+} // namespace ou
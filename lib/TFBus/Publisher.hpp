@@ -0,0 +1,75 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Publisher.hpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFBus
+ * Created: October 19, 2026 21:50 PM
+ */
+
+#pragma once
+
+// publisher side of the bus: turns reader requests into rings, and into upstream watches
+//   Poll, on a timer, finds streams newly requested, creates the symbol's ring if needed,
+//   then fStart subscribes upstream, with handlers calling Ring::Publish
+//   rings remain until the Publisher is destroyed, upstream watches need to be stopped first
+
+#include <memory>
+#include <string>
+#include <functional>
+#include <unordered_map>
+
+#include "Ring.hpp"
+#include "Requests.hpp"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace bus { // shared memory market data
+
+class Publisher {
+public:
+
+  using fStart_t = std::function<void(const std::string& sSymbol, uint32_t nStreams, Ring&)>; // streams not yet started
+
+  Publisher( fStart_t&&, uint32_t nSlots = Ring::c_nSlotsDefault );
+  ~Publisher();
+
+  void Poll();
+
+  size_t Symbols() const { return m_mapSymbol.size(); }
+
+protected:
+private:
+
+  struct Served {
+    Ring::pRing_t pRing;
+    uint32_t nStreams;
+    Served(): nStreams {} {}
+  };
+  using mapSymbol_t = std::unordered_map<std::string,Served>;
+
+  const uint32_t m_nSlots;
+  fStart_t m_fStart;
+
+  Requests m_requests;
+  uint32_t m_nGeneration;
+
+  mapSymbol_t m_mapSymbol;
+
+};
+
+} // namespace bus
+} // namespace tf
+} // namespace ou
@@ -0,0 +1,165 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Record.hpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFBus
+ * Created: October 19, 2026 21:10 PM
+ */
+
+#pragma once
+
+// one market data event, as laid out in a shared memory ring slot
+//   plain data only, as the datums have vtables, and the slot is read by other processes
+//   date times are microseconds since the unix epoch, 0 for not_a_date_time
+
+#include <atomic>
+#include <cstdint>
+
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+#include <TFTimeSeries/DatedDatum.h>
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace bus { // shared memory market data
+
+enum class EType: uint8_t { none = 0, quote, trade, depthbymm, depthbyorder };
+
+struct alignas( 64 ) Record {
+
+  std::atomic<uint64_t> nSequence; // seqlock, 0 while the slot is being written
+
+  int64_t nDateTime;
+  EType type;
+  char chMsgType; // depth
+  char chSide;    // depth
+  uint8_t pad[ 5 ];
+
+  union {
+    struct {
+      double dblBid;
+      double dblAsk;
+      uint32_t nBidSize;
+      uint32_t nAskSize;
+    } quote;
+    struct {
+      double dblPrice;
+      uint32_t nVolume;
+    } trade;
+    struct {
+      double dblPrice;
+      uint32_t nVolume;
+      uint32_t mmid;
+    } depthbymm;
+    struct {
+      double dblPrice;
+      uint32_t nVolume;
+      uint32_t pad;
+      uint64_t nOrderID;
+      uint64_t nPriority;
+      int64_t nDateTimeMarket;
+    } depthbyorder;
+  };
+
+  // the body is copied in and out, the sequence is handled by the ring
+  void Set( const ou::tf::Quote& );
+  void Set( const ou::tf::Trade& );
+  void Set( const ou::tf::DepthByMM& );
+  void Set( const ou::tf::DepthByOrder& );
+
+  ou::tf::Quote Quote() const;
+  ou::tf::Trade Trade() const;
+  ou::tf::DepthByMM DepthByMM() const;
+  ou::tf::DepthByOrder DepthByOrder() const;
+
+  static int64_t Encode( boost::posix_time::ptime dt ) {
+    return dt.is_special() ? 0 : ( dt - Epoch() ).total_microseconds();
+  }
+  static boost::posix_time::ptime Decode( int64_t n ) {
+    return ( 0 == n ) ? boost::posix_time::ptime() : ( Epoch() + boost::posix_time::microseconds( n ) );
+  }
+
+private:
+  static const boost::posix_time::ptime& Epoch() {
+    static const boost::posix_time::ptime dtEpoch( boost::gregorian::date( 1970, 1, 1 ) );
+    return dtEpoch;
+  }
+};
+
+static_assert( 64 == sizeof( Record ), "bus::Record is one cache line" );
+static_assert( std::atomic<uint64_t>::is_always_lock_free, "bus::Record sequence is shared between processes" );
+
+inline void Record::Set( const ou::tf::Quote& datum ) {
+  nDateTime = Encode( datum.DateTime() );
+  type = EType::quote;
+  quote.dblBid = datum.Bid();
+  quote.dblAsk = datum.Ask();
+  quote.nBidSize = datum.BidSize();
+  quote.nAskSize = datum.AskSize();
+}
+
+inline void Record::Set( const ou::tf::Trade& datum ) {
+  nDateTime = Encode( datum.DateTime() );
+  type = EType::trade;
+  trade.dblPrice = datum.Price();
+  trade.nVolume = datum.Volume();
+}
+
+inline void Record::Set( const ou::tf::DepthByMM& datum ) {
+  nDateTime = Encode( datum.DateTime() );
+  type = EType::depthbymm;
+  chMsgType = datum.MsgType();
+  chSide = datum.Side();
+  depthbymm.dblPrice = datum.Price();
+  depthbymm.nVolume = datum.Volume();
+  depthbymm.mmid = datum.MMID();
+}
+
+inline void Record::Set( const ou::tf::DepthByOrder& datum ) {
+  nDateTime = Encode( datum.DateTime() );
+  type = EType::depthbyorder;
+  chMsgType = datum.MsgType();
+  chSide = datum.Side();
+  depthbyorder.dblPrice = datum.Price();
+  depthbyorder.nVolume = datum.Volume();
+  depthbyorder.nOrderID = datum.OrderID();
+  depthbyorder.nPriority = datum.Priority();
+  depthbyorder.nDateTimeMarket = Encode( datum.MarketTimeStamp() );
+}
+
+inline ou::tf::Quote Record::Quote() const {
+  return ou::tf::Quote( Decode( nDateTime ), quote.dblBid, quote.nBidSize, quote.dblAsk, quote.nAskSize );
+}
+
+inline ou::tf::Trade Record::Trade() const {
+  return ou::tf::Trade( Decode( nDateTime ), trade.dblPrice, trade.nVolume );
+}
+
+inline ou::tf::DepthByMM Record::DepthByMM() const {
+  return ou::tf::DepthByMM(
+    Decode( nDateTime ), chMsgType, chSide, depthbymm.nVolume, depthbymm.dblPrice, depthbymm.mmid );
+}
+
+inline ou::tf::DepthByOrder Record::DepthByOrder() const {
+  return ou::tf::DepthByOrder(
+    Decode( nDateTime ), Decode( depthbyorder.nDateTimeMarket ),
+    depthbyorder.nOrderID, depthbyorder.nPriority,
+    chMsgType, chSide, depthbyorder.dblPrice, depthbyorder.nVolume );
+}
+
+} // namespace bus
+} // namespace tf
+} // namespace ou
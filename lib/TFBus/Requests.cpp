@@ -0,0 +1,178 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Requests.cpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFBus
+ * Created: October 19, 2026 21:35 PM
+ */
+
+#include <ctime>
+#include <cerrno>
+#include <chrono>
+#include <thread>
+#include <cstring>
+#include <stdexcept>
+
+#include <signal.h>
+#include <unistd.h>
+
+#include <boost/log/trivial.hpp>
+
+#include <boost/interprocess/shared_memory_object.hpp>
+
+#include "Requests.hpp"
+
+namespace ipc = boost::interprocess;
+
+namespace {
+
+  static const char* c_sSegment = "tfbus.requests";
+
+  inline uint64_t State( uint64_t nState ) { return nState & 0xff; }
+  inline uint32_t Pid( uint64_t nState ) { return ( nState >> 8 ) & 0xffffff; }
+  inline uint32_t Seconds( uint64_t nState ) { return nState >> 32; }
+
+  uint32_t Now() {
+    return (uint32_t)std::time( nullptr );
+  }
+
+  uint64_t Claim( uint64_t nClaimed ) {
+    return ( (uint64_t)Now() << 32 ) | ( ( (uint64_t)::getpid() & 0xffffff ) << 8 ) | nClaimed;
+  }
+
+  bool Alive( uint32_t pid ) {
+    return ( 0 == ::kill( (pid_t)pid, 0 ) ) || ( ESRCH != errno );
+  }
+
+}
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace bus { // shared memory market data
+
+Requests::Requests()
+: m_pTable( nullptr )
+{
+  ipc::shared_memory_object shm( ipc::open_or_create, c_sSegment, ipc::read_write );
+  shm.truncate( sizeof( Table ) ); // each side sizes it, so neither maps an empty segment, new pages are zero
+  ipc::mapped_region region( shm, ipc::read_write );
+  m_region.swap( region );
+  m_pTable = reinterpret_cast<Table*>( m_region.get_address() );
+
+  // a zeroed table is an empty table, the magic number only guards against a different layout
+  uint32_t nMagic {};
+  const uint32_t nExpected( c_nMagic ^ c_nVersion );
+  if ( !m_pTable->nMagic.compare_exchange_strong( nMagic, nExpected, std::memory_order_acq_rel ) ) {
+    if ( nExpected != nMagic ) {
+      throw std::runtime_error( "bus::Requests incompatible table in " + std::string( c_sSegment ) );
+    }
+  }
+}
+
+Requests::~Requests() {}
+
+void Requests::Remove() {
+  ipc::shared_memory_object::remove( c_sSegment );
+}
+
+void Requests::Request( const std::string& sSymbol, uint32_t nStreams ) {
+
+  if ( sizeof( Entry::sSymbol ) <= sSymbol.size() ) {
+    throw std::invalid_argument( "bus::Requests symbol name too long: " + sSymbol );
+  }
+
+  // entries are never released, so a ready entry with the name is the one to extend,
+  //   two readers may both claim a new entry for the same name, the publisher merges them,
+  //   so an entry still claimed after the wait can be skipped
+  for ( Entry& entry: m_pTable->entry ) {
+    uint64_t nState( entry.nState.load( std::memory_order_acquire ) );
+    if ( EState::empty == nState ) {
+      const uint64_t nClaim( Claim( EState::claimed ) );
+      if ( entry.nState.compare_exchange_strong( nState, nClaim, std::memory_order_acq_rel ) ) {
+        Fill( entry, nClaim, sSymbol, nStreams );
+        return;
+      }
+    }
+    if ( EState::claimed == State( nState ) ) { // another reader is filling it in
+      nState = Wait( entry, nState );
+      if ( ( EState::claimed == State( nState ) ) && Stale( nState ) ) {
+        const uint64_t nAbandoned( nState );
+        const uint64_t nClaim( Claim( EState::claimed ) );
+        if ( entry.nState.compare_exchange_strong( nState, nClaim, std::memory_order_acq_rel ) ) {
+          BOOST_LOG_TRIVIAL(warning) << "bus::Requests reclaimed an entry abandoned by pid " << Pid( nAbandoned );
+          Fill( entry, nClaim, sSymbol, nStreams );
+          return;
+        }
+      }
+      if ( EState::claimed == State( nState ) ) {
+        BOOST_LOG_TRIVIAL(warning) << "bus::Requests entry held by pid " << Pid( nState ) << ", skipped";
+        continue;
+      }
+    }
+    if ( ( EState::ready == nState ) && ( sSymbol == entry.sSymbol ) ) {
+      const uint32_t nPrior( entry.nStreams.fetch_or( nStreams, std::memory_order_acq_rel ) );
+      if ( nStreams != ( nPrior & nStreams ) ) {
+        m_pTable->nGeneration.fetch_add( 1, std::memory_order_acq_rel );
+      }
+      return;
+    }
+  }
+
+  BOOST_LOG_TRIVIAL(error) << "bus::Requests table full, " << sSymbol << " not requested";
+}
+
+void Requests::Fill( Entry& entry, uint64_t nClaim, const std::string& sSymbol, uint32_t nStreams ) {
+  std::strncpy( entry.sSymbol, sSymbol.c_str(), sizeof( entry.sSymbol ) - 1 );
+  entry.nStreams.store( nStreams, std::memory_order_relaxed );
+  if ( entry.nState.compare_exchange_strong( nClaim, EState::ready, std::memory_order_acq_rel ) ) {
+    m_pTable->nGeneration.fetch_add( 1, std::memory_order_acq_rel );
+  }
+  else { // taken over as stale, the other reader's request stands
+    BOOST_LOG_TRIVIAL(error) << "bus::Requests claim lost, " << sSymbol << " not requested";
+  }
+}
+
+// spins, then yields, until the claim resolves or c_msClaimWait passes, returns the last state seen
+uint64_t Requests::Wait( const Entry& entry, uint64_t nState ) {
+  for ( uint32_t n = 0; ( n < c_nClaimSpin ) && ( EState::claimed == State( nState ) ); n++ ) {
+    nState = entry.nState.load( std::memory_order_acquire );
+  }
+  const std::chrono::steady_clock::time_point until
+    = std::chrono::steady_clock::now() + std::chrono::milliseconds( c_msClaimWait );
+  while ( ( EState::claimed == State( nState ) ) && ( std::chrono::steady_clock::now() < until ) ) {
+    std::this_thread::yield();
+    nState = entry.nState.load( std::memory_order_acquire );
+  }
+  return nState;
+}
+
+bool Requests::Stale( uint64_t nState ) {
+  return ( ( Seconds( nState ) + c_sClaimStale ) < Now() ) || !Alive( Pid( nState ) );
+}
+
+void Requests::Scan( fRequest_t&& fRequest ) const {
+  for ( const Entry& entry: m_pTable->entry ) {
+    const uint64_t nState( entry.nState.load( std::memory_order_acquire ) );
+    if ( EState::empty == nState ) break; // entries are claimed in order
+    if ( EState::ready == nState ) {
+      fRequest( entry.sSymbol, entry.nStreams.load( std::memory_order_acquire ) );
+    }
+  }
+}
+
+} // namespace bus
+} // namespace tf
+} // namespace ou
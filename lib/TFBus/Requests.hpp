@@ -0,0 +1,98 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Requests.hpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFBus
+ * Created: October 19, 2026 21:35 PM
+ */
+
+#pragma once
+
+// the symbols readers want, in a shared memory table, so the publisher knows what to watch
+//   readers add symbols / streams, the publisher polls the generation and scans for changes
+//   a request remains until the table is removed, the publisher keeps a symbol going once started
+//   either side may create the table, the other side opens it
+
+#include <atomic>
+#include <string>
+#include <cstdint>
+#include <functional>
+
+#include <boost/interprocess/mapped_region.hpp>
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace bus { // shared memory market data
+
+enum EStream: uint32_t { quote = 1, trade = 2, depthbymm = 4, depthbyorder = 8 };
+
+class Requests {
+public:
+
+  using fRequest_t = std::function<void(const std::string& sSymbol, uint32_t nStreams)>;
+
+  Requests(); // throws when an incompatible table is present
+  ~Requests();
+
+  // reader
+  void Request( const std::string& sSymbol, uint32_t nStreams ); // bits of EStream
+
+  // publisher
+  uint32_t Generation() const { return m_pTable->nGeneration.load( std::memory_order_acquire ); }
+  void Scan( fRequest_t&& ) const; // each symbol requested, with its streams
+
+  static void Remove(); // clears all requests, when no publisher or readers are running
+
+protected:
+private:
+
+  static const uint32_t c_nMagic = 0x54464252; // "TFBR"
+  static const uint32_t c_nVersion = 2;
+  static const uint32_t c_nEntries = 1024;
+
+  static constexpr uint32_t c_nClaimSpin = 1000; // then yield until c_msClaimWait
+  static constexpr uint32_t c_msClaimWait = 100; // then the entry is skipped, or taken over when stale
+  static constexpr uint32_t c_sClaimStale = 10; // a claim older than this is abandoned, as is one whose process is gone
+
+  enum EState: uint64_t { empty = 0, claimed, ready };
+
+  // state in the low byte, a claim also carries the claiming pid and the time of the claim (s):
+  //   [ 63..32 seconds | 31..8 pid | 7..0 state ]
+  //   a reader which dies between claiming and ready leaves a claim which can be recognized and reclaimed
+  struct Entry {
+    std::atomic<uint64_t> nState;
+    std::atomic<uint32_t> nStreams;
+    char sSymbol[ 100 ];
+  };
+
+  struct Table {
+    std::atomic<uint32_t> nMagic;
+    std::atomic<uint32_t> nGeneration; // changed with each request
+    Entry entry[ c_nEntries ];
+  };
+
+  boost::interprocess::mapped_region m_region;
+  Table* m_pTable;
+
+  void Fill( Entry&, uint64_t nClaim, const std::string& sSymbol, uint32_t nStreams );
+  static uint64_t Wait( const Entry&, uint64_t nState );
+  static bool Stale( uint64_t nState );
+
+};
+
+} // namespace bus
+} // namespace tf
+} // namespace ou
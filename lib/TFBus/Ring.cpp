@@ -0,0 +1,161 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Ring.cpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFBus
+ * Created: October 19, 2026 21:20 PM
+ */
+
+#include <cstring>
+#include <stdexcept>
+
+#include <unistd.h>
+
+#include <boost/log/trivial.hpp>
+
+#include <boost/interprocess/shared_memory_object.hpp>
+
+#include <OUCommon/TimeSource.h>
+
+#include "Ring.hpp"
+
+namespace ipc = boost::interprocess;
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace bus { // shared memory market data
+
+Ring::Ring( bool bOwner, const std::string& sSymbol, ipc::mapped_region&& region )
+: m_bOwner( bOwner )
+, m_sSymbol( sSymbol )
+, m_sSegment( SegmentName( sSymbol ) )
+, m_region( std::move( region ) )
+, m_pHeader( reinterpret_cast<Header*>( m_region.get_address() ) )
+, m_pSlots( reinterpret_cast<Record*>( reinterpret_cast<char*>( m_region.get_address() ) + sizeof( Header ) ) )
+, m_nMask( m_pHeader->nSlots - 1 )
+, m_nInstance( m_pHeader->nInstance )
+, m_nSequence( m_pHeader->nPublished.load( std::memory_order_relaxed ) )
+{}
+
+Ring::~Ring() {
+  if ( m_bOwner ) {
+    ipc::shared_memory_object::remove( m_sSegment.c_str() );
+  }
+}
+
+std::string Ring::SegmentName( const std::string& sSymbol ) {
+  // a posix shared memory name is a single path component
+  std::string sSegment( "tfbus." );
+  for ( const char ch: sSymbol ) {
+    sSegment += ( ( '/' == ch ) || ( ' ' == ch ) ) ? '_' : ch;
+  }
+  return sSegment;
+}
+
+Ring::pRing_t Ring::Create( const std::string& sSymbol, uint32_t nSlots ) {
+
+  if ( sizeof( Header::sSymbol ) <= sSymbol.size() ) {
+    throw std::invalid_argument( "bus::Ring symbol name too long: " + sSymbol );
+  }
+
+  uint32_t nPower( 4 );
+  while ( nPower < nSlots ) nPower <<= 1;
+
+  const std::string sSegment( SegmentName( sSymbol ) );
+  ipc::shared_memory_object::remove( sSegment.c_str() ); // readers of a prior instance keep their mapping
+
+  ipc::shared_memory_object shm( ipc::create_only, sSegment.c_str(), ipc::read_write );
+  shm.truncate( sizeof( Header ) + (size_t)nPower * sizeof( Record ) ); // zero filled
+  ipc::mapped_region region( shm, ipc::read_write );
+
+  Header& header( *reinterpret_cast<Header*>( region.get_address() ) );
+  header.nVersion = c_nVersion;
+  header.nSlots = nPower;
+  header.nRecordSize = sizeof( Record );
+  header.nInstance
+    = ( ( (uint64_t)Record::Encode( ou::TimeSource::GlobalInstance().External() ) ) << 16 )
+    ^ (uint64_t)::getpid();
+  std::strncpy( header.sSymbol, sSymbol.c_str(), sizeof( header.sSymbol ) - 1 );
+  header.nMagic.store( c_nMagic, std::memory_order_release );
+
+  BOOST_LOG_TRIVIAL(info) << "bus::Ring " << sSegment << " created with " << nPower << " slots";
+
+  return pRing_t( new Ring( true, sSymbol, std::move( region ) ) );
+}
+
+Ring::pRing_t Ring::Open( const std::string& sSymbol ) {
+
+  pRing_t pRing;
+
+  try {
+    const std::string sSegment( SegmentName( sSymbol ) );
+    ipc::shared_memory_object shm( ipc::open_only, sSegment.c_str(), ipc::read_only );
+
+    ipc::offset_t size {};
+    if ( shm.get_size( size ) && ( sizeof( Header ) <= (size_t)size ) ) {
+      ipc::mapped_region region( shm, ipc::read_only );
+      const Header& header( *reinterpret_cast<const Header*>( region.get_address() ) );
+      if ( c_nMagic == header.nMagic.load( std::memory_order_acquire ) ) { // otherwise not yet initialized
+        if ( ( c_nVersion != header.nVersion ) || ( sizeof( Record ) != header.nRecordSize ) ) {
+          BOOST_LOG_TRIVIAL(error) << "bus::Ring " << sSegment << " version mismatch";
+        }
+        else
+        if ( sSymbol != header.sSymbol ) {
+          BOOST_LOG_TRIVIAL(error) << "bus::Ring " << sSegment << " holds " << header.sSymbol;
+        }
+        else
+        if ( ( sizeof( Header ) + (size_t)header.nSlots * sizeof( Record ) ) <= (size_t)size ) {
+          pRing.reset( new Ring( false, sSymbol, std::move( region ) ) );
+        }
+      }
+    }
+  }
+  catch ( const ipc::interprocess_exception& ) { // not yet created
+  }
+
+  return pRing;
+}
+
+Ring::ERead Ring::Read( uint64_t nSequence, Record& record ) const {
+  const Record& slot( m_pSlots[ nSequence & m_nMask ] );
+  if ( nSequence != slot.nSequence.load( std::memory_order_acquire ) ) return ERead::lapped;
+  std::memcpy(
+    reinterpret_cast<char*>( &record ) + sizeof( Record::nSequence ),
+    reinterpret_cast<const char*>( &slot ) + sizeof( Record::nSequence ),
+    sizeof( Record ) - sizeof( Record::nSequence ) );
+  std::atomic_thread_fence( std::memory_order_acquire ); // the copy completes before the re-check
+  if ( nSequence != slot.nSequence.load( std::memory_order_relaxed ) ) return ERead::lapped;
+  return ERead::ok;
+}
+
+bool Ring::Replaced() const {
+  bool bReplaced( false );
+  try {
+    ipc::shared_memory_object shm( ipc::open_only, m_sSegment.c_str(), ipc::read_only );
+    ipc::mapped_region region( shm, ipc::read_only, 0, sizeof( Header ) );
+    const Header& header( *reinterpret_cast<const Header*>( region.get_address() ) );
+    bReplaced
+      = ( c_nMagic == header.nMagic.load( std::memory_order_acquire ) )
+     && ( m_nInstance != header.nInstance );
+  }
+  catch ( const ipc::interprocess_exception& ) { // publisher gone, nothing newer yet
+  }
+  return bReplaced;
+}
+
+} // namespace bus
+} // namespace tf
+} // namespace ou
@@ -0,0 +1,126 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Ring.hpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFBus
+ * Created: October 19, 2026 21:20 PM
+ */
+
+#pragma once
+
+// a per symbol ring of Records in a named shared memory segment
+//   a single publisher process writes, any number of reader processes follow along
+//   each slot is a seqlock: the sequence is zeroed, the body written, then the sequence stored,
+//     a reader copies the body, and keeps it only if the sequence is unchanged across the copy
+//   readers never block the publisher, a reader which falls a ring behind skips ahead,
+//     and counts what it missed
+//   the publisher replaces any prior segment of the same name, and removes it when done,
+//     readers notice a replacement via the instance number in the header
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <cstdint>
+
+#include <boost/interprocess/mapped_region.hpp>
+
+#include "Record.hpp"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace bus { // shared memory market data
+
+class Ring {
+public:
+
+  using pRing_t = std::unique_ptr<Ring>;
+
+  enum class ERead { ok, lapped }; // lapped: the slot has been re-used for a later record
+
+  static const uint32_t c_nSlotsDefault = 1 << 14; // 1MB per symbol
+
+  ~Ring();
+
+  // publisher, nSlots is rounded up to a power of two
+  static pRing_t Create( const std::string& sSymbol, uint32_t nSlots = c_nSlotsDefault );
+  // reader, nullptr when the symbol is not (yet) published
+  static pRing_t Open( const std::string& sSymbol );
+
+  static std::string SegmentName( const std::string& sSymbol );
+
+  const std::string& Symbol() const { return m_sSymbol; }
+  uint32_t Slots() const { return m_nMask + 1; }
+
+  // publisher, thread safe, as quotes/trades and depth arrive on different threads,
+  //   writers are serialised on m_mutexPublish, readers take no lock
+  template<typename Datum>
+  void Publish( const Datum& );
+
+  // reader
+  uint64_t Published() const { return m_pHeader->nPublished.load( std::memory_order_acquire ); } // 0: nothing yet
+  ERead Read( uint64_t nSequence, Record& ) const; // nSequence <= Published()
+  bool Replaced() const; // the publisher has since created a new segment under this name
+
+protected:
+private:
+
+  static const uint32_t c_nMagic = 0x54464253; // "TFBS"
+  static const uint32_t c_nVersion = 1;
+
+  struct Header {
+    std::atomic<uint32_t> nMagic; // stored last by the publisher
+    uint32_t nVersion;
+    uint32_t nSlots;
+    uint32_t nRecordSize;
+    uint64_t nInstance;
+    char sSymbol[ 104 ];
+    alignas( 64 ) std::atomic<uint64_t> nPublished;
+  };
+  static_assert( 0 == sizeof( Header ) % alignof( Record ), "bus::Ring slots follow the header" );
+
+  const bool m_bOwner;
+  const std::string m_sSymbol;
+  const std::string m_sSegment;
+
+  boost::interprocess::mapped_region m_region;
+
+  Header* m_pHeader;
+  Record* m_pSlots;
+  uint64_t m_nMask;
+  uint64_t m_nInstance;
+
+  std::mutex m_mutexPublish;
+  uint64_t m_nSequence; // last published
+
+  Ring( bool bOwner, const std::string& sSymbol, boost::interprocess::mapped_region&& );
+};
+
+template<typename Datum>
+void Ring::Publish( const Datum& datum ) {
+  std::lock_guard<std::mutex> lock( m_mutexPublish );
+  const uint64_t nSequence( ++m_nSequence );
+  Record& record( m_pSlots[ nSequence & m_nMask ] );
+  record.nSequence.store( 0, std::memory_order_relaxed );
+  std::atomic_thread_fence( std::memory_order_release ); // the zero is visible before any of the body
+  record.Set( datum );
+  record.nSequence.store( nSequence, std::memory_order_release );
+  m_pHeader->nPublished.store( nSequence, std::memory_order_release );
+}
+
+} // namespace bus
+} // namespace tf
+} // namespace ou
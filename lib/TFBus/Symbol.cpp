@@ -0,0 +1,143 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Symbol.cpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFBus
+ * Created: October 19, 2026 22:05 PM
+ */
+
+#include <boost/log/trivial.hpp>
+
+#include "Symbol.hpp"
+
+namespace {
+  static const std::chrono::milliseconds c_msAttach( 250 );
+  static const std::chrono::seconds c_secondsIdle( 1 ); // before checking for a replacement ring
+}
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace bus { // shared memory market data
+
+Symbol::Symbol( const std::string& sName, pInstrument_t pInstrument, const std::string& sRing )
+: ou::tf::Symbol<Symbol>( pInstrument, sName )
+, m_sRing( sRing )
+, m_nStreams {}
+, m_nNext {}
+, m_nReceived {}, m_nDropped {}
+{
+}
+
+Symbol::~Symbol() {
+}
+
+bool Symbol::Attach() {
+  const clock_t::time_point tpNow( clock_t::now() );
+  if ( c_msAttach <= ( tpNow - m_tpAttach ) ) {
+    m_tpAttach = tpNow;
+    m_pRing = Ring::Open( m_sRing );
+    if ( m_pRing ) {
+      m_nNext = m_pRing->Published() + 1; // join live, history is not replayed
+      m_tpActivity = tpNow;
+      BOOST_LOG_TRIVIAL(info) << "bus::Symbol " << m_sRing << " attached at " << m_nNext;
+    }
+  }
+  return (bool)m_pRing;
+}
+
+void Symbol::Skip( uint64_t nPublished ) {
+  // resume half a ring behind the publisher, to leave some room before being lapped again
+  const uint64_t nHalf( m_pRing->Slots() / 2 );
+  const uint64_t nResume( ( nHalf < nPublished ) ? ( nPublished - nHalf + 1 ) : 1 );
+  if ( m_nNext < nResume ) {
+    const uint64_t nDropped( nResume - m_nNext );
+    m_nDropped.fetch_add( nDropped, std::memory_order_relaxed );
+    BOOST_LOG_TRIVIAL(warning) << "bus::Symbol " << m_sRing << " lapped, dropped " << nDropped;
+    m_nNext = nResume;
+  }
+}
+
+void Symbol::Dispatch() {
+  switch ( m_record.type ) {
+    case EType::quote:
+      m_OnQuote( m_record.Quote() );
+      break;
+    case EType::trade:
+      m_OnTrade( m_record.Trade() );
+      break;
+    case EType::depthbymm:
+      m_OnDepthByMM( m_record.DepthByMM() );
+      break;
+    case EType::depthbyorder:
+      m_OnDepthByOrder( m_record.DepthByOrder() );
+      break;
+    default:
+      break;
+  }
+}
+
+size_t Symbol::Drain( size_t nLimit ) {
+
+  if ( !m_pRing ) {
+    if ( !Attach() ) return 0;
+  }
+
+  size_t nDispatched {};
+  uint64_t nPublished( m_pRing->Published() );
+
+  while ( ( m_nNext <= nPublished ) && ( nDispatched < nLimit ) ) {
+    if ( m_pRing->Slots() <= ( nPublished - m_nNext ) ) {
+      Skip( nPublished );
+    }
+    else {
+      if ( Ring::ERead::ok == m_pRing->Read( m_nNext, m_record ) ) {
+        m_nNext++;
+        nDispatched++;
+        Dispatch();
+      }
+      else { // overwritten while copying
+        nPublished = m_pRing->Published();
+        Skip( nPublished );
+      }
+    }
+  }
+
+  if ( 0 < nDispatched ) {
+    m_nReceived.fetch_add( nDispatched, std::memory_order_relaxed );
+    m_tpActivity = clock_t::time_point(); // checked on the next idle pass
+  }
+  else {
+    const clock_t::time_point tpNow( clock_t::now() );
+    if ( clock_t::time_point() == m_tpActivity ) {
+      m_tpActivity = tpNow;
+    }
+    else
+    if ( c_secondsIdle <= ( tpNow - m_tpActivity ) ) {
+      m_tpActivity = tpNow;
+      if ( m_pRing->Replaced() ) { // publisher restarted
+        BOOST_LOG_TRIVIAL(info) << "bus::Symbol " << m_sRing << " ring replaced";
+        m_pRing.reset();
+        m_tpAttach = clock_t::time_point();
+      }
+    }
+  }
+
+  return nDispatched;
+}
+
+} // namespace bus
+} // namespace tf
+} // namespace ou
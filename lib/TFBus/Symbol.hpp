@@ -0,0 +1,84 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Symbol.hpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFBus
+ * Created: October 19, 2026 22:05 PM
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+
+#include <TFTrading/Symbol.h>
+
+#include "Ring.hpp"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace bus { // shared memory market data
+
+class Provider;
+
+class Symbol
+: public ou::tf::Symbol<Symbol>
+{
+  friend class Provider;
+public:
+
+  using inherited_t = ou::tf::Symbol<Symbol>;
+  using pInstrument_t = inherited_t::pInstrument_t;
+
+  // sRing: the upstream provider's name for the instrument, as used by the publisher
+  Symbol( const std::string& sName, pInstrument_t pInstrument, const std::string& sRing );
+  virtual ~Symbol();
+
+  const std::string& RingName() const { return m_sRing; }
+
+  uint64_t Received() const { return m_nReceived.load( std::memory_order_relaxed ); }
+  uint64_t Dropped() const { return m_nDropped.load( std::memory_order_relaxed ); } // lapped by the publisher
+
+protected:
+
+  // on the provider's poll thread, dispatches up to nLimit records, returns the count
+  size_t Drain( size_t nLimit );
+
+private:
+
+  using clock_t = std::chrono::steady_clock;
+
+  const std::string m_sRing;
+  uint32_t m_nStreams; // requested, maintained by the provider
+
+  Ring::pRing_t m_pRing;
+  uint64_t m_nNext; // sequence of the next record to dispatch
+  Record m_record;  // copied out of the ring
+
+  std::atomic<uint64_t> m_nReceived;
+  std::atomic<uint64_t> m_nDropped;
+
+  clock_t::time_point m_tpAttach;   // last attempt to open the ring
+  clock_t::time_point m_tpActivity; // last record, or last check for a replacement ring
+
+  bool Attach();
+  void Skip( uint64_t nPublished );
+  void Dispatch();
+};
+
+} // namespace bus
+} // namespace tf
+} // namespace ou
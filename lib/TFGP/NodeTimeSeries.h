@@ -33,6 +33,7 @@ public:
   virtual void PreProcess( void ) {
     TimeSeriesRegistration<TS>::SetTimeSeries( &this->m_pTimeSeries, this->m_ixTimeSeries );
   }
+  OpCode::E Op( void ) const { return OpCode::Input; }; // ToString names the series column
 protected:
 private:
 };
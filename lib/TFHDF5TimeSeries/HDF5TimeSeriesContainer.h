@@ -41,6 +41,7 @@ public:
   //void Read( const iterator &_begin, const iterator &_end, T* _dest );
   void Read( iterator &_begin, iterator &_end, typename ou::tf::TimeSeries<DD>* _dest );
   void Write( const DD* _begin, const DD* _end );
+  void Write( const ou::tf::TimeSeries<DD>& ); // segment by segment, from the insertion point of the first datum
 protected:
   iterator* m_end;
   virtual void SetNewSize( size_type newsize );
@@ -76,13 +77,20 @@ template<class DD> void HDF5TimeSeriesContainer<DD>::SetNewSize( size_type newsi
 }
 
 template<class DD> void HDF5TimeSeriesContainer<DD>::Read( iterator& _begin, iterator& _end, typename ou::tf::TimeSeries<DD>* _dest ) {
+  // _dest has been resized to hold the range, its storage may be in segments
   hsize_t cnt = _end - _begin;
-  H5::DataSpace* pDs = _dest->DefineDataSpace();
-  if ( cnt > 0 ) {
-    HDF5TimeSeriesAccessor<DD>::Read( _begin.m_ItemIndex, cnt, pDs, const_cast<DD*>( &(*_dest->First()) ) );
-  }
-  pDs->close();
-  delete pDs;
+  hsize_t ix = _begin.m_ItemIndex;
+  _dest->ForEachSegment(
+    [this,&cnt,&ix]( const DD* pSegment, size_t nSegment ){
+      hsize_t n = std::min<hsize_t>( cnt, nSegment );
+      if ( 0 < n ) {
+        H5::DataSpace ds( 1, &n );
+        HDF5TimeSeriesAccessor<DD>::Read( ix, n, &ds, const_cast<DD*>( pSegment ) );
+        ds.close();
+        ix += n;
+        cnt -= n;
+      }
+    } );
 }
 
 template<class DD> void HDF5TimeSeriesContainer<DD>::Write( const DD* _begin, const DD* _end ) {
@@ -95,5 +103,19 @@ template<class DD> void HDF5TimeSeriesContainer<DD>::Write( const DD* _begin, co
   }
 }
 
+template<class DD> void HDF5TimeSeriesContainer<DD>::Write( const ou::tf::TimeSeries<DD>& series ) {
+  if ( 0 < series.Size() ) {
+    std::pair<HDF5TimeSeriesContainer<DD>::iterator, HDF5TimeSeriesContainer<DD>::iterator> p;
+    p = std::equal_range( begin(), end(), *series.begin() );
+    // whether we found something or not, p.first is insertion point
+    hsize_t ix = p.first.m_ItemIndex;
+    series.ForEachSegment(
+      [this,&ix]( const DD* pSegment, size_t nSegment ){
+        HDF5TimeSeriesAccessor<DD>::Write( ix, nSegment, pSegment );
+        ix += nSegment;
+      } );
+  }
+}
+
 } // namespace tf
 } // namespace ou
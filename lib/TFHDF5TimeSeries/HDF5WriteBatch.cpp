@@ -0,0 +1,161 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    HDF5WriteBatch.cpp
+ * Author:  raymond@burkholder.net
+ * Project: TFHDF5TimeSeries
+ * Created: October 19, 2026 15:10 PM
+ */
+
+#include <set>
+#include <iostream>
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/thread/thread.hpp>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include "HDF5WriteBatch.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+HDF5WriteBatch::HDF5WriteBatch( hsize_t nChunkSize, size_t nThreads, bool bReport, int nDeflate )
+: m_nChunkSize( nChunkSize ), m_nDeflate( nDeflate ), m_nThreads( nThreads ), m_bReport( bReport )
+{
+  if ( 0 == m_nThreads ) m_nThreads = std::max<size_t>( 1, boost::thread::hardware_concurrency() );
+}
+
+HDF5WriteBatch::~HDF5WriteBatch( void ) {
+}
+
+void HDF5WriteBatch::AddOptionAttributes( const std::string& sPathName, const HDF5Attributes::structOption& option ) {
+  m_vOption.emplace_back( pairOption_t( sPathName, option ) );
+}
+
+void HDF5WriteBatch::Write( void ) {
+
+  namespace pt = boost::posix_time;
+
+  if ( 0 == m_vEntry.size() ) {
+    m_vOption.clear();
+    return;
+  }
+
+  pt::ptime dtStart( pt::microsec_clock::universal_time() );
+
+  { // stage 1: snapshot each series, io_context::run returns once all are done
+    boost::asio::io_context srvc;
+    for ( Entry& entry: m_vEntry ) {
+      Entry* pEntry( &entry );
+      boost::asio::post( srvc, [pEntry](){
+        try {
+          pEntry->nBytes = pEntry->fSnapshot();
+        }
+        catch ( const std::exception& e ) {
+          std::cout << "HDF5WriteBatch::Write snapshot " << pEntry->sPathName << " problem: " << e.what() << std::endl;
+        }
+      } );
+    }
+    boost::thread_group threads;
+    for ( size_t ix = 0; ix < std::min( m_nThreads, m_vEntry.size() ); ix++ ) {
+      threads.create_thread( [&srvc](){ srvc.run(); } );
+    }
+    threads.join_all();
+  }
+
+  pt::ptime dtSnapshot( pt::microsec_clock::universal_time() );
+
+  ou::tf::HDF5DataManager dm( ou::tf::HDF5DataManager::RDWR );
+
+  // stage 2: data, one writer
+  for ( Entry& entry: m_vEntry ) {
+    try {
+      entry.fWrite( dm );
+    }
+    catch ( H5::Exception& e ) {
+      std::cout << "HDF5WriteBatch::Write " << entry.sPathName << " H5::Exception " << e.getDetailMsg() << std::endl;
+    }
+    catch ( const std::exception& e ) {
+      std::cout << "HDF5WriteBatch::Write " << entry.sPathName << " problem: " << e.what() << std::endl;
+    }
+  }
+
+  pt::ptime dtData( pt::microsec_clock::universal_time() );
+
+  // stage 3: attributes
+  for ( const Entry& entry: m_vEntry ) {
+    try {
+      HDF5Attributes attr( dm, entry.sPathName );
+      attr.SetSignature( entry.attributes.nSignature );
+      if ( entry.attributes.bInstrument ) {
+        attr.SetMultiplier( entry.attributes.nMultiplier );
+        attr.SetSignificantDigits( entry.attributes.nSignificantDigits );
+      }
+      attr.SetProviderType( entry.attributes.idProvider );
+    }
+    catch ( H5::Exception& e ) {
+      std::cout << "HDF5WriteBatch::Write attributes " << entry.sPathName << " H5::Exception " << e.getDetailMsg() << std::endl;
+    }
+  }
+  for ( const pairOption_t& option: m_vOption ) {
+    try {
+      HDF5Attributes attr( dm, option.first, option.second );
+    }
+    catch ( H5::Exception& e ) {
+      std::cout << "HDF5WriteBatch::Write option attributes " << option.first << " H5::Exception " << e.getDetailMsg() << std::endl;
+    }
+  }
+
+  dm.Flush();
+
+  pt::ptime dtEnd( pt::microsec_clock::universal_time() );
+
+  if ( m_bReport ) Report( dtStart, dtSnapshot, dtData, dtEnd );
+
+  m_vEntry.clear();
+  m_vOption.clear();
+}
+
+void HDF5WriteBatch::Report(
+  boost::posix_time::ptime dtStart, boost::posix_time::ptime dtSnapshot,
+  boost::posix_time::ptime dtData, boost::posix_time::ptime dtEnd
+) const {
+
+  size_t nBytes {};
+  std::set<std::string> setSymbol;
+  for ( const Entry& entry: m_vEntry ) {
+    nBytes += entry.nBytes;
+    setSymbol.insert( entry.sSymbol );
+  }
+  const size_t nSymbols( setSymbol.size() );
+  const double dblSeconds( (double)( dtEnd - dtStart ).total_microseconds() / 1000000.0 );
+
+  std::cout
+    << "HDF5WriteBatch: "
+    << m_vEntry.size() << " series, "
+    << nSymbols << " symbols, "
+    << nBytes << " bytes in " << dblSeconds << "s"
+    << " (snapshot " << ( dtSnapshot - dtStart )
+    << ", data " << ( dtData - dtSnapshot )
+    << ", attributes " << ( dtEnd - dtData ) << ")"
+    << ", per symbol " << ( nBytes / nSymbols ) << " bytes, "
+    << ( 1000.0 * dblSeconds / nSymbols ) << "ms"
+    << std::endl;
+}
+
+} // namespace tf
+} // namespace ou
@@ -0,0 +1,175 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    HDF5WriteBatch.h
+ * Author:  raymond@burkholder.net
+ * Project: TFHDF5TimeSeries
+ * Created: October 19, 2026 15:10 PM
+ */
+
+#pragma once
+
+#include <mutex>
+#include <memory>
+#include <string>
+#include <vector>
+#include <functional>
+
+#include <boost/cstdint.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+#include "HDF5Attribute.h"
+#include "HDF5WriteTimeSeries.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+// collects many series, typically from all watches at end of day, and writes them in one pass
+//   1) each series is copied to its own buffer, in parallel, so feeds may continue appending:
+//        a series still being appended to is copied under the mutex its owner appends with, see Add,
+//        which holds off the owner's appends for the length of that copy
+//   2) the file is opened once and each buffer is written in a single call from one thread
+//   3) attributes are written in a second pass over the same open file
+// time and bytes, in total and per symbol, are reported to std::cout when bReport is set
+
+class HDF5WriteBatch {
+public:
+
+  struct Attributes {
+    boost::uint64_t nSignature;
+    bool bInstrument; // multiplier and significant digits are written
+    unsigned short nMultiplier;
+    unsigned char nSignificantDigits;
+    keytypes::eidProvider_t idProvider;
+    Attributes()
+    : nSignature {}, bInstrument( false ), nMultiplier( 1 ), nSignificantDigits {}, idProvider( keytypes::EProviderUnknown ) {}
+    Attributes( boost::uint64_t nSignature_, keytypes::eidProvider_t idProvider_ )
+    : nSignature( nSignature_ ), bInstrument( false ), nMultiplier( 1 ), nSignificantDigits {}, idProvider( idProvider_ ) {}
+    Attributes( boost::uint64_t nSignature_, unsigned short nMultiplier_, unsigned char nSignificantDigits_, keytypes::eidProvider_t idProvider_ )
+    : nSignature( nSignature_ ), bInstrument( true ), nMultiplier( nMultiplier_ ), nSignificantDigits( nSignificantDigits_ ), idProvider( idProvider_ ) {}
+  };
+
+  // nThreads 0: one per hardware thread, nDeflate 0: stored uncompressed
+  HDF5WriteBatch( hsize_t nChunkSize = 256, size_t nThreads = 0, bool bReport = true, int nDeflate = 5 );
+  ~HDF5WriteBatch( void );
+
+  template<typename TS> // series is referenced until Write, and copied there
+  // pMutex: held by the owner while appending, and here while copying, nullptr when appends have stopped
+  void Add( const std::string& sSymbol, const std::string& sPathName, const TS& series, const Attributes&, std::mutex* pMutex = nullptr );
+
+  template<typename TS> // series is owned by the batch, for one-off series built at save time
+  void Add( const std::string& sSymbol, const std::string& sPathName, std::shared_ptr<TS> pSeries, const Attributes& );
+
+  void AddOptionAttributes( const std::string& sPathName, const HDF5Attributes::structOption& ); // applied in the attribute pass
+
+  void Write( void ); // snapshot, write, attribute, then clears the batch
+
+  size_t Size( void ) const { return m_vEntry.size(); }
+
+protected:
+private:
+
+  struct Entry {
+    std::string sSymbol;
+    std::string sPathName;
+    Attributes attributes;
+    size_t nBytes;
+    std::function<size_t()> fSnapshot; // copy the series, returns bytes, run on the pool
+    std::function<void( HDF5DataManager& )> fWrite; // write and release the copy, run serially
+    Entry( const std::string& sSymbol_, const std::string& sPathName_, const Attributes& attributes_ )
+    : sSymbol( sSymbol_ ), sPathName( sPathName_ ), attributes( attributes_ ), nBytes {} {}
+  };
+  using vEntry_t = std::vector<Entry>;
+  vEntry_t m_vEntry;
+
+  using pairOption_t = std::pair<std::string,HDF5Attributes::structOption>;
+  using vOption_t = std::vector<pairOption_t>;
+  vOption_t m_vOption;
+
+  hsize_t m_nChunkSize;
+  int m_nDeflate;
+  size_t m_nThreads;
+  bool m_bReport;
+
+  void Report(
+    boost::posix_time::ptime dtStart, boost::posix_time::ptime dtSnapshot,
+    boost::posix_time::ptime dtData, boost::posix_time::ptime dtEnd ) const;
+
+  template<typename TS>
+  static std::shared_ptr<TS> Copy( const TS& series, std::mutex* pMutex ) {
+    if ( nullptr == pMutex ) return std::make_shared<TS>( series );
+    std::lock_guard<std::mutex> lock( *pMutex );
+    return std::make_shared<TS>( series );
+  }
+
+  template<typename TS>
+  void Emplace( const std::string& sSymbol, const std::string& sPathName, const Attributes&, std::shared_ptr<std::shared_ptr<TS> > );
+
+};
+
+template<typename TS>
+void HDF5WriteBatch::Add( const std::string& sSymbol, const std::string& sPathName, const TS& series, const Attributes& attributes, std::mutex* pMutex ) {
+
+  if ( nullptr == pMutex ) {
+    if ( 0 == series.Size() ) return;
+  }
+  else {
+    std::lock_guard<std::mutex> lock( *pMutex );
+    if ( 0 == series.Size() ) return;
+  }
+
+  using pTS_t = std::shared_ptr<TS>;
+  std::shared_ptr<pTS_t> ppBuffer( std::make_shared<pTS_t>() ); // shared between the two stages
+
+  Emplace<TS>( sSymbol, sPathName, attributes, ppBuffer );
+  m_vEntry.back().fSnapshot = [&series,ppBuffer,pMutex]()->size_t{
+    *ppBuffer = Copy( series, pMutex );
+    return (*ppBuffer)->Size() * sizeof( typename TS::datum_t );
+  };
+}
+
+template<typename TS>
+void HDF5WriteBatch::Add( const std::string& sSymbol, const std::string& sPathName, std::shared_ptr<TS> pSeries, const Attributes& attributes ) {
+
+  if ( !pSeries || ( 0 == pSeries->Size() ) ) return;
+
+  using pTS_t = std::shared_ptr<TS>;
+  std::shared_ptr<pTS_t> ppBuffer( std::make_shared<pTS_t>( pSeries ) );
+
+  Emplace<TS>( sSymbol, sPathName, attributes, ppBuffer );
+  m_vEntry.back().fSnapshot = [ppBuffer]()->size_t{
+    return (*ppBuffer)->Size() * sizeof( typename TS::datum_t );
+  };
+}
+
+template<typename TS>
+void HDF5WriteBatch::Emplace( const std::string& sSymbol, const std::string& sPathName, const Attributes& attributes, std::shared_ptr<std::shared_ptr<TS> > ppBuffer ) {
+
+  m_vEntry.emplace_back( Entry( sSymbol, sPathName, attributes ) );
+
+  const hsize_t nChunkSize( m_nChunkSize );
+  const int nDeflate( m_nDeflate );
+  m_vEntry.back().fWrite = [ppBuffer,sPathName,nChunkSize,nDeflate]( HDF5DataManager& dm ){
+    std::shared_ptr<TS> pBuffer;
+    pBuffer.swap( *ppBuffer ); // released on return
+    if ( pBuffer && ( 0 != pBuffer->Size() ) ) {
+      HDF5WriteTimeSeries<TS> wts( dm, 0 < nDeflate, true, nDeflate, nChunkSize );
+      wts.Write( sPathName, pBuffer.get() );
+    }
+  };
+}
+
+} // namespace tf
+} // namespace ou
@@ -124,7 +124,7 @@ template<class TS> void HDF5WriteTimeSeries<TS>::Write(const std::string &sPathN
 
   try {
     HDF5TimeSeriesContainer<DD> repository( m_dm, sPathName );
-    repository.Write( timeseries->First(), timeseries->Last() + 1 );
+    repository.Write( *timeseries );
     //dm.AddGroupForSymbol( m_sSymbol );
     //dm.GetH5File()->link( H5L_type_t::H5L_TYPE_HARD, sFileName1, "/symbol/" + m_sSymbol + "/bar.86400" );
   }
@@ -0,0 +1,486 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    HistoryDownloader.cpp
+ * Author:  raymond@burkholder.net
+ * Project: TFIQFeed
+ * Created: October 19, 2026 18:15 PM
+ */
+
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+
+#include "HistoryQuery.h"
+#include "HistoryDownloader.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace iqfeed { // IQFeed
+
+// one history port connection, its requests are issued by the dispatcher
+
+class HistoryDownloader::Connection: public HistoryQuery<Connection> {
+  friend HistoryQuery<Connection>;
+public:
+
+  using inherited_t = HistoryQuery<Connection>;
+
+  Connection( HistoryDownloader& downloader, size_t ix )
+  : m_downloader( downloader ), m_ix( ix )
+  {
+    SetAddress( m_downloader.m_config.sAddress );
+    SetPort( m_downloader.m_config.nPort );
+    SetRequestDelay( 0 ); // the token bucket paces requests
+  }
+
+  virtual ~Connection() {}
+
+  void Issue( const Request& request ) { // throws std::logic_error if a request is in progress
+    m_sError.clear();
+    m_pBars = std::make_shared<ou::tf::Bars>();
+    switch ( request.type ) {
+      case EType::EndOfDay:
+        RetrieveNEndOfDays( request.sSymbol, request.nCount );
+        break;
+      case EType::Intervals:
+        RetrieveNIntervals( request.sSymbol, request.nSeconds, request.nCount );
+        break;
+    }
+  }
+
+protected:
+
+  // CRTP from HistoryQuery<Connection>
+  void OnHistoryConnected() {
+    m_downloader.HandleConnected( m_ix );
+  }
+
+  void OnHistoryDisconnected() {
+    m_stateRetrieval = inherited_t::RetrievalState::Idle; // an interrupted request is retried on a fresh connection
+    m_downloader.HandleDisconnected( m_ix );
+  }
+
+  void OnHistoryError( size_t e ) {
+    m_downloader.HandleError( m_ix, e );
+  }
+
+  void OnHistoryIntervalData( Interval* pDP ) {
+    m_pBars->Append( ou::tf::Bar( pDP->DateTime, pDP->Open, pDP->High, pDP->Low, pDP->Close, pDP->PeriodVolume ) );
+    ReQueueInterval( pDP );
+  }
+
+  void OnHistoryEndOfDayData( EndOfDay* pDP ) {
+    m_pBars->Append( ou::tf::Bar( pDP->DateTime, pDP->Open, pDP->High, pDP->Low, pDP->Close, pDP->PeriodVolume ) );
+    ReQueueEndOfDay( pDP );
+  }
+
+  void OnHistoryRequestError( const std::string& sError ) {
+    m_sError = sError;
+  }
+
+  void OnHistoryRequestDone( bool bStatus ) {
+    pBars_t pBars;
+    pBars.swap( m_pBars );
+    m_downloader.HandleDone( m_ix, bStatus, m_sError, pBars );
+  }
+
+private:
+  HistoryDownloader& m_downloader;
+  const size_t m_ix;
+  std::string m_sError;
+  pBars_t m_pBars;
+};
+
+HistoryDownloader::Slot::Slot(): state( EState::Disconnected ) {}
+HistoryDownloader::Slot::Slot( Slot&& ) = default;
+HistoryDownloader::Slot::~Slot() {}
+
+HistoryDownloader::HistoryDownloader( const Config& config, fBars_t&& fBars, fFailed_t&& fFailed )
+: m_config( config )
+, m_fBars( std::move( fBars ) ), m_fFailed( std::move( fFailed ) )
+, m_bStop( false ), m_nOutstanding {}
+, m_bucket( config.dblRequestsPerSecond, config.dblBurst )
+{
+  assert( m_fBars );
+  if ( 0 == m_config.nConnections ) m_config.nConnections = 1;
+  if ( 0 == m_config.nMaxAttempts ) m_config.nMaxAttempts = 1;
+  m_vSlot.resize( m_config.nConnections );
+  for ( size_t ix = 0; ix < m_vSlot.size(); ix++ ) {
+    m_vSlot[ ix ].pConnection = std::make_unique<Connection>( *this, ix );
+  }
+}
+
+HistoryDownloader::~HistoryDownloader( void ) {
+  Stop();
+}
+
+void HistoryDownloader::Start( void ) {
+  {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    if ( m_pDispatcher ) return;
+    m_bStop = false;
+    m_tpStart = clock_t::now();
+    for ( Slot& slot: m_vSlot ) {
+      slot.state = EState::Disconnected;
+      slot.tp = m_tpStart; // connect right away
+    }
+  }
+  m_pDispatcher = std::make_unique<std::thread>( [this](){ Dispatcher(); } );
+}
+
+void HistoryDownloader::EndOfDay( const std::string& sSymbol, unsigned int nDays ) {
+  Request request;
+  request.type = EType::EndOfDay;
+  request.sSymbol = sSymbol;
+  request.nCount = nDays;
+  Queue( std::move( request ) );
+}
+
+void HistoryDownloader::Intervals( const std::string& sSymbol, unsigned int nSeconds, unsigned int nIntervals ) {
+  Request request;
+  request.type = EType::Intervals;
+  request.sSymbol = sSymbol;
+  request.nCount = nIntervals;
+  request.nSeconds = nSeconds;
+  Queue( std::move( request ) );
+}
+
+void HistoryDownloader::Queue( Request&& request ) {
+  {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    m_dequeRequest.emplace_back( std::move( request ) );
+    m_nOutstanding++;
+    m_stats.nQueued++;
+  }
+  m_cvDispatch.notify_one();
+}
+
+void HistoryDownloader::Wait( void ) {
+  std::unique_lock<std::mutex> lock( m_mutex );
+  m_cvIdle.wait( lock, [this](){ return m_bStop || ( 0 == m_nOutstanding ); } );
+}
+
+void HistoryDownloader::Stop( void ) {
+
+  {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    if ( !m_pDispatcher ) return;
+    m_bStop = true;
+  }
+  m_cvDispatch.notify_one();
+  m_cvIdle.notify_all();
+  m_pDispatcher->join();
+  m_pDispatcher.reset();
+
+  // close connections before they are destroyed, Network would call back into a destroyed Connection
+  for ( Slot& slot: m_vSlot ) {
+    bool bConnected;
+    {
+      std::lock_guard<std::mutex> lock( m_mutex );
+      bConnected = ( EState::Idle == slot.state ) || ( EState::Busy == slot.state ) || ( EState::Settling == slot.state );
+      if ( bConnected ) slot.state = EState::Closing;
+    }
+    if ( bConnected ) slot.pConnection->Disconnect();
+  }
+  std::unique_lock<std::mutex> lock( m_mutex );
+  m_cvDispatch.wait_for( // a connect in progress resolves through the Network connect timer
+    lock, std::chrono::seconds( 5 ),
+    [this](){
+      for ( const Slot& slot: m_vSlot ) {
+        if ( EState::Disconnected != slot.state ) return false;
+      }
+      return true;
+    } );
+
+  m_dequeRequest.clear();
+  m_vRetry.clear();
+  m_nOutstanding = 0;
+}
+
+void HistoryDownloader::Dispatcher( void ) {
+
+  vAction_t vAction;
+
+  std::unique_lock<std::mutex> lock( m_mutex );
+  while ( !m_bStop ) {
+
+    const clock_t::time_point now( clock_t::now() );
+    clock_t::time_point tpWake( now + std::chrono::seconds( 1 ) ); // housekeeping, timeouts
+
+    // retries which are due go to the front of the queue
+    while ( !m_vRetry.empty() && ( m_vRetry.front().tpDue <= now ) ) {
+      std::pop_heap( m_vRetry.begin(), m_vRetry.end(), std::greater<Request>() );
+      m_dequeRequest.emplace_front( std::move( m_vRetry.back() ) );
+      m_vRetry.pop_back();
+    }
+    if ( !m_vRetry.empty() ) tpWake = std::min( tpWake, m_vRetry.front().tpDue );
+
+    for ( Slot& slot: m_vSlot ) {
+      Connection* pConnection( slot.pConnection.get() );
+      switch ( slot.state ) {
+        case EState::Disconnected:
+          if ( slot.tp <= now ) {
+            slot.state = EState::Connecting;
+            vAction.emplace_back( [pConnection](){ pConnection->Connect(); } );
+          }
+          else tpWake = std::min( tpWake, slot.tp );
+          break;
+        case EState::Busy:
+          if ( m_config.msTimeout <= ( now - slot.tp ) ) {
+            std::cout << "HistoryDownloader " << slot.request.sSymbol << " timed out" << std::endl;
+            m_stats.nTimeouts++;
+            slot.state = EState::Closing; // the request is retried from HandleDisconnected
+            vAction.emplace_back( [pConnection](){ pConnection->Disconnect(); } );
+          }
+          break;
+        case EState::Settling:
+          if ( slot.tp <= now ) slot.state = EState::Idle;
+          else tpWake = std::min( tpWake, slot.tp );
+          break;
+        default:
+          break;
+      }
+    }
+
+    // hand out requests while there are idle connections and tokens
+    for ( Slot& slot: m_vSlot ) {
+      if ( m_dequeRequest.empty() ) break;
+      if ( EState::Idle != slot.state ) continue;
+      const clock_t::duration wait( m_bucket.Take( now ) );
+      if ( clock_t::duration::zero() != wait ) {
+        m_stats.nThrottled++;
+        tpWake = std::min( tpWake, now + wait );
+        break;
+      }
+      slot.state = EState::Busy;
+      slot.tp = now;
+      slot.request = std::move( m_dequeRequest.front() );
+      m_dequeRequest.pop_front();
+      slot.request.nAttempt++;
+      m_stats.nRequests++;
+      Connection* pConnection( slot.pConnection.get() );
+      const Request request( slot.request );
+      const size_t ix( &slot - &m_vSlot.front() );
+      vAction.emplace_back(
+        [this,pConnection,request,ix](){
+          try {
+            pConnection->Issue( request );
+          }
+          catch ( const std::logic_error& e ) { // stale retrieval state, recycle the connection
+            std::cout << "HistoryDownloader " << request.sSymbol << " issue: " << e.what() << std::endl;
+            {
+              std::lock_guard<std::mutex> lock( m_mutex );
+              if ( EState::Busy == m_vSlot[ ix ].state ) m_vSlot[ ix ].state = EState::Closing;
+            }
+            pConnection->Disconnect();
+          }
+        } );
+    }
+
+    if ( vAction.empty() ) {
+      m_cvDispatch.wait_until( lock, tpWake );
+    }
+    else { // Connect, Disconnect and Send may call back into the downloader
+      lock.unlock();
+      for ( fAction_t& fAction: vAction ) fAction();
+      vAction.clear();
+      lock.lock();
+    }
+  }
+}
+
+void HistoryDownloader::Retry( Request&& request, const std::string& sReason, bool& bFailed ) {
+  if ( m_config.nMaxAttempts <= request.nAttempt ) {
+    m_stats.nFailed++;
+    bFailed = true;
+  }
+  else {
+    m_stats.nRetries++;
+    bFailed = false;
+    const auto msBackoff( std::min( m_config.msBackoffMax, m_config.msBackoff * ( 1 << std::min<size_t>( request.nAttempt - 1, 16 ) ) ) );
+    request.tpDue = clock_t::now() + msBackoff;
+    std::cout << "HistoryDownloader " << request.sSymbol << " retry " << request.nAttempt << " in " << msBackoff.count() << "ms: " << sReason << std::endl;
+    m_vRetry.emplace_back( std::move( request ) );
+    std::push_heap( m_vRetry.begin(), m_vRetry.end(), std::greater<Request>() );
+  }
+}
+
+void HistoryDownloader::Finish( void ) {
+  bool bIdle;
+  {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    assert( 0 < m_nOutstanding );
+    m_nOutstanding--;
+    bIdle = ( 0 == m_nOutstanding );
+  }
+  if ( bIdle ) m_cvIdle.notify_all();
+}
+
+void HistoryDownloader::HandleConnected( size_t ix ) {
+  bool bDisconnect( false );
+  {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    Slot& slot( m_vSlot[ ix ] );
+    if ( EState::Connecting == slot.state ) {
+      if ( m_bStop ) { // connected while Stop was closing the others
+        slot.state = EState::Closing;
+        bDisconnect = true;
+      }
+      else slot.state = EState::Idle;
+    }
+  }
+  if ( bDisconnect ) m_vSlot[ ix ].pConnection->Disconnect();
+  m_cvDispatch.notify_one();
+}
+
+void HistoryDownloader::HandleDisconnected( size_t ix ) {
+
+  bool bFailed( false );
+  std::string sSymbol;
+  {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    Slot& slot( m_vSlot[ ix ] );
+    const bool bInFlight( ( EState::Busy == slot.state ) || ( ( EState::Closing == slot.state ) && !slot.request.sSymbol.empty() ) );
+    if ( bInFlight && !m_bStop ) {
+      sSymbol = slot.request.sSymbol;
+      Retry( std::move( slot.request ), "disconnected", bFailed );
+    }
+    slot.request = Request();
+    slot.state = EState::Disconnected;
+    slot.tp = clock_t::now() + m_config.msReconnect;
+    if ( !m_bStop ) m_stats.nReconnects++;
+  }
+  m_cvDispatch.notify_all(); // the dispatcher, or Stop
+
+  if ( bFailed ) {
+    if ( m_fFailed ) m_fFailed( sSymbol, "disconnected" );
+    Finish();
+  }
+}
+
+void HistoryDownloader::HandleError( size_t ix, size_t e ) {
+
+  std::cout << "HistoryDownloader connection " << ix << " error " << e << std::endl;
+
+  bool bDisconnect( false );
+  {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    Slot& slot( m_vSlot[ ix ] );
+    switch ( slot.state ) {
+      case EState::Idle:
+      case EState::Busy:
+      case EState::Settling:
+        slot.state = EState::Closing; // an in flight request is retried from HandleDisconnected
+        bDisconnect = true;
+        break;
+      default: // a failed connect resolves through the Network connect timer
+        break;
+    }
+  }
+  if ( bDisconnect ) m_vSlot[ ix ].pConnection->Disconnect();
+}
+
+void HistoryDownloader::HandleDone( size_t ix, bool bStatus, const std::string& sError, pBars_t pBars ) {
+
+  enum class EOutcome { Stale, Delivered, Retried, Failed } outcome( EOutcome::Stale );
+  std::string sSymbol;
+  std::string sReason;
+
+  {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    Slot& slot( m_vSlot[ ix ] );
+    if ( EState::Busy == slot.state ) { // otherwise abandoned by a timeout
+      Request request( std::move( slot.request ) );
+      slot.request = Request();
+      sSymbol = request.sSymbol;
+      const clock_t::time_point now( clock_t::now() );
+      if ( !bStatus ) { // invalid symbol
+        slot.state = EState::Settling;
+        slot.tp = now + m_config.msSettle;
+        m_stats.nFailed++;
+        sReason = "invalid symbol";
+        outcome = EOutcome::Failed;
+      }
+      else {
+        slot.state = EState::Idle;
+        if ( sError.empty() || ( std::string::npos != sError.find( "NO_DATA" ) ) ) {
+          m_stats.nCompleted++;
+          m_stats.nBars += pBars ? pBars->Size() : 0;
+          outcome = EOutcome::Delivered;
+        }
+        else {
+          if ( std::string::npos != sError.find( "Too many" ) ) {
+            m_bucket.Drain( now );
+          }
+          bool bFailed;
+          sReason = sError;
+          Retry( std::move( request ), sError, bFailed );
+          outcome = bFailed ? EOutcome::Failed : EOutcome::Retried;
+        }
+      }
+    }
+  }
+  m_cvDispatch.notify_one();
+
+  switch ( outcome ) {
+    case EOutcome::Delivered:
+      if ( !pBars ) pBars = std::make_shared<ou::tf::Bars>();
+      try {
+        m_fBars( sSymbol, pBars );
+      }
+      catch ( const std::exception& e ) {
+        std::cout << "HistoryDownloader " << sSymbol << " bars: " << e.what() << std::endl;
+      }
+      Finish();
+      break;
+    case EOutcome::Failed:
+      if ( m_fFailed ) m_fFailed( sSymbol, sReason );
+      Finish();
+      break;
+    default:
+      break;
+  }
+}
+
+HistoryDownloader::Stats HistoryDownloader::GetStats( void ) const {
+  std::lock_guard<std::mutex> lock( m_mutex );
+  Stats stats( m_stats );
+  if ( clock_t::time_point() != m_tpStart ) {
+    stats.dblElapsed = std::chrono::duration<double>( clock_t::now() - m_tpStart ).count();
+  }
+  return stats;
+}
+
+void HistoryDownloader::Summary( void ) const {
+  const Stats stats( GetStats() );
+  std::cout
+    << "HistoryDownloader: "
+    << stats.nQueued << " queued, "
+    << stats.nCompleted << " completed, "
+    << stats.nFailed << " failed, "
+    << stats.nBars << " bars, "
+    << stats.nRequests << " requests, "
+    << stats.nRetries << " retries, "
+    << stats.nTimeouts << " timeouts, "
+    << stats.nReconnects << " reconnects, "
+    << stats.nThrottled << " throttled, "
+    << stats.RequestsPerSecond() << " requests/s"
+    << std::endl;
+}
+
+} // namespace iqfeed
+} // namespace tf
+} // namespace ou
@@ -0,0 +1,231 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    HistoryDownloader.h
+ * Author:  raymond@burkholder.net
+ * Project: TFIQFeed
+ * Created: October 19, 2026 18:15 PM
+ */
+
+#pragma once
+
+#include <deque>
+#include <algorithm>
+#include <mutex>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <functional>
+#include <condition_variable>
+
+#include <TFTimeSeries/TimeSeries.h>
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace iqfeed { // IQFeed
+
+// requests are paced by a token bucket, iqfeed allows 50 history requests per second
+//   tokens refill at the rate, up to the burst size, a request waits until a token is available
+
+class TokenBucket {
+public:
+
+  using clock_t = std::chrono::steady_clock;
+
+  TokenBucket( double dblRate, double dblBurst )
+  : m_dblRate( dblRate ), m_dblBurst( dblBurst ), m_dblTokens( dblBurst ), m_tp( clock_t::now() ) {}
+
+  // zero when a token was taken, otherwise the wait until one is available
+  clock_t::duration Take( clock_t::time_point now ) {
+    Refill( now );
+    if ( 1.0 <= m_dblTokens ) {
+      m_dblTokens -= 1.0;
+      return clock_t::duration::zero();
+    }
+    const clock_t::duration wait(
+      std::chrono::duration_cast<clock_t::duration>( std::chrono::duration<double>( ( 1.0 - m_dblTokens ) / m_dblRate ) ) );
+    return std::max( wait, clock_t::duration( 1 ) );
+  }
+
+  // the server pushed back, start refilling from empty
+  void Drain( clock_t::time_point now ) {
+    Refill( now );
+    m_dblTokens = std::min( m_dblTokens, 0.0 );
+  }
+
+private:
+
+  double m_dblRate;   // tokens per second
+  double m_dblBurst;  // bucket size
+  double m_dblTokens;
+  clock_t::time_point m_tp; // last refill
+
+  void Refill( clock_t::time_point now ) {
+    const double dblSeconds( std::chrono::duration<double>( now - m_tp ).count() );
+    m_dblTokens = std::min( m_dblBurst, m_dblTokens + m_dblRate * dblSeconds );
+    m_tp = now;
+  }
+
+};
+
+// bulk history download over several connections to the iqfeed history port
+//   a work queue feeds the connections, each connection has one request in flight,
+//     and is handed its next request as soon as the previous one completes
+//   the token bucket paces the requests across all connections
+//   errors, timeouts and dropped connections are retried with exponential backoff,
+//     an invalid symbol is not retried, it is reported through fFailed_t
+//   bars for a request accumulate into one series, handed over whole through fBars_t
+// callbacks run on the connection threads, and may run concurrently
+// the address and port may point to a local mock history server for testing
+
+class HistoryDownloader {
+public:
+
+  using pBars_t = std::shared_ptr<ou::tf::Bars>;
+
+  using fBars_t = std::function<void( const std::string& sSymbol, pBars_t )>; // empty series for !NO_DATA!
+  using fFailed_t = std::function<void( const std::string& sSymbol, const std::string& sReason )>;
+
+  struct Config {
+    std::string sAddress;
+    uint16_t nPort;
+    size_t nConnections;
+    double dblRequestsPerSecond;
+    double dblBurst;
+    size_t nMaxAttempts; // includes the first
+    std::chrono::milliseconds msBackoff;    // first retry, doubled on each subsequent attempt
+    std::chrono::milliseconds msBackoffMax;
+    std::chrono::milliseconds msTimeout;    // a request without completion is abandoned, and its connection recycled
+    std::chrono::milliseconds msSettle;     // quiet time after an invalid symbol, for a trailing !ENDMSG!
+    std::chrono::milliseconds msReconnect;  // Network has a 2 second connect timer, reconnect after it has expired
+    Config()
+    : sAddress( "127.0.0.1" ), nPort( 9100 )
+    , nConnections( 8 )
+    , dblRequestsPerSecond( 40.0 ), dblBurst( 5.0 ) // rate + burst bounds any one second, kept under 50
+    , nMaxAttempts( 5 )
+    , msBackoff( 250 ), msBackoffMax( 8000 )
+    , msTimeout( 30000 ), msSettle( 250 ), msReconnect( 3000 )
+    {}
+  };
+
+  struct Stats {
+    size_t nQueued;
+    size_t nRequests;   // sent, includes retries
+    size_t nCompleted;
+    size_t nBars;
+    size_t nRetries;
+    size_t nFailed;
+    size_t nTimeouts;
+    size_t nReconnects;
+    size_t nThrottled;  // dispatches which waited on the token bucket
+    double dblElapsed;  // seconds since Start
+    Stats()
+    : nQueued {}, nRequests {}, nCompleted {}, nBars {}, nRetries {}, nFailed {}
+    , nTimeouts {}, nReconnects {}, nThrottled {}, dblElapsed {} {}
+    double RequestsPerSecond( void ) const { return ( 0.0 == dblElapsed ) ? 0.0 : nRequests / dblElapsed; }
+  };
+
+  HistoryDownloader( const Config&, fBars_t&&, fFailed_t&& = nullptr );
+  ~HistoryDownloader( void );
+
+  void Start( void ); // connect, and begin dispatching
+
+  void EndOfDay( const std::string& sSymbol, unsigned int nDays ); // HDX, 0 for all
+  void Intervals( const std::string& sSymbol, unsigned int nSeconds, unsigned int nIntervals ); // HIX
+
+  void Wait( void ); // until each request queued so far has been delivered or has failed
+  void Stop( void ); // outstanding requests are abandoned, connections are closed
+
+  Stats GetStats( void ) const;
+  void Summary( void ) const;
+
+protected:
+private:
+
+  using clock_t = TokenBucket::clock_t;
+
+  enum class EType { EndOfDay, Intervals };
+
+  struct Request {
+    EType type;
+    std::string sSymbol;
+    unsigned int nCount;    // days or intervals
+    unsigned int nSeconds;  // interval width
+    size_t nAttempt;
+    clock_t::time_point tpDue; // retry
+    Request(): type( EType::EndOfDay ), nCount {}, nSeconds {}, nAttempt {} {}
+    bool operator>( const Request& rhs ) const { return tpDue > rhs.tpDue; }
+  };
+
+  class Connection;
+
+  enum class EState { Disconnected, Connecting, Idle, Busy, Closing, Settling };
+
+  struct Slot {
+    std::unique_ptr<Connection> pConnection;
+    EState state;
+    Request request;          // while Busy
+    clock_t::time_point tp;   // Busy: sent, Settling: until, Disconnected: reconnect at
+    Slot();
+    Slot( Slot&& );
+    ~Slot(); // Connection is complete in the .cpp
+  };
+  using vSlot_t = std::vector<Slot>;
+
+  using fAction_t = std::function<void()>; // run by the dispatcher outside the lock
+  using vAction_t = std::vector<fAction_t>;
+
+  Config m_config;
+
+  fBars_t m_fBars;
+  fFailed_t m_fFailed;
+
+  mutable std::mutex m_mutex;
+  std::condition_variable m_cvDispatch;
+  std::condition_variable m_cvIdle;
+
+  bool m_bStop;
+  size_t m_nOutstanding; // queued, waiting on retry, or in flight
+
+  TokenBucket m_bucket;
+
+  vSlot_t m_vSlot;
+  std::deque<Request> m_dequeRequest;
+  std::vector<Request> m_vRetry; // min-heap on tpDue
+
+  std::unique_ptr<std::thread> m_pDispatcher;
+
+  clock_t::time_point m_tpStart;
+  Stats m_stats;
+
+  void Queue( Request&& );
+  void Dispatcher( void );
+  void Retry( Request&&, const std::string& sReason, bool& bFailed ); // m_mutex is held
+  void Finish( void ); // one outstanding request has been delivered or has failed
+
+  // from the connections
+  void HandleConnected( size_t ix );
+  void HandleDisconnected( size_t ix );
+  void HandleError( size_t ix, size_t e );
+  void HandleDone( size_t ix, bool bStatus, const std::string& sError, pBars_t );
+
+};
+
+} // namespace iqfeed
+} // namespace tf
+} // namespace ou
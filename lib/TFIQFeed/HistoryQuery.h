@@ -324,13 +324,17 @@ protected:
   void OnHistoryTickDataPoint( TickDataPoint* pDP ) { ReQueueTickDataPoint( pDP ); };
   void OnHistoryIntervalData( Interval* pDP ) { ReQueueInterval( pDP ); };
   void OnHistoryEndOfDayData( EndOfDay* pDP ) { ReQueueEndOfDay( pDP ); };
+  void OnHistoryRequestError( const std::string& ) {}; // error line other than invalid symbol, the request continues to !ENDMSG!
   void OnHistoryRequestDone( bool ) {};
 
+  // pause before each request is sent, 0 for callers which pace themselves
+  void SetRequestDelay( size_t nMilliseconds ) { m_nMillisecondsToSleep = nMilliseconds; }
+
 private:
 
   using const_iterator_t = typename inherited_t::linebuffer_t::const_iterator;
 
-  static const size_t m_nMillisecondsToSleep;
+  size_t m_nMillisecondsToSleep;
 
   // used for containing parsed data and passing it on
   ou::BufferRepository<TickDataPoint> m_reposTickDataPoint;
@@ -352,7 +356,8 @@ private:
 template <typename T>
 HistoryQuery<T>::HistoryQuery()
 : Network<HistoryQuery<T> >( "127.0.0.1", 9100 ),
-  m_stateRetrieval( RetrievalState::Idle )
+  m_stateRetrieval( RetrievalState::Idle ),
+  m_nMillisecondsToSleep( 75 )
 {
   m_ruleEndMsg = qi::lit( "!ENDMSG!" );
   m_ruleErrorInvalidSymbol = qi::lit( "E,Invalid symbol" );
@@ -408,7 +413,7 @@ void HistoryQuery<T>::RetrieveNDataPoints( const std::string& sSymbol, unsigned
   else {
     m_stateRetrieval = RetrievalState::RetrieveDataPoints;
     std::stringstream ss;
-    boost::this_thread::sleep( boost::posix_time::milliseconds( m_nMillisecondsToSleep ) );
+    if ( 0 < m_nMillisecondsToSleep ) boost::this_thread::sleep( boost::posix_time::milliseconds( m_nMillisecondsToSleep ) );
     ss << "HTX," << sSymbol << "," << n << ",1,D\n";
     this->Send( ss.str().c_str() );
   }
@@ -422,7 +427,7 @@ void HistoryQuery<T>::RetrieveNDaysOfDataPoints( const std::string& sSymbol, uns
   else {
     m_stateRetrieval = RetrievalState::RetrieveDataPoints;
     std::stringstream ss;
-    boost::this_thread::sleep( boost::posix_time::milliseconds( m_nMillisecondsToSleep ) );
+    if ( 0 < m_nMillisecondsToSleep ) boost::this_thread::sleep( boost::posix_time::milliseconds( m_nMillisecondsToSleep ) );
     ss << "HTD," << sSymbol << "," << n << ",,,,1,D\n";
     this->Send( ss.str().c_str() );
   }
@@ -446,7 +451,7 @@ void HistoryQuery<T>::RetrieveDatedRangeOfDataPoints( const std::string& sSymbol
     ss.imbue( special_locale );
     (*facet).format( "%Y%m%d %H%M%S" );
 
-    boost::this_thread::sleep( boost::posix_time::milliseconds( m_nMillisecondsToSleep ) );
+    if ( 0 < m_nMillisecondsToSleep ) boost::this_thread::sleep( boost::posix_time::milliseconds( m_nMillisecondsToSleep ) );
 
     ss << "HTT," << sSymbol << "," << dtStart << "," << dtEnd << ",,,,1,D\n";
     this->Send( ss.str().c_str() );
@@ -461,7 +466,7 @@ void HistoryQuery<T>::RetrieveNIntervals( const std::string& sSymbol, unsigned i
   else {
     m_stateRetrieval = RetrievalState::RetrieveIntervals;
     std::stringstream ss;
-    boost::this_thread::sleep( boost::posix_time::milliseconds( m_nMillisecondsToSleep ) );
+    if ( 0 < m_nMillisecondsToSleep ) boost::this_thread::sleep( boost::posix_time::milliseconds( m_nMillisecondsToSleep ) );
     ss << "HIX," << sSymbol << "," << i << "," << n << ",1,I\n";
     this->Send( ss.str().c_str() );
   }
@@ -475,7 +480,7 @@ void HistoryQuery<T>::RetrieveNDaysOfIntervals( const std::string& sSymbol, unsi
   else {
     m_stateRetrieval = RetrievalState::RetrieveIntervals;
     std::stringstream ss;
-    boost::this_thread::sleep( boost::posix_time::milliseconds( m_nMillisecondsToSleep ) );
+    if ( 0 < m_nMillisecondsToSleep ) boost::this_thread::sleep( boost::posix_time::milliseconds( m_nMillisecondsToSleep ) );
     ss << "HID," << sSymbol << "," << i << "," << n << ",,,,1,I\n";
     this->Send( ss.str().c_str() );
   }
@@ -489,7 +494,7 @@ void HistoryQuery<T>::RetrieveNEndOfDays( const std::string& sSymbol, unsigned i
   else {
     m_stateRetrieval = RetrievalState::RetrieveEndOfDays;
     std::stringstream ss;
-    boost::this_thread::sleep( boost::posix_time::milliseconds( m_nMillisecondsToSleep ) );
+    if ( 0 < m_nMillisecondsToSleep ) boost::this_thread::sleep( boost::posix_time::milliseconds( m_nMillisecondsToSleep ) );
     ss << "HDX," << sSymbol << "," << n << ",1,E\n";
     this->Send( ss.str().c_str() );
   }
@@ -574,6 +579,11 @@ void HistoryQuery<T>::ProcessHistoryRetrieval( linebuffer_t* buf ) {
             static_cast<T*>( this )->OnHistoryRequestDone( false );
           }
       }
+      else {
+        if ( &HistoryQuery<T>::OnHistoryRequestError != &T::OnHistoryRequestError ) {
+          static_cast<T*>( this )->OnHistoryRequestError( std::string( bgn2, end ) );
+        }
+      }
     }
     else {
       b = parse( bgn2, end, m_ruleEndMsg );
@@ -593,8 +603,6 @@ void HistoryQuery<T>::ProcessHistoryRetrieval( linebuffer_t* buf ) {
   }
 }
 
-template <typename T> const size_t HistoryQuery<T>::m_nMillisecondsToSleep = 75;
-
 } // namespace iqfeed
 } // namespace tf
 } // namespace ou
@@ -280,6 +280,7 @@ void IQFeed<T>::OnNetworkLineBuffer( linebuffer_t* pBuffer ) {
           case v62: {
             IQFDynamicFeedUpdateMessage* msg = m_reposDynamicFeedUpdateMessages.CheckOutL();
             msg->Assign( iter, end );
+            ou::latency::Mark( ou::latency::EStage::Parse );
             if ( &IQFeed<T>::OnIQFeedDynamicFeedUpdateMessage != &T::OnIQFeedDynamicFeedUpdateMessage ) {
               static_cast<T*>( this )->OnIQFeedDynamicFeedUpdateMessage( pBuffer, msg);
             }
@@ -309,6 +310,7 @@ void IQFeed<T>::OnNetworkLineBuffer( linebuffer_t* pBuffer ) {
           case v62: {
             IQFDynamicFeedSummaryMessage* msg = m_reposDynamicFeedSummaryMessages.CheckOutL();
             msg->Assign( iter, end );
+            ou::latency::Mark( ou::latency::EStage::Parse );
             if ( &IQFeed<T>::OnIQFeedDynamicFeedSummaryMessage != &T::OnIQFeedDynamicFeedSummaryMessage ) {
               static_cast<T*>( this )->OnIQFeedDynamicFeedSummaryMessage( pBuffer, msg);
             }
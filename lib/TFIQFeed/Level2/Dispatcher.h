@@ -191,7 +191,9 @@ void Dispatcher<T>::OnNetworkLineBuffer( l2_linebuffer_t* pBuffer ) {
         namespace OrderArrival = ou::tf::iqfeed::l2::msg::OrderArrival;
         OrderArrival::decoded msg;
         if ( OrderArrival::Decode( m_parserArrival, msg, iter, end) ) {
+          ou::latency::Mark( ou::latency::EStage::Parse );
           static_cast<T*>( this )->OnMBOAdd( msg );
+          ou::latency::Mark( ou::latency::EStage::Callback );
         }
         else {
           std::cout << "MarketDepth Order Add error" << std::endl;
@@ -203,7 +205,9 @@ void Dispatcher<T>::OnNetworkLineBuffer( l2_linebuffer_t* pBuffer ) {
         namespace OrderArrival = ou::tf::iqfeed::l2::msg::OrderArrival;
         OrderArrival::decoded msg;
         if ( OrderArrival::Decode( m_parserArrival, msg, iter, end) ) {
+          ou::latency::Mark( ou::latency::EStage::Parse );
           static_cast<T*>( this )->OnMBOUpdate( msg );
+          ou::latency::Mark( ou::latency::EStage::Callback );
         }
         else {
           std::cout << "MarketDepth Order Update error" << std::endl;
@@ -215,7 +219,9 @@ void Dispatcher<T>::OnNetworkLineBuffer( l2_linebuffer_t* pBuffer ) {
         namespace OrderDelete = ou::tf::iqfeed::l2::msg::OrderDelete;
         OrderDelete::decoded msg;
         if ( OrderDelete::Decode( m_parserDelete, msg, iter, end) ) {
+          ou::latency::Mark( ou::latency::EStage::Parse );
           static_cast<T*>( this )->OnMBODelete( msg );
+          ou::latency::Mark( ou::latency::EStage::Callback );
         }
         else {
           std::string str( iter, end );
@@ -233,7 +239,9 @@ void Dispatcher<T>::OnNetworkLineBuffer( l2_linebuffer_t* pBuffer ) {
         namespace OrderArrival = ou::tf::iqfeed::l2::msg::OrderArrival;
         OrderArrival::decoded msg;
         if ( OrderArrival::Decode( m_parserArrival, msg, iter, end) ) {
+          ou::latency::Mark( ou::latency::EStage::Parse );
           static_cast<T*>( this )->OnMBOSummary( msg );
+          ou::latency::Mark( ou::latency::EStage::Callback );
         }
         else {
           std::cout << "MarketDepth Order Summary error" << std::endl;
@@ -0,0 +1,321 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    FeatureEngine.cpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFIQFeed/Level2
+ * Created: October 19, 2026 21:05 PM
+ */
+
+#include <cstring>
+#include <iterator>
+#include <cassert>
+#include <stdexcept>
+
+#include "FeatureEngine.hpp"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace iqfeed { // IQFeed
+namespace l2 { // level 2 data
+
+namespace {
+
+  // same weights as FeatureSet_Level
+
+  // exponential over 20 values
+  constexpr double dblWeightShort = 20.0;
+  constexpr double dblWeightHeadShort =                    1.0   / dblWeightShort;
+  constexpr double dblWeightTailShort = ( dblWeightShort - 1.0 ) / dblWeightShort;
+
+  // exponential over 200 values
+  constexpr double dblWeightLong = 200.0;
+  constexpr double dblWeightHeadLong =                   1.0   / dblWeightLong;
+  constexpr double dblWeightTailLong = ( dblWeightLong - 1.0 ) / dblWeightLong;
+
+  const ptime c_epoch( boost::gregorian::date( 1970, 1, 1 ) );
+
+  inline int64_t Microseconds( const ptime& dt ) {
+    return ( dt - c_epoch ).total_microseconds();
+  }
+
+  inline double Ratio( double numerator, double denominator ) {
+    return ( 0.0 == denominator ) ? 0.0 : numerator / denominator;
+  }
+}
+
+FeatureEngine::FeatureEngine()
+: m_nLevels {}
+, m_ixDirty( nMaxLevels + 1 )
+{
+  std::memset( &m_ask, 0, sizeof( m_ask ) );
+  std::memset( &m_bid, 0, sizeof( m_bid ) );
+  std::memset( &m_cross, 0, sizeof( m_cross ) );
+}
+
+void FeatureEngine::Set( size_t nLevels ) {
+
+  if ( ( 3 > nLevels ) || ( nMaxLevels < nLevels ) ) {
+    throw std::runtime_error( "FeatureEngine::Set: levels out of range" );
+  }
+  assert( 0 == m_nLevels );  // one time set only
+  m_nLevels = nLevels;
+
+  for ( slot_t ix = 0; ix <= nMaxLevels; ix++ ) {
+    m_ask.slot[ ix ] = ix;
+    m_bid.slot[ ix ] = ix;
+  }
+
+}
+
+void FeatureEngine::HandleBookChangesAsk( ou::tf::iqfeed::l2::EOp op, unsigned int ix, const ou::tf::Depth& depth ) {
+  HandleBookChanges( m_ask, op, ix, depth );
+}
+
+void FeatureEngine::HandleBookChangesBid( ou::tf::iqfeed::l2::EOp op, unsigned int ix, const ou::tf::Depth& depth ) {
+  HandleBookChanges( m_bid, op, ix, depth );
+}
+
+void FeatureEngine::HandleBookChanges( BookSide& side, ou::tf::iqfeed::l2::EOp op, unsigned int ix, const ou::tf::Depth& depth ) {
+  if ( ( 0 == ix ) || ( m_nLevels < ix ) ) {
+    assert( 0 != ix );
+    assert( m_nLevels >= ix );
+  }
+  else {
+    slot_t* pSlot( &side.slot[ ix ] );
+    const size_t nBelow( m_nLevels - ix ); // levels under ix
+    switch ( op ) {
+      case ou::tf::iqfeed::l2::EOp::Insert: {
+          // the deepest level falls off the end, its slot is re-used at ix
+          const slot_t slot( side.slot[ m_nLevels ] );
+          std::memmove( pSlot + 1, pSlot, nBelow );
+          *pSlot = slot;
+          Clear( side, slot );
+          side.bActive[ slot ] = true;
+          Quote( side, slot, depth );
+          Dirty( ix, true );
+        }
+        break;
+      case ou::tf::iqfeed::l2::EOp::Increase:
+      case ou::tf::iqfeed::l2::EOp::Decrease:
+        Dirty( ix, Quote( side, *pSlot, depth ) );
+        break;
+      case ou::tf::iqfeed::l2::EOp::Delete: {
+          // levels under ix move up, the slot at ix is cleared for the deepest level
+          const slot_t slot( *pSlot );
+          std::memmove( pSlot, pSlot + 1, nBelow );
+          side.slot[ m_nLevels ] = slot;
+          Clear( side, slot );
+          Dirty( ix, true );
+        }
+        break;
+    }
+  }
+}
+
+void FeatureEngine::Clear( BookSide& side, slot_t slot ) {
+  side.bActive[ slot ] = false;
+  side.price[ slot ] = 0.0;
+  side.volume[ slot ] = 0.0;
+  side.tLast[ slot ] = 0;
+  side.dPrice_dt[ slot ] = 0.0;
+  side.dVolume_dt[ slot ] = 0.0;
+  for ( size_t kind = 0; kind < (size_t)EKind::_Count; kind++ ) {
+    side.tLastKind[ kind ][ slot ] = 0;
+    side.intensityShort[ kind ][ slot ] = 0.0;
+    side.intensityLong[ kind ][ slot ] = 0.0;
+    side.relative[ kind ][ slot ] = 0.0;
+    side.accel[ kind ][ slot ] = 0.0;
+  }
+}
+
+// v1, v6, true when the price changed
+bool FeatureEngine::Quote( BookSide& side, slot_t slot, const ou::tf::Depth& depth ) {
+
+  const int64_t t( Microseconds( depth.DateTime() ) );
+  const int64_t tLast( side.tLast[ slot ] );
+
+  if ( 0 != tLast ) {
+    const int64_t diff( t - tLast ); // might be delete -> update
+    if ( 0 < diff ) {
+      const double deltaArrival( (double)diff / 1000000.0 ); // rate per second
+      side.dPrice_dt[ slot ]  = dblWeightTailShort * side.dPrice_dt[ slot ]  + dblWeightHeadShort * ( depth.Price()  / deltaArrival ); // slope = rise / run
+      side.dVolume_dt[ slot ] = dblWeightTailShort * side.dVolume_dt[ slot ] + dblWeightHeadShort * ( depth.Volume() / deltaArrival ); // slope = rise / run
+    }
+  }
+  side.tLast[ slot ] = t;
+
+  const bool bPrice( side.price[ slot ] != depth.Price() );
+  side.price[ slot ] = depth.Price();
+  side.volume[ slot ] = depth.Volume();
+  return bPrice;
+}
+
+// v1 aggregates, v2, v3, v4, v5, for the levels from m_ixDirty down
+//   levels above keep their cumulative sums
+void FeatureEngine::Recalc() const {
+
+  const unsigned int ixStart( m_ixDirty );
+  m_ixDirty = nMaxLevels + 1;
+
+  const price_t askTop( m_ask.price[ m_ask.slot[ 1 ] ] );
+  const price_t bidTop( m_bid.price[ m_bid.slot[ 1 ] ] );
+
+  double askCumVolume( m_ask.cumVolume[ ixStart - 1 ] );
+  double bidCumVolume( m_bid.cumVolume[ ixStart - 1 ] );
+  price_t askCumPrice( m_ask.cumPrice[ ixStart - 1 ] );
+  price_t bidCumPrice( m_bid.cumPrice[ ixStart - 1 ] );
+
+  for ( unsigned int level = ixStart; level <= m_nLevels; level++ ) {
+
+    const slot_t slotAsk( m_ask.slot[ level ] );
+    const slot_t slotBid( m_bid.slot[ level ] );
+
+    const price_t askPrice( m_ask.price[ slotAsk ] );
+    const price_t bidPrice( m_bid.price[ slotBid ] );
+    const double askVolume( m_ask.volume[ slotAsk ] );
+    const double bidVolume( m_bid.volume[ slotBid ] );
+
+    askCumVolume += askVolume;
+    bidCumVolume += bidVolume;
+    askCumPrice += askPrice;
+    bidCumPrice += bidPrice;
+
+    m_ask.cumVolume[ level ] = askCumVolume;
+    m_bid.cumVolume[ level ] = bidCumVolume;
+    m_ask.cumPrice[ level ] = askCumPrice;
+    m_bid.cumPrice[ level ] = bidCumPrice;
+
+    m_ask.diffToTop[ level ] = ( 1 == level ) ? 0.0 : askPrice - askTop;
+    m_bid.diffToTop[ level ] = ( 1 == level ) ? 0.0 : bidTop - bidPrice;
+
+    if ( m_nLevels == level ) {
+      m_ask.diffToAdjacent[ level ] = 0.0;
+      m_bid.diffToAdjacent[ level ] = 0.0;
+    }
+    else {
+      const slot_t slotAskNext( m_ask.slot[ level + 1 ] );
+      const slot_t slotBidNext( m_bid.slot[ level + 1 ] );
+      m_ask.diffToAdjacent[ level ] = m_ask.bActive[ slotAskNext ] ? m_ask.price[ slotAskNext ] - askPrice : 0.0;
+      m_bid.diffToAdjacent[ level ] = m_bid.bActive[ slotBidNext ] ? bidPrice - m_bid.price[ slotBidNext ] : 0.0;
+    }
+
+    m_cross.spread[ level ] = askPrice - bidPrice;
+    m_cross.mid[ level ] = ( askPrice + bidPrice ) / 2.0;
+    m_cross.imbalanceLvl[ level ] = Ratio( bidVolume - askVolume, bidVolume + askVolume );
+    m_cross.imbalanceAgg[ level ] = Ratio( bidCumVolume - askCumVolume, bidCumVolume + askCumVolume );
+  }
+}
+
+// v7, v8, v9
+void FeatureEngine::Intensity( BookSide& side, EKind kind_, unsigned int ix, const ou::tf::Depth& depth ) {
+
+  if ( ( 0 == ix ) || ( m_nLevels < ix ) ) {
+    assert( 0 != ix );
+    assert( m_nLevels >= ix );
+    return;
+  }
+
+  const size_t kind( (size_t)kind_ );
+  const slot_t slot( side.slot[ ix ] );
+
+  const int64_t t( Microseconds( depth.DateTime() ) );
+  int64_t& tLast( side.tLastKind[ kind ][ slot ] );
+  double& intensityShort( side.intensityShort[ kind ][ slot ] );
+  double& intensityLong( side.intensityLong[ kind ][ slot ] );
+
+  if ( 0 != tLast ) {
+    const int64_t diff( t - tLast );
+    if ( 0 < diff ) {
+      const double intensityShortPrevious( intensityShort );
+      const double deltaArrival( (double)diff / 1000000.0 ); // rate per second
+      intensityShort = dblWeightTailShort * intensityShort + dblWeightHeadShort / deltaArrival;
+      intensityLong  = dblWeightTailLong  * intensityLong  + dblWeightHeadLong  / deltaArrival;
+
+      const double diffIntensity( intensityShort - intensityShortPrevious );
+      side.accel[ kind ][ slot ] = dblWeightTailShort * side.accel[ kind ][ slot ] + dblWeightHeadShort * diffIntensity / deltaArrival;
+    }
+  }
+  tLast = t;
+
+  side.relative[ kind ][ slot ] = ( 0.0 < intensityLong ) ? intensityShort / intensityLong : 0.0;
+}
+
+void FeatureEngine::Fill( float* p ) const {
+
+  Refresh();
+
+  auto fill = [&p]( const BookSide& side, unsigned int level ){
+    const slot_t slot( side.slot[ level ] );
+    *p++ = side.volume[ slot ];
+    *p++ = side.price[ slot ];
+    *p++ = side.cumVolume[ level - 1 ]; // aggregate of the levels above
+    *p++ = side.cumPrice[ level - 1 ];
+    *p++ = side.diffToTop[ level ];
+    *p++ = side.diffToAdjacent[ level ];
+    *p++ = side.cumPrice[ level ] / level;  // mean
+    *p++ = side.cumVolume[ level ] / level;
+    *p++ = side.dPrice_dt[ slot ];
+    *p++ = side.dVolume_dt[ slot ];
+    for ( size_t kind = 0; kind < (size_t)EKind::_Count; kind++ ) *p++ = side.intensityShort[ kind ][ slot ];
+    for ( size_t kind = 0; kind < (size_t)EKind::_Count; kind++ ) *p++ = side.intensityLong[ kind ][ slot ];
+    for ( size_t kind = 0; kind < (size_t)EKind::_Count; kind++ ) *p++ = side.relative[ kind ][ slot ];
+    for ( size_t kind = 0; kind < (size_t)EKind::_Count; kind++ ) *p++ = side.accel[ kind ][ slot ];
+  };
+
+  for ( unsigned int level = 1; level <= m_nLevels; level++ ) {
+    fill( m_ask, level );
+    fill( m_bid, level );
+    *p++ = m_cross.spread[ level ];
+    *p++ = m_cross.mid[ level ];
+    *p++ = m_cross.imbalanceLvl[ level ];
+    *p++ = m_cross.imbalanceAgg[ level ];
+    *p++ = m_ask.cumPrice[ level ] - m_bid.cumPrice[ level ];   // v5
+    *p++ = m_ask.cumVolume[ level ] - m_bid.cumVolume[ level ];
+  }
+}
+
+const std::string FeatureEngine::Header( size_t nLevels ) {
+
+  static const char* rSide[] = {
+    "v1.vol", "v1.price", "v1.aggvol", "v1.aggprice",
+    "v3.diff2top", "v3.diff2adj",
+    "v4.mean.price", "v4.mean.vol",
+    "v6.dprice", "v6.dvol",
+    "v7.limit.int", "v7.mrkt.int", "v7.cncl.int",
+    "v8.limit.int", "v8.mrkt.int", "v8.cncl.int",
+    "v8.limit.rel", "v8.mrkt.rel", "v8.cncl.rel",
+    "v9.limit", "v9.mrkt", "v9.cncl"
+  };
+  static const char* rCross[] = {
+    "v2.spread", "v2.mid", "v2.imbal.lvl", "v2.imbal.agg",
+    "v5.sum.price.spread", "v5.sum.vol.spread"
+  };
+  static_assert( 2 * std::size( rSide ) + std::size( rCross ) == nColumnsPerLevel );
+
+  std::string header;
+  for ( size_t level = 1; level <= nLevels; level++ ) {
+    const std::string sLevel( std::to_string( level ) );
+    for ( const char* sz: rSide ) { header += ",l" + sLevel + ".ask." + sz; }
+    for ( const char* sz: rSide ) { header += ",l" + sLevel + ".bid." + sz; }
+    for ( const char* sz: rCross ) { header += ",l" + sLevel + ".cross." + sz; }
+  }
+  return header.substr( 1 );
+}
+
+} // namespace l2
+} // namesapce iqfeed
+} // namespace tf
+} // namespace ou
@@ -0,0 +1,168 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    FeatureEngine.hpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFIQFeed/Level2
+ * Created: October 19, 2026 21:05 PM
+ */
+
+ // based upon the paper:
+ // Modeling high-frequency limit order book dynamics with support vector machines
+ // October 24, 2013, Alec N.Kercheval, Yuan Zhang
+ // page 16, table 2, Feature Vector Sets
+
+ // same features, and same update calls, as FeatureSet / FeatureSet_Level, laid out for throughput:
+ //   fixed capacity, nothing is allocated after Set
+ //   each feature is an array across the levels (structure of arrays)
+ //   a level's state lives in a slot, a per side map gives the slot for each level,
+ //     an insertion or deletion moves one byte slot numbers rather than the level state
+ //   an update touches its own slot, aggregates and cross level features are recalculated when next read,
+ //     from the shallowest level changed since
+ //   Fill writes the current vector as floats, for FeatureStream or a model
+ // levels are numbered 1 - n, as in FeatureSet
+
+#pragma once
+
+#include <array>
+#include <string>
+#include <cstdint>
+
+#include "Symbols.hpp"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace iqfeed { // IQFeed
+namespace l2 { // level 2 data
+
+class FeatureEngine {
+public:
+
+  static constexpr size_t nMaxLevels = 32;
+  static constexpr size_t nColumnsPerLevel = 50; // ask 22, bid 22, cross 6
+
+  using price_t = ou::tf::Trade::price_t;
+  using volume_t = ou::tf::Trade::volume_t;
+
+  enum class ESide: uint8_t { Ask, Bid };
+  enum class EKind: uint8_t { Limit, Market, Cancel, _Count }; // v7, v8, v9
+
+  FeatureEngine();
+
+  // Initialization
+
+  void Set( size_t nLevels ); // 3 <= nLevels <= nMaxLevels, one time set only
+
+  // Queries
+
+  size_t Levels() const { return m_nLevels; }
+  size_t Columns() const { return m_nLevels * nColumnsPerLevel; }
+
+  static const std::string Header( size_t nLevels ); // comma separated column names, Fill order
+
+  void Fill( float* ) const; // Columns() values
+
+  bool Active( ESide side, unsigned int ix ) const { return Side( side ).bActive[ Slot( side, ix ) ]; }
+  price_t Price( ESide side, unsigned int ix ) const { return Side( side ).price[ Slot( side, ix ) ]; }
+  volume_t Volume( ESide side, unsigned int ix ) const { return Side( side ).volume[ Slot( side, ix ) ]; }
+  double Relative( ESide side, EKind kind, unsigned int ix ) const { return Side( side ).relative[ (size_t)kind ][ Slot( side, ix ) ]; }
+  double ImbalanceAgg( unsigned int ix ) const { Refresh(); return m_cross.imbalanceAgg[ ix ]; }
+
+  // Assignment / Update
+
+  void HandleBookChangesAsk( ou::tf::iqfeed::l2::EOp, unsigned int, const ou::tf::Depth& );
+  void HandleBookChangesBid( ou::tf::iqfeed::l2::EOp, unsigned int, const ou::tf::Depth& );
+
+  void Ask_IncLimit(  unsigned int ix, const ou::tf::Depth& depth ) { Intensity( m_ask, EKind::Limit,  ix, depth ); }
+  void Ask_IncMarket( unsigned int ix, const ou::tf::Depth& depth ) { Intensity( m_ask, EKind::Market, ix, depth ); }
+  void Ask_IncCancel( unsigned int ix, const ou::tf::Depth& depth ) { Intensity( m_ask, EKind::Cancel, ix, depth ); }
+
+  void Bid_IncLimit(  unsigned int ix, const ou::tf::Depth& depth ) { Intensity( m_bid, EKind::Limit,  ix, depth ); }
+  void Bid_IncMarket( unsigned int ix, const ou::tf::Depth& depth ) { Intensity( m_bid, EKind::Market, ix, depth ); }
+  void Bid_IncCancel( unsigned int ix, const ou::tf::Depth& depth ) { Intensity( m_bid, EKind::Cancel, ix, depth ); }
+
+protected:
+private:
+
+  template<typename T>
+  using level_t = std::array<T, nMaxLevels + 1>; // [0] not used
+
+  using slot_t = uint8_t;
+
+  struct BookSide {
+
+    level_t<slot_t> slot; // level -> slot
+
+    // by slot, follows the level as it moves
+
+    level_t<bool> bActive;
+
+    level_t<price_t> price;   // v1
+    level_t<double> volume;
+
+    level_t<int64_t> tLast;   // v6, microseconds, 0 for none
+    level_t<double> dPrice_dt;
+    level_t<double> dVolume_dt;
+
+    std::array<level_t<int64_t>, (size_t)EKind::_Count> tLastKind;  // v7
+    std::array<level_t<double>, (size_t)EKind::_Count> intensityShort;
+    std::array<level_t<double>, (size_t)EKind::_Count> intensityLong; // v8
+    std::array<level_t<double>, (size_t)EKind::_Count> relative;
+    std::array<level_t<double>, (size_t)EKind::_Count> accel;        // v9
+
+    // by level, recalculated on read
+
+    mutable level_t<double> cumVolume;     // levels 1 - ix inclusive
+    mutable level_t<price_t> cumPrice;
+    mutable level_t<price_t> diffToTop;     // v3
+    mutable level_t<price_t> diffToAdjacent;
+  };
+
+  struct Cross { // by level, recalculated on read
+    level_t<price_t> spread;  // v2
+    level_t<price_t> mid;
+    level_t<double> imbalanceLvl;
+    level_t<double> imbalanceAgg;
+  };
+
+  size_t m_nLevels;
+
+  BookSide m_ask;
+  BookSide m_bid;
+  mutable Cross m_cross;
+
+  mutable unsigned int m_ixDirty; // shallowest level changed since Recalc, past nMaxLevels when none
+
+  const BookSide& Side( ESide side ) const { return ( ESide::Ask == side ) ? m_ask : m_bid; }
+  slot_t Slot( ESide side, unsigned int ix ) const { return Side( side ).slot[ ix ]; }
+
+  void HandleBookChanges( BookSide&, ou::tf::iqfeed::l2::EOp, unsigned int ix, const ou::tf::Depth& );
+
+  void Clear( BookSide&, slot_t );
+  bool Quote( BookSide&, slot_t, const ou::tf::Depth& );
+  void Dirty( unsigned int ix, bool bPrice ) { // a price change reaches the diff to adjacent above
+    const unsigned int ixDirty( ( bPrice && ( 1 < ix ) ) ? ix - 1 : ix );
+    if ( ixDirty < m_ixDirty ) m_ixDirty = ixDirty;
+  }
+  void Refresh() const { if ( m_nLevels >= m_ixDirty ) Recalc(); }
+  void Recalc() const;
+  void Intensity( BookSide&, EKind, unsigned int ix, const ou::tf::Depth& );
+
+};
+
+} // namespace l2
+} // namesapce iqfeed
+} // namespace tf
+} // namespace ou
@@ -0,0 +1,207 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    FeatureStream.cpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFIQFeed/Level2
+ * Created: October 19, 2026 21:40 PM
+ */
+
+#include <cstring>
+#include <cassert>
+#include <algorithm>
+#include <stdexcept>
+
+#include "FeatureStream.hpp"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace iqfeed { // IQFeed
+namespace l2 { // level 2 data
+
+namespace {
+  const ptime c_epoch( boost::gregorian::date( 1970, 1, 1 ) );
+}
+
+FeatureStream::FeatureStream( const FeatureEngine& engine, const Config& config )
+: m_engine( engine ), m_config( config )
+, m_nRecordBytes {}, m_nRecordsPerBlock {}
+, m_ixCurrent( nNone ), m_nInCurrent {}, m_nSequence {}
+, m_bStop( false )
+, m_ixFullHead {}, m_nFull {}
+, m_nRecords {}, m_nDropped {}, m_nBlocks {}
+{
+  assert( 0 < m_config.nBlocks );
+}
+
+FeatureStream::~FeatureStream() {
+  Close();
+}
+
+void FeatureStream::Open( const std::string& sPath ) {
+
+  assert( !m_stream.is_open() );
+  assert( 0 < m_engine.Levels() ); // FeatureEngine::Set has been called
+
+  m_nRecordBytes = sizeof( RecordHeader ) + m_engine.Columns() * sizeof( float );
+  m_nRecordsPerBlock = std::max<size_t>( 1, m_config.nBlockBytes / m_nRecordBytes );
+
+  m_stream.open( sPath, std::ios::out | std::ios::binary | std::ios::trunc );
+  if ( !m_stream.is_open() ) {
+    throw std::runtime_error( "FeatureStream::Open: can not open " + sPath );
+  }
+
+  const std::string sNames( FeatureEngine::Header( m_engine.Levels() ) );
+
+  FileHeader header;
+  std::memset( &header, 0, sizeof( header ) );
+  std::strncpy( header.szMagic, "tffvs", sizeof( header.szMagic ) );
+  header.nVersion = 1;
+  header.nLevels = m_engine.Levels();
+  header.nColumns = m_engine.Columns();
+  header.nRecordBytes = m_nRecordBytes;
+  header.nNames = sNames.size();
+
+  m_stream.write( reinterpret_cast<const char*>( &header ), sizeof( header ) );
+  m_stream.write( sNames.data(), sNames.size() );
+
+  // all memory is taken here, Append does not allocate
+  m_vBlock.clear();
+  m_vFree.clear();
+  for ( size_t ix = 0; ix < m_config.nBlocks; ix++ ) {
+    m_vBlock.emplace_back( new char[ m_nRecordsPerBlock * m_nRecordBytes ] );
+    m_vFree.push_back( ix );
+  }
+  m_vFull.assign( m_config.nBlocks, nNone );
+  m_vCount.assign( m_config.nBlocks, 0 );
+  m_ixFullHead = m_nFull = 0;
+
+  m_ixCurrent = m_vFree.back();
+  m_vFree.pop_back();
+  m_nInCurrent = 0;
+  m_nSequence = 0;
+  m_nRecords = m_nDropped = m_nBlocks = 0;
+
+  m_bStop = false;
+  m_pWriter = std::make_unique<std::thread>( [this](){ Writer(); } );
+}
+
+void FeatureStream::Append( const ptime& dt, FeatureEngine::ESide side, ou::tf::iqfeed::l2::EOp op, unsigned int ix ) {
+
+  if ( !m_pWriter ) return; // not open
+
+  const uint32_t nSequence( m_nSequence++ ); // dropped records leave a gap
+
+  if ( nNone == m_ixCurrent ) {
+    std::unique_lock<std::mutex> lock( m_mutex );
+    if ( m_config.bWait ) {
+      m_cvFree.wait( lock, [this](){ return !m_vFree.empty(); } );
+    }
+    if ( m_vFree.empty() ) {
+      m_nDropped++;
+      return;
+    }
+    m_ixCurrent = m_vFree.back();
+    m_vFree.pop_back();
+  }
+
+  char* p( m_vBlock[ m_ixCurrent ].get() + m_nInCurrent * m_nRecordBytes );
+
+  RecordHeader& record( *reinterpret_cast<RecordHeader*>( p ) );
+  record.tMicroseconds = ( dt - c_epoch ).total_microseconds();
+  record.nSequence = nSequence;
+  record.side = (uint8_t)side;
+  record.op = (uint8_t)op;
+  record.level = ix;
+
+  m_engine.Fill( reinterpret_cast<float*>( p + sizeof( RecordHeader ) ) );
+
+  m_nRecords++;
+  m_nInCurrent++;
+  if ( m_nRecordsPerBlock == m_nInCurrent ) {
+    HandOff();
+  }
+}
+
+void FeatureStream::HandOff() {
+  {
+    std::scoped_lock<std::mutex> lock( m_mutex );
+    m_vCount[ m_ixCurrent ] = m_nInCurrent;
+    m_vFull[ ( m_ixFullHead + m_nFull ) % m_vFull.size() ] = m_ixCurrent;
+    m_nFull++;
+    if ( m_vFree.empty() ) {
+      m_ixCurrent = nNone;
+    }
+    else {
+      m_ixCurrent = m_vFree.back();
+      m_vFree.pop_back();
+    }
+    m_nInCurrent = 0;
+  }
+  m_cv.notify_one();
+}
+
+void FeatureStream::Writer() {
+  std::unique_lock<std::mutex> lock( m_mutex );
+  while ( true ) {
+    m_cv.wait( lock, [this](){ return m_bStop || ( 0 < m_nFull ); } );
+    if ( 0 == m_nFull ) break; // stopped, and nothing pending
+    const size_t ix( m_vFull[ m_ixFullHead ] );
+    m_ixFullHead = ( m_ixFullHead + 1 ) % m_vFull.size();
+    m_nFull--;
+    const size_t nBytes( m_vCount[ ix ] * m_nRecordBytes );
+    lock.unlock();
+    m_stream.write( m_vBlock[ ix ].get(), nBytes );
+    lock.lock();
+    m_vFree.push_back( ix );
+    m_nBlocks++;
+    m_cvFree.notify_one();
+  }
+}
+
+void FeatureStream::Close() {
+  if ( m_pWriter ) {
+    if ( ( nNone != m_ixCurrent ) && ( 0 < m_nInCurrent ) ) {
+      HandOff();
+    }
+    {
+      std::scoped_lock<std::mutex> lock( m_mutex );
+      m_bStop = true;
+    }
+    m_cv.notify_one();
+    m_pWriter->join();
+    m_pWriter.reset();
+  }
+  if ( m_stream.is_open() ) {
+    m_stream.close();
+  }
+}
+
+FeatureStream::Stats FeatureStream::GetStats() const {
+  Stats stats;
+  stats.nRecords = m_nRecords.load();
+  stats.nDropped = m_nDropped.load();
+  stats.nBlocks = m_nBlocks.load();
+  {
+    std::scoped_lock<std::mutex> lock( m_mutex );
+    stats.nPending = m_nFull;
+  }
+  return stats;
+}
+
+} // namespace l2
+} // namesapce iqfeed
+} // namespace tf
+} // namespace ou
@@ -0,0 +1,140 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    FeatureStream.hpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFIQFeed/Level2
+ * Created: October 19, 2026 21:40 PM
+ */
+
+ // binary feature vector file, for offline model training
+ //   FileHeader, then the column names (FeatureEngine::Header, nNames bytes), then fixed size records
+ //   each record is a RecordHeader followed by FeatureEngine::Columns() floats
+ //   native byte order (little endian on the supported platforms)
+ // Append copies the current vector into a preallocated block, a full block goes to a writer thread
+ //   the caller only takes a lock when a block fills
+ //   when every block is waiting on the disk, records are dropped and counted rather than stalling the book,
+ //     unless bWait is set, as for a replay, where Append waits for the writer instead
+
+#pragma once
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <fstream>
+#include <condition_variable>
+
+#include "FeatureEngine.hpp"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace iqfeed { // IQFeed
+namespace l2 { // level 2 data
+
+class FeatureStream {
+public:
+
+  struct FileHeader {
+    char szMagic[ 8 ];   // "tffvs"
+    uint32_t nVersion;
+    uint32_t nLevels;
+    uint32_t nColumns;
+    uint32_t nRecordBytes;
+    uint32_t nNames;
+    uint32_t nReserved;
+  };
+
+  struct RecordHeader {
+    int64_t tMicroseconds; // since 1970-01-01, from the depth which caused the change
+    uint32_t nSequence;
+    uint8_t side;          // FeatureEngine::ESide
+    uint8_t op;            // EOp
+    uint16_t level;
+  };
+
+  struct Config {
+    size_t nBlockBytes;
+    size_t nBlocks;
+    bool bWait; // for a free block, rather than drop
+    Config(): nBlockBytes( 4 * 1024 * 1024 ), nBlocks( 16 ), bWait( false ) {}
+  };
+
+  struct Stats {
+    uint64_t nRecords;  // written or pending
+    uint64_t nDropped;
+    uint64_t nBlocks;   // written
+    size_t nPending;    // blocks waiting on the writer
+  };
+
+  FeatureStream( const FeatureEngine&, const Config& = Config() );
+  ~FeatureStream();
+
+  void Open( const std::string& sPath ); // truncates, throws on failure
+  void Append( const ptime&, FeatureEngine::ESide, ou::tf::iqfeed::l2::EOp, unsigned int ix );
+  void Close(); // writes what is pending, then closes the file
+
+  Stats GetStats() const;
+
+protected:
+private:
+
+  static constexpr size_t nNone = (size_t)-1;
+
+  const FeatureEngine& m_engine;
+  Config m_config;
+
+  size_t m_nRecordBytes;
+  size_t m_nRecordsPerBlock;
+
+  std::ofstream m_stream;
+
+  using vBlock_t = std::vector<std::unique_ptr<char[]> >;
+  vBlock_t m_vBlock;
+
+  // owned by the caller of Append
+  size_t m_ixCurrent; // block being filled, nNone when none are free
+  size_t m_nInCurrent;
+  uint32_t m_nSequence;
+
+  // shared with the writer
+  mutable std::mutex m_mutex;
+  std::condition_variable m_cv;     // to the writer, a block is full
+  std::condition_variable m_cvFree; // from the writer, a block is free
+  bool m_bStop;
+  std::vector<size_t> m_vFree;
+  std::vector<size_t> m_vFull; // ring, m_ixFullHead + m_nFull
+  size_t m_ixFullHead;
+  size_t m_nFull;
+  std::vector<size_t> m_vCount; // records in each block handed off, the last may be partial
+
+  std::atomic<uint64_t> m_nRecords;
+  std::atomic<uint64_t> m_nDropped;
+  std::atomic<uint64_t> m_nBlocks;
+
+  std::unique_ptr<std::thread> m_pWriter;
+
+  void HandOff(); // current block to the writer, take a free one
+  void Writer();
+
+};
+
+} // namespace l2
+} // namesapce iqfeed
+} // namespace tf
+} // namespace ou
@@ -28,6 +28,7 @@
 #include <OUCommon/KeyWordMatch.h>
 
 #include <TFTimeSeries/DatedDatum.h>
+#include <TFTimeSeries/PriceTick.h>
 #include <TFTimeSeries/TimeSeries.h>
 
 #include "Dispatcher.h"
@@ -47,7 +48,7 @@ enum class EOp { Insert, Increase, Decrease, Delete };
 using fBookChanges_t = std::function<void(EOp,unsigned int,const ou::tf::Depth&)>; // operation, level, attributes
 using fVolumeAtPrice_t = std::function<void(double,int,bool)>; // price, volume, add
 
-template<typename Compare>  // ask is std::less<key>, bid is std::greater<key>, where key is currently double
+template<typename Compare>  // ask is std::less<key>, bid is std::greater<key>, where key is PriceTick
 class MapLevelAggregate {
   friend class Symbols;
 private:
@@ -71,14 +72,19 @@ private:
     : ixLevel{ rhs.ixLevel }, nQuantity( rhs.nQuantity ), nOrders( rhs.nOrders ) {}
   };
 
-  using mapLevelAggregate_t = std::map<double,LevelAggregate,Compare>;
+  using mapLevelAggregate_t = std::map<ou::tf::PriceTick,LevelAggregate,Compare>;
 
 public:
 
   static const unsigned int max_ix = 10;
 
+  // l2 symbols are keyed by name, without an instrument, so levels are keyed at a scale
+  //   finer than any feed price (1/128 is seven decimals), rather than at the min tick
+  static constexpr double c_dblKeyTick = 1e-8;
+
   MapLevelAggregate()
-  : m_fVolumeAtPrice( nullptr )
+  : m_scale( c_dblKeyTick )
+  , m_fVolumeAtPrice( nullptr )
   {}
 
   void Set( fVolumeAtPrice_t&& fVolumeAtPrice ) { // simple callback
@@ -93,11 +99,12 @@ public:
 
     price_t price( depth.Price() );
     volume_t volume( depth.Volume() );
+    const ou::tf::PriceTick tick( m_scale.Nearest( price ) );
 
-    typename mapLevelAggregate_t::iterator iterLevelAggregate = m_mapLevelAggregate.find( price );
+    typename mapLevelAggregate_t::iterator iterLevelAggregate = m_mapLevelAggregate.find( tick );
     if ( m_mapLevelAggregate.end() == iterLevelAggregate ) {
 
-      auto pair = m_mapLevelAggregate.emplace( std::pair( price, LevelAggregate( volume ) ) );
+      auto pair = m_mapLevelAggregate.emplace( std::pair( tick, LevelAggregate( volume ) ) );
       assert( pair.second );
       iterLevelAggregate = pair.first;
 
@@ -171,7 +178,7 @@ public:
     price_t price( depth.Price() );
     volume_t volume( depth.Volume() );
 
-    typename mapLevelAggregate_t::iterator iterLevelAggregate = m_mapLevelAggregate.find( price );
+    typename mapLevelAggregate_t::iterator iterLevelAggregate = m_mapLevelAggregate.find( m_scale.Nearest( price ) );
     if ( m_mapLevelAggregate.end() == iterLevelAggregate ) {
       BOOST_LOG_TRIVIAL(error) << "MapLevelAggregate::Delete price not found: " << price;
     }
@@ -230,6 +237,7 @@ protected:
   mapLevelAggregate_t m_mapLevelAggregate;
 
 private:
+  const ou::tf::TickScale m_scale;
   fBookChanges_t m_fBookChanges;
   fVolumeAtPrice_t m_fVolumeAtPrice;
 }; // class MapLevelAggregate
@@ -264,8 +272,8 @@ public:
 
 protected:
 
-  using MapLevelAggregateAsk_t = MapLevelAggregate<std::less<double> >;    // top of book: lowest price
-  using MapLevelAggregateBid_t = MapLevelAggregate<std::greater<double> >; // top of book: highest price
+  using MapLevelAggregateAsk_t = MapLevelAggregate<std::less<ou::tf::PriceTick> >;    // top of book: lowest price
+  using MapLevelAggregateBid_t = MapLevelAggregate<std::greater<ou::tf::PriceTick> >; // top of book: highest price
 
   MapLevelAggregateAsk_t m_LevelAggregateAsk;
   MapLevelAggregateBid_t m_LevelAggregateBid;
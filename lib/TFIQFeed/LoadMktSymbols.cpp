@@ -20,8 +20,7 @@
 
 #include "CurlGetMktSymbols.h"
 #include "UnzipMktSymbols.h"
-#include "ParseMktSymbolDiskFile.h"
-#include "ValidateMktSymbolLine.h"
+#include "MktSymbolIngest.h"
 
 #include "LoadMktSymbols.h"
 
@@ -33,6 +32,7 @@ namespace detail {
   // shared between debug and release
   const std::string sFileNameMarketSymbolsText( "../mktsymbols_v2.txt" );
   const std::string sFileNameMarketSymbolsBinary( "../symbols.ser" );
+  const std::string sFileNameMarketSymbolsSnapshot( "../symbols.snap" );
 }
 
 typedef MarketSymbol::TableRowDef trd_t;
@@ -53,8 +53,7 @@ void LoadMktSymbols( InMemoryMktSymbolList& symbols, MktSymbolLoadType::Enum e,
 
   symbols.Clear();
 
-  ValidateMktSymbolLine validator;
-  validator.SetOnProcessLine( MakeDelegate( &symbols, &InMemoryMktSymbolList::InsertParsedStructure ) );
+  MktSymbolIngest ingest; // parse and validate in parallel, PostProcess is applied before rows reach the list
 
   switch ( e ) {
   case MktSymbolLoadType::Download:
@@ -82,24 +81,15 @@ void LoadMktSymbols( InMemoryMktSymbolList& symbols, MktSymbolLoadType::Enum e,
       std::cout << "Processing Contents" << std::endl;
       const char* pBegin = pUnZippedFile.get();
       const char* pEnd = pBegin + uzmsf.UnZippedFileSize();
-      validator.ParseHeaderLine( pBegin, pEnd );
-      while ( pBegin != pEnd ) {
-        validator.Parse( pBegin, pEnd );
-      }
+      ingest.Run( pBegin, pEnd );
     }
     catch( ... ) {
       std::cout << "Some Sort of failure in Download" << std::endl;
     }
     break;
   case MktSymbolLoadType::LoadTextFromDisk:
-    typedef ParseMktSymbolDiskFile diskfile_t;
-
     try {
-
-      diskfile_t diskfile;
-      diskfile.SetOnProcessLine( MakeDelegate( &validator, &ValidateMktSymbolLine::Parse<diskfile_t::iterator_t> ) );
-
-      diskfile.Run( detail::sFileNameMarketSymbolsText );
+      ingest.Run( sName );
     }
     catch (...) {
       std::cout << "Some sort of failure on disk read" << std::endl;
@@ -107,10 +97,8 @@ void LoadMktSymbols( InMemoryMktSymbolList& symbols, MktSymbolLoadType::Enum e,
     break;
   }
 
-  validator.SetOnProcessHasOption( MakeDelegate( &symbols, &InMemoryMktSymbolList::HandleSymbolHasOption ) );
-  validator.SetOnUpdateOptionUnderlying( MakeDelegate( &symbols, &InMemoryMktSymbolList::HandleUpdateOptionUnderlying ) );
-  validator.PostProcess();
-  validator.Summary();
+  ingest.Insert( symbols );
+  ingest.Summary();
 
 }
 
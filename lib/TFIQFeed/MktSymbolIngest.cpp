@@ -0,0 +1,223 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    MktSymbolIngest.cpp
+ * Author:  raymond@burkholder.net
+ * Project: TFIQFeed
+ * Created: October 19, 2026 17:40 PM
+ */
+
+#include <iostream>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/thread/thread.hpp>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include "ValidateMktSymbolLine.h"
+#include "InMemoryMktSymbolList.h"
+
+#include "MktSymbolIngest.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace iqfeed { // IQFeed
+
+namespace {
+
+  const size_t nChunksPerThread = 4; // options cluster in the file, smaller chunks even out the load
+
+  struct Chunk {
+    const char* pBegin;
+    const char* pEnd;
+    MktSymbolIngest::vRow_t vRow;
+    std::unique_ptr<ValidateMktSymbolLine> pValidator;
+    Chunk( const char* pBegin_, const char* pEnd_ ): pBegin( pBegin_ ), pEnd( pEnd_ ) {}
+    void HandleRow( const MktSymbolIngest::trd_t& trd ) { vRow.push_back( trd ); }
+    void Parse( void ) {
+      pValidator = std::make_unique<ValidateMktSymbolLine>();
+      pValidator->SetOnProcessLine( MakeDelegate( this, &Chunk::HandleRow ) );
+      vRow.reserve( ( pEnd - pBegin ) / 64 ); // roughly the average line length
+      const char* pLine( pBegin );
+      while ( pEnd != pLine ) {
+        const char* pStart( pLine );
+        pValidator->Parse( pLine, pEnd );
+        if ( pStart == pLine ) { // unparseable and unconsumed, such as a blank line
+          pLine = std::find( pLine, pEnd, '\n' );
+          if ( pEnd != pLine ) ++pLine;
+        }
+      }
+    }
+  };
+
+  double Seconds( boost::posix_time::ptime dtBegin, boost::posix_time::ptime dtEnd ) {
+    return (double)( dtEnd - dtBegin ).total_microseconds() / 1000000.0;
+  }
+
+} // namespace anonymous
+
+MktSymbolIngest::MktSymbolIngest( size_t nThreads )
+: m_nThreads( nThreads )
+{
+  if ( 0 == m_nThreads ) m_nThreads = std::max<size_t>( 1, boost::thread::hardware_concurrency() );
+}
+
+MktSymbolIngest::~MktSymbolIngest( void ) {
+}
+
+void MktSymbolIngest::Run( const std::string& sFileName ) {
+
+  namespace ipc = boost::interprocess;
+
+  std::cout << "Mapping Input Symbol File " << sFileName << std::endl;
+
+  ipc::file_mapping file;
+  ipc::mapped_region region;
+  try {
+    file = ipc::file_mapping( sFileName.c_str(), ipc::read_only );
+    region = ipc::mapped_region( file, ipc::read_only );
+  }
+  catch ( const ipc::interprocess_exception& e ) {
+    throw std::runtime_error( "MktSymbolIngest can't map " + sFileName + ": " + e.what() );
+  }
+  region.advise( ipc::mapped_region::advice_sequential );
+
+  const char* pBegin( static_cast<const char*>( region.get_address() ) );
+  Run( pBegin, pBegin + region.get_size() );
+}
+
+void MktSymbolIngest::Run( const char* pBegin, const char* pEnd ) {
+
+  namespace pt = boost::posix_time;
+
+  m_vRow.clear();
+  m_mapRow.clear();
+  m_stats = Stats();
+
+  pt::ptime dtStart( pt::microsec_clock::universal_time() );
+
+  pBegin = std::find( pBegin, pEnd, '\n' ); // skip the header line
+  if ( pEnd != pBegin ) ++pBegin;
+
+  // cut on line boundaries
+  std::vector<Chunk> vChunk;
+  const size_t nChunks( m_nThreads * nChunksPerThread );
+  const size_t nChunkSize( std::max<size_t>( 1, ( pEnd - pBegin ) / nChunks ) );
+  vChunk.reserve( nChunks + 1 );
+  while ( pEnd != pBegin ) {
+    const char* pCut( pBegin + std::min<size_t>( nChunkSize, pEnd - pBegin ) );
+    pCut = std::find( pCut, pEnd, '\n' );
+    if ( pEnd != pCut ) ++pCut;
+    vChunk.emplace_back( Chunk( pBegin, pCut ) );
+    pBegin = pCut;
+  }
+
+  { // io_context::run returns once all chunks are done
+    boost::asio::io_context srvc;
+    for ( Chunk& chunk: vChunk ) {
+      Chunk* pChunk( &chunk );
+      boost::asio::post( srvc, [pChunk](){
+        try {
+          pChunk->Parse();
+        }
+        catch ( const std::exception& e ) {
+          std::cout << "MktSymbolIngest::Run chunk problem: " << e.what() << std::endl;
+        }
+      } );
+    }
+    boost::thread_group threads;
+    for ( size_t ix = 0; ix < std::min( m_nThreads, vChunk.size() ); ix++ ) {
+      threads.create_thread( [&srvc](){ srvc.run(); } );
+    }
+    threads.join_all();
+  }
+
+  pt::ptime dtParse( pt::microsec_clock::universal_time() );
+
+  // merge, in file order
+  m_pValidator = std::make_unique<ValidateMktSymbolLine>();
+  size_t nRows {};
+  for ( const Chunk& chunk: vChunk ) nRows += chunk.vRow.size();
+  m_vRow.reserve( nRows );
+  for ( Chunk& chunk: vChunk ) {
+    if ( chunk.pValidator ) m_pValidator->Merge( *chunk.pValidator );
+    std::move( chunk.vRow.begin(), chunk.vRow.end(), std::back_inserter( m_vRow ) );
+    chunk.vRow.clear();
+    chunk.pValidator.reset();
+  }
+
+  m_mapRow.reserve( m_vRow.size() );
+  for ( size_t ix = 0; ix < m_vRow.size(); ix++ ) {
+    m_mapRow.emplace( m_vRow[ ix ].sSymbol, ix ); // first occurrence wins, as with the symbol list
+  }
+
+  m_pValidator->SetOnProcessHasOption( MakeDelegate( this, &MktSymbolIngest::HandleHasOption ) );
+  m_pValidator->SetOnUpdateOptionUnderlying( MakeDelegate( this, &MktSymbolIngest::HandleUpdateOptionUnderlying ) );
+  m_pValidator->PostProcess();
+
+  pt::ptime dtEnd( pt::microsec_clock::universal_time() );
+
+  m_stats.nLines = m_pValidator->LinesProcessed();
+  m_stats.nRows = m_vRow.size();
+  m_stats.nChunks = vChunk.size();
+  m_stats.nThreads = m_nThreads;
+  m_stats.dblParse = Seconds( dtStart, dtParse );
+  m_stats.dblMerge = Seconds( dtParse, dtEnd );
+}
+
+bool MktSymbolIngest::HandleHasOption( const std::string& sSymbol ) {
+  mapRow_t::iterator iter = m_mapRow.find( sSymbol );
+  if ( m_mapRow.end() == iter ) return false;
+  m_vRow[ iter->second ].bHasOptions = true;
+  return true;
+}
+
+void MktSymbolIngest::HandleUpdateOptionUnderlying( const std::string& sSymbol, const std::string& sUnderlying ) {
+  mapRow_t::iterator iter = m_mapRow.find( sSymbol );
+  if ( m_mapRow.end() != iter ) {
+    m_vRow[ iter->second ].sUnderlying = sUnderlying;
+  }
+}
+
+void MktSymbolIngest::Insert( InMemoryMktSymbolList& list ) const {
+  for ( const trd_t& trd: m_vRow ) {
+    list( trd );
+  }
+}
+
+void MktSymbolIngest::Summary( void ) {
+  if ( m_pValidator ) m_pValidator->Summary();
+  std::cout
+    << "MktSymbolIngest: "
+    << m_stats.nLines << " lines, "
+    << m_stats.nRows << " rows, "
+    << m_stats.nChunks << " chunks on "
+    << m_stats.nThreads << " threads, "
+    << "parse " << m_stats.dblParse << "s, "
+    << "merge " << m_stats.dblMerge << "s, "
+    << (size_t)m_stats.LinesPerSecond() << " lines/s"
+    << std::endl;
+}
+
+} // namespace iqfeed
+} // namespace tf
+} // namespace ou
@@ -0,0 +1,94 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    MktSymbolIngest.h
+ * Author:  raymond@burkholder.net
+ * Project: TFIQFeed
+ * Created: October 19, 2026 17:40 PM
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "MarketSymbol.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace iqfeed { // IQFeed
+
+class InMemoryMktSymbolList;
+class ValidateMktSymbolLine;
+
+// parallel replacement for ParseMktSymbolDiskFile -> ValidateMktSymbolLine -> InMemoryMktSymbolList
+//   the file is mapped, and cut into chunks on line boundaries
+//   each chunk is parsed and validated on the pool by its own validator into its own row vector
+//   validators and rows are then merged, in file order, and PostProcess is applied to the merged rows
+//   the result is handed over in one step: Insert into a symbol list, or Rows for a bulk sqlite write
+
+class MktSymbolIngest {
+public:
+
+  using trd_t = MarketSymbol::TableRowDef;
+  using vRow_t = std::vector<trd_t>;
+
+  struct Stats {
+    size_t nLines;
+    size_t nRows;
+    size_t nChunks;
+    size_t nThreads;
+    double dblParse;  // seconds
+    double dblMerge;  // seconds, includes PostProcess
+    Stats(): nLines {}, nRows {}, nChunks {}, nThreads {}, dblParse {}, dblMerge {} {}
+    double LinesPerSecond( void ) const { return ( 0.0 == ( dblParse + dblMerge ) ) ? 0.0 : nLines / ( dblParse + dblMerge ); }
+  };
+
+  MktSymbolIngest( size_t nThreads = 0 ); // 0: one per hardware thread
+  ~MktSymbolIngest( void );
+
+  void Run( const std::string& sFileName ); // "mktsymbols_v2.txt", throws std::runtime_error if it can't be mapped
+  void Run( const char* pBegin, const char* pEnd ); // an unzipped download, header line included
+
+  vRow_t& Rows( void ) { return m_vRow; } // file order, with bHasOptions and corrected underlyings
+  void Insert( InMemoryMktSymbolList& ) const;
+
+  const Stats& GetStats( void ) const { return m_stats; }
+  void Summary( void ); // validator summary, then lines per second
+
+protected:
+private:
+
+  using mapRow_t = std::unordered_map<std::string,size_t>; // symbol, index into m_vRow
+
+  size_t m_nThreads;
+
+  vRow_t m_vRow;
+  mapRow_t m_mapRow;
+
+  std::unique_ptr<ValidateMktSymbolLine> m_pValidator; // merged from the chunks
+
+  Stats m_stats;
+
+  bool HandleHasOption( const std::string& );
+  void HandleUpdateOptionUnderlying( const std::string& sSymbol, const std::string& sUnderlying );
+
+};
+
+} // namespace iqfeed
+} // namespace tf
+} // namespace ou
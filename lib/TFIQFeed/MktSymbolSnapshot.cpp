@@ -0,0 +1,304 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    MktSymbolSnapshot.cpp
+ * Author:  raymond@burkholder.net
+ * Project: TFIQFeed
+ * Created: October 19, 2026 17:05 PM
+ */
+
+#include <vector>
+#include <cstdio>
+#include <ctime>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+
+#include <boost/filesystem.hpp>
+
+#include "MktSymbolSnapshot.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace iqfeed { // IQFeed
+
+namespace {
+
+  const char szMagic[ 8 ] = { 'O', 'U', 'I', 'Q', 'M', 'S', 'Y', 'M' };
+  const uint32_t nVersion = 2; // 2: source stamp
+
+  struct Header {
+    char szMagic[ 8 ];
+    uint32_t nVersion;
+    uint32_t nRowSize;
+    uint64_t nRows;
+    uint64_t oRows;       // offsets are from the start of the file
+    uint64_t oExchange;
+    uint64_t oClass;
+    uint64_t oUnderlying;
+    uint64_t oPool;
+    uint64_t nPool;
+    uint64_t nSourceSize; // of the .ser written with it, 0 when none
+    int64_t nSourceTime;  // its last write time, seconds since the epoch
+  };
+
+  // size and last write time, zeros when the file is absent
+  void Stamp( const std::string& sFileName, uint64_t& nSize, int64_t& nTime ) {
+    nSize = 0;
+    nTime = 0;
+    if ( !sFileName.empty() ) {
+      boost::system::error_code ec;
+      const uintmax_t size( boost::filesystem::file_size( sFileName, ec ) );
+      if ( !ec ) {
+        const std::time_t time( boost::filesystem::last_write_time( sFileName, ec ) );
+        if ( !ec ) {
+          nSize = size;
+          nTime = time;
+        }
+      }
+    }
+  }
+
+  static_assert( 72 == sizeof( MktSymbolSnapshot::Row ), "MktSymbolSnapshot::Row layout changed, bump nVersion" );
+
+  uint64_t Align8( uint64_t n ) { return ( n + 7 ) & ~uint64_t( 7 ); }
+
+  class Pool { // interns strings, exchanges and underlyings repeat a great deal
+  public:
+    MktSymbolSnapshot::Str Intern( const std::string& s ) {
+      MktSymbolSnapshot::Str str { 0, (uint32_t)s.size() };
+      if ( !s.empty() ) {
+        mapOffset_t::iterator iter = m_mapOffset.find( s );
+        if ( m_mapOffset.end() == iter ) {
+          iter = m_mapOffset.emplace( s, (uint32_t)m_vChar.size() ).first;
+          m_vChar.insert( m_vChar.end(), s.begin(), s.end() );
+        }
+        str.offset = iter->second;
+      }
+      return str;
+    }
+    const std::vector<char>& Chars( void ) const { return m_vChar; }
+  private:
+    using mapOffset_t = std::unordered_map<std::string,uint32_t>;
+    mapOffset_t m_mapOffset;
+    std::vector<char> m_vChar;
+  };
+
+  void Pad( std::ofstream& ofs, uint64_t nFrom, uint64_t nTo ) {
+    static const char zeros[ 8 ] = {};
+    ofs.write( zeros, nTo - nFrom );
+  }
+
+} // namespace anonymous
+
+void MktSymbolSnapshot::Write( const InMemoryMktSymbolList& list, const std::string& sFileName, const std::string& sFileNameSource ) {
+
+  using vRow_t = std::vector<Row>;
+  using vIndex_t = std::vector<uint32_t>;
+
+  Pool pool;
+  vRow_t vRow;
+  vRow.reserve( list.Size() );
+
+  list.ScanSymbols( // symbol order, the primary ordering of the snapshot
+    [&pool,&vRow]( const trd_t& trd ){
+      Row row;
+      std::memset( &row, 0, sizeof( Row ) );
+      row.symbol = pool.Intern( trd.sSymbol );
+      row.description = pool.Intern( trd.sDescription );
+      row.exchange = pool.Intern( trd.sExchange );
+      row.market = pool.Intern( trd.sListedMarket );
+      row.underlying = pool.Intern( trd.sUnderlying );
+      row.dblStrike = trd.dblStrike;
+      row.sc = trd.sc;
+      row.nSIC = trd.nSIC;
+      row.nNAICS = trd.nNAICS;
+      row.nMultiplier = trd.nMultiplier;
+      row.nYear = trd.nYear;
+      row.nMonth = trd.nMonth;
+      row.nDay = trd.nDay;
+      row.chOptionSide = (char)trd.eOptionSide;
+      row.nFlags = ( trd.bFrontMonth ? Row::EFrontMonth : 0 ) | ( trd.bHasOptions ? Row::EHasOptions : 0 );
+      vRow.push_back( row );
+    } );
+
+  if ( std::numeric_limits<uint32_t>::max() < pool.Chars().size() ) {
+    throw std::runtime_error( "MktSymbolSnapshot::Write string pool too large" );
+  }
+
+  const std::vector<char>& vChar( pool.Chars() );
+  auto string = [&vChar]( const Str& str ){ return std::string_view( vChar.data() + str.offset, str.length ); };
+
+  // stable sorts keep rows in symbol order within each key
+  auto build = [&vRow]( auto less )->vIndex_t {
+    vIndex_t v( vRow.size() );
+    for ( uint32_t ix = 0; ix < v.size(); ix++ ) v[ ix ] = ix;
+    std::stable_sort( v.begin(), v.end(), [&vRow,&less]( uint32_t a, uint32_t b ){ return less( vRow[ a ], vRow[ b ] ); } );
+    return v;
+  };
+  vIndex_t vExchange( build( [&string]( const Row& a, const Row& b ){ return string( a.exchange ) < string( b.exchange ); } ) );
+  vIndex_t vClass( build( []( const Row& a, const Row& b ){ return a.sc < b.sc; } ) );
+  vIndex_t vUnderlying( build( [&string]( const Row& a, const Row& b ){ return string( a.underlying ) < string( b.underlying ); } ) );
+
+  Header header;
+  std::memset( &header, 0, sizeof( Header ) );
+  std::memcpy( header.szMagic, szMagic, sizeof( szMagic ) );
+  header.nVersion = nVersion;
+  header.nRowSize = sizeof( Row );
+  header.nRows = vRow.size();
+  const uint64_t nIndex( Align8( vRow.size() * sizeof( uint32_t ) ) );
+  header.oRows = Align8( sizeof( Header ) );
+  header.oExchange = header.oRows + vRow.size() * sizeof( Row );
+  header.oClass = header.oExchange + nIndex;
+  header.oUnderlying = header.oClass + nIndex;
+  header.oPool = header.oUnderlying + nIndex;
+  header.nPool = vChar.size();
+  Stamp( sFileNameSource, header.nSourceSize, header.nSourceTime );
+
+  const std::string sTemp( sFileName + ".tmp" );
+  {
+    std::ofstream ofs( sTemp, std::ios::binary | std::ios::trunc );
+    if ( !ofs ) {
+      throw std::runtime_error( "MktSymbolSnapshot::Write can't open " + sTemp );
+    }
+    ofs.write( reinterpret_cast<const char*>( &header ), sizeof( Header ) );
+    Pad( ofs, sizeof( Header ), header.oRows );
+    ofs.write( reinterpret_cast<const char*>( vRow.data() ), vRow.size() * sizeof( Row ) );
+    for ( const vIndex_t* pv: { &vExchange, &vClass, &vUnderlying } ) {
+      ofs.write( reinterpret_cast<const char*>( pv->data() ), pv->size() * sizeof( uint32_t ) );
+      Pad( ofs, pv->size() * sizeof( uint32_t ), nIndex );
+    }
+    ofs.write( vChar.data(), vChar.size() );
+    if ( !ofs ) {
+      throw std::runtime_error( "MktSymbolSnapshot::Write failed writing " + sTemp );
+    }
+  }
+
+  std::remove( sFileName.c_str() ); // a mapped original lives on until unmapped
+  if ( 0 != std::rename( sTemp.c_str(), sFileName.c_str() ) ) {
+    throw std::runtime_error( "MktSymbolSnapshot::Write can't rename " + sTemp + " to " + sFileName );
+  }
+}
+
+MktSymbolSnapshot::MktSymbolSnapshot( const std::string& sFileName )
+: m_nRows {}, m_pRows( nullptr )
+, m_pixExchange( nullptr ), m_pixClass( nullptr ), m_pixUnderlying( nullptr )
+, m_pPool( nullptr )
+, m_nSourceSize {}, m_nSourceTime {}
+{
+  namespace ipc = boost::interprocess;
+
+  try {
+    m_file = ipc::file_mapping( sFileName.c_str(), ipc::read_only );
+    m_region = ipc::mapped_region( m_file, ipc::read_only );
+  }
+  catch ( const ipc::interprocess_exception& e ) {
+    throw std::runtime_error( "MktSymbolSnapshot can't map " + sFileName + ": " + e.what() );
+  }
+
+  const char* pBase( static_cast<const char*>( m_region.get_address() ) );
+  const uint64_t nSize( m_region.get_size() );
+
+  if ( sizeof( Header ) > nSize ) {
+    throw std::runtime_error( "MktSymbolSnapshot " + sFileName + " is truncated" );
+  }
+  const Header& header( *reinterpret_cast<const Header*>( pBase ) );
+  if ( 0 != std::memcmp( header.szMagic, szMagic, sizeof( szMagic ) ) ) {
+    throw std::runtime_error( "MktSymbolSnapshot " + sFileName + " is not a snapshot" );
+  }
+  if ( ( nVersion != header.nVersion ) || ( sizeof( Row ) != header.nRowSize ) ) {
+    throw std::runtime_error( "MktSymbolSnapshot " + sFileName + " has a different layout, rebuild it" );
+  }
+  const uint64_t nIndex( Align8( header.nRows * sizeof( uint32_t ) ) );
+  if (
+       ( header.oRows + header.nRows * sizeof( Row ) > header.oExchange )
+    || ( header.oExchange + nIndex > header.oClass )
+    || ( header.oClass + nIndex > header.oUnderlying )
+    || ( header.oUnderlying + nIndex > header.oPool )
+    || ( header.oPool + header.nPool > nSize )
+  ) {
+    throw std::runtime_error( "MktSymbolSnapshot " + sFileName + " is truncated" );
+  }
+
+  m_nRows = header.nRows;
+  m_pRows = reinterpret_cast<const Row*>( pBase + header.oRows );
+  m_pixExchange = reinterpret_cast<const uint32_t*>( pBase + header.oExchange );
+  m_pixClass = reinterpret_cast<const uint32_t*>( pBase + header.oClass );
+  m_pixUnderlying = reinterpret_cast<const uint32_t*>( pBase + header.oUnderlying );
+  m_pPool = pBase + header.oPool;
+  m_nSourceSize = header.nSourceSize;
+  m_nSourceTime = header.nSourceTime;
+}
+
+bool MktSymbolSnapshot::Current( const std::string& sFileNameSource ) const {
+  uint64_t nSize;
+  int64_t nTime;
+  Stamp( sFileNameSource, nSize, nTime );
+  if ( 0 == nSize ) return true; // no source, the snapshot is all there is
+  return ( m_nSourceSize == nSize ) && ( m_nSourceTime == nTime );
+}
+
+MktSymbolSnapshot::~MktSymbolSnapshot( void ) {
+}
+
+MktSymbolSnapshot::trd_t MktSymbolSnapshot::Trd( const Row& row ) const {
+  trd_t trd;
+  trd.sSymbol = String( row.symbol );
+  trd.sDescription = String( row.description );
+  trd.sExchange = String( row.exchange );
+  trd.sListedMarket = String( row.market );
+  trd.sUnderlying = String( row.underlying );
+  trd.sc = row.sc;
+  trd.nMultiplier = row.nMultiplier;
+  trd.nSIC = row.nSIC;
+  trd.nNAICS = row.nNAICS;
+  trd.eOptionSide = (ou::tf::OptionSide::EOptionSide)row.chOptionSide;
+  trd.dblStrike = row.dblStrike;
+  trd.nYear = row.nYear;
+  trd.nMonth = row.nMonth;
+  trd.nDay = row.nDay;
+  trd.bFrontMonth = row.FrontMonth();
+  trd.bHasOptions = row.HasOptions();
+  return trd;
+}
+
+const MktSymbolSnapshot::Row* MktSymbolSnapshot::Find( std::string_view sSymbol ) const {
+  const Row* pEnd( m_pRows + m_nRows );
+  const Row* pRow = std::lower_bound(
+    m_pRows, pEnd, sSymbol,
+    [this]( const Row& row, std::string_view s ){ return String( row.symbol ) < s; } );
+  if ( ( pEnd != pRow ) && ( String( pRow->symbol ) == sSymbol ) ) return pRow;
+  return nullptr;
+}
+
+MktSymbolSnapshot::trd_t MktSymbolSnapshot::GetTrd( const std::string& sSymbol ) const {
+  const Row* pRow( Find( sSymbol ) );
+  if ( nullptr == pRow ) {
+    throw std::runtime_error( "GetTrd can't find " + sSymbol );
+  }
+  return Trd( *pRow );
+}
+
+void MktSymbolSnapshot::Populate( InMemoryMktSymbolList& list ) const {
+  for ( size_t ix = 0; ix < m_nRows; ix++ ) {
+    list( Trd( m_pRows[ ix ] ) );
+  }
+}
+
+} // namespace iqfeed
+} // namespace tf
+} // namespace ou
@@ -0,0 +1,167 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    MktSymbolSnapshot.h
+ * Author:  raymond@burkholder.net
+ * Project: TFIQFeed
+ * Created: October 19, 2026 17:05 PM
+ */
+
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include <algorithm>
+#include <string_view>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include "InMemoryMktSymbolList.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace iqfeed { // IQFeed
+
+// read-only, memory mapped, image of an InMemoryMktSymbolList
+//   opening is a map and a header check, nothing is deserialized, pages fault in as they are touched
+//   strings are interned into one pool, rows are fixed size and sorted by symbol
+//   exchange, class and underlying are arrays of row numbers, pre-sorted at Write, searched by binary search
+//   the multi_index container is built only when asked for, through Populate
+// the file is in native byte order, the header records the layout version and row size
+// the header also records the size and modification time of the .ser the snapshot was written beside,
+//   Current() tells a loader when that .ser has since been rewritten, and the snapshot is stale
+// Write builds a temporary and renames it over the target, so an open snapshot keeps its old pages
+
+class MktSymbolSnapshot {
+public:
+
+  using trd_t = InMemoryMktSymbolList::trd_t;
+
+  struct Str { // slice of the string pool
+    uint32_t offset;
+    uint32_t length;
+  };
+
+  struct Row {
+    Str symbol;
+    Str description;
+    Str exchange;
+    Str market;
+    Str underlying;
+    double dblStrike;
+    ESecurityType sc;
+    uint32_t nSIC;
+    uint32_t nNAICS;
+    uint16_t nMultiplier;
+    uint16_t nYear;
+    uint8_t nMonth;
+    uint8_t nDay;
+    char chOptionSide; // OptionSide::EOptionSide
+    uint8_t nFlags;
+    uint32_t nReserved;
+    enum EFlags: uint8_t { EFrontMonth = 0x01, EHasOptions = 0x02 };
+    bool FrontMonth( void ) const { return 0 != ( nFlags & EFrontMonth ); }
+    bool HasOptions( void ) const { return 0 != ( nFlags & EHasOptions ); }
+  };
+
+  explicit MktSymbolSnapshot( const std::string& sFileName ); // throws std::runtime_error on a missing or mismatched file
+  ~MktSymbolSnapshot( void );
+
+  // sFileNameSource: the serialized list just saved from the same content, empty when there is none
+  static void Write( const InMemoryMktSymbolList&, const std::string& sFileName, const std::string& sFileNameSource = std::string() );
+
+  // false when sFileNameSource differs from the one stamped at Write, true when it is absent
+  bool Current( const std::string& sFileNameSource ) const;
+
+  size_t Size( void ) const { return m_nRows; }
+  const Row& operator[]( size_t ix ) const { return m_pRows[ ix ]; }
+
+  std::string_view String( const Str& str ) const { return std::string_view( m_pPool + str.offset, str.length ); }
+
+  trd_t Trd( const Row& ) const;
+
+  const Row* Find( std::string_view sSymbol ) const; // nullptr when not found
+  bool Exists( std::string_view sSymbol ) const { return nullptr != Find( sSymbol ); }
+  trd_t GetTrd( const std::string& sSymbol ) const; // throws as InMemoryMktSymbolList::GetTrd
+
+  // Function: void( const Row& ), rows are presented in symbol order within each key
+
+  template<typename Function>
+  void ScanSymbols( Function f ) const {
+    for ( size_t ix = 0; ix < m_nRows; ix++ ) f( m_pRows[ ix ] );
+  }
+
+  template<typename Function>
+  void SelectSymbolsByExchange( std::string_view sExchange, Function f ) const {
+    Select( m_pixExchange, [this,sExchange]( uint32_t ix ){ return String( m_pRows[ ix ].exchange ).compare( sExchange ); }, f );
+  }
+
+  template<typename ExchangeIterator, typename Function>
+  void SelectSymbolsByExchange( ExchangeIterator beginExchange, ExchangeIterator endExchange, Function f ) const {
+    for ( ; beginExchange != endExchange; beginExchange++ ) SelectSymbolsByExchange( std::string_view( *beginExchange ), f );
+  }
+
+  template<typename Function>
+  void SelectSymbolsByClass( ESecurityType sc, Function f ) const {
+    Select( m_pixClass, [this,sc]( uint32_t ix ){ return (int)m_pRows[ ix ].sc - (int)sc; }, f );
+  }
+
+  template<typename Function>
+  void SelectOptionsByUnderlying( std::string_view sUnderlying, Function f ) const {
+    Select( m_pixUnderlying, [this,sUnderlying]( uint32_t ix ){ return String( m_pRows[ ix ].underlying ).compare( sUnderlying ); }, f );
+  }
+
+  // build the multi_index container, for code which still needs one
+  void Populate( InMemoryMktSymbolList& ) const;
+
+  template<typename Predicate> // bool( const Row& )
+  void Populate( InMemoryMktSymbolList& list, Predicate f ) const {
+    for ( size_t ix = 0; ix < m_nRows; ix++ ) {
+      if ( f( m_pRows[ ix ] ) ) list( Trd( m_pRows[ ix ] ) );
+    }
+  }
+
+protected:
+private:
+
+  boost::interprocess::file_mapping m_file;
+  boost::interprocess::mapped_region m_region;
+
+  size_t m_nRows;
+  const Row* m_pRows;
+  const uint32_t* m_pixExchange;
+  const uint32_t* m_pixClass;
+  const uint32_t* m_pixUnderlying;
+  const char* m_pPool;
+
+  uint64_t m_nSourceSize;
+  int64_t m_nSourceTime;
+
+  // Compare: int( uint32_t ixRow ), <0, 0, >0 relative to the key
+  template<typename Compare, typename Function>
+  void Select( const uint32_t* pIndex, Compare compare, Function& f ) const {
+    const uint32_t* pEnd( pIndex + m_nRows );
+    const uint32_t* pBegin = std::lower_bound( pIndex, pEnd, 0, [&compare]( uint32_t ix, int ){ return compare( ix ) < 0; } );
+    for ( ; ( pEnd != pBegin ) && ( 0 == compare( *pBegin ) ); pBegin++ ) {
+      f( m_pRows[ *pBegin ] );
+    }
+  }
+
+};
+
+} // namespace iqfeed
+} // namespace tf
+} // namespace ou
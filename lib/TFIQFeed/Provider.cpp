@@ -12,6 +12,12 @@
  * See the file LICENSE.txt for redistribution information.             *
  ************************************************************************/
 
+#include <thread>
+#include <chrono>
+#include <functional>
+
+#include <boost/asio/post.hpp>
+#include <boost/scope_exit.hpp>
 #include <boost/lexical_cast.hpp>
 
 #include <TFTrading/KeyTypes.h>
@@ -26,6 +32,7 @@ namespace iqfeed { // IQFeed
 Provider::Provider()
 : ou::tf::sim::SimulationInterface<Provider,IQFeedSymbol>()
 , IQFeed<Provider>()
+, m_nShardPending {}
 {
   m_sName = "IQFeed";
   m_nID = keytypes::EProviderIQF;
@@ -37,6 +44,42 @@ Provider::Provider()
 }
 
 Provider::~Provider() {
+  // shard handlers hold buffers from IQFeed, which is destroyed before the worker threads are joined
+  while ( 0 != m_nShardPending.load() ) {
+    std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+  }
+}
+
+void Provider::SetShardCount( size_t nShards ) {
+  assert( 0 < nShards );
+  assert( m_vShard.empty() );
+  assert( 0 == m_mapSymbols.size() ); // symbols pick up their shard when added
+  if ( 0 == m_nThreads ) SetThreadCount( nShards );
+  for ( size_t ix = 0; ix < nShards; ix++ ) {
+    m_vShard.emplace_back( std::make_unique<strand_t>( m_srvc ) );
+  }
+}
+
+template<typename F>
+void Provider::Route( IQFeedSymbol& symbol, F&& f ) {
+  if ( symbol.m_bShard ) {
+    m_nShardPending++;
+    const ou::latency::Trace trace( ou::latency::Capture() );
+    boost::asio::post(
+      *symbol.m_pStrand,
+      [this,trace,f_=std::move( f )](){
+        ou::latency::Resume( trace );
+        ou::latency::Mark( ou::latency::EStage::Strand );
+        BOOST_SCOPE_EXIT_TPL( this_ ) { // even when f_ throws, so ~Provider is not left waiting
+          ou::latency::End();
+          this_->m_nShardPending--;
+        } BOOST_SCOPE_EXIT_END
+        f_();
+      } );
+  }
+  else {
+    f();
+  }
 }
 
 void Provider::EnableExecution( bool bEnable ) {
@@ -81,6 +124,10 @@ void Provider::OnIQFeedError( size_t e ) {
 Provider::pSymbol_t Provider::NewCSymbol( pInstrument_t pInstrument ) {
   pSymbol_t pSymbol( new IQFeedSymbol( pInstrument->GetInstrumentName( ID() ), pInstrument ) );
   inherited_t::AddCSymbol( pSymbol );
+  if ( !m_vShard.empty() ) {
+    const size_t ix( std::hash<std::string>()( pSymbol->GetId() ) % m_vShard.size() );
+    pSymbol->SetShard( *m_vShard[ ix ] );
+  }
   return pSymbol;
 }
 
@@ -194,12 +241,17 @@ void Provider::OnIQFeedDynamicFeedUpdateMessage( linebuffer_t* pBuffer, IQFDynam
   mapSymbols_iter = m_mapSymbols.find( field );
   if ( m_mapSymbols.end() != mapSymbols_iter ) {
     pSymbol_t pSym = mapSymbols_iter -> second;
-    pSym ->HandleDynamicFeedUpdateMessage( pMsg );
+    ou::latency::Tag( pSym->m_idLatency );
+    ou::latency::Mark( ou::latency::EStage::Dispatch );
+    Route( *pSym, [this,pSym,pBuffer,pMsg](){
+      pSym ->HandleDynamicFeedUpdateMessage( pMsg );
+      this->DynamicFeedUpdateDone( pBuffer, pMsg );
+    } );
   }
   else {
     std::cout << "field " << field << " update not found" << std::endl;
+    this->DynamicFeedUpdateDone( pBuffer, pMsg );
   }
-  this->DynamicFeedUpdateDone( pBuffer, pMsg );
 }
 
 void Provider::OnIQFeedDynamicFeedSummaryMessage( linebuffer_t* pBuffer, IQFDynamicFeedSummaryMessage *pMsg ) {
@@ -208,12 +260,15 @@ void Provider::OnIQFeedDynamicFeedSummaryMessage( linebuffer_t* pBuffer, IQFDyna
   mapSymbols_iter = m_mapSymbols.find( field );
   if ( m_mapSymbols.end() != mapSymbols_iter ) {
     pSymbol_t  pSym = mapSymbols_iter -> second;
-    pSym ->HandleDynamicFeedSummaryMessage( pMsg );
+    Route( *pSym, [this,pSym,pBuffer,pMsg](){
+      pSym ->HandleDynamicFeedSummaryMessage( pMsg );
+      this->DynamicFeedSummaryDone( pBuffer, pMsg );
+    } );
   }
   else {
     std::cout << "field " << field << " summary not found" << std::endl;
+    this->DynamicFeedSummaryDone( pBuffer, pMsg );
   }
-  this->DynamicFeedSummaryDone( pBuffer, pMsg );
 }
 
 void Provider::OnIQFeedUpdateMessage( linebuffer_t* pBuffer, IQFUpdateMessage *pMsg ) {
@@ -222,9 +277,14 @@ void Provider::OnIQFeedUpdateMessage( linebuffer_t* pBuffer, IQFUpdateMessage *p
   pSymbol_t pSym;
   if ( m_mapSymbols.end() != mapSymbols_iter ) {
     pSym = mapSymbols_iter -> second;
-    pSym ->HandleUpdateMessage( pMsg );
+    Route( *pSym, [this,pSym,pBuffer,pMsg](){
+      pSym ->HandleUpdateMessage( pMsg );
+      this->UpdateDone( pBuffer, pMsg );
+    } );
+  }
+  else {
+    this->UpdateDone( pBuffer, pMsg );
   }
-  this->UpdateDone( pBuffer, pMsg );
 }
 
 void Provider::OnIQFeedSummaryMessage( linebuffer_t* pBuffer, IQFSummaryMessage *pMsg ) {
@@ -233,9 +293,14 @@ void Provider::OnIQFeedSummaryMessage( linebuffer_t* pBuffer, IQFSummaryMessage
   pSymbol_t pSym;
   if ( m_mapSymbols.end() != mapSymbols_iter ) {
     pSym = mapSymbols_iter -> second;
-    pSym ->HandleSummaryMessage( pMsg );
+    Route( *pSym, [this,pSym,pBuffer,pMsg](){
+      pSym ->HandleSummaryMessage( pMsg );
+      this->SummaryDone( pBuffer, pMsg );
+    } );
+  }
+  else {
+    this->SummaryDone( pBuffer, pMsg );
   }
-  this->SummaryDone( pBuffer, pMsg );
 }
 
 void Provider::OnIQFeedFundamentalMessage( linebuffer_t* pBuffer, IQFFundamentalMessage *pMsg ) {
@@ -244,35 +309,40 @@ void Provider::OnIQFeedFundamentalMessage( linebuffer_t* pBuffer, IQFFundamental
   pSymbol_t pSym;
   if ( m_mapSymbols.end() != mapSymbols_iter ) {
     pSym = mapSymbols_iter -> second;
-    pSym ->HandleFundamentalMessage(
-      pMsg,
-      [this](int nSecurityType )->ESecurityType { return LookupSecurityType( nSecurityType ); },
-      [this](std::string sExchangeId)->std::string{ // supplied string is in hex
-        int n {};
-        int t {};
-        for ( std::string::iterator iter = sExchangeId.begin(); iter != sExchangeId.end(); iter++ ) {
-          n = n << 4;
-          char cur = *iter;
-          if ( ( 'A' <= cur ) && ( 'F' >= cur ) ) {
-            t = cur - 'A' + 10;
-          }
-          else {
-            if ( ( 'a' <= cur ) && ( 'f' >= cur ) ) {
-              t = cur - 'a' + 10;
+    Route( *pSym, [this,pSym,pBuffer,pMsg](){
+      pSym ->HandleFundamentalMessage(
+        pMsg,
+        [this](int nSecurityType )->ESecurityType { return LookupSecurityType( nSecurityType ); },
+        [this](std::string sExchangeId)->std::string{ // supplied string is in hex
+          int n {};
+          int t {};
+          for ( std::string::iterator iter = sExchangeId.begin(); iter != sExchangeId.end(); iter++ ) {
+            n = n << 4;
+            char cur = *iter;
+            if ( ( 'A' <= cur ) && ( 'F' >= cur ) ) {
+              t = cur - 'A' + 10;
             }
             else {
-              if ( ( '0' <= cur ) && ( '9' >= cur ) ) {
-                t = cur - '0';
+              if ( ( 'a' <= cur ) && ( 'f' >= cur ) ) {
+                t = cur - 'a' + 10;
+              }
+              else {
+                if ( ( '0' <= cur ) && ( '9' >= cur ) ) {
+                  t = cur - '0';
+                }
               }
             }
+            n += t;
           }
-          n += t;
+          return LookupListedMarket( n );
         }
-        return LookupListedMarket( n );
-      }
-      );
+        );
+      this->FundamentalDone( pBuffer, pMsg );
+    } );
+  }
+  else {
+    this->FundamentalDone( pBuffer, pMsg );
   }
-  this->FundamentalDone( pBuffer, pMsg );
 }
 
 void Provider::OnIQFeedNewsMessage( linebuffer_t* pBuffer, IQFNewsMessage *pMsg ) {
@@ -14,6 +14,12 @@
 
 #pragma once
 
+#include <atomic>
+#include <vector>
+#include <memory>
+
+#include <boost/asio/io_context_strand.hpp>
+
 #include <TFSimulation/SimulationInterface.hpp>
 
 #include "IQFeed.h"
@@ -60,6 +66,13 @@ public:
 
   std::string ListedMarket( key_t nListedMarket ) const { return LookupListedMarket( nListedMarket ); }
 
+  // strong suggestion: set prior to connect, and prior to adding symbols
+  //   symbols are hashed onto nShards strands, where their messages are decoded and their callbacks run
+  //   the network thread then only frames and routes lines, messages for a symbol remain in order
+  //   uses nShards worker threads if SetThreadCount has not been called
+  void SetShardCount( size_t nShards );
+  size_t GetShardCount() const { return m_vShard.size(); }
+
 protected:
 
   // overridden from ProviderInterface, called when application adds/removes watches
@@ -86,6 +99,15 @@ protected:
 
 private:
 
+  using strand_t = boost::asio::io_context::strand;
+  using vShard_t = std::vector<std::unique_ptr<strand_t> >;
+
+  vShard_t m_vShard;
+  std::atomic<size_t> m_nShardPending; // posted to a shard, buffers not yet given back
+
+  template<typename F>
+  void Route( IQFeedSymbol&, F&& ); // onto the symbol's shard, or in line without shards
+
   void UpdateQuoteTradeWatch( char command, IQFeedSymbol::WatchState next, IQFeedSymbol *pSymbol );
 
   void HandleExecution( Order::idOrder_t orderId, const Execution &exec );
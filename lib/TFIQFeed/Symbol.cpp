@@ -18,6 +18,8 @@
 
 #include <OUCommon/TimeSource.h>
 
+#include <OUCommon/Latency.h>
+
 #include <TFTrading/MacroStrand.h>
 
 #include "Symbol.h"
@@ -32,6 +34,8 @@ IQFeedSymbol::IQFeedSymbol( const idSymbol_t& sSymbol, pInstrument_t pInstrument
 , m_QStatus( qUnknown )
 , m_stateWatch( WatchState::None )
 , m_bWaitForFirstQuote( true )
+, m_idLatency( ou::latency::Intern( sSymbol ) )
+, m_bShard( false )
 {
   m_pFundamentals = std::make_shared<Fundamentals>();
   m_pSummary = std::make_shared<Summary>();
@@ -40,6 +44,12 @@ IQFeedSymbol::IQFeedSymbol( const idSymbol_t& sSymbol, pInstrument_t pInstrument
 IQFeedSymbol::~IQFeedSymbol() {
 }
 
+void IQFeedSymbol::SetShard( boost::asio::io_context::strand& shard ) {
+  m_pStrand = std::make_unique<boost::asio::io_context::strand>( shard );
+  m_bStrand = false;
+  m_bShard = true;
+}
+
 void IQFeedSymbol::HandleFundamentalMessage(
   IQFFundamentalMessage *pMsg,
   fLookupSecurityType_t&& fLookupSecurityType,
@@ -319,6 +329,7 @@ void IQFeedSymbol::HandleDynamicFeedUpdateMessage( IQFDynamicFeedUpdateMessage*
 //  }
 //  if ( qFound == m_QStatus ) {
     DecodeDynamicFeedMessage<IQFDynamicFeedUpdateMessage>( pMsg );
+    ou::latency::Mark( ou::latency::EStage::Decode );
 
     STRAND( OnUpdateMessage( m_pSummary ) )
 
@@ -347,11 +358,21 @@ void IQFeedSymbol::HandleNewsMessage( IQFNewsMessage* pMsg ) {
 }
 
 void IQFeedSymbol::SubmitMarketDepthByMM( const ou::tf::DepthByMM& md ) {
-  STRAND_CAPTURE( (Symbol::m_OnDepthByMM( md )), md )
+  if ( m_bShard ) { // keeps depth in order with quotes and trades
+    boost::asio::post( *m_pStrand, [this,md](){ Symbol::m_OnDepthByMM( md ); } );
+  }
+  else {
+    STRAND_CAPTURE( (Symbol::m_OnDepthByMM( md )), md )
+  }
 }
 
 void IQFeedSymbol::SubmitMarketDepthByOrder( const ou::tf::DepthByOrder& md ) {
-  STRAND_CAPTURE( (Symbol::m_OnDepthByOrder( md )), md )
+  if ( m_bShard ) {
+    boost::asio::post( *m_pStrand, [this,md](){ Symbol::m_OnDepthByOrder( md ); } );
+  }
+  else {
+    STRAND_CAPTURE( (Symbol::m_OnDepthByOrder( md )), md )
+  }
 }
 
 } // namespace iqfeed
@@ -100,6 +100,9 @@ protected:
     None, WSQuote, WSTrade, Both
   };
 
+  // messages arrive already on the shard, so callbacks run in line, depth is posted to the shard
+  void SetShard( boost::asio::io_context::strand& );
+
   void SetWatchState( WatchState state ) { m_stateWatch = state; };
   WatchState GetWatchState() const { return m_stateWatch; };
 
@@ -132,6 +135,10 @@ private:
   pFundamentals_t m_pFundamentals;
   pSummary_t m_pSummary;
 
+  uint32_t m_idLatency; // tags latency traces, see OUCommon/Latency.h
+
+  bool m_bShard; // m_pStrand is a copy of a Provider shard
+
 };
 
 } // namespace iqfeed
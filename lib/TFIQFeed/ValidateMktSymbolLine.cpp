@@ -98,6 +98,38 @@ void ValidateMktSymbolLine::PostProcess() {
   }
 }
 
+void ValidateMktSymbolLine::CountExchange( const std::string& sPattern, size_t cnt, bool bAnnounce ) {
+  size_t ix = kwmExchanges.FindMatch( sPattern );
+  if ( ( 0 == ix ) || ( sPattern.length() != vSymbolsPerExchange[ ix ].s.length() ) ) {
+    if ( bAnnounce ) std::cout << "Adding Exchange " << sPattern << std::endl;
+    size_t ixNew = kwmExchanges.GetPatternCount();
+    kwmExchanges.AddPattern( sPattern, ixNew );
+    structCountPerString cps;
+    vSymbolsPerExchange.push_back( cps );
+    vSymbolsPerExchange[ ixNew ].cnt = cnt;
+    vSymbolsPerExchange[ ixNew ].s = sPattern;
+  }
+  else {
+    vSymbolsPerExchange[ ix ].cnt += cnt;
+  }
+}
+
+void ValidateMktSymbolLine::Merge( const ValidateMktSymbolLine& rhs ) {
+  cntLinesTotal += rhs.cntLinesTotal;
+  cntLinesParsed += rhs.cntLinesParsed;
+  cntSIC += rhs.cntSIC;
+  cntNAICS += rhs.cntNAICS;
+  nUnderlyingSize = std::max<unsigned short>( nUnderlyingSize, rhs.nUnderlyingSize );
+  for ( size_t ix = 0; ix < vSymbolTypeStats.size(); ix++ ) {
+    vSymbolTypeStats[ ix ] += rhs.vSymbolTypeStats[ ix ];
+  }
+  vSymbolsPerExchange[ 0 ].cnt += rhs.vSymbolsPerExchange[ 0 ].cnt;
+  for ( size_t ix = 1; ix < rhs.vSymbolsPerExchange.size(); ix++ ) { // 0 is the unknown entry
+    CountExchange( rhs.vSymbolsPerExchange[ ix ].s, rhs.vSymbolsPerExchange[ ix ].cnt, false );
+  }
+  mapUnderlying.insert( rhs.mapUnderlying.begin(), rhs.mapUnderlying.end() );
+}
+
 void ValidateMktSymbolLine::Summary() {
 
   std::cout << "== Market Symbol Type and Count ==" << std::endl;
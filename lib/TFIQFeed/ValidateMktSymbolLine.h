@@ -63,6 +63,9 @@ public:
 
   void PostProcess( void );
 
+  // fold in the counts and optionables of a validator which parsed another part of the same file
+  void Merge( const ValidateMktSymbolLine& );
+
   void Summary( void );
 
   size_t LinesProcessed( void ) const { return cntLinesTotal; };
@@ -110,6 +113,8 @@ private:
   void ParseOptionContractInformation( trd_t& trd );
   void ParseFOptionContractInformation( trd_t& trd );
 
+  void CountExchange( const std::string& sPattern, size_t cnt, bool bAnnounce );
+
 };
 
 extern boost::uint8_t rFutureMonth[];
@@ -139,8 +144,6 @@ void ValidateMktSymbolLine::Parse( Iterator& begin, Iterator& end ) {
 
       cntLinesParsed++;
 
-      size_t ix;
-
       vSymbolTypeStats[ (size_t)trd.sc ]++;
       if ( sc_t::Unknown == trd.sc ) {
         // set marker not to save record?
@@ -158,19 +161,7 @@ void ValidateMktSymbolLine::Parse( Iterator& begin, Iterator& end ) {
         std::cout << trd.sSymbol << " has zero length exchange,market" << std::endl;
       }
       else {
-        ix = kwmExchanges.FindMatch( sPattern );
-        if ( ( 0 == ix ) || ( sPattern.length() != vSymbolsPerExchange[ ix ].s.length() ) ) {
-          std::cout << "Adding Exchange " << sPattern << std::endl;
-          size_t cnt = kwmExchanges.GetPatternCount();
-          kwmExchanges.AddPattern( sPattern, cnt );
-          structCountPerString cps;
-          vSymbolsPerExchange.push_back( cps );
-          vSymbolsPerExchange[ cnt ].cnt = 1;
-          vSymbolsPerExchange[ cnt ].s = sPattern;
-        }
-        else {
-          ++( vSymbolsPerExchange[ ix ].cnt );
-        }
+        CountExchange( sPattern, 1, true );
       }
 
       bool bDecode( true );
@@ -230,7 +221,7 @@ void ValidateMktSymbolLine::Parse( Iterator& begin, Iterator& end ) {
     if ( b == begin ) { // nothing was processed, so skip over crap
       std::cout << "parserFullLine serious fail" << std::endl;
       while ( ( end != begin ) && ( '\n' != *begin )  && ( 0 != *begin ) ) ++begin;
-      if ( '\n' == *begin ) ++begin; // one last character which should be the \n
+      if ( ( end != begin ) && ( '\n' == *begin ) ) ++begin; // one last character which should be the \n
     }
   }
 
@@ -594,6 +594,22 @@ void Combo::SaveSeries( const std::string& sPrefix ) {
   }
 }
 
+void Combo::CollectSeries( ou::tf::HDF5WriteBatch& batch, const std::string& sPrefix ) {
+  for ( mapComboLeg_t::value_type& entry: m_mapComboLeg ) {
+    entry.second.m_leg.CollectSeries( batch, sPrefix );
+  }
+}
+
+void Combo::RiskGridLegs( boost::posix_time::ptime dtUtcOrigin, RiskGrid::vLeg_t& vLeg ) const {
+  vLeg.clear();
+  RiskGrid::Leg leg;
+  for ( const mapComboLeg_t::value_type& entry: m_mapComboLeg ) {
+    if ( entry.second.m_leg.RiskGridLeg( dtUtcOrigin, leg ) ) {
+      vLeg.push_back( leg );
+    }
+  }
+}
+
 } // namespace option
 } // namespace tf
 } // namespace ou
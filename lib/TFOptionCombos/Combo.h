@@ -196,6 +196,9 @@ public:
 
   bool AreOrdersActive() const;
   void SaveSeries( const std::string& sPrefix );
+  void CollectSeries( ou::tf::HDF5WriteBatch&, const std::string& sPrefix );
+
+  void RiskGridLegs( boost::posix_time::ptime dtUtcOrigin, RiskGrid::vLeg_t& ) const; // active legs only
 
 protected:
 
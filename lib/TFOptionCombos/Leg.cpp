@@ -19,6 +19,9 @@
  * Created on May 25, 2019, 4:46 PM
  */
 
+#include <cmath>
+#include <algorithm>
+
 #include <boost/log/trivial.hpp>
 
 #include "Leg.h"
@@ -154,6 +157,12 @@ void Leg::SaveSeries( const std::string& sPrefix ) {
   }
 }
 
+void Leg::CollectSeries( HDF5WriteBatch& batch, const std::string& sPrefix ) {
+  if ( m_pPosition ) {
+    m_pPosition->GetWatch()->CollectSeries( batch, sPrefix ); // virtual, options add their greeks
+  }
+}
+
 namespace { // where is the primary table?  is there a primary table?
   constexpr size_t ixPL = 2;
   constexpr size_t ixIV = 11;
@@ -376,5 +385,52 @@ double Leg::ConstructedValue() const {
   return value;
 }
 
+bool Leg::RiskGridLeg( boost::posix_time::ptime dtUtcOrigin, option::RiskGrid::Leg& leg ) const {
+
+  if ( !m_pPosition ) return false;
+
+  const ou::tf::Position::TableRowDef& row( m_pPosition->GetRow() );
+  if ( 0 == row.nPositionActive ) return false;
+
+  int quantity {};
+  switch ( row.eOrderSideActive ) {
+    case ou::tf::OrderSide::Buy:
+      quantity = (int) row.nPositionActive;
+      break;
+    case ou::tf::OrderSide::Sell:
+      quantity = -(int) row.nPositionActive;
+      break;
+    case ou::tf::OrderSide::Unknown:
+    default:
+      return false; // not active
+  }
+
+  ou::tf::Instrument::pInstrument_t pInstrument( m_pPosition->GetInstrument() );
+  const double multiplier( pInstrument->GetMultiplier() );
+
+  leg.idInstrument = pInstrument->GetInternId();
+  leg.quantity = quantity;
+  leg.multiplier = multiplier;
+  leg.basis = std::abs( row.dblConstructedValue ) / ( row.nPositionActive * multiplier );
+
+  if ( m_bOption ) {
+    pOption_t pOption = std::dynamic_pointer_cast<ou::tf::option::Option>( m_pPosition->GetWatch() );
+    leg.side = pOption->GetOptionSide();
+    leg.strike = pOption->GetStrike();
+    leg.iv = pOption->ImpliedVolatility();
+    static const double dblSecondsPerYear( 365.0 * 24.0 * 60.0 * 60.0 );
+    const double tue( ( pInstrument->GetExpiryUtc() - dtUtcOrigin ).total_seconds() / dblSecondsPerYear );
+    leg.tue = std::max( 0.0, tue );
+  }
+  else {
+    leg.side = ou::tf::OptionSide::Unknown;
+    leg.strike = 0.0;
+    leg.iv = 0.0;
+    leg.tue = 0.0;
+  }
+
+  return true;
+}
+
 } // namespace ou
 } // namespace tf
@@ -29,6 +29,7 @@
 
 // TODO: may need option version inheritance
 #include <TFOptions/Option.h>
+#include <TFOptions/RiskGrid.h>
 
 #include "LegNote.h"
 
@@ -57,6 +58,7 @@ public:
   bool IsActive() const;
 
   void SaveSeries( const std::string& sPrefix );
+  void CollectSeries( HDF5WriteBatch&, const std::string& sPrefix );
 
   void SetChartData( pChartDataView_t pChartData, ou::Colour::EColour );
   void DelChartData();
@@ -66,6 +68,9 @@ public:
   void NetGreeks( double& delta, double& gamma ) const;
   void NetGreeks( double& pl, double& IV, double& delta, double& gamma, double& theta, double& vega, double& rho );
 
+  // active position as a scenario grid leg, time to expiry measured from dtUtcOrigin, false when flat
+  bool RiskGridLeg( boost::posix_time::ptime dtUtcOrigin, option::RiskGrid::Leg& ) const;
+
   const option::LegNote& GetLegNote() const { return m_legNote; }
 
 private:
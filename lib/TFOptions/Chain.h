@@ -27,7 +27,12 @@
 #include <algorithm>
 #include <functional>
 
-#include <map>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+#include <vector>
 #include <string>
 #include <stdexcept>
 
@@ -52,6 +57,8 @@ namespace chain {
     : sIQFeedSymbolName( rhs.sIQFeedSymbolName ) {}
     OptionName( const OptionName&& rhs )
     : sIQFeedSymbolName( std::move( rhs.sIQFeedSymbolName ) ) {}
+    OptionName& operator=( const OptionName& ) = default;
+    OptionName& operator=( OptionName&& ) = default;
   };
 
   template<typename Option>
@@ -67,11 +74,139 @@ namespace chain {
     : call( rhs.call ),
       put( rhs.put )
       {}
-    Strike( const Strike&& rhs )
+    Strike( Strike&& rhs )
     : call( std::move( rhs.call ) ),
       put( std::move( rhs.put ) )
       {}
+    Strike& operator=( const Strike& ) = default;
+    Strike& operator=( Strike&& ) = default;
   };
+
+  // sorted strikes, each with the position of its record in the caller's contiguous records
+  //   records are appended as strikes arrive, so an insert shifts only the small sorted arrays
+  //   lookups use a bucket table over the strike range, evenly spaced strikes land in their bucket directly,
+  //   uneven strikes have a short branchless search within the bucket
+  //   the table is built on the first lookup after a change, so loading a chain doesn't rebuild it per strike
+  class StrikeIndex {
+  public:
+
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+    StrikeIndex(): m_bTable( false ), m_dblBucketInverse {} {}
+    StrikeIndex( StrikeIndex&& rhs )
+    : m_vStrike( std::move( rhs.m_vStrike ) ),
+      m_vRecord( std::move( rhs.m_vRecord ) ),
+      m_bTable( false ), m_dblBucketInverse {}
+    {}
+    StrikeIndex& operator=( StrikeIndex&& rhs ) {
+      m_vStrike = std::move( rhs.m_vStrike );
+      m_vRecord = std::move( rhs.m_vRecord );
+      m_bTable = false;
+      return *this;
+    }
+
+    size_t Size() const { return m_vStrike.size(); }
+    double operator[]( size_t ix ) const { return m_vStrike[ ix ]; } // ix in strike order
+    size_t Record( size_t ix ) const { return m_vRecord[ ix ]; } // record position of the strike at ix
+
+    // record position of the strike, nRecordNew when the strike is new
+    size_t Insert( double strike, size_t nRecordNew, bool& bInserted ) {
+      const size_t ix( Search( strike, 0, m_vStrike.size() ) );
+      bInserted = ( m_vStrike.size() == ix ) || ( strike != m_vStrike[ ix ] );
+      if ( bInserted ) {
+        m_vStrike.insert( m_vStrike.begin() + ix, strike );
+        m_vRecord.insert( m_vRecord.begin() + ix, (uint32_t)nRecordNew );
+        m_bTable = false;
+      }
+      return m_vRecord[ ix ];
+    }
+
+    void Erase( size_t ix ) { // the caller removes the record
+      m_vStrike.erase( m_vStrike.begin() + ix );
+      m_vRecord.erase( m_vRecord.begin() + ix );
+      m_bTable = false;
+    }
+
+    void Relocate( size_t nRecordFrom, size_t nRecordTo ) { // the caller has moved a record
+      for ( uint32_t& nRecord: m_vRecord ) {
+        if ( nRecordFrom == nRecord ) {
+          nRecord = (uint32_t)nRecordTo;
+          break;
+        }
+      }
+    }
+
+    size_t Find( double strike ) const { // exact match, npos if none
+      const size_t ix( LowerBound( strike ) );
+      return ( ( m_vStrike.size() != ix ) && ( strike == m_vStrike[ ix ] ) ) ? ix : npos;
+    }
+
+    size_t LowerBound( double value ) const { // index of first strike >= value, Size() if none
+      const size_t nStrikes( m_vStrike.size() );
+      if ( ( 0 == nStrikes ) || !( m_vStrike.front() < value ) ) return 0;
+      if ( m_vStrike.back() < value ) return nStrikes;
+      if ( !m_bTable.load( std::memory_order_acquire ) ) BuildTable();
+      const size_t nBuckets( m_vBucket.size() - 1 );
+      const size_t ixBucket( std::min<size_t>( nBuckets - 1, (size_t)( ( value - m_vStrike.front() ) * m_dblBucketInverse ) ) );
+      size_t ix( Search( value, m_vBucket[ ixBucket ], m_vBucket[ ixBucket + 1 ] ) );
+      // rounding at a bucket edge, at most a strike either way
+      while ( ( 0 < ix ) && !( m_vStrike[ ix - 1 ] < value ) ) ix--;
+      while ( ( nStrikes > ix ) && ( m_vStrike[ ix ] < value ) ) ix++;
+      return ix;
+    }
+
+    size_t UpperBound( double value ) const { // index of first strike > value, Size() if none
+      size_t ix( LowerBound( value ) );
+      if ( ( m_vStrike.size() > ix ) && ( value == m_vStrike[ ix ] ) ) ix++;
+      return ix;
+    }
+
+  private:
+
+    using vStrike_t = std::vector<double>;
+    vStrike_t m_vStrike;
+    using vRecord_t = std::vector<uint32_t>;
+    vRecord_t m_vRecord;
+
+    // m_vBucket[ b ] is the first strike at or above the start of bucket b, the last entry is Size()
+    //   built under the mutex, as concurrent const lookups may each find it missing
+    mutable std::mutex m_mutexTable;
+    mutable std::atomic<bool> m_bTable;
+    mutable vRecord_t m_vBucket;
+    mutable double m_dblBucketInverse;
+
+    size_t Search( double value, size_t ixBegin, size_t ixEnd ) const { // branchless lower bound in [ixBegin,ixEnd)
+      size_t n( ixEnd - ixBegin );
+      if ( 0 == n ) return ixBegin;
+      const double* pBase( m_vStrike.data() + ixBegin );
+      while ( 1 < n ) {
+        const size_t half( n / 2 );
+        pBase = ( pBase[ half ] < value ) ? pBase + half : pBase;
+        n -= half;
+      }
+      return ( pBase - m_vStrike.data() ) + ( *pBase < value );
+    }
+
+    void BuildTable() const { // two or more strikes
+      std::scoped_lock<std::mutex> lock( m_mutexTable );
+      if ( m_bTable.load( std::memory_order_relaxed ) ) return;
+      const size_t nStrikes( m_vStrike.size() );
+      const size_t nBuckets( 2 * nStrikes );
+      const double first( m_vStrike.front() );
+      const double width( ( m_vStrike.back() - first ) / nBuckets );
+      m_vBucket.resize( nBuckets + 1 );
+      size_t ix {};
+      for ( size_t ixBucket = 0; ixBucket < nBuckets; ixBucket++ ) {
+        const double start( first + ixBucket * width );
+        while ( ( nStrikes > ix ) && ( m_vStrike[ ix ] < start ) ) ix++;
+        m_vBucket[ ixBucket ] = (uint32_t)ix;
+      }
+      m_vBucket[ nBuckets ] = (uint32_t)nStrikes;
+      m_dblBucketInverse = 1.0 / width;
+      m_bTable.store( true, std::memory_order_release );
+    }
+  };
+
 }
 
 template<typename Option>
@@ -84,9 +219,10 @@ public:
   using fStrike_t = std::function<void( double, const strike_t& )>;
 
   Chain() {}
-  Chain( Chain&& rhs ) {
-    m_mapChain = std::move( rhs.m_mapChain );
-  }
+  Chain( Chain&& rhs )
+  : m_index( std::move( rhs.m_index ) ),
+    m_vStrike( std::move( rhs.m_vStrike ) )
+  {}
   virtual ~Chain() {};
 
   struct exception_strike_not_found: public std::runtime_error {
@@ -96,6 +232,7 @@ public:
     exception_at_start_of_chain( const char* ch ): exception_strike_not_found( ch ) {}
   };
 
+  // references to strikes and options remain valid until a strike is added or erased
   Option& SetIQFeedNameCall( double strike, const std::string& sIQFeedSymbolName );
   Option& SetIQFeedNamePut(  double strike, const std::string& sIQFeedSymbolName );
 
@@ -127,14 +264,12 @@ public:
   int AdjacentStrikes( double strikeSource, double& strikeLower, double& strikeUpper ) const;
 
   void Strikes( fStrike_t&& fStrike ) const {
-    for ( const typename mapChain_t::value_type& vt: m_mapChain ) {
-      fStrike( vt.first, vt.second );
+    for ( size_t ix = 0; ix < m_index.Size(); ix++ ) {
+      fStrike( m_index[ ix ], m_vStrike[ m_index.Record( ix ) ] );
     }
   }
 
-  using mapChain_t = std::map<double, strike_t>;
-
-  typename mapChain_t::size_type Size() const { return m_mapChain.size(); }
+  size_t Size() const { return m_vStrike.size(); }
   size_t EmitValues() const;
   size_t EmitSummary() const;
 
@@ -142,203 +277,150 @@ public:
 
 protected:
 
-  typename mapChain_t::const_iterator FindStrike( const double strike ) const;
-  typename mapChain_t::iterator FindStrike( const double strike );
+  size_t FindStrike( const double strike ) const;
 
 private:
 
-  mapChain_t m_mapChain;
+  chain::StrikeIndex m_index;
+  using vStrike_t = std::vector<strike_t>;
+  vStrike_t m_vStrike; // contiguous call/put records, in arrival order, located through m_index
+
+  strike_t& Insert( double strike ); // existing or new
+  double Closest( double, const char* szError ) const;
 
 };
 
 // methods:
 
+template<typename Option>
+typename Chain<Option>::strike_t& Chain<Option>::Insert( double strike ) {
+  bool bInserted;
+  const size_t nRecord( m_index.Insert( strike, m_vStrike.size(), bInserted ) );
+  if ( bInserted ) {
+    m_vStrike.emplace_back();
+  }
+  return m_vStrike[ nRecord ];
+}
+
 template<typename Option>
 double Chain<Option>::Put_Itm( double value ) const { // price < strike
-  typename mapChain_t::const_iterator iter = std::upper_bound(
-    m_mapChain.begin(), m_mapChain.end(), value,
-    [](double value, const typename mapChain_t::value_type& vt)->bool{ return value < vt.first; } );
-  if ( m_mapChain.end() == iter ) throw exception_strike_not_found( "Put_Itm not found" );
-  return iter->first;
+  const size_t ix( m_index.UpperBound( value ) );
+  if ( m_index.Size() == ix ) throw exception_strike_not_found( "Put_Itm not found" );
+  return m_index[ ix ];
 }
 
 template<typename Option>
 double Chain<Option>::Put_ItmAtm( double value ) const { // price <= strike
-  typename mapChain_t::const_iterator iter = std::lower_bound(
-    m_mapChain.begin(), m_mapChain.end(), value,
-    [](const typename mapChain_t::value_type& vt, double value)->bool{ return vt.first < value; } );
-  if ( m_mapChain.end() == iter ) throw exception_strike_not_found( "Put_ItmAtm not found" );
-  return iter->first;
+  const size_t ix( m_index.LowerBound( value ) );
+  if ( m_index.Size() == ix ) throw exception_strike_not_found( "Put_ItmAtm not found" );
+  return m_index[ ix ];
 }
 
 template<typename Option>
 double Chain<Option>::Put_Atm( double value ) const { // closest strike (use itm vs otm)
-  double atm {};
-  typename mapChain_t::const_iterator iter1 = std::lower_bound(
-    m_mapChain.begin(), m_mapChain.end(), value,
-    [](const typename mapChain_t::value_type& vt, double value)->bool{ return vt.first < value; } );
-  if ( m_mapChain.end() == iter1 ) throw exception_strike_not_found( "Put_Atm not found" );
-  if ( value == iter1->first ) {
-    atm = value;
-  }
-  else {
-    if ( m_mapChain.begin() == iter1 ) {
-      atm = value;
-    }
-    else {
-      typename mapChain_t::const_iterator iter2 = iter1;
-      iter2--;
-      if ( ( iter1->first - value ) < ( value - iter2->first ) ) {
-        atm = iter1->first;
-      }
-      else {
-        atm = iter2->first;
-      }
-    }
-  }
-  assert( 0.0 != atm );
-  return atm;
+  return Closest( value, "Put_Atm not found" );
 }
 
 template<typename Option>
 double Chain<Option>::Put_OtmAtm( double value ) const { // price >= strike
-  typename mapChain_t::const_iterator iter = std::lower_bound(
-    m_mapChain.begin(), m_mapChain.end(), value,
-    [](const typename mapChain_t::value_type& vt, double value)->bool{ return vt.first < value; } );
-  if ( m_mapChain.end() == iter ) throw exception_strike_not_found( "Put_OtmAtm not found" );
-  if ( value == iter->first ) {
+  size_t ix( m_index.LowerBound( value ) );
+  if ( m_index.Size() == ix ) throw exception_strike_not_found( "Put_OtmAtm not found" );
+  if ( value == m_index[ ix ] ) {
     // atm
   }
   else {
-    if ( m_mapChain.begin() == iter ) {
+    if ( 0 == ix ) {
       throw exception_at_start_of_chain( "Put_OtmAtm at begin of chain" );
     }
     else {
-      iter--; // strike will be OTM
+      ix--; // strike will be OTM
     }
   }
-  return iter->first;
+  return m_index[ ix ];
 }
 
 template<typename Option>
 double Chain<Option>::Put_Otm( double value ) const { // price > strike
-  typename mapChain_t::const_iterator iter = std::lower_bound(
-    m_mapChain.begin(), m_mapChain.end(), value,
-    [](const typename mapChain_t::value_type& vt, double value)->bool{ return vt.first < value; } );
-  if ( m_mapChain.end() == iter ) throw exception_strike_not_found( "Put_Otm not found" );
-  if ( m_mapChain.begin() == iter ) {
+  const size_t ix( m_index.LowerBound( value ) );
+  if ( m_index.Size() == ix ) throw exception_strike_not_found( "Put_Otm not found" );
+  if ( 0 == ix ) {
     throw exception_at_start_of_chain( "Put_Otm at begin of chain" );
   }
-  else {
-    iter--; // strike will be OTM
-  }
-  return iter->first;
+  return m_index[ ix - 1 ]; // strike will be OTM
 }
 
 template<typename Option>
 double Chain<Option>::Call_Itm( double value ) const { // price > strike
-  typename mapChain_t::const_iterator iter = std::lower_bound(
-    m_mapChain.begin(), m_mapChain.end(), value,
-    [](const typename mapChain_t::value_type& vt, double value)->bool{ return vt.first < value; } );
-  if ( m_mapChain.end() == iter ) throw exception_strike_not_found( "Call_Itm not found" );
-    if ( m_mapChain.begin() == iter ) {
-      throw exception_at_start_of_chain( "Call_Itm at begin of chain" );
-    }
-    else {
-      iter--;
-    }
-  return iter->first;
+  const size_t ix( m_index.LowerBound( value ) );
+  if ( m_index.Size() == ix ) throw exception_strike_not_found( "Call_Itm not found" );
+  if ( 0 == ix ) {
+    throw exception_at_start_of_chain( "Call_Itm at begin of chain" );
+  }
+  return m_index[ ix - 1 ];
 }
 
 template<typename Option>
 double Chain<Option>::Call_ItmAtm( double value ) const { // price >= strike
-  typename mapChain_t::const_iterator iter = std::lower_bound(
-    m_mapChain.begin(), m_mapChain.end(), value,
-    [](const typename mapChain_t::value_type& vt, double value)->bool{ return vt.first < value; } );
-  if ( m_mapChain.end() == iter ) throw exception_strike_not_found( "Call_ItmAtm not found" );
-  if ( value == iter->first ) {
+  size_t ix( m_index.LowerBound( value ) );
+  if ( m_index.Size() == ix ) throw exception_strike_not_found( "Call_ItmAtm not found" );
+  if ( value == m_index[ ix ] ) {
     // atm
   }
   else {
-    if ( m_mapChain.begin() == iter ) {
+    if ( 0 == ix ) {
       throw exception_at_start_of_chain( "Call_ItmAtm at begin of chain" );
     }
     else {
-      iter--; // strike will be Itm
+      ix--; // strike will be Itm
     }
   }
-  return iter->first;
+  return m_index[ ix ];
 }
 
 template<typename Option>
 double Chain<Option>::Call_Atm( double value ) const { // closest strike (use itm vs otm)
-  double atm {};
-  typename mapChain_t::const_iterator iter1 = std::lower_bound(
-    m_mapChain.begin(), m_mapChain.end(), value,
-    [](const typename mapChain_t::value_type& vt, double value)->bool{ return vt.first < value; } );
-  if ( m_mapChain.end() == iter1 ) throw exception_strike_not_found( "Call_Atm not found" );
-  if ( value == iter1->first ) {
-    atm = value;
-  }
-  else {
-    if ( m_mapChain.begin() == iter1 ) {
-      atm = value;
-    }
-    else {
-      typename mapChain_t::const_iterator iter2 = iter1;
-      iter2--;
-      if ( ( iter1->first - value ) < ( value - iter2->first ) ) {
-        atm = iter1->first;
-      }
-      else {
-        atm = iter2->first;
-      }
-    }
-  }
-  assert( 0.0 != atm );
-  return atm;
+  return Closest( value, "Call_Atm not found" );
 }
 
 template<typename Option>
 double Chain<Option>::Call_OtmAtm( double value ) const { // price <= strike
-  typename mapChain_t::const_iterator iter = std::lower_bound(
-    m_mapChain.begin(), m_mapChain.end(), value,
-    [](const typename mapChain_t::value_type& vt, double value)->bool{ return vt.first < value; } );
-  if ( m_mapChain.end() == iter ) throw exception_strike_not_found( "Call_OtmAtm not found" );
-  return iter->first;
+  const size_t ix( m_index.LowerBound( value ) );
+  if ( m_index.Size() == ix ) throw exception_strike_not_found( "Call_OtmAtm not found" );
+  return m_index[ ix ];
 }
 
 template<typename Option>
 double Chain<Option>::Call_Otm( double value ) const { // price < strike
-  typename mapChain_t::const_iterator iter = std::upper_bound(
-    m_mapChain.begin(), m_mapChain.end(), value,
-    [](double value, const typename mapChain_t::value_type& vt)->bool{ return value < vt.first; } );
-  if ( m_mapChain.end() == iter ) throw exception_strike_not_found( "Call_Otm not found" );
-  return iter->first;
+  const size_t ix( m_index.UpperBound( value ) );
+  if ( m_index.Size() == ix ) throw exception_strike_not_found( "Call_Otm not found" );
+  return m_index[ ix ];
 }
 
 template<typename Option>
 double Chain<Option>::Atm( double value ) const { // closest strike (use itm vs otm)
+  return Closest( value, "Call_Atm not found" );
+}
+
+template<typename Option>
+double Chain<Option>::Closest( double value, const char* szError ) const {
   double atm {};
-  typename mapChain_t::const_iterator iter1 = std::lower_bound(
-    m_mapChain.begin(), m_mapChain.end(), value,
-    [](const typename mapChain_t::value_type& vt, double value)->bool{ return vt.first < value; } );
-  if ( m_mapChain.end() == iter1 ) throw exception_strike_not_found( "Call_Atm not found" );
-  if ( value == iter1->first ) {
+  const size_t ix( m_index.LowerBound( value ) );
+  if ( m_index.Size() == ix ) throw exception_strike_not_found( szError );
+  const double upper( m_index[ ix ] );
+  if ( value == upper ) {
     atm = value;
   }
   else {
-    if ( m_mapChain.begin() == iter1 ) {
+    if ( 0 == ix ) {
       atm = value;
     }
     else {
-      typename mapChain_t::const_iterator iter2 = iter1;
-      iter2--;
-      if ( ( iter1->first - value ) < ( value - iter2->first ) ) {
-        atm = iter1->first;
+      const double lower( m_index[ ix - 1 ] );
+      if ( ( upper - value ) < ( value - lower ) ) {
+        atm = upper;
       }
       else {
-        atm = iter2->first;
+        atm = lower;
       }
     }
   }
@@ -350,18 +432,14 @@ template<typename Option>
 int Chain<Option>::AdjacentStrikes( double strikeSource, double& strikeLower, double& strikeUpper ) const {
   strikeLower = strikeUpper = 0.0;
   int nReturn {};
-  typename mapChain_t::const_iterator iterSource = m_mapChain.find( strikeSource );
-  if ( m_mapChain.end() != iterSource ) {
-    typename mapChain_t::const_iterator iterLower = iterSource;
-    if ( m_mapChain.begin() != iterLower ) {
-      iterLower--;
-      strikeLower = iterLower->first;
+  const size_t ix( m_index.Find( strikeSource ) );
+  if ( chain::StrikeIndex::npos != ix ) {
+    if ( 0 < ix ) {
+      strikeLower = m_index[ ix - 1 ];
       nReturn++;
     }
-    typename mapChain_t::const_iterator iterUpper = iterSource;
-    iterUpper++;
-    if ( m_mapChain.end() != iterUpper ) {
-      strikeUpper = iterUpper->first;
+    if ( m_index.Size() > ( ix + 1 ) ) {
+      strikeUpper = m_index[ ix + 1 ];
       nReturn++;
     }
   }
@@ -370,155 +448,121 @@ int Chain<Option>::AdjacentStrikes( double strikeSource, double& strikeLower, do
 
 template<typename Option>
 Option& Chain<Option>::SetIQFeedNameCall( double dblStrike, const std::string& sIQFeedSymbolName ) {
-  typename mapChain_t::iterator iter = m_mapChain.find( dblStrike );
-  if ( m_mapChain.end() == iter ) {
-    auto result = m_mapChain.emplace( typename mapChain_t::value_type( dblStrike, strike_t() ) );
-    assert( result.second );
-    iter = result.first;
-  }
-  if ( iter->second.call.sIQFeedSymbolName.empty() ) {
-    iter->second.call.sIQFeedSymbolName = sIQFeedSymbolName;
+  strike_t& strike( Insert( dblStrike ) );
+  if ( strike.call.sIQFeedSymbolName.empty() ) {
+    strike.call.sIQFeedSymbolName = sIQFeedSymbolName;
   }
   else {
     std::cout
       << "Chain<Option>::SetIQFeedNameCall duplicate existing: "
-      << iter->second.call.sIQFeedSymbolName
+      << strike.call.sIQFeedSymbolName
       << ", new "
       << sIQFeedSymbolName
       << ", skipped"
       << std::endl;
     throw std::runtime_error( "duplicate call" );
     // maybe throw an exception and let caller handle it: ignore or not
-    //assert( iter->second.call.sIQFeedSymbolName == sIQFeedSymbolName );
+    //assert( strike.call.sIQFeedSymbolName == sIQFeedSymbolName );
   }
-  return iter->second.call;
+  return strike.call;
 }
 
 template<typename Option>
 Option& Chain<Option>::SetIQFeedNamePut( double dblStrike, const std::string& sIQFeedSymbolName ) {
-  typename mapChain_t::iterator iter = m_mapChain.find( dblStrike );
-  if ( m_mapChain.end() == iter ) {
-    auto result = m_mapChain.emplace( typename mapChain_t::value_type( dblStrike, strike_t() ) );
-    assert( result.second );
-    iter = result.first;
-  }
-  if ( iter->second.put.sIQFeedSymbolName.empty() ) {
-    iter->second.put.sIQFeedSymbolName = sIQFeedSymbolName;
+  strike_t& strike( Insert( dblStrike ) );
+  if ( strike.put.sIQFeedSymbolName.empty() ) {
+    strike.put.sIQFeedSymbolName = sIQFeedSymbolName;
   }
   else {
     std::cout
       << "Chain<Option>::SetIQFeedNamePut duplicate existing: "
-      << iter->second.put.sIQFeedSymbolName
+      << strike.put.sIQFeedSymbolName
       << ", new "
       << sIQFeedSymbolName
       << ", skipped"
       << std::endl;
     throw std::runtime_error( "duplicate put" );
     // maybe throw an exception and let caller handle it: ignore or not
-    //assert( iter->second.put.sIQFeedSymbolName == sIQFeedSymbolName );
+    //assert( strike.put.sIQFeedSymbolName == sIQFeedSymbolName );
   }
-  return iter->second.put;
+  return strike.put;
 }
 
 template<typename Option>
 const std::string Chain<Option>::GetIQFeedNameCall( double dblStrike ) const {
-  typename mapChain_t::const_iterator iter = FindStrike( dblStrike );
-  return iter->second.call.sIQFeedSymbolName;
+  return m_vStrike[ m_index.Record( FindStrike( dblStrike ) ) ].call.sIQFeedSymbolName;
 }
 
 template<typename Option>
 const std::string Chain<Option>::GetIQFeedNamePut( double dblStrike ) const {
-  typename mapChain_t::const_iterator iter = FindStrike( dblStrike );
-  return iter->second.put.sIQFeedSymbolName;
+  return m_vStrike[ m_index.Record( FindStrike( dblStrike ) ) ].put.sIQFeedSymbolName;
 }
 
 template<typename Option>
 void Chain<Option>::Erase( double dblStrike ) {
-  typename mapChain_t::const_iterator iter = FindStrike( dblStrike );
-  m_mapChain.erase( iter );
+  const size_t ix( FindStrike( dblStrike ) );
+  const size_t nRecord( m_index.Record( ix ) );
+  m_index.Erase( ix );
+  const size_t nRecordLast( m_vStrike.size() - 1 );
+  if ( nRecordLast != nRecord ) { // keep the records contiguous
+    m_vStrike[ nRecord ] = std::move( m_vStrike[ nRecordLast ] );
+    m_index.Relocate( nRecordLast, nRecord );
+  }
+  m_vStrike.pop_back();
 }
 
 template<typename Option>
 const chain::Strike<Option>& Chain<Option>::GetExistingStrike( double dblStrike ) const { // this one doesn't make much sense
-  typename mapChain_t::const_iterator citer = m_mapChain.find( dblStrike );
-  if ( m_mapChain.end() == citer ) {
+  const size_t ix( m_index.Find( dblStrike ) );
+  if ( chain::StrikeIndex::npos == ix ) {
     throw exception_strike_not_found( "Chain::GetExistingStrike const: no strike" );
   }
-  return citer->second;
+  return m_vStrike[ m_index.Record( ix ) ];
 }
 
-//template<typename Option>
-//const chain::Strike<Option>& Chain<Option>::GetStrike( double dblStrike ) const { // this one doesn't make much sense
-//  typename mapChain_t::iterator iter = m_mapChain.find( dblStrike );
-//  if ( m_mapChain.end() == iter ) {
-//    iter = m_mapChain.insert( m_mapChain.begin(), std::move( typename mapChain_t::value_type( dblStrike, strike_t() ) ) );
-//  }
-//  return iter->second;
-//}
-
 template<typename Option>
 chain::Strike<Option>& Chain<Option>::GetStrike( double dblStrike ) {
-  typename mapChain_t::iterator iter = m_mapChain.find( dblStrike );
-  if ( m_mapChain.end() == iter ) {
-    auto result = m_mapChain.emplace( typename mapChain_t::value_type( dblStrike, strike_t() ) );
-    assert( result.second );
-    iter = result.first;
-  }
-  return iter->second;
+  return Insert( dblStrike );
 }
 
-// const iterator
 template<typename Option>
-typename Chain<Option>::mapChain_t::const_iterator Chain<Option>::FindStrike( const double strike ) const {
-  typename mapChain_t::const_iterator iter = m_mapChain.find( strike );
-  if ( m_mapChain.end() == iter ) {
-    throw exception_strike_not_found( "Chain::FindStrike const: no strike" );
-  }
-  return iter;
-}
-
-// regular iterator
-template<typename Option>
-typename Chain<Option>::mapChain_t::iterator Chain<Option>::FindStrike( const double strike ) {
-  typename mapChain_t::iterator iter = m_mapChain.find( strike );
-  if ( m_mapChain.end() == iter ) {
+size_t Chain<Option>::FindStrike( const double strike ) const {
+  const size_t ix( m_index.Find( strike ) );
+  if ( chain::StrikeIndex::npos == ix ) {
     std::cout
       << "Chain::FindStrike error: "
       << "strike " << strike
-      << ", m_mapChain size=" << m_mapChain.size()
+      << ", chain size=" << m_vStrike.size()
       << std::endl;
     throw exception_strike_not_found( "Chain::FindStrike: no strike" );
   }
-  return iter;
+  return ix;
 }
 
 template<typename Option>
 size_t Chain<Option>::EmitValues() const { // TODO: supply output stream
-  size_t cnt {};
-  std::for_each( m_mapChain.begin(), m_mapChain.end(), [&cnt](const typename mapChain_t::value_type& vt){
-    cnt++;
+  for ( size_t ix = 0; ix < m_index.Size(); ix++ ) {
+    const strike_t& strike( m_vStrike[ m_index.Record( ix ) ] );
     std::cout
-      << vt.first << ": "
-      << vt.second.call.sIQFeedSymbolName
+      << m_index[ ix ] << ": "
+      << strike.call.sIQFeedSymbolName
       << ", "
-      << vt.second.put.sIQFeedSymbolName
+      << strike.put.sIQFeedSymbolName
       << std::endl;
-  });
-  return cnt;
+  }
+  return m_vStrike.size();
 }
 
 template<typename Option>
 size_t Chain<Option>::EmitSummary() const { // TODO: supply output stream
-  size_t nStrikes {};
   size_t nCalls {};
   size_t nPuts {};
-  std::for_each( m_mapChain.begin(), m_mapChain.end(), [ &nStrikes, &nCalls, &nPuts](const typename mapChain_t::value_type& vt){
-    nStrikes++;
-    if ( 0 != vt.second.call.sIQFeedSymbolName.size() ) nCalls++;
-    if ( 0 != vt.second.put.sIQFeedSymbolName.size() ) nPuts++;
-  });
+  for ( const strike_t& strike: m_vStrike ) {
+    if ( 0 != strike.call.sIQFeedSymbolName.size() ) nCalls++;
+    if ( 0 != strike.put.sIQFeedSymbolName.size() ) nPuts++;
+  }
     std::cout
-      << "  #strikes=" << nStrikes
+      << "  #strikes=" << m_vStrike.size()
       << ", #calls=" << nCalls
       << ", #puts=" << nPuts
       << std::endl;
@@ -116,10 +116,8 @@ void PopulateMap( mapChains_t& map, const std::string& sUnderlying, fGatherOptio
 
 template<typename mapChains_t>
 static typename mapChains_t::const_iterator SelectChain( const mapChains_t& mapChains, boost::gregorian::date date, boost::gregorian::days daysToExpiry ) {
-  typename mapChains_t::const_iterator citerChain = std::find_if( mapChains.begin(), mapChains.end(),
-    [date,daysToExpiry](const typename mapChains_t::value_type& vt)->bool{
-      return daysToExpiry <= ( vt.first - date );  // first chain where trading date less than expiry date
-  } );
+  // first chain where daysToExpiry <= ( expiry - date ), ie expiry >= date + daysToExpiry
+  typename mapChains_t::const_iterator citerChain = mapChains.lower_bound( date + daysToExpiry );
   if ( mapChains.end() == citerChain ) {
     throw ou::tf::option::exception_chain_not_found( "option::SelectChain" );
   }
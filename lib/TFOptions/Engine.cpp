@@ -194,33 +194,31 @@ Engine::~Engine( ) {
 
   m_mapOptionEntry.clear();
 
-  m_mapKnownOptions.clear();
-  m_mapKnownWatches.clear();
+  m_vKnownOptions.Clear();
+  m_vKnownWatches.Clear();
 }
 
 void Engine::RegisterUnderlying( const pWatch_t& pWatch ) {
   assert( pWatch );
   std::lock_guard<std::mutex> lock(m_mutexOptionEntryOperationQueue);
-  const std::string& sInstrumentName( pWatch->GetInstrument()->GetInstrumentName() );
-  mapKnownWatches_t::iterator iter = m_mapKnownWatches.find( sInstrumentName );
-  if ( m_mapKnownWatches.end() == iter ) {
-    m_mapKnownWatches.insert( mapKnownWatches_t::value_type( sInstrumentName, pWatch ) );
+  pWatch_t& pKnown( m_vKnownWatches.Slot( pWatch->GetInstrument()->GetInternId() ) );
+  if ( !pKnown ) {
+    pKnown = pWatch;
   }
   else {
-    throw std::runtime_error( "Engine::Register Underlying: already exists - " + sInstrumentName );
+    throw std::runtime_error( "Engine::Register Underlying: already exists - " + pWatch->GetInstrument()->GetInstrumentName() );
   }
 }
 
 void Engine::RegisterOption( const pOption_t& pOption) {
   assert( pOption );
   std::lock_guard<std::mutex> lock(m_mutexOptionEntryOperationQueue);
-  const std::string& sInstrumentName( pOption->GetInstrument()->GetInstrumentName() );
-  mapKnownOptions_t::iterator iter = m_mapKnownOptions.find( sInstrumentName );
-  if ( m_mapKnownOptions.end() == iter ) {
-    m_mapKnownOptions.insert( mapKnownOptions_t::value_type( sInstrumentName, pOption ) );
+  pOption_t& pKnown( m_vKnownOptions.Slot( pOption->GetInstrument()->GetInternId() ) );
+  if ( !pKnown ) {
+    pKnown = pOption;
   }
   else {
-    throw std::runtime_error( "Engine::Register Option: already exists - " + sInstrumentName );
+    throw std::runtime_error( "Engine::Register Option: already exists - " + pOption->GetInstrument()->GetInstrumentName() );
   }
 }
 
@@ -236,19 +234,19 @@ ou::tf::Watch::pWatch_t Engine::FindWatch( const pInstrument_t pInstrument ) {
   //std::cout << "Engine::Find Watch: " << pInstrument->GetInstrumentName() << std::endl;
   pWatch_t pWatch;
   std::lock_guard<std::mutex> lock(m_mutexOptionEntryOperationQueue);
-  mapKnownWatches_t::iterator iter = m_mapKnownWatches.find( pInstrument->GetInstrumentName() );
-  if ( m_mapKnownWatches.end() == iter ) {
+  pWatch_t& pKnown( m_vKnownWatches.Slot( pInstrument->GetInternId() ) );
+  if ( !pKnown ) {
     if ( nullptr != m_fBuildWatch ) {
       pWatch = m_fBuildWatch( pInstrument );
       assert( 0 != pWatch.get() );
-      m_mapKnownWatches.insert( mapKnownWatches_t::value_type( pInstrument->GetInstrumentName(), pWatch ) );
+      pKnown = pWatch;
     }
     else {
       throw std::runtime_error( "Engine::m_fBuildWatch is nullptr" );
     }
   }
   else {
-    pWatch = iter->second;
+    pWatch = pKnown;
   }
   assert( pWatch );
   return pWatch;
@@ -260,19 +258,19 @@ Option::pOption_t Engine::FindOption( const pInstrument_t pInstrument ) {
   //std::cout << "Engine::Find Option: " << pInstrument->GetInstrumentName() << std::endl;
   pOption_t pOption;
   std::lock_guard<std::mutex> lock(m_mutexOptionEntryOperationQueue);
-  mapKnownOptions_t::iterator iter = m_mapKnownOptions.find( pInstrument->GetInstrumentName() );
-  if ( m_mapKnownOptions.end() == iter ) {
+  pOption_t& pKnown( m_vKnownOptions.Slot( pInstrument->GetInternId() ) );
+  if ( !pKnown ) {
     if ( nullptr != m_fBuildOption ) {
       pOption = m_fBuildOption( pInstrument );
       assert( 0 != pOption.get() );
-      m_mapKnownOptions.insert( mapKnownOptions_t::value_type( pInstrument->GetInstrumentName(), pOption ) );
+      pKnown = pOption;
     }
     else {
       throw std::runtime_error( "Engine::m_fBuildOption is nullptr" );
     }
   }
   else {
-    pOption = iter->second;
+    pOption = pKnown;
   }
   assert( 0 != pOption.get() );
   return pOption;
@@ -331,24 +329,20 @@ void Engine::ProcessOptionEntryOperationQueue() {
   std::lock_guard<std::mutex> lock(m_mutexOptionEntryOperationQueue);
   if ( !m_dequeOptionEntryOperation.empty() ) {
     OptionEntryOperation& oe( m_dequeOptionEntryOperation.front() );
-    const std::string& sUnderlying( oe.m_oe.UnderlyingName() );
-    const std::string& sOption( oe.m_oe.OptionName() );
-    std::string MapKey( sUnderlying + "_" + sOption );
+    const idIntern_t idUnderlying( oe.m_oe.UnderlyingId() );
+    const idIntern_t idOption( oe.m_oe.OptionId() );
+    const keyOptionEntry_t MapKey( ( keyOptionEntry_t( idUnderlying ) << 32 ) | idOption );
 
     switch( oe.m_action ) {
       case Action::AddOption: {
           //std::cout << "Engine::AddOption: " << MapKey << " " << oe.m_oe.GetOption().get() << std::endl;
 
-          mapKnownWatches_t::iterator iterWatches = m_mapKnownWatches.find( sUnderlying );
-          if ( m_mapKnownWatches.end() == iterWatches ) {
-            //m_mapKnownWatches.insert( mapKnownWatches_t::value_type( sUnderlying, iterOption->second.GetUnderlying() ) );
-            throw  std::runtime_error( "Engine::ProcessOptionEntryOperationQueue doesn't find known watch: " + sUnderlying );
+          if ( !m_vKnownWatches.Get( idUnderlying ) ) {
+            throw  std::runtime_error( "Engine::ProcessOptionEntryOperationQueue doesn't find known watch: " + oe.m_oe.UnderlyingName() );
           }
 
-          mapKnownOptions_t::iterator iterOptions = m_mapKnownOptions.find( sOption );
-          if ( m_mapKnownOptions.end() == iterOptions ) {
-            //m_mapKnownOptions.insert( mapKnownOptions_t::value_type( sOption, iterOption->second.GetOption() ) );
-            throw  std::runtime_error( "Engine::ProcessOptionEntryOperationQueue doesn't find known option " + sOption );
+          if ( !m_vKnownOptions.Get( idOption ) ) {
+            throw  std::runtime_error( "Engine::ProcessOptionEntryOperationQueue doesn't find known option " + oe.m_oe.OptionName() );
           }
 
           mapOptionEntry_t::iterator iterOption = m_mapOptionEntry.find( MapKey );
@@ -363,12 +357,12 @@ void Engine::ProcessOptionEntryOperationQueue() {
         }
         break;
       case Action::RemoveOption: {
-          // should option and instrument be removed from m_mapKnownWatches, m_mapKnownOptions?
+          // should option and instrument be removed from m_vKnownWatches, m_vKnownOptions?
           // if so, then maps require counters, or use the pOption_t use_count?
           //std::cout << "Engine::RemoveOption: " << MapKey << std::endl;
           mapOptionEntry_t::iterator iterOption = m_mapOptionEntry.find( MapKey );
           if ( m_mapOptionEntry.end() == iterOption ) {
-            throw std::runtime_error( "Engine::Remove: can't find option" + MapKey );
+            throw std::runtime_error( "Engine::Remove: can't find option " + oe.m_oe.UnderlyingName() + "_" + oe.m_oe.OptionName() );
           }
 
           OptionEntry::size_type cnt = iterOption->second.Dec();
@@ -35,6 +35,7 @@
 #include <TFTimeSeries/DatedDatum.h>
 
 #include <TFTrading/Instrument.h>
+#include <TFTrading/InstrumentIntern.h>
 #include <TFTrading/Watch.h>
 
 #include <TFOptions/Option.h>
@@ -82,6 +83,8 @@ public:
 
   const std::string& OptionName() { return m_pOption->GetInstrument()->GetInstrumentName(); }
   const std::string& UnderlyingName() { return m_pUnderlying->GetInstrument()->GetInstrumentName(); }
+  ou::tf::Instrument::idIntern_t OptionId() { return m_pOption->GetInstrument()->GetInternId(); }
+  ou::tf::Instrument::idIntern_t UnderlyingId() { return m_pUnderlying->GetInstrument()->GetInternId(); }
 
   void Inc();
   size_t Dec();
@@ -148,9 +151,13 @@ private:
 
   using idInstrument_t = ou::tf::Instrument::idInstrument_t;
 
-  using mapKnownWatches_t = std::unordered_map<idInstrument_t, pWatch_t>;
-  using mapKnownOptions_t = std::unordered_map<idInstrument_t, pOption_t>;
-  using mapOptionEntry_t  = std::unordered_map<idInstrument_t, OptionEntry>;
+  using idIntern_t = ou::tf::Instrument::idIntern_t;
+
+  // by interned instrument id, names are only needed for error messages
+  using vKnownWatches_t = ou::tf::InternVector<pWatch_t>;
+  using vKnownOptions_t = ou::tf::InternVector<pOption_t>;
+  using keyOptionEntry_t = uint64_t; // underlying id in the high half, option id in the low half
+  using mapOptionEntry_t  = std::unordered_map<keyOptionEntry_t, OptionEntry>;
 
   //std::atomic<size_t> m_cntOptionEntryOperationQueueCount;
   std::mutex m_mutexOptionEntryOperationQueue;
@@ -178,8 +185,8 @@ private:
 
   dequeOptionEntryOperation_t m_dequeOptionEntryOperation;
 
-  mapKnownWatches_t m_mapKnownWatches;
-  mapKnownOptions_t m_mapKnownOptions;
+  vKnownWatches_t m_vKnownWatches;
+  vKnownOptions_t m_vKnownOptions;
   mapOptionEntry_t m_mapOptionEntry;
 
   void HandleTimerScan( const boost::system::error_code &ec );
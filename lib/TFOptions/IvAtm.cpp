@@ -32,6 +32,7 @@ namespace option { // options
 
 IvAtm::IvAtm( pWatch_t pWatchUnderlying, fConstructOption_t fConstructOption, fStartCalc_t fStartCalc, fStopCalc_t fStopCalc )
 :
+  m_ixUpper {}, m_ixMid {}, m_ixLower {},
   m_stateOptionWatch( EOptionWatchState::EOWSNoWatch ),
   m_pWatchUnderlying( pWatchUnderlying ),
   //m_fConstructOption( std::move( fConstructOption ) ),
@@ -51,6 +52,7 @@ IvAtm::IvAtm( pWatch_t pWatchUnderlying, fConstructOption_t fConstructOption, fS
 
 IvAtm::IvAtm( IvAtm&& rhs  )
 :
+  m_ixUpper( rhs.m_ixUpper ), m_ixMid( rhs.m_ixMid ), m_ixLower( rhs.m_ixLower ),
   m_stateOptionWatch( rhs.m_stateOptionWatch ),
   m_pWatchUnderlying( rhs.m_pWatchUnderlying ),
   m_fConstructOption( std::move( rhs.m_fConstructOption ) ),
@@ -73,20 +75,19 @@ IvAtm::tupleAdjacentStrikes_t IvAtm::FindAdjacentStrikes() const {
   
   double dblUnderlying = CurrentUnderlying();
 
-  mapChain_t::const_iterator iter = m_mapChain.lower_bound( dblUnderlying ); 
-  if ( m_mapChain.end() == iter ) {
+  const size_t ix = m_index.LowerBound( dblUnderlying );
+  if ( m_index.Size() == ix ) {
     throw exception_at_end_of_chain( "IvAtm::FindAdjacentStrikes: no upper strike available" );
   }
-  dblStrikeUpper = iter->first;
+  dblStrikeUpper = m_index[ ix ];
   if ( dblUnderlying == dblStrikeUpper ) {
     dblStrikeLower = dblStrikeUpper;
   }
   else {
-    if ( m_mapChain.begin() == iter ) {
+    if ( 0 == ix ) {
       throw exception_at_start_of_chain( "IvAtm::FindAdjacentStrikes: already at lower lower end of strikes" );
     }
-    --iter;
-    dblStrikeLower = iter->first;
+    dblStrikeLower = m_index[ ix - 1 ];
   }
   
   return strikes;
@@ -99,55 +100,52 @@ void IvAtm::RecalcATMWatch( double dblUnderlying ) { // keeps underlying consist
   // uses a 50% hysterisis level to select new set of three containing options
   //   ie underlying has to be within +/- 50% of mid strike to choose midstrike and corresponding upper/lower strikes
   
-  mapChain_t::iterator iterUpper;
-  mapChain_t::iterator iterLower;
-  
   auto& sUnderlying( m_pWatchUnderlying->GetInstrument()->GetInstrumentName() );
   
-  iterUpper = m_mapChain.lower_bound( dblUnderlying ); 
+  const size_t ixUpper = m_index.LowerBound( dblUnderlying );
   
-  if ( m_mapChain.end() == iterUpper ) {
+  if ( m_index.Size() == ixUpper ) {
     std::cout << sUnderlying << ": IvAtm::RecalcATMWatch - no upper strike available" << std::endl; // stay in no watch state
     m_stateOptionWatch = EOWSNoWatch;
   }
   else {
-    iterLower = iterUpper;
-    if ( m_mapChain.begin() == iterLower ) {
+    if ( 0 == ixUpper ) {
       std::cout << sUnderlying << ": IvAtm::RecalcATMWatch - no lower strike available" << std::endl;  // stay in no watch state
       m_stateOptionWatch = EOWSNoWatch;
     }
     else {
-      --iterLower;
-      double dblMidPoint = ( iterUpper->first + iterLower->first ) * 0.5;
+      const size_t ixLower = ixUpper - 1;
+      double dblMidPoint = ( m_index[ ixUpper ] + m_index[ ixLower ] ) * 0.5;
       if ( dblUnderlying >= dblMidPoint ) { // third strike is above
-        m_iterUpper = iterUpper;
-        ++m_iterUpper;
-        if ( m_mapChain.end() == m_iterUpper ) {
+        if ( m_index.Size() == ( ixUpper + 1 ) ) {
           std::cout << sUnderlying << ": IvAtm::RecalcATMWatch - no upper upper strike available" << std::endl;  // stay in no watch state
           m_stateOptionWatch = EOWSNoWatch;
         }
         else {
-          m_iterMid = iterUpper;
-          m_iterLower = iterLower;
+          m_ixUpper = ixUpper + 1;
+          m_ixMid = ixUpper;
+          m_ixLower = ixLower;
           m_stateOptionWatch = EOWSWatching;
         }
       }
       else { // third strike is below
-        m_iterLower = iterLower;
-        if ( m_mapChain.begin() == m_iterLower ) {
+        if ( 0 == ixLower ) {
           std::cout << sUnderlying << ": IvAtm::RecalcATMWatch - no lower lower strike available" << std::endl;  // stay in no watch state
           m_stateOptionWatch = EOWSNoWatch;
         }
         else {
-          --m_iterLower;
-          m_iterMid = iterLower;
-          m_iterUpper = iterUpper;
+          m_ixLower = ixLower - 1;
+          m_ixMid = ixLower;
+          m_ixUpper = ixUpper;
           m_stateOptionWatch = EOWSWatching;
         }
       }
       if ( EOWSWatching == m_stateOptionWatch ) {
-        m_dblUpperTrigger = m_iterUpper->first - ( m_iterUpper->first - m_iterMid->first ) * 0.25;
-        m_dblLowerTrigger = m_iterLower->first + ( m_iterMid->first - m_iterLower->first ) * 0.25;
+        const double dblUpper( m_index[ m_ixUpper ] );
+        const double dblMid( m_index[ m_ixMid ] );
+        const double dblLower( m_index[ m_ixLower ] );
+        m_dblUpperTrigger = dblUpper - ( dblUpper - dblMid ) * 0.25;
+        m_dblLowerTrigger = dblLower + ( dblMid - dblLower ) * 0.25;
         std::cout << m_dblLowerTrigger << " < " << dblUnderlying << " < " << m_dblUpperTrigger << std::endl;
       }
     }
@@ -169,31 +167,31 @@ void IvAtm::UpdateATMWatch( double dblUnderlying ) {
       case EOWSNoWatch:
         break;
       case EOWSWatching:
-        m_iterUpper->second.Start( m_fStartCalc, m_pWatchUnderlying, m_fConstructOption );
-        m_iterMid  ->second.Start( m_fStartCalc, m_pWatchUnderlying, m_fConstructOption );
-        m_iterLower->second.Start( m_fStartCalc, m_pWatchUnderlying, m_fConstructOption );
+        AtStrike( m_ixUpper ).Start( m_fStartCalc, m_pWatchUnderlying, m_fConstructOption );
+        AtStrike( m_ixMid   ).Start( m_fStartCalc, m_pWatchUnderlying, m_fConstructOption );
+        AtStrike( m_ixLower ).Start( m_fStartCalc, m_pWatchUnderlying, m_fConstructOption );
         break;
     }
     break;
   case EOWSWatching:
     if ( ( dblUnderlying > m_dblUpperTrigger ) || ( dblUnderlying < m_dblLowerTrigger ) ) {
-      mapChain_t::iterator iterUpper( m_iterUpper );
-      mapChain_t::iterator iterMid( m_iterMid );
-      mapChain_t::iterator iterLower( m_iterLower );
+      const size_t ixUpper( m_ixUpper );
+      const size_t ixMid( m_ixMid );
+      const size_t ixLower( m_ixLower );
       RecalcATMWatch( dblUnderlying );
       stateAfter = m_stateOptionWatch;
       switch ( stateAfter ) {
         case EOWSNoWatch: 
           break;
         case EOWSWatching:
-          m_iterUpper->second.Start( m_fStartCalc, m_pWatchUnderlying, m_fConstructOption );
-          m_iterMid  ->second.Start( m_fStartCalc, m_pWatchUnderlying, m_fConstructOption );
-          m_iterLower->second.Start( m_fStartCalc, m_pWatchUnderlying, m_fConstructOption );
+          AtStrike( m_ixUpper ).Start( m_fStartCalc, m_pWatchUnderlying, m_fConstructOption );
+          AtStrike( m_ixMid   ).Start( m_fStartCalc, m_pWatchUnderlying, m_fConstructOption );
+          AtStrike( m_ixLower ).Start( m_fStartCalc, m_pWatchUnderlying, m_fConstructOption );
           break;
       }
-      iterUpper->second.Stop( m_fStopCalc, m_pWatchUnderlying );
-      iterMid  ->second.Stop( m_fStopCalc, m_pWatchUnderlying );
-      iterLower->second.Stop( m_fStopCalc, m_pWatchUnderlying );
+      AtStrike( ixUpper ).Stop( m_fStopCalc, m_pWatchUnderlying );
+      AtStrike( ixMid   ).Stop( m_fStopCalc, m_pWatchUnderlying );
+      AtStrike( ixLower ).Stop( m_fStopCalc, m_pWatchUnderlying );
     }
     break;
   }
@@ -209,34 +207,40 @@ void IvAtm::CalcIvAtm( ptime dtNow, fOnPriceIV_t& fOnPriceIV ) {
   UpdateATMWatch( dblUnderlying );
 
   switch ( m_stateOptionWatch ) {
-    case EOWSWatching:
-      if ( dblUnderlying == m_iterMid->first ) {
-        dblIvCall = m_iterMid->second.pCall->ImpliedVolatility();
-        dblIvPut = m_iterMid->second.pPut->ImpliedVolatility();
+    case EOWSWatching: {
+      const OptionsAtStrike& upper( AtStrike( m_ixUpper ) );
+      const OptionsAtStrike& mid( AtStrike( m_ixMid ) );
+      const OptionsAtStrike& lower( AtStrike( m_ixLower ) );
+      const double dblUpper( m_index[ m_ixUpper ] );
+      const double dblMid( m_index[ m_ixMid ] );
+      const double dblLower( m_index[ m_ixLower ] );
+      if ( dblUnderlying == dblMid ) {
+        dblIvCall = mid.pCall->ImpliedVolatility();
+        dblIvPut = mid.pPut->ImpliedVolatility();
       }
       else {
-        if ( dblUnderlying > m_iterMid->first ) { // linear interpolation
-          double ratio = ( dblUnderlying - m_iterMid->first ) / ( m_iterUpper->first - m_iterMid->first );
+        if ( dblUnderlying > dblMid ) { // linear interpolation
+          double ratio = ( dblUnderlying - dblMid ) / ( dblUpper - dblMid );
 
           double iv1, iv2;
-          iv1 = m_iterMid->second.pCall->ImpliedVolatility();
-          iv2 = m_iterUpper->second.pCall->ImpliedVolatility();
+          iv1 = mid.pCall->ImpliedVolatility();
+          iv2 = upper.pCall->ImpliedVolatility();
           dblIvCall = iv1 + ( iv2 - iv1 ) * ratio; 
 
-          iv1 = m_iterMid->second.pPut->ImpliedVolatility();
-          iv2 = m_iterUpper->second.pPut->ImpliedVolatility();
+          iv1 = mid.pPut->ImpliedVolatility();
+          iv2 = upper.pPut->ImpliedVolatility();
           dblIvPut = iv1 + ( iv2 - iv1 ) * ratio; 
         }
         else { // linear interpolation
-          double ratio = ( dblUnderlying - m_iterLower->first ) / ( m_iterMid->first - m_iterLower->first );
+          double ratio = ( dblUnderlying - dblLower ) / ( dblMid - dblLower );
 
           double iv1, iv2;
-          iv1 = m_iterLower->second.pCall->ImpliedVolatility();
-          iv2 = m_iterMid->second.pCall->ImpliedVolatility();
+          iv1 = lower.pCall->ImpliedVolatility();
+          iv2 = mid.pCall->ImpliedVolatility();
           dblIvCall = iv1 + ( iv2 - iv1 ) * ratio; 
 
-          iv1 = m_iterLower->second.pPut->ImpliedVolatility();
-          iv2 = m_iterMid->second.pPut->ImpliedVolatility();
+          iv1 = lower.pPut->ImpliedVolatility();
+          iv2 = mid.pPut->ImpliedVolatility();
           dblIvPut = iv1 + ( iv2 - iv1 ) * ratio; 
         }
       }
@@ -249,6 +253,9 @@ void IvAtm::CalcIvAtm( ptime dtNow, fOnPriceIV_t& fOnPriceIV ) {
       if ( nullptr != fOnPriceIV ) fOnPriceIV( ivATM );
 
       //  std::cout << "AtmIV " << now << "" << m_dtExpiry << " " << dblUnderlying << "," << dblIvCall << "," << dblIvPut << std::endl;
+      }
+      break;
+    case EOWSNoWatch:
       break;
   }
 
@@ -261,10 +268,11 @@ void IvAtm::CalcIvAtm( ptime dtNow, fOnPriceIV_t& fOnPriceIV ) {
 //}
 
 void IvAtm::EmitValues( void ) {
-  std::for_each( m_mapChain.begin(), m_mapChain.end(), [](const mapChain_t::value_type& vt){
-    std::cout << vt.first << ": " << vt.second.sCall << ", " << vt.second.sPut << std::endl;
-    //std::cout << vt.first << ": " << vt.second.pCall->EmitValues() << ", " << vt.second.pPut->EmitValues() << std::endl;
-  });
+  for ( size_t ix = 0; ix < m_index.Size(); ix++ ) {
+    const OptionsAtStrike& oas( AtStrike( ix ) );
+    std::cout << m_index[ ix ] << ": " << oas.sCall << ", " << oas.sPut << std::endl;
+    //std::cout << m_index[ ix ] << ": " << oas.pCall->EmitValues() << ", " << oas.pPut->EmitValues() << std::endl;
+  }
 }
 
 void IvAtm::SaveIvAtm( const std::string& sPrefix, const std::string& sPrefix86400sec ) {
@@ -322,9 +330,9 @@ void IvAtm::SaveIvAtm( const std::string& sPrefix, const std::string& sPrefix864
 
 void IvAtm::SaveSeries( const std::string& sPrefix, const std::string& sPrefix86400sec ) {
   
-  std::for_each( m_mapChain.begin(), m_mapChain.end(), [&sPrefix](mapChain_t::value_type& vt){
-    vt.second.SaveSeries( sPrefix );
-  } );
+  for ( OptionsAtStrike& oas: m_vOptionsAtStrike ) {
+    oas.SaveSeries( sPrefix );
+  }
   
   SaveIvAtm( sPrefix, sPrefix86400sec );
 }
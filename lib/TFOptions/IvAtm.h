@@ -21,11 +21,12 @@
 #ifndef ATMIV_H
 #define ATMIV_H
 
-#include <map>
 #include <tuple>
+#include <vector>
 #include <string>
 #include <functional>
 
+#include <TFOptions/Chain.h>
 #include <TFOptions/Option.h>
 
 namespace ou { // One Unified
@@ -89,6 +90,7 @@ private:
       pPut( std::move( rhs.pPut ) ),
       bStarted( rhs.bStarted )
     { }
+    OptionsAtStrike& operator=( OptionsAtStrike&& ) = default;
 
     void Start( fStartCalc_t& fStart, pWatch_t pWatchUnderlying, fConstructOption_t& fConstruct ) {
       assert( !bStarted );
@@ -123,13 +125,19 @@ private:
     }
   };
 
-  using mapChain_t = std::map<double, OptionsAtStrike>;
+  // contiguous per strike records, located through m_index
+  //   Start captures the record, so the chain is to be complete before the first watch
+  chain::StrikeIndex m_index;
+  using vOptionsAtStrike_t = std::vector<OptionsAtStrike>;
+  vOptionsAtStrike_t m_vOptionsAtStrike;
 
-  mapChain_t::iterator m_iterUpper;
-  mapChain_t::iterator m_iterMid;
-  mapChain_t::iterator m_iterLower;
+  // positions in strike order
+  size_t m_ixUpper;
+  size_t m_ixMid;
+  size_t m_ixLower;
 
-  mapChain_t m_mapChain;
+  OptionsAtStrike& AtStrike( size_t ix ) { return m_vOptionsAtStrike[ m_index.Record( ix ) ]; }
+  const OptionsAtStrike& AtStrike( size_t ix ) const { return m_vOptionsAtStrike[ m_index.Record( ix ) ]; }
 
   double m_dblUpperTrigger;
   double m_dblLowerTrigger;
@@ -21,6 +21,7 @@
 #include <TFHDF5TimeSeries/HDF5WriteTimeSeries.h>
 #include <TFHDF5TimeSeries/HDF5IterateGroups.h>
 #include <TFHDF5TimeSeries/HDF5Attribute.h>
+#include <TFHDF5TimeSeries/HDF5WriteBatch.h>
 
 #include "Option.h"
 #include "Binomial.h"
@@ -269,6 +270,7 @@ void Option::NetGreeks(
 void Option::HandleGreek( const Greek& greek ) {
   m_greek = greek;
   if ( m_bRecordSeries ) {
+    std::lock_guard<std::mutex> lock( m_mutexLockAppend );
     m_greeks.Append( greek );
   }
   OnGreek( greek );
@@ -278,42 +280,42 @@ void Option::AppendGreek( const ou::tf::Greek& greek ) {
   HandleGreek( greek );
 }
 
-void Option::SaveSeries( const std::string& sPrefix ) {
+void Option::CollectSeries( HDF5WriteBatch& batch, const std::string& sPrefix ) {
 
-  std::string sPathName;
+  const std::string& sName( m_pInstrument->GetInstrumentName() );
 
   HDF5Attributes::structOption option(
     m_dblStrike, m_pInstrument->GetExpiryYear(), m_pInstrument->GetExpiryMonth(), m_pInstrument->GetExpiryDay(), m_pInstrument->GetOptionSide() );
 
-  Watch::SaveSeries( sPrefix );
+  // sizes are taken before the series are added, a series may only grow, so each attributed series is written
+  bool bQuotes, bTrades, bGreeks;
+  {
+    std::lock_guard<std::mutex> lock( m_mutexLockAppend );
+    bQuotes = 0 != m_quotes.Size();
+    bTrades = 0 != m_trades.Size();
+    bGreeks = 0 != m_greeks.Size();
+  }
 
-  ou::tf::HDF5DataManager dm( ou::tf::HDF5DataManager::RDWR );
+  Watch::CollectSeries( batch, sPrefix );
 
-  // add in option attributes to the already written quotes and trades.
-  if ( 0 != m_quotes.Size() ) {
-    sPathName = sPrefix + ou::tf::Quotes::Directory() + m_pInstrument->GetInstrumentName();
-    HDF5Attributes attrGreeks( dm, sPathName, option );
+  // add in option attributes to the quotes and trades.
+  if ( bQuotes ) {
+    batch.AddOptionAttributes( sPrefix + ou::tf::Quotes::Directory() + sName, option );
   }
 
-  if ( 0 != m_trades.Size() ) {
-    sPathName = sPrefix + ou::tf::Trades::Directory() + m_pInstrument->GetInstrumentName();
-    HDF5Attributes attrGreeks( dm, sPathName, option );
+  if ( bTrades ) {
+    batch.AddOptionAttributes( sPrefix + ou::tf::Trades::Directory() + sName, option );
   }
 
-  if ( 0 != m_greeks.Size() ) {
-    sPathName = sPrefix + ou::tf::Greeks::Directory() + m_pInstrument->GetInstrumentName();
-    HDF5WriteTimeSeries<ou::tf::Greeks> wtsGreeks( dm, true, true, 5, 256 );
-    wtsGreeks.Write( sPathName, &m_greeks );
-    HDF5Attributes attrGreeks( dm, sPathName, option );
-    attrGreeks.SetSignature( ou::tf::Greek::Signature() );
-    attrGreeks.SetMultiplier( m_pInstrument->GetMultiplier() );
-    attrGreeks.SetSignificantDigits( m_pInstrument->GetSignificantDigits() );
-    if ( m_pGreekProvider ) {
-      attrGreeks.SetProviderType( m_pGreekProvider->ID() );
-    }
-    else {
-      attrGreeks.SetProviderType( ou::tf::keytypes::EProviderCalc );
-    }
+  if ( bGreeks ) {
+    const std::string sPathName( sPrefix + ou::tf::Greeks::Directory() + sName );
+    batch.Add(
+      sName, sPathName, m_greeks,
+      HDF5WriteBatch::Attributes(
+        ou::tf::Greek::Signature(), m_pInstrument->GetMultiplier(), m_pInstrument->GetSignificantDigits(),
+        m_pGreekProvider ? m_pGreekProvider->ID() : ou::tf::keytypes::EProviderCalc ),
+      &m_mutexLockAppend );
+    batch.AddOptionAttributes( sPathName, option );
   }
 
 }
@@ -94,7 +94,8 @@ public:
 
   ou::Delegate<const Greek&> OnGreek;
 
-  void SaveSeries( const std::string& sPrefix );
+  using Watch::CollectSeries;
+  void CollectSeries( HDF5WriteBatch&, const std::string& sPrefix ) override; // adds greeks and option attributes
 
 protected:
 
@@ -0,0 +1,255 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    RiskGrid.cpp
+ * Author:  raymond@burkholder.net
+ * Project: TFOptions
+ * Created: October 19, 2026 10:12 AM
+ */
+
+#include <cmath>
+#include <stdexcept>
+#include <algorithm>
+
+#include <boost/asio/post.hpp>
+
+#include "RiskGrid.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace option { // options
+
+namespace {
+  const double c_dblMinVol( 0.0001 );
+  const double c_dblRecipSqrt2( 0.7071067811865475 );
+  inline double N( double x ) { return 0.5 * std::erfc( -x * c_dblRecipSqrt2 ); }
+}
+
+RiskGrid::RiskGrid( size_t nThreads )
+: m_nCells {}
+, m_srvcWork( boost::asio::make_work_guard( m_srvc ) )
+, m_nOutstanding {}
+{
+  if ( 0 == nThreads ) nThreads = 1;
+  for ( std::size_t ix = 0; ix < nThreads; ix++ ) {
+    m_threads.create_thread( [this](){ m_srvc.run(); } );
+  }
+}
+
+RiskGrid::~RiskGrid() {
+  m_srvcWork.reset();
+  m_threads.join_all();
+}
+
+void RiskGrid::Set( const Axes& axes ) {
+  m_axes = axes;
+  m_nCells = m_axes.vYearsForward.size() * m_axes.vVolShift.size() * m_axes.vPrice.size();
+  m_vTotal.assign( m_nCells, 0.0 );
+  m_vMargin.assign( m_axes.vYearsForward.size() * m_axes.vVolShift.size(), 0.0 );
+  for ( Combo& combo: m_vCombo ) {
+    if ( combo.bActive ) {
+      combo.vPL.assign( m_nCells, 0.0 ); // totals restart from zero
+      combo.bDirty = true;
+    }
+  }
+}
+
+RiskGrid::idCombo_t RiskGrid::AddCombo( const vLeg_t& vLeg ) {
+  idCombo_t id;
+  if ( m_vFree.empty() ) {
+    id = m_vCombo.size();
+    m_vCombo.emplace_back( Combo() );
+  }
+  else {
+    id = m_vFree.back();
+    m_vFree.pop_back();
+  }
+  Combo& combo( m_vCombo[ id ] );
+  combo.bActive = true;
+  combo.bDirty = true;
+  combo.vLeg = vLeg;
+  combo.vPL.assign( m_nCells, 0.0 );
+  return id;
+}
+
+void RiskGrid::UpdateCombo( idCombo_t id, const vLeg_t& vLeg ) {
+  Combo& combo( LU( id ) );
+  combo.vLeg = vLeg;
+  combo.bDirty = true;
+}
+
+void RiskGrid::UpdateLeg( idCombo_t id, size_t ixLeg, const Leg& leg ) {
+  Combo& combo( LU( id ) );
+  if ( combo.vLeg.size() <= ixLeg ) {
+    throw std::runtime_error( "RiskGrid::UpdateLeg leg not found" );
+  }
+  combo.vLeg[ ixLeg ] = leg;
+  combo.bDirty = true;
+}
+
+void RiskGrid::DeleteCombo( idCombo_t id ) {
+  Combo& combo( LU( id ) );
+  for ( size_t ix = 0; ix < m_nCells; ix++ ) {
+    m_vTotal[ ix ] -= combo.vPL[ ix ];
+  }
+  combo.bActive = false;
+  combo.bDirty = false;
+  combo.vLeg.clear();
+  combo.vPL.clear();
+  combo.vScratch.clear();
+  m_vFree.push_back( id );
+  CalcMargin();
+}
+
+const RiskGrid::vValue_t& RiskGrid::PL( idCombo_t id ) const {
+  if ( ( m_vCombo.size() <= id ) || !m_vCombo[ id ].bActive ) {
+    throw std::runtime_error( "RiskGrid::PL combo not found" );
+  }
+  return m_vCombo[ id ].vPL;
+}
+
+RiskGrid::Combo& RiskGrid::LU( idCombo_t id ) {
+  if ( ( m_vCombo.size() <= id ) || !m_vCombo[ id ].bActive ) {
+    throw std::runtime_error( "RiskGrid::LU combo not found" );
+  }
+  return m_vCombo[ id ];
+}
+
+void RiskGrid::Recalc() {
+
+  std::vector<Combo*> vDirty;
+  for ( Combo& combo: m_vCombo ) {
+    if ( combo.bDirty ) vDirty.push_back( &combo );
+  }
+  if ( vDirty.empty() ) return;
+
+  {
+    std::unique_lock<std::mutex> lock( m_mutex );
+    m_nOutstanding = vDirty.size();
+  }
+
+  for ( Combo* pCombo: vDirty ) {
+    boost::asio::post( m_srvc, [this,pCombo](){
+      Evaluate( *pCombo );
+      std::unique_lock<std::mutex> lock( m_mutex );
+      if ( 0 == --m_nOutstanding ) m_cvDone.notify_one();
+    } );
+  }
+
+  {
+    std::unique_lock<std::mutex> lock( m_mutex );
+    m_cvDone.wait( lock, [this]{ return 0 == m_nOutstanding; } );
+  }
+
+  // replace the previous contribution of each re-evaluated combo
+  for ( Combo* pCombo: vDirty ) {
+    Combo& combo( *pCombo );
+    for ( size_t ix = 0; ix < m_nCells; ix++ ) {
+      m_vTotal[ ix ] += combo.vScratch[ ix ] - combo.vPL[ ix ];
+    }
+    combo.vPL.swap( combo.vScratch );
+    combo.bDirty = false;
+  }
+
+  CalcMargin();
+}
+
+// runs in a worker thread, touches only the combo's scratch buffer
+void RiskGrid::Evaluate( Combo& combo ) {
+
+  const size_t nPrice( m_axes.vPrice.size() );
+  const double* pPrice( m_axes.vPrice.data() );
+  const double r( m_axes.rate );
+
+  combo.vScratch.assign( m_nCells, 0.0 );
+  double* pCell( combo.vScratch.data() );
+
+  for ( const double years: m_axes.vYearsForward ) {
+    for ( const double shift: m_axes.vVolShift ) {
+
+      for ( const Leg& leg: combo.vLeg ) {
+
+        const double scale( leg.quantity * leg.multiplier );
+        const double K( leg.strike );
+        const double tue( leg.tue - years );
+
+        switch ( leg.side ) {
+          case ou::tf::OptionSide::Call:
+          case ou::tf::OptionSide::Put:
+            if ( 0.0 >= tue ) { // expired, intrinsic value
+              if ( ou::tf::OptionSide::Call == leg.side ) {
+                for ( size_t ix = 0; ix < nPrice; ix++ ) {
+                  pCell[ ix ] += scale * ( std::max( pPrice[ ix ] - K, 0.0 ) - leg.basis );
+                }
+              }
+              else {
+                for ( size_t ix = 0; ix < nPrice; ix++ ) {
+                  pCell[ ix ] += scale * ( std::max( K - pPrice[ ix ], 0.0 ) - leg.basis );
+                }
+              }
+            }
+            else {
+              // terms constant across the price axis are hoisted out of the inner loop
+              const double vol( std::max( leg.iv + shift, c_dblMinVol ) );
+              const double volSqrtTue( vol * std::sqrt( tue ) );
+              const double recipVolSqrtTue( 1.0 / volSqrtTue );
+              const double drift( ( r + 0.5 * vol * vol ) * tue );
+              const double discountK( K * std::exp( -r * tue ) );
+              const double recipK( 1.0 / K );
+              if ( ou::tf::OptionSide::Call == leg.side ) {
+                for ( size_t ix = 0; ix < nPrice; ix++ ) {
+                  const double S( pPrice[ ix ] );
+                  const double d1( ( std::log( S * recipK ) + drift ) * recipVolSqrtTue );
+                  const double d2( d1 - volSqrtTue );
+                  pCell[ ix ] += scale * ( S * N( d1 ) - discountK * N( d2 ) - leg.basis );
+                }
+              }
+              else {
+                for ( size_t ix = 0; ix < nPrice; ix++ ) {
+                  const double S( pPrice[ ix ] );
+                  const double d1( ( std::log( S * recipK ) + drift ) * recipVolSqrtTue );
+                  const double d2( d1 - volSqrtTue );
+                  pCell[ ix ] += scale * ( discountK * N( -d2 ) - S * N( -d1 ) - leg.basis );
+                }
+              }
+            }
+            break;
+          default: // underlying
+            for ( size_t ix = 0; ix < nPrice; ix++ ) {
+              pCell[ ix ] += scale * ( pPrice[ ix ] - leg.basis );
+            }
+            break;
+        }
+      }
+
+      pCell += nPrice;
+    }
+  }
+}
+
+void RiskGrid::CalcMargin() {
+  const size_t nPrice( m_axes.vPrice.size() );
+  if ( 0 == nPrice ) return;
+  const double* pCell( m_vTotal.data() );
+  for ( double& margin: m_vMargin ) {
+    const double worst( *std::min_element( pCell, pCell + nPrice ) );
+    margin = std::max( 0.0, -worst );
+    pCell += nPrice;
+  }
+}
+
+} // namespace option
+} // namespace tf
+} // namespace ou
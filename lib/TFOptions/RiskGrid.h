@@ -0,0 +1,146 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    RiskGrid.h
+ * Author:  raymond@burkholder.net
+ * Project: TFOptions
+ * Created: October 19, 2026 10:12 AM
+ */
+
+#pragma once
+
+#include <mutex>
+#include <vector>
+#include <algorithm>
+#include <condition_variable>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/thread/thread.hpp>
+
+#include <TFTrading/KeyTypes.h>
+#include <TFTrading/TradingEnumerations.h>
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace option { // options
+
+// scenario cube of P&L for a set of combos: time forward x implied volatility shift x underlying price
+//   cells are dense, price is the fastest moving index: [time][vol][price]
+//   only combos marked dirty (new, leg updated, axes changed) are re-evaluated in Recalc
+//   margin is a risk based estimate: worst loss of the summed grid along the price axis
+//     for each time/vol cell, the shape specific rules remain in Margin.h
+
+class RiskGrid {
+public:
+
+  using idCombo_t = size_t;
+  using vValue_t = std::vector<double>;
+
+  struct Leg {
+    ou::tf::keytypes::idIntern_t idInstrument; // identity only, not used in valuation
+    ou::tf::OptionSide::EOptionSide side; // Unknown for underlying
+    double strike;
+    double tue; // time to expiry, in years, at grid origin
+    double iv;  // current implied volatility
+    double basis; // price paid per unit
+    int quantity; // positive is long, negative is short
+    double multiplier;
+    Leg()
+    : idInstrument {}, side( ou::tf::OptionSide::Unknown ), strike {}, tue {}, iv {}, basis {}, quantity {}, multiplier( 1.0 ) {}
+    Leg( ou::tf::OptionSide::EOptionSide side_, double strike_, double tue_, double iv_, double basis_, int quantity_, double multiplier_ )
+    : idInstrument {}, side( side_ ), strike( strike_ ), tue( tue_ ), iv( iv_ ), basis( basis_ ), quantity( quantity_ ), multiplier( multiplier_ ) {}
+    // same position: instrument, side, strike, expiry, quantity, basis; iv is market data, it only feeds the valuation
+    bool SamePosition( const Leg& rhs ) const {
+      return ( idInstrument == rhs.idInstrument ) && ( side == rhs.side ) && ( strike == rhs.strike ) && ( tue == rhs.tue )
+          && ( quantity == rhs.quantity ) && ( basis == rhs.basis ) && ( multiplier == rhs.multiplier );
+    }
+  };
+  using vLeg_t = std::vector<Leg>;
+
+  static bool SamePosition( const vLeg_t& lhs, const vLeg_t& rhs ) {
+    return std::equal( lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+      []( const Leg& a, const Leg& b ){ return a.SamePosition( b ); } );
+  }
+
+  struct Axes {
+    vValue_t vPrice; // underlying price
+    vValue_t vVolShift; // added to each leg's iv
+    vValue_t vYearsForward; // subtracted from each leg's tue
+    double rate; // risk free rate
+    Axes(): rate {} {}
+  };
+
+  RiskGrid( size_t nThreads = 2 );
+  ~RiskGrid();
+
+  void Set( const Axes& ); // marks all combos dirty
+
+  idCombo_t AddCombo( const vLeg_t& );
+  void UpdateCombo( idCombo_t, const vLeg_t& );
+  void UpdateLeg( idCombo_t, size_t ixLeg, const Leg& );
+  void DeleteCombo( idCombo_t );
+
+  void Recalc(); // evaluates dirty combos across the thread pool, blocks until complete
+
+  size_t Cells() const { return m_nCells; }
+  size_t Index( size_t ixYears, size_t ixVol, size_t ixPrice ) const {
+    return ( ixYears * m_axes.vVolShift.size() + ixVol ) * m_axes.vPrice.size() + ixPrice;
+  }
+
+  const vValue_t& PL( idCombo_t ) const;
+  const vValue_t& PL() const { return m_vTotal; } // sum of all combos
+  const vValue_t& Margin() const { return m_vMargin; } // [time][vol]
+  size_t MarginIndex( size_t ixYears, size_t ixVol ) const {
+    return ixYears * m_axes.vVolShift.size() + ixVol;
+  }
+
+protected:
+private:
+
+  struct Combo {
+    bool bActive;
+    bool bDirty;
+    vLeg_t vLeg;
+    vValue_t vPL; // contribution currently summed into m_vTotal
+    vValue_t vScratch; // evaluation target for worker threads
+    Combo(): bActive( false ), bDirty( false ) {}
+  };
+  using vCombo_t = std::vector<Combo>;
+  vCombo_t m_vCombo;
+  std::vector<idCombo_t> m_vFree;
+
+  Axes m_axes;
+  size_t m_nCells;
+
+  vValue_t m_vTotal;
+  vValue_t m_vMargin;
+
+  boost::asio::io_context m_srvc;
+  boost::thread_group m_threads;
+  boost::asio::executor_work_guard<boost::asio::io_context::executor_type> m_srvcWork;
+
+  std::mutex m_mutex;
+  std::condition_variable m_cvDone;
+  size_t m_nOutstanding;
+
+  Combo& LU( idCombo_t );
+  void Evaluate( Combo& );
+  void CalcMargin();
+};
+
+} // namespace option
+} // namespace tf
+} // namespace ou
@@ -27,6 +27,177 @@ namespace phemex {
 namespace gateway {
 namespace trades {
 
+namespace {
+
+// just enough json for the trades message, anything unexpected declines the message
+class Cursor {
+public:
+
+  Cursor( std::string_view sv ): m_p( sv.data() ), m_end( sv.data() + sv.size() ) {}
+
+  bool Next( char ch ) {
+    Space();
+    if ( ( m_end != m_p ) && ( ch == *m_p ) ) {
+      m_p++;
+      return true;
+    }
+    return false;
+  }
+
+  bool String( std::string_view& sv ) {
+    if ( !Next( '"' ) ) return false;
+    const char* begin( m_p );
+    while ( m_end != m_p ) {
+      switch ( *m_p ) {
+        case '"':
+          sv = std::string_view( begin, m_p - begin );
+          m_p++;
+          return true;
+        case '\\': // escapes are not expected in this schema
+          return false;
+        default:
+          m_p++;
+      }
+    }
+    return false;
+  }
+
+  bool Unsigned( uint64_t& value ) {
+    Space();
+    const char* begin( m_p );
+    value = 0;
+    while ( ( m_end != m_p ) && ( '0' <= *m_p ) && ( '9' >= *m_p ) ) {
+      value = value * 10 + ( *m_p - '0' );
+      m_p++;
+    }
+    return ( begin != m_p ) && ( 20 > ( m_p - begin ) );
+  }
+
+  bool Skip( unsigned int depth = 0 ) { // any value
+    Space();
+    if ( ( m_end == m_p ) || ( 16 < depth ) ) return false;
+    switch ( *m_p ) {
+      case '"': {
+          std::string_view sv;
+          return String( sv );
+        }
+      case '{':
+        m_p++;
+        if ( Next( '}' ) ) return true;
+        do {
+          std::string_view sv;
+          if ( !String( sv ) || !Next( ':' ) || !Skip( depth + 1 ) ) return false;
+        } while ( Next( ',' ) );
+        return Next( '}' );
+      case '[':
+        m_p++;
+        if ( Next( ']' ) ) return true;
+        do {
+          if ( !Skip( depth + 1 ) ) return false;
+        } while ( Next( ',' ) );
+        return Next( ']' );
+      default: { // number, true, false, null
+          const char* begin( m_p );
+          while ( ( m_end != m_p ) && ( ',' != *m_p ) && ( '}' != *m_p ) && ( ']' != *m_p ) && !IsSpace( *m_p ) ) m_p++;
+          return begin != m_p;
+        }
+    }
+  }
+
+  bool End() {
+    Space();
+    return m_end == m_p;
+  }
+
+private:
+
+  const char* m_p;
+  const char* m_end;
+
+  static bool IsSpace( char ch ) {
+    return ( ' ' == ch ) || ( '\n' == ch ) || ( '\r' == ch ) || ( '\t' == ch );
+  }
+
+  void Space() {
+    while ( ( m_end != m_p ) && IsSpace( *m_p ) ) m_p++;
+  }
+};
+
+// [timestamp,"Buy",priceEp,qty]
+bool Trade( Cursor& cursor, trade& trade ) {
+  std::string_view side;
+  if ( !cursor.Next( '[' ) ) return false;
+  if ( !cursor.Unsigned( trade.time_stamp ) || !cursor.Next( ',' ) ) return false;
+  if ( !cursor.String( side ) || !cursor.Next( ',' ) ) return false;
+  trade.side.assign( side.data(), side.size() );
+  if ( !cursor.Unsigned( trade.price ) || !cursor.Next( ',' ) ) return false;
+  if ( !cursor.Unsigned( trade.quantity ) ) return false;
+  return cursor.Next( ']' );
+}
+
+} // namespace anonymous
+
+bool decode( std::string_view svMessage, message& msg ) {
+
+  Cursor cursor( svMessage );
+  bool bTrades( false );
+  bool bSymbol( false );
+  bool bType( false );
+  size_t nTrades {};
+
+  // msg is reused across messages, nothing from the previous one may survive
+  msg.sequence = 0;
+  msg.symbol.clear();
+  msg.type.clear();
+
+  if ( !cursor.Next( '{' ) ) return false;
+  do {
+    std::string_view key;
+    if ( !cursor.String( key ) || !cursor.Next( ':' ) ) return false;
+    if ( "trades" == key ) {
+      bTrades = true;
+      if ( !cursor.Next( '[' ) ) return false;
+      if ( !cursor.Next( ']' ) ) {
+        do {
+          if ( msg.trades.size() == nTrades ) msg.trades.emplace_back();
+          if ( !Trade( cursor, msg.trades[ nTrades ] ) ) return false;
+          nTrades++;
+        } while ( cursor.Next( ',' ) );
+        if ( !cursor.Next( ']' ) ) return false;
+      }
+    }
+    else {
+      if ( "symbol" == key ) {
+        std::string_view sv;
+        if ( !cursor.String( sv ) ) return false;
+        msg.symbol.assign( sv.data(), sv.size() );
+        bSymbol = true;
+      }
+      else {
+        if ( "type" == key ) {
+          std::string_view sv;
+          if ( !cursor.String( sv ) ) return false;
+          msg.type.assign( sv.data(), sv.size() );
+          bType = true;
+        }
+        else {
+          if ( "sequence" == key ) {
+            if ( !cursor.Unsigned( msg.sequence ) ) return false;
+          }
+          else {
+            if ( !cursor.Skip() ) return false;
+          }
+        }
+      }
+    }
+  } while ( cursor.Next( ',' ) );
+
+  if ( !cursor.Next( '}' ) || !cursor.End() ) return false;
+
+  msg.trades.resize( nTrades ); // only shrinks, elements beyond are from an earlier, longer message
+  return bTrades && bSymbol && bType;
+}
+
 } // namespace trades
 } // namespace gateway
 } // namespace phemex
@@ -23,6 +23,8 @@
 
 #include <vector>
 #include <string>
+#include <cstdint>
+#include <string_view>
 
 namespace boost {
 namespace json {
@@ -50,6 +52,20 @@ struct trade {
 
 using v_trade_t = std::vector<trade>;
 
+// {"sequence":N,"symbol":"BTCUSD","trades":[[timestamp,"Buy",priceEp,qty],...],"type":"incremental"}
+struct message {
+  uint64_t sequence;
+  std::string symbol;
+  std::string type; // snapshot, incremental
+  v_trade_t trades;
+};
+
+// schema specific decode of a trades message, straight from the socket buffer, no json dom
+//   message is re-used between calls, so the strings and the vector keep their capacity
+//   false: not a trades message (error, heartbeat response, ...), or not understood,
+//     caller falls back to boost::json for those
+bool decode( std::string_view, message& );
+
 } // namespace trades
 } // namespace gateway
 } // namespace phemex
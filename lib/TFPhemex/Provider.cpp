@@ -273,11 +273,17 @@ void Provider::DataGateWayUp() {
       //m_pTradeUpdates->disconnect();
       ProviderInterfaceBase::OnDisconnected( 0 );
     },
-    [this]( std::string&& sMessage){ // fMessage_t
+    [this]( std::string_view svMessage ){ // fMessage_t
+      if ( gateway::trades::decode( svMessage, m_messageTrades ) ) { // the bulk of the traffic
+        HandleTrades( m_messageTrades );
+        return;
+      }
+      unsigned char buffer[ 4096 ]; // the remaining messages are small, so the dom usually lives on the stack
+      json::monotonic_resource mr( buffer, sizeof( buffer ) );
       json::error_code jec;
-      json::value jv = json::parse( sMessage, jec );
+      json::value jv = json::parse( svMessage, jec, &mr );
       if ( jec.failed() ) {
-        BOOST_LOG_TRIVIAL(error) << "provider/phemex failed to parse web_socket stream: " << sMessage;
+        BOOST_LOG_TRIVIAL(error) << "provider/phemex failed to parse web_socket stream: " << svMessage;
       }
       else { // TODO: use spirit here at some point
         bool bMessageProcessed( false );
@@ -290,81 +296,60 @@ void Provider::DataGateWayUp() {
               break;
             case (int)session::web_socket::EMessageId::StartTradeWatch:
               if ( !obj.at( "error" ).is_null() ) {
-                json::object error = json::value_to<json::object>( obj.at( "error" ) );
                 BOOST_LOG_TRIVIAL(error)
-                  << "provider/phemex gw start watch: " << sMessage;
+                  << "provider/phemex gw start watch: " << svMessage;
               }
               break;
             case (int)session::web_socket::EMessageId::StopTradeWatch:
               if ( !obj.at( "error" ).is_null() ) {
-                json::object error = json::value_to<json::object>( obj.at( "error" ) );
                 BOOST_LOG_TRIVIAL(error)
-                  << "provider/phemex gw stop watch: " << sMessage;
+                  << "provider/phemex gw stop watch: " << svMessage;
               }
               break;
             default:
-              BOOST_LOG_TRIVIAL(error) << "provider/phemex gw error: " << sMessage;
+              BOOST_LOG_TRIVIAL(error) << "provider/phemex gw error: " << svMessage;
               break;
           }
           bMessageProcessed = true;
         }
         else {
-          if ( auto p = obj.if_contains( "trades" ) ) {
-            uint64_t sequence = json::value_to<uint64_t>( obj.at( "sequence" ) );
-            std::string sSymbol = json::value_to<std::string>( obj.at( "symbol" ) );
-            json::array trades = json::value_to<json::array>( obj.at( "trades" ) );
-            std::string sType = json::value_to<std::string>( obj.at( "type" ) );
-
-            mapSymbols_t::iterator iterSymbol = m_mapSymbols.find( sSymbol );
-            if ( m_mapSymbols.end() == iterSymbol ) {
-              BOOST_LOG_TRIVIAL(error) << "provider/phemex DataGateway can not find symbol " << sSymbol;
-            }
-            else {
-              if ( "snapshot" == sType ) {}
-              if ( "incremental" == sType ) {
-                gateway::trades::v_trade_t v_trade;
-                try {
-                  for ( const auto& item: trades ) {
-
-                    json::array trade_items = json::value_to<json::array>( item );
-                    json::array::const_iterator citer = trade_items.begin();
-
-                    v_trade.push_back( gateway::trades::trade() );
-                    auto& back( v_trade.back() );
-                    back.time_stamp = json::value_to<uint64_t>( *citer ); citer++;
-                    back.side = json::value_to<std::string>( *citer ); citer++;
-                    back.price = json::value_to<uint64_t>( *citer ); citer++;
-                    back.quantity = json::value_to<uint64_t>( *citer );
-                  }
-                }
-                catch (...) {
-                  BOOST_LOG_TRIVIAL(error) << "provider/phemex DataGateWay error";
-                }
-
-                uint64_t value1 {}, value2 {};
-                for ( gateway::trades::v_trade_t::const_reverse_iterator iter = v_trade.rbegin(); v_trade.rend() != iter; iter++ ) {
-                  value2 = iter->time_stamp;
-                  if ( value2 < value1 ) {
-                    BOOST_LOG_TRIVIAL(error)
-                      << "phemex::DataGateWay trades not in expected sequence: "
-                      << value1 << "," << value2
-                      ;
-                  }
-                  value1 = value2;
-                  iterSymbol->second->HandleTrade( *iter );
-                }
-              }
-            }
+          if ( auto p = obj.if_contains( "trades" ) ) { // a trades message the decoder did not understand
+            BOOST_LOG_TRIVIAL(error) << "provider/phemex DataGateWay error: " << svMessage;
             bMessageProcessed = true;
           }
         }
         if ( !bMessageProcessed ) {
-          BOOST_LOG_TRIVIAL(info) << "gateway received: " << sMessage;
+          BOOST_LOG_TRIVIAL(info) << "gateway received: " << svMessage;
         }
       }
     });
 }
 
+void Provider::HandleTrades( const gateway::trades::message& msg ) {
+
+  mapSymbols_t::iterator iterSymbol = m_mapSymbols.find( msg.symbol );
+  if ( m_mapSymbols.end() == iterSymbol ) {
+    BOOST_LOG_TRIVIAL(error) << "provider/phemex DataGateway can not find symbol " << msg.symbol;
+  }
+  else {
+    if ( "snapshot" == msg.type ) {}
+    if ( "incremental" == msg.type ) {
+      uint64_t value1 {}, value2 {};
+      for ( gateway::trades::v_trade_t::const_reverse_iterator iter = msg.trades.rbegin(); msg.trades.rend() != iter; iter++ ) {
+        value2 = iter->time_stamp;
+        if ( value2 < value1 ) {
+          BOOST_LOG_TRIVIAL(error)
+            << "phemex::DataGateWay trades not in expected sequence: "
+            << value1 << "," << value2
+            ;
+        }
+        value1 = value2;
+        iterSymbol->second->HandleTrade( *iter );
+      }
+    }
+  }
+}
+
 //void Provider::StartQuoteWatch( pSymbol_t pSymbol ) {
   // no quotes to watch for now, will need to pull from order book
 //}
@@ -127,8 +127,11 @@ private:
 
   bool m_bSendHeartBeat;
 
+  gateway::trades::message m_messageTrades; // re-used by each decode
+
   void GetProducts();
   void DataGateWayUp();
+  void HandleTrades( const gateway::trades::message& );
 
 };
 
@@ -23,6 +23,7 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 #include <atomic>
 #include <functional>
 
@@ -60,7 +61,7 @@ public:
 
   using fConnected_t = std::function<void(bool)>;
   using fDisconnected_t = std::function<void()>;
-  using fMessage_t = std::function<void(std::string&&)>;
+  using fMessage_t = std::function<void(std::string_view)>; // view into the read buffer, valid for the call only
 
   // Start the asynchronous operation
   void connect(
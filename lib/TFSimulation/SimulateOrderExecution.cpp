@@ -24,11 +24,17 @@ namespace ou { // One Unified
 namespace tf { // TradeFrame
 namespace sim { // simulation
 
+namespace {
+  const ou::tf::TickScale c_scaleUnset( 1e-8 ); // orders the books only, comparisons use the order's price
+}
+
 int OrderExecution::m_nExecId( 1000 );
 
 OrderExecution::OrderExecution()
 : m_dtQueueDelay( milliseconds( 250 ) )
 , m_dblCommission( 1.00 )
+, m_bScaleDecided( false )
+, m_bTickScale( false )
 {
 }
 
@@ -64,6 +70,18 @@ void OrderExecution::SubmitOrder( pOrder_t pOrder ) {
   Order::idOrder_t idOrder( pOrder->GetOrderId() );
   BOOST_LOG_TRIVIAL(info)
     << "simulate," << idOrder << ",queued,submit," << pOrder->GetInstrument()->GetInstrumentName();
+  const double dblMinTick( pOrder->GetInstrument()->GetMinTick() );
+  if ( !m_bScaleDecided ) { // the books are keyed on one grid for the life of the instance
+    m_bScaleDecided = true;
+    if ( 0.0 < dblMinTick ) {
+      m_scale = pOrder->GetInstrument()->GetTickScale();
+      m_bTickScale = true;
+    }
+  }
+  else { // one instrument per instance
+    assert( m_bTickScale == ( 0.0 < dblMinTick ) );
+    assert( !m_bTickScale || ( m_scale.MinTick() == dblMinTick ) );
+  }
   m_lOrderDelay.push_back( pOrder );
   TrackOrder( idOrder, OrderState::State::Delay ); // might be new or a change
 }
@@ -210,6 +228,22 @@ bool OrderExecution::ProcessMarketOrders( const Quote& quote ) {
   return bProcessed;
 }
 
+ou::tf::PriceTick OrderExecution::KeyCeil( double price ) const {
+  return m_bTickScale ? m_scale.Ceil( price ) : c_scaleUnset.Nearest( price );
+}
+
+ou::tf::PriceTick OrderExecution::KeyFloor( double price ) const {
+  return m_bTickScale ? m_scale.Floor( price ) : c_scaleUnset.Nearest( price );
+}
+
+bool OrderExecution::BidReaches( double bid, const mapOrderBook_t::value_type& entry ) const {
+  return m_bTickScale ? ( m_scale.Floor( bid ) >= entry.first ) : ( bid >= entry.second->GetPrice1() );
+}
+
+bool OrderExecution::AskReaches( double ask, const mapOrderBook_t::value_type& entry ) const {
+  return m_bTickScale ? ( m_scale.Ceil( ask ) <= entry.first ) : ( ask <= entry.second->GetPrice1() );
+}
+
 bool OrderExecution::ProcessLimitOrders( const Quote& quote ) {
 
   bool bProcessed( false );
@@ -220,7 +254,7 @@ bool OrderExecution::ProcessLimitOrders( const Quote& quote ) {
   if ( !m_mapAsks.empty() ) {
     mapOrderBook_t::value_type& entry( *m_mapAsks.begin() );
     const double bid( quote.Bid() );
-    if ( bid >= entry.first ) {
+    if ( BidReaches( bid, entry ) ) {
       if ( 0 < quote.BidSize() ) {
 
         bProcessed = true;
@@ -268,7 +302,7 @@ bool OrderExecution::ProcessLimitOrders( const Quote& quote ) {
   if ( !m_mapBids.empty() && !bProcessed) {
     mapOrderBook_t::value_type& entry( *m_mapBids.rbegin() );
     const double ask( quote.Ask() );
-    if ( ask <= entry.first ) {
+    if ( AskReaches( ask, entry ) ) {
       if ( 0 < quote.AskSize() ) {
 
         bProcessed = true;
@@ -321,14 +355,14 @@ bool OrderExecution::ProcessLimitOrders( const Trade& trade ) {
   if ( false ) { // disable this for now
     double ask( trade.Price() );
     if ( !m_mapAsks.empty() ) {
-      if ( m_lastQuote.Ask() <= m_mapAsks.begin()->first ) {
+      if ( AskReaches( m_lastQuote.Ask(), *m_mapAsks.begin() ) ) {
         ask = m_lastQuote.Ask();
       }
     }
 
     double bid( trade.Price() );
     if ( !m_mapBids.empty() ) {
-      if ( m_lastQuote.Bid() >= m_mapBids.rbegin()->first ) {
+      if ( BidReaches( m_lastQuote.Bid(), *m_mapBids.rbegin() ) ) {
         bid = m_lastQuote.Bid();
       }
     }
@@ -426,12 +460,13 @@ void OrderExecution::ProcessDelayQueue( const Quote& quote ) {
             // TODO: can't have limit orders in two different directions
             assert( 0 < order.GetPrice1() );
 
+            // a limit between ticks rests at the first tick it would accept
             switch ( order.GetOrderSide() ) {
               case OrderSide::Sell:
-                m_mapAsks.insert( mapOrderBook_pair_t( order.GetPrice1(), pOrderFrontOfQueue ) );
+                m_mapAsks.insert( mapOrderBook_pair_t( KeyCeil( order.GetPrice1() ), pOrderFrontOfQueue ) );
                 break;
               case OrderSide::Buy:
-                m_mapBids.insert( mapOrderBook_pair_t( order.GetPrice1(), pOrderFrontOfQueue ) );
+                m_mapBids.insert( mapOrderBook_pair_t( KeyFloor( order.GetPrice1() ), pOrderFrontOfQueue ) );
                 break;
               default:
                 assert( false );
@@ -443,10 +478,10 @@ void OrderExecution::ProcessDelayQueue( const Quote& quote ) {
             assert( 0 < order.GetPrice1() );
             switch ( order.GetOrderSide() ) {
               case OrderSide::Sell:
-                m_mapSellStops.insert( mapOrderBook_pair_t( order.GetPrice1(), pOrderFrontOfQueue ) );
+                m_mapSellStops.insert( mapOrderBook_pair_t( KeyFloor( order.GetPrice1() ), pOrderFrontOfQueue ) );
                 break;
               case OrderSide::Buy:
-                m_mapBuyStops.insert( mapOrderBook_pair_t( order.GetPrice1(), pOrderFrontOfQueue ) );
+                m_mapBuyStops.insert( mapOrderBook_pair_t( KeyCeil( order.GetPrice1() ), pOrderFrontOfQueue ) );
                 break;
               default:
                 assert( false );
@@ -28,6 +28,7 @@
 using namespace fastdelegate;
 
 #include <TFTimeSeries/DatedDatum.h>
+#include <TFTimeSeries/PriceTick.h>
 
 #include <TFTrading/Order.h>
 #include <TFTrading/Execution.h>
@@ -118,10 +119,20 @@ private:
   lOrderQueue_t m_lOrderDelay;  // all orders put in delay queue, taken out then processed as limit or market or stop
   lOrderQueue_t m_lOrderMarket;  // market orders to be processed
 
-  using mapOrderBook_t = std::multimap<double,pOrder_t>;
+  bool m_bScaleDecided; // by the first order submitted
+  bool m_bTickScale; // instrument supplied a min tick, otherwise levels compare as plain doubles
+  ou::tf::TickScale m_scale; // from the instrument, order prices are keyed in ticks
+  using mapOrderBook_t = std::multimap<ou::tf::PriceTick,pOrder_t>;
   using mapOrderBook_iter_t = mapOrderBook_t::iterator;
   using mapOrderBook_pair_t = mapOrderBook_t::value_type;
 
+  // book keys, the first tick a limit accepts, or without a min tick, the price itself on a grid finer than any feed
+  ou::tf::PriceTick KeyCeil( double price ) const;
+  ou::tf::PriceTick KeyFloor( double price ) const;
+  // a quote reaches a resting order, on the tick grid, or without a min tick, against the order's own price
+  bool BidReaches( double bid, const mapOrderBook_t::value_type& ) const;
+  bool AskReaches( double ask, const mapOrderBook_t::value_type& ) const;
+
   mapOrderBook_t m_mapAsks; // lowest at beginning
   mapOrderBook_t m_mapBids; // highest at end
   mapOrderBook_t m_mapSellStops;  // pending sell stops, turned into market order when touched
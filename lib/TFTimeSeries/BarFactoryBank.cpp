@@ -0,0 +1,236 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    BarFactoryBank.cpp
+ * Author:  raymond@burkholder.net
+ * Project: TFTimeSeries
+ * Created: October 19, 2026 22:45 PM
+ */
+
+#include <limits>
+#include <cassert>
+#include <algorithm>
+#include <stdexcept>
+
+#include "BarFactoryBank.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+namespace {
+  const ptime c_epoch( boost::gregorian::date( 1970, 1, 1 ) );
+}
+
+BarFactoryBank::BarFactoryBank()
+: m_bLinked( false )
+, m_nLastUpdate( std::numeric_limits<int64_t>::min() )
+{}
+
+BarFactoryBank::~BarFactoryBank() {
+  OnBarsComplete = NULL;
+  OnBarsUpdated = NULL;
+}
+
+BarFactoryBank::idBar_t BarFactoryBank::AddTime( duration_t nSeconds ) {
+  return Find( EType::Time, std::max<duration_t>( 1, nSeconds ) );
+}
+
+BarFactoryBank::idBar_t BarFactoryBank::AddVolume( volume_t nVolume ) {
+  return Find( EType::Volume, std::max<volume_t>( 1, nVolume ) );
+}
+
+BarFactoryBank::idBar_t BarFactoryBank::AddTicks( size_t nTicks ) {
+  return Find( EType::Ticks, std::max<size_t>( 1, nTicks ) );
+}
+
+BarFactoryBank::idBar_t BarFactoryBank::Find( EType type, int64_t nWidth ) {
+  for ( idBar_t id = 0; id < m_vWidth.size(); id++ ) {
+    const Width& width( m_vWidth[ id ] );
+    if ( ( type == width.type ) && ( nWidth == width.nWidth ) ) return id;
+  }
+  if ( m_bLinked ) {
+    throw std::runtime_error( "BarFactoryBank: widths are added before the first trade" );
+  }
+  m_vWidth.emplace_back( Width( type, nWidth ) );
+  return m_vWidth.size() - 1;
+}
+
+// each time or tick width hangs off the largest smaller width of the same type which divides it
+void BarFactoryBank::Link() {
+  for ( size_t ix = 0; ix < m_vWidth.size(); ix++ ) {
+    Width& width( m_vWidth[ ix ] );
+    if ( EType::Volume != width.type ) {
+      for ( size_t jx = 0; jx < m_vWidth.size(); jx++ ) {
+        const Width& candidate( m_vWidth[ jx ] );
+        if ( ( width.type == candidate.type )
+          && ( width.nWidth > candidate.nWidth )
+          && ( 0 == width.nWidth % candidate.nWidth )
+        ) {
+          if ( ( nNone == width.ixParent ) || ( m_vWidth[ width.ixParent ].nWidth < candidate.nWidth ) ) {
+            width.ixParent = jx;
+          }
+        }
+      }
+    }
+    if ( nNone == width.ixParent ) {
+      m_vRoot.push_back( ix );
+    }
+    else {
+      Width& parent( m_vWidth[ width.ixParent ] );
+      width.nRatio = width.nWidth / parent.nWidth;
+      parent.vChild.push_back( ix );
+    }
+  }
+  m_vCompleted.reserve( m_vWidth.size() ); // each width completes at most once per trade
+  m_bLinked = true;
+}
+
+void BarFactoryBank::Add( const ptime& dt, price_t price, volume_t volume ) {
+
+  if ( !m_bLinked ) Link();
+
+  const int64_t nSeconds( ( dt - c_epoch ).total_seconds() );
+
+  m_vCompleted.clear();
+
+  for ( const size_t ix: m_vRoot ) {
+    Width& width( m_vWidth[ ix ] );
+    Bar& bar( width.bar );
+    switch ( width.type ) {
+      case EType::Time: {
+          const int64_t nInterval( nSeconds / width.nWidth );
+          if ( bar.IsNull() || ( nInterval != width.nInterval ) ) {
+            if ( !bar.IsNull() ) Complete( ix, nSeconds );
+            width.nInterval = nInterval;
+            Start( width, c_epoch + boost::posix_time::seconds( nInterval * width.nWidth ), price, volume );
+          }
+          else {
+            bar.Close( price );
+            bar.High( std::max( bar.High(), price ) );
+            bar.Low( std::min( bar.Low(), price ) );
+            bar.Volume( bar.Volume() + volume );
+          }
+        }
+        break;
+      case EType::Volume:
+      case EType::Ticks:
+        if ( bar.IsNull() ) {
+          Start( width, dt, price, volume );
+          width.nCount = 0;
+        }
+        else {
+          bar.Close( price );
+          bar.High( std::max( bar.High(), price ) );
+          bar.Low( std::min( bar.Low(), price ) );
+          bar.Volume( bar.Volume() + volume );
+        }
+        width.nCount += ( EType::Volume == width.type ) ? volume : 1;
+        if ( width.nWidth <= width.nCount ) {
+          Complete( ix, nSeconds );
+          bar = Bar();
+        }
+        break;
+    }
+  }
+
+  if ( !m_vCompleted.empty() ) {
+    if ( 0 != OnBarsComplete ) OnBarsComplete( m_vCompleted );
+  }
+
+  if ( m_nLastUpdate < nSeconds ) {
+    m_nLastUpdate = nSeconds;
+    if ( 0 != OnBarsUpdated ) OnBarsUpdated();
+  }
+}
+
+void BarFactoryBank::Start( Width& width, const ptime& dt, price_t price, volume_t volume ) {
+  Bar& bar( width.bar );
+  bar.DateTime( dt );
+  bar.Open( price );
+  bar.High( price );
+  bar.Low( price );
+  bar.Close( price );
+  bar.Volume( volume );
+}
+
+// hand over the bar, then roll it up into the derived widths, which may complete in turn
+void BarFactoryBank::Complete( size_t ix, int64_t nSeconds ) {
+  const Width& width( m_vWidth[ ix ] );
+  m_vCompleted.push_back( Completed{ ix, width.bar } );
+  for ( const size_t ixChild: width.vChild ) {
+    Width& child( m_vWidth[ ixChild ] );
+    Fold( child, width );
+    bool bComplete( false );
+    switch ( child.type ) {
+      case EType::Time:
+        bComplete = ( nSeconds / child.nWidth ) != child.nInterval;
+        break;
+      case EType::Ticks:
+        bComplete = child.nRatio == ++child.nCount;
+        break;
+      case EType::Volume:
+        assert( false ); // not derived
+        break;
+    }
+    if ( bComplete ) {
+      Complete( ixChild, nSeconds );
+      child.bar = Bar();
+      child.nCount = 0;
+    }
+  }
+}
+
+void BarFactoryBank::Fold( Width& child, const Width& parent ) {
+  const Bar& from( parent.bar );
+  Bar& to( child.bar );
+  if ( to.IsNull() ) {
+    to = from;
+    if ( EType::Time == child.type ) {
+      child.nInterval = ( parent.nInterval * parent.nWidth ) / child.nWidth;
+      to.DateTime( c_epoch + boost::posix_time::seconds( child.nInterval * child.nWidth ) );
+    }
+  }
+  else {
+    to.High( std::max( to.High(), from.High() ) );
+    to.Low( std::min( to.Low(), from.Low() ) );
+    to.Close( from.Close() );
+    to.Volume( to.Volume() + from.Volume() );
+  }
+}
+
+Bar BarFactoryBank::GetCurrentBar( idBar_t id ) const {
+  const Width& width( m_vWidth.at( id ) );
+  if ( nNone == width.ixParent ) return width.bar;
+  const Bar parent( GetCurrentBar( width.ixParent ) );
+  if ( parent.IsNull() ) return width.bar;
+  Bar bar( width.bar );
+  if ( bar.IsNull() ) {
+    bar = parent;
+    if ( EType::Time == width.type ) {
+      const int64_t nSeconds( ( parent.DateTime() - c_epoch ).total_seconds() );
+      bar.DateTime( c_epoch + boost::posix_time::seconds( ( nSeconds / width.nWidth ) * width.nWidth ) );
+    }
+  }
+  else {
+    bar.High( std::max( bar.High(), parent.High() ) );
+    bar.Low( std::min( bar.Low(), parent.Low() ) );
+    bar.Close( parent.Close() );
+    bar.Volume( bar.Volume() + parent.Volume() );
+  }
+  return bar;
+}
+
+} // namespace tf
+} // namespace ou
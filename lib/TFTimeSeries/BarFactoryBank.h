@@ -0,0 +1,122 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    BarFactoryBank.h
+ * Author:  raymond@burkholder.net
+ * Project: TFTimeSeries
+ * Created: October 19, 2026 22:45 PM
+ */
+
+#pragma once
+
+// many bar widths from one trade stream, in one pass per trade
+//   time bars: n seconds, aligned to the epoch (so to midnight for widths which divide a day)
+//   volume bars: complete on the trade which brings the volume to at least n
+//   tick bars: complete on the n-th trade
+// a time or tick width which is a multiple of a smaller one of the same type is derived
+//   from the smaller one's completed bars, rather than from the trades
+//   so a trade touches only the smallest widths, the others roll up when those complete
+// a time bar completes on the first trade of the next interval, as with BarFactory, empty intervals emit nothing
+// the bars completed by one trade are handed over together, a width ahead of those derived from it,
+//   the bar for the same id which the trade started is available through GetCurrentBar
+// widths are added before the first trade
+
+#include <vector>
+#include <cstdint>
+
+#include "BarFactory.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+class BarFactoryBank {
+public:
+
+  typedef BarFactory::duration_t duration_t;  // seconds
+  typedef Bar::volume_t volume_t;
+  typedef Bar::price_t price_t;
+
+  typedef size_t idBar_t;
+
+  BarFactoryBank();
+  virtual ~BarFactoryBank();
+
+  idBar_t AddTime( duration_t nSeconds ); // an existing width returns its id
+  idBar_t AddVolume( volume_t nVolume );
+  idBar_t AddTicks( size_t nTicks );
+
+  void Add( const ptime&, price_t, volume_t );
+  void Add( const Trade& trade ) { Add( trade.DateTime(), trade.Price(), trade.Volume() ); };
+
+  Bar GetCurrentBar( idBar_t ) const; // includes the trades not yet rolled up from a smaller width
+
+  struct Completed {
+    idBar_t id;
+    Bar bar;
+  };
+  typedef std::vector<Completed> vCompleted_t;
+
+  typedef FastDelegate1<const vCompleted_t&> OnBarsCompleteHandler;
+  void SetOnBarsComplete( OnBarsCompleteHandler function ) { // once per trade, when any bars completed
+    OnBarsComplete = function;
+  }
+  typedef FastDelegate0<> OnBarsUpdatedHandler;
+  void SetOnBarsUpdated( OnBarsUpdatedHandler function ) {  // called at most once a second
+    OnBarsUpdated = function;
+  }
+
+protected:
+private:
+
+  enum class EType { Time, Volume, Ticks };
+
+  static constexpr size_t nNone = (size_t)-1;
+
+  struct Width {
+    EType type;
+    int64_t nWidth;    // seconds, volume or ticks
+    size_t ixParent;   // nNone when built from trades
+    int64_t nRatio;    // ticks: parent bars per bar
+    int64_t nInterval; // time: seconds since epoch / nWidth
+    int64_t nCount;    // volume or ticks so far, or parent bars so far
+    std::vector<size_t> vChild;
+    Bar bar;           // in progress, completed parent bars only when derived
+    Width( EType type_, int64_t nWidth_ )
+    : type( type_ ), nWidth( nWidth_ ), ixParent( nNone ), nRatio {}, nInterval {}, nCount {} {}
+  };
+  typedef std::vector<Width> vWidth_t;
+
+  vWidth_t m_vWidth;
+  std::vector<size_t> m_vRoot; // widths built from trades
+
+  bool m_bLinked;
+  int64_t m_nLastUpdate; // seconds since epoch, of the last OnBarsUpdated
+
+  vCompleted_t m_vCompleted; // reserved, reused for each trade
+
+  OnBarsCompleteHandler OnBarsComplete;
+  OnBarsUpdatedHandler OnBarsUpdated;
+
+  idBar_t Find( EType, int64_t nWidth );
+  void Link(); // assign parents, on the first trade
+
+  void Start( Width&, const ptime&, price_t, volume_t );
+  void Complete( size_t ix, int64_t nSeconds ); // nSeconds: the trade which closed the bar
+  void Fold( Width&, const Width& parent ); // the parent's completed bar into a derived bar
+
+};
+
+} // namespace tf
+} // namespace ou
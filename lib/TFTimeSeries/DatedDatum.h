@@ -44,6 +44,8 @@ public:
   DatedDatum( const std::string& dt ); // YYYY-MM-DD HH:MM:SS
   virtual ~DatedDatum();
 
+  DatedDatum& operator=( const DatedDatum& ) = default;
+
   inline bool IsNull() const { return m_dt.is_not_a_date_time(); }
 
   inline bool operator<( const DatedDatum &rhs ) const { return m_dt < rhs.m_dt; }
@@ -153,6 +155,8 @@ public:
     const std::string& low, const std::string& close, const std::string& volume );
   virtual ~Bar();
 
+  Bar& operator=( const Bar& ) = default;
+
   inline price_t Open() const { return m_dblOpen; }
   inline price_t High() const { return m_dblHigh; }
   inline price_t Low() const { return m_dblLow; }
@@ -0,0 +1,123 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    PriceTick.h
+ * Author:  raymond@burkholder.net
+ * Project: TFTimeSeries
+ * Created: October 19, 2026 19:05 PM
+ */
+
+#pragma once
+
+// a price as a whole number of ticks, so prices compare exactly, and can be used as map keys
+//   or as array / ladder indices, with plain integer arithmetic between levels
+// TickScale converts at the edges, built from the instrument's min tick (Instrument::GetTickScale)
+//   when 1 / min tick is a whole number (0.01, 0.25, 1/64, 0.00005), a tick converts back to
+//   the same double as the decimal price would parse to, so prices round trip exactly
+
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+class PriceTick {
+public:
+
+  using rep_t = int64_t;
+
+  constexpr PriceTick(): m_nTicks {} {}
+  constexpr explicit PriceTick( rep_t nTicks ): m_nTicks( nTicks ) {}
+
+  constexpr rep_t Count() const { return m_nTicks; }
+
+  constexpr PriceTick operator+( rep_t n ) const { return PriceTick( m_nTicks + n ); }
+  constexpr PriceTick operator-( rep_t n ) const { return PriceTick( m_nTicks - n ); }
+  constexpr rep_t operator-( PriceTick rhs ) const { return m_nTicks - rhs.m_nTicks; } // distance in ticks
+
+  PriceTick& operator++() { ++m_nTicks; return *this; }
+  PriceTick& operator--() { --m_nTicks; return *this; }
+
+  constexpr bool operator==( PriceTick rhs ) const { return m_nTicks == rhs.m_nTicks; }
+  constexpr bool operator!=( PriceTick rhs ) const { return m_nTicks != rhs.m_nTicks; }
+  constexpr bool operator< ( PriceTick rhs ) const { return m_nTicks <  rhs.m_nTicks; }
+  constexpr bool operator<=( PriceTick rhs ) const { return m_nTicks <= rhs.m_nTicks; }
+  constexpr bool operator> ( PriceTick rhs ) const { return m_nTicks >  rhs.m_nTicks; }
+  constexpr bool operator>=( PriceTick rhs ) const { return m_nTicks >= rhs.m_nTicks; }
+
+private:
+  rep_t m_nTicks;
+};
+
+class TickScale {
+public:
+
+  explicit TickScale( double dblMinTick = 0.01 ) // default matches Instrument's default
+  : m_dblMinTick( dblMinTick ), m_dblPerPrice {}, m_bWhole( false )
+  {
+    if ( !( 0.0 < dblMinTick ) ) {
+      throw std::invalid_argument( "TickScale: min tick needs to be positive" );
+    }
+    const double dblPerPrice( std::round( 1.0 / dblMinTick ) );
+    m_bWhole = ( 1.0 <= dblPerPrice ) && ( 1e-9 > std::abs( dblPerPrice * dblMinTick - 1.0 ) );
+    m_dblPerPrice = m_bWhole ? dblPerPrice : ( 1.0 / dblMinTick );
+  }
+
+  double MinTick() const { return m_dblMinTick; }
+
+  // price to ticks, Nearest for prices from the feed, which should already be on a tick,
+  //   Floor / Ceil for levels derived from a price, eg which buy / sell limits a quote reaches
+  PriceTick Nearest( double price ) const {
+    return PriceTick( std::llround( Ticks( price ) ) );
+  }
+  PriceTick Floor( double price ) const {
+    return PriceTick( (PriceTick::rep_t)std::floor( Ticks( price ) + c_tolerance ) );
+  }
+  PriceTick Ceil( double price ) const {
+    return PriceTick( (PriceTick::rep_t)std::ceil( Ticks( price ) - c_tolerance ) );
+  }
+
+  double Price( PriceTick tick ) const {
+    return m_bWhole ? ( tick.Count() / m_dblPerPrice ) : ( tick.Count() * m_dblMinTick );
+  }
+
+  double Normalize( double price ) const { return Price( Nearest( price ) ); }
+
+private:
+
+  static constexpr double c_tolerance = 1e-6; // of a tick, absorbs the representation error in price / min tick
+
+  double m_dblMinTick;
+  double m_dblPerPrice; // ticks per unit of price
+  bool m_bWhole; // m_dblPerPrice is a whole number, so the division in Price is correctly rounded
+
+  double Ticks( double price ) const {
+    return m_bWhole ? ( price * m_dblPerPrice ) : ( price / m_dblMinTick );
+  }
+};
+
+} // namespace tf
+} // namespace ou
+
+namespace std {
+  template<>
+  struct hash<ou::tf::PriceTick> {
+    size_t operator()( ou::tf::PriceTick tick ) const noexcept {
+      return std::hash<ou::tf::PriceTick::rep_t>()( tick.Count() );
+    }
+  };
+}
@@ -0,0 +1,341 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    SegmentedVector.h
+ * Author:  raymond@burkholder.net
+ * Project: TFTimeSeries
+ * Created: October 19, 2026 21:05 PM
+ */
+
+#pragma once
+
+// append only storage for long running time series, a std::vector subset
+//   elements live in segments which are never moved, so an append does not copy,
+//     and addresses, references and iterators remain valid as the series grows
+//   segment k holds nFirst << k elements, so small series stay small,
+//     and an index maps to its segment with a bit scan
+//   segments come from an allocation policy in TSAllocator.h, huge_page for large series
+//   ForEachSegment visits the contiguous runs, for bulk transfers such as hdf5
+
+#include <new>
+#include <array>
+#include <memory>
+#include <cassert>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+#include "TSAllocator.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+template<typename T, typename PolicyT = ou::heap<T> >
+class SegmentedVector {
+private:
+  template<bool bConst> class Iterator;
+public:
+
+  using value_type      = T;
+  using size_type       = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference       = T&;
+  using const_reference = const T&;
+  using pointer         = T*;
+  using const_pointer   = const T*;
+
+  using iterator               = Iterator<false>;
+  using const_iterator         = Iterator<true>;
+  using reverse_iterator       = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  SegmentedVector(): m_nSize {}, m_nSegments {}, m_pNext {}, m_pEnd {} { m_rSegment.fill( nullptr ); }
+  SegmentedVector( const SegmentedVector& rhs ): SegmentedVector() { Copy( rhs ); }
+  SegmentedVector( SegmentedVector&& rhs ): SegmentedVector() { Swap( rhs ); }
+  ~SegmentedVector() { Release(); }
+
+  SegmentedVector& operator=( const SegmentedVector& rhs ) {
+    if ( this != &rhs ) {
+      clear();
+      Copy( rhs );
+    }
+    return *this;
+  }
+
+  SegmentedVector& operator=( SegmentedVector&& rhs ) {
+    if ( this != &rhs ) {
+      Release();
+      Swap( rhs );
+    }
+    return *this;
+  }
+
+  size_type size() const { return m_nSize; }
+  bool empty() const { return 0 == m_nSize; }
+  size_type capacity() const { return Capacity( m_nSegments ); }
+
+  void push_back( const T& t ) {
+    if ( m_pNext == m_pEnd ) Advance();
+    new( m_pNext ) T( t );
+    ++m_pNext;
+    ++m_nSize;
+  }
+
+  void pop_back() {
+    assert( 0 < m_nSize );
+    back().~T();
+    --m_nSize;
+    Position( m_nSize );
+  }
+
+  void clear() { // segments are kept, as with std::vector
+    for ( T& t: *this ) t.~T();
+    m_nSize = 0;
+    Position( 0 );
+  }
+
+  void reserve( size_type n ) {
+    while ( capacity() < n ) Allocate();
+    Position( m_nSize );
+  }
+
+  void resize( size_type n ) {
+    while ( n < m_nSize ) pop_back();
+    while ( m_nSize < n ) push_back( T() );
+  }
+
+  iterator insert( const_iterator pos, const T& t ) { // to the end, then rotated into place
+    const size_type ix( pos - cbegin() );
+    push_back( t );
+    std::rotate( begin() + ix, end() - 1, end() );
+    return begin() + ix;
+  }
+
+  reference       operator[]( size_type ix )       { return *Locate( ix ); }
+  const_reference operator[]( size_type ix ) const { return *Locate( ix ); }
+
+  reference at( size_type ix ) {
+    if ( m_nSize <= ix ) throw std::out_of_range( "SegmentedVector::at" );
+    return *Locate( ix );
+  }
+  const_reference at( size_type ix ) const {
+    if ( m_nSize <= ix ) throw std::out_of_range( "SegmentedVector::at" );
+    return *Locate( ix );
+  }
+
+  reference       front()       { assert( 0 < m_nSize ); return *m_rSegment[ 0 ]; }
+  const_reference front() const { assert( 0 < m_nSize ); return *m_rSegment[ 0 ]; }
+  reference       back()        { assert( 0 < m_nSize ); return *Locate( m_nSize - 1 ); }
+  const_reference back() const  { assert( 0 < m_nSize ); return *Locate( m_nSize - 1 ); }
+
+  iterator begin() { return iterator( this, 0 ); }
+  iterator end()   { return iterator( this, m_nSize ); }
+  const_iterator begin() const { return const_iterator( this, 0 ); }
+  const_iterator end() const   { return const_iterator( this, m_nSize ); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const   { return end(); }
+
+  reverse_iterator rbegin() { return reverse_iterator( end() ); }
+  reverse_iterator rend()   { return reverse_iterator( begin() ); }
+  const_reverse_iterator rbegin() const { return const_reverse_iterator( end() ); }
+  const_reverse_iterator rend() const   { return const_reverse_iterator( begin() ); }
+  const_reverse_iterator crbegin() const { return rbegin(); }
+  const_reverse_iterator crend() const   { return rend(); }
+
+  // f( const T*, size_type ) for each contiguous run, in order
+  template<typename F>
+  void ForEachSegment( F&& f ) const {
+    size_type nRemaining( m_nSize );
+    for ( size_type k = 0; 0 < nRemaining; k++ ) {
+      const size_type n( std::min( nRemaining, SegmentSize( k ) ) );
+      f( static_cast<const T*>( m_rSegment[ k ] ), n );
+      nRemaining -= n;
+    }
+  }
+
+protected:
+private:
+
+  static const size_type nFirstBits = 6;
+  static const size_type nFirst = size_type( 1 ) << nFirstBits;
+  static const size_type nMaxSegments = 8 * sizeof( size_type ) - nFirstBits;
+
+  using rSegment_t = std::array<T*, nMaxSegments>;
+
+  rSegment_t m_rSegment;
+  size_type m_nSize;
+  size_type m_nSegments; // allocated
+  T* m_pNext; // where the next push_back goes
+  T* m_pEnd;  // end of the segment holding m_pNext
+
+  PolicyT m_policy;
+
+  static size_type SegmentSize( size_type k ) { return nFirst << k; }
+  static size_type Capacity( size_type nSegments ) { return nFirst * ( ( size_type( 1 ) << nSegments ) - 1 ); }
+
+  static size_type HighBit( size_type n ) { // n is non zero
+#if defined(__GNUC__) || defined(__clang__)
+    return 8 * sizeof( unsigned long long ) - 1 - __builtin_clzll( n );
+#else
+    size_type bit {};
+    while ( n >>= 1 ) ++bit;
+    return bit;
+#endif
+  }
+
+  // segment k starts at index nFirst * ( 2^k - 1 ), so ix + nFirst has its high bit at k + nFirstBits
+  static void Split( size_type ix, size_type& k, size_type& offset ) {
+    const size_type j( ix + nFirst );
+    k = HighBit( j ) - nFirstBits;
+    offset = j - ( nFirst << k );
+  }
+
+  T* Locate( size_type ix ) const {
+    size_type k, offset;
+    Split( ix, k, offset );
+    assert( k < m_nSegments );
+    return m_rSegment[ k ] + offset;
+  }
+
+  void Allocate() {
+    if ( nMaxSegments == m_nSegments ) throw std::length_error( "SegmentedVector segments exhausted" );
+    T* p( m_policy.allocate( SegmentSize( m_nSegments ) ) );
+    if ( nullptr == p ) throw std::bad_alloc();
+    m_rSegment[ m_nSegments ] = p;
+    ++m_nSegments;
+  }
+
+  void Advance() { // m_pNext is at the end of its segment, or no segment yet
+    if ( capacity() == m_nSize ) Allocate();
+    Position( m_nSize );
+  }
+
+  void Position( size_type ix ) { // set m_pNext and m_pEnd for ix
+    size_type k, offset;
+    Split( ix, k, offset );
+    if ( k < m_nSegments ) {
+      m_pNext = m_rSegment[ k ] + offset;
+      m_pEnd = m_rSegment[ k ] + SegmentSize( k );
+    }
+    else {
+      m_pNext = m_pEnd = nullptr;
+    }
+  }
+
+  void Copy( const SegmentedVector& rhs ) {
+    reserve( rhs.size() );
+    rhs.ForEachSegment(
+      [this]( const T* p, size_type n ){
+        for ( const T* pEnd = p + n; p != pEnd; ++p ) push_back( *p );
+      } );
+  }
+
+  void Swap( SegmentedVector& rhs ) {
+    std::swap( m_rSegment, rhs.m_rSegment );
+    std::swap( m_nSize, rhs.m_nSize );
+    std::swap( m_nSegments, rhs.m_nSegments );
+    std::swap( m_pNext, rhs.m_pNext );
+    std::swap( m_pEnd, rhs.m_pEnd );
+  }
+
+  void Release() {
+    clear();
+    for ( size_type k = 0; k < m_nSegments; k++ ) {
+      m_policy.deallocate( m_rSegment[ k ], SegmentSize( k ) );
+      m_rSegment[ k ] = nullptr;
+    }
+    m_nSegments = 0;
+    m_pNext = m_pEnd = nullptr;
+  }
+
+  // random access, increments stay within a segment until its end
+  template<bool bConst>
+  class Iterator {
+  public:
+
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = typename std::conditional<bConst, const T*, T*>::type;
+    using reference         = typename std::conditional<bConst, const T&, T&>::type;
+
+    using container_t = typename std::conditional<bConst, const SegmentedVector, SegmentedVector>::type;
+
+    Iterator(): m_pContainer {}, m_ix {}, m_p {}, m_pEnd {} {}
+    Iterator( container_t* pContainer, size_type ix ): m_pContainer( pContainer ), m_ix( ix ) { Seek(); }
+    template<bool bOther, typename = typename std::enable_if<bConst && !bOther>::type>
+    Iterator( const Iterator<bOther>& rhs ): m_pContainer( rhs.m_pContainer ), m_ix( rhs.m_ix ), m_p( rhs.m_p ), m_pEnd( rhs.m_pEnd ) {}
+
+    reference operator*() const { return *Get(); }
+    pointer operator->() const { return Get(); }
+    reference operator[]( difference_type n ) const { return *( *this + n ); }
+
+    Iterator& operator++() {
+      ++m_ix;
+      if ( ( nullptr == m_p ) || ( ++m_p == m_pEnd ) ) Seek(); // no pointer: made past the segments, which may since have grown
+      return *this;
+    }
+    Iterator operator++( int ) { Iterator tmp( *this ); ++*this; return tmp; }
+    Iterator& operator--() { --m_ix; Seek(); return *this; }
+    Iterator operator--( int ) { Iterator tmp( *this ); --*this; return tmp; }
+
+    Iterator& operator+=( difference_type n ) { m_ix += n; Seek(); return *this; }
+    Iterator& operator-=( difference_type n ) { m_ix -= n; Seek(); return *this; }
+    Iterator operator+( difference_type n ) const { Iterator tmp( *this ); return tmp += n; }
+    Iterator operator-( difference_type n ) const { Iterator tmp( *this ); return tmp -= n; }
+    friend Iterator operator+( difference_type n, const Iterator& rhs ) { return rhs + n; }
+    // const and non-const mix, as with std::vector
+    template<bool b> difference_type operator-( const Iterator<b>& rhs ) const { return difference_type( m_ix ) - difference_type( rhs.m_ix ); }
+
+    template<bool b> bool operator==( const Iterator<b>& rhs ) const { return m_ix == rhs.m_ix; }
+    template<bool b> bool operator!=( const Iterator<b>& rhs ) const { return m_ix != rhs.m_ix; }
+    template<bool b> bool operator< ( const Iterator<b>& rhs ) const { return m_ix <  rhs.m_ix; }
+    template<bool b> bool operator> ( const Iterator<b>& rhs ) const { return m_ix >  rhs.m_ix; }
+    template<bool b> bool operator<=( const Iterator<b>& rhs ) const { return m_ix <= rhs.m_ix; }
+    template<bool b> bool operator>=( const Iterator<b>& rhs ) const { return m_ix >= rhs.m_ix; }
+
+  private:
+
+    friend class Iterator<!bConst>;
+
+    container_t* m_pContainer;
+    size_type m_ix;
+    pointer m_p;
+    pointer m_pEnd;
+
+    pointer Get() const { // position is m_ix, m_p is its cache
+      return ( nullptr == m_p ) ? m_pContainer->Locate( m_ix ) : m_p;
+    }
+
+    void Seek() { // past the allocated segments, such as an end() on a segment boundary, has no pointer
+      if ( m_pContainer->capacity() <= m_ix ) {
+        m_p = m_pEnd = nullptr;
+      }
+      else {
+        size_type k, offset;
+        Split( m_ix, k, offset );
+        m_p = m_pContainer->m_rSegment[ k ] + offset;
+        m_pEnd = m_pContainer->m_rSegment[ k ] + SegmentSize( k );
+      }
+    }
+
+  };
+
+};
+
+} // namespace tf
+} // namespace ou
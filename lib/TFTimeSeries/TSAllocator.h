@@ -28,6 +28,13 @@
 
 //#include <OUCommon/FastDelegate.h>
 
+#include <new>
+#include <cstdlib>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
 namespace ou { // One Unified
 
 template<typename T>
@@ -123,6 +130,56 @@ public:
   
 };
 
+// allocations of a huge page or more are aligned to, and advised for, transparent huge pages,
+//   smaller allocations come from the heap
+// used by SegmentedVector, whose later segments are large
+template<typename T>
+class huge_page {
+public:
+
+  ALLOCATOR_TRAITS(T)
+
+  template<typename U>
+  struct rebind {
+      typedef huge_page<U> other;
+  };
+
+  huge_page(void){}
+
+  template<typename U>
+  huge_page(huge_page<U> const& other){}
+
+  pointer allocate(size_type count, const_pointer /* hint */ = 0) {
+    if(count > max_size()){throw std::bad_alloc();}
+#if defined(__linux__)
+    const size_type nBytes( count * sizeof(type) );
+    if ( nHugePage <= nBytes ) {
+      void* p( nullptr );
+      if ( 0 != ::posix_memalign( &p, nHugePage, Rounded( nBytes ) ) ) {throw std::bad_alloc();}
+      ::madvise( p, Rounded( nBytes ), MADV_HUGEPAGE ); // advisory, ignored where unsupported
+      return static_cast<pointer>( p );
+    }
+#endif
+    return static_cast<pointer>(::operator new(count * sizeof(type)));
+  }
+
+  void deallocate(pointer ptr, size_type count ) {
+#if defined(__linux__)
+    if ( nHugePage <= count * sizeof(type) ) {
+      ::free( ptr );
+      return;
+    }
+#endif
+    ::operator delete(ptr);
+  }
+
+  size_type max_size(void) const {return max_allocations<T>::value;}
+
+private:
+  static const size_type nHugePage = 2 * 1024 * 1024;
+  static size_type Rounded( size_type nBytes ) { return ( nBytes + nHugePage - 1 ) & ~( nHugePage - 1 ); }
+};
+
 #define FORWARD_ALLOCATOR_TRAITS(C)                  \
 typedef typename C::value_type      value_type;      \
 typedef typename C::pointer         pointer;         \
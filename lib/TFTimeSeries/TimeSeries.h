@@ -26,6 +26,7 @@
 
 #include "DatedDatum.h"
 #include "TSAllocator.h"
+#include "SegmentedVector.h"
 
 // 2012/04/01 use Intel Thread Building Blocks to use concurrent_vector?
 // not sure:  the time series here are typically just used for batch mode processing into and out of hdf5 files
@@ -47,6 +48,10 @@
 // 2017/05/06 see DoubleBuffer for a mechanism for locking and reusing data
 //   between threads
 
+// 2026/10/19 quotes, trades and depth by order use SegmentedVector storage, see TimeSeriesStorage,
+//   a full session of quotes no longer stalls the feed thread while a reallocation copies it
+//   use ForEachSegment rather than pointer arithmetic for bulk access to the underlying memory
+
 //#include <boost/serialization/vector.hpp>
 // http://www.boost.org/libs/serialization/doc/traits.html
 
@@ -91,6 +96,17 @@ private:
   boost::mutex m_mutex;
 };
 */
+// storage for a series, contiguous unless specialized here
+template<typename T>
+struct TimeSeriesStorage {
+  using type = std::vector<T, ou::allocator<T, heap<T> > >;
+};
+
+// these build up over a session in Watch and in the collectors
+template<> struct TimeSeriesStorage<Quote> { using type = SegmentedVector<Quote, huge_page<Quote> >; };
+template<> struct TimeSeriesStorage<Trade> { using type = SegmentedVector<Trade, huge_page<Trade> >; };
+template<> struct TimeSeriesStorage<DepthByOrder> { using type = SegmentedVector<DepthByOrder, huge_page<DepthByOrder> >; };
+
 template<typename T=ou::tf::DatedDatum>
 class TimeSeries:
   public TimeSeriesBase
@@ -102,7 +118,7 @@ public:
 
   using allocator_t = typename ou::allocator<T, heap<T> >;
 
-  using vTimeSeries_t = typename std::vector<T, allocator_t>;
+  using vTimeSeries_t = typename TimeSeriesStorage<T>::type;
 
   using size_type = typename vTimeSeries_t::size_type;
 
@@ -128,7 +144,7 @@ public:
   void Resize( size_type Size ) { m_vSeries.resize( Size );  }
 
   void Sort(); // use when loaded from external data
-  void Flip() { reverse( m_vSeries.begin(), m_vSeries.end() ); }
+  void Flip() { std::reverse( m_vSeries.begin(), m_vSeries.end() ); }
 
   // these three methods update m_vIterator, used mostly with MergeDatedDatumCarrier, (const can't be used)
   // TODO: convert to lamdda visitor
@@ -182,6 +198,10 @@ public:
     }
   }
 
+  // f( const T*, size_type ) for each contiguous run, a single run with std::vector storage
+  template<typename F>
+  void ForEachSegment( F&& f ) const { Segments( m_vSeries, f ); }
+
   void ForEachReverse( fForEach_t&& f ) const {
     for (
       typename vTimeSeries_t::const_reverse_iterator iter = m_vSeries.rbegin();
@@ -203,6 +223,14 @@ private:
   vTimeSeries_t m_vSeries;
   const_iterator m_vIterator;  // belongs after vector declaration
 
+  template<typename F, typename A>
+  static void Segments( const std::vector<T, A>& v, F& f ) {
+    if ( !v.empty() ) f( v.data(), v.size() );
+  }
+
+  template<typename F, typename P>
+  static void Segments( const SegmentedVector<T, P>& v, F& f ) { v.ForEachSegment( f ); }
+
 };
 
 template<typename T>
@@ -264,7 +292,7 @@ void TimeSeries<T>::Insert( const dt_t& dt, const T& datum ) {
   T key( dt );
   std::pair<iterator, iterator> p;
   //strict_lock<TimeSeries<T> > guard(*this);
-  p = equal_range( m_vSeries.begin(), m_vSeries.end(), key );
+  p = std::equal_range( m_vSeries.begin(), m_vSeries.end(), key );
   if ( m_vSeries.end() == p.second ) {
     m_vSeries.push_back( datum );
   }
@@ -277,7 +305,7 @@ template<typename T>
 void TimeSeries<T>::Insert( const T& datum ) {
   std::pair<iterator, iterator> p;
   //strict_lock<TimeSeries<T> > guard(*this);
-  p = equal_range( m_vSeries.begin(), m_vSeries.end(), datum );
+  p = std::equal_range( m_vSeries.begin(), m_vSeries.end(), datum );
   if ( m_vSeries.end() == p.second ) {
     m_vSeries.push_back( datum );
   }
@@ -366,7 +394,7 @@ typename TimeSeries<T>::const_reference TimeSeries<T>::At( const dt_t& dt ) {
   // TODO: Check that this is correct
   T key( dt );
   std::pair<iterator, iterator> p;
-  p = equal_range( m_vSeries.begin(), m_vSeries.end(), key );
+  p = std::equal_range( m_vSeries.begin(), m_vSeries.end(), key );
 //  if ( p.first != p.second ) {
 //    m_vIterator = p.first;
 //  }
@@ -383,7 +411,7 @@ typename TimeSeries<T>::const_iterator TimeSeries<T>::AtOrAfter( const dt_t &dt
   T key( dt );
   std::pair<const_iterator, const_iterator> p;
   //strict_lock<TimeSeries<T> > guard(*this);
-  p = equal_range( m_vSeries.begin(), m_vSeries.end(), key );
+  p = std::equal_range( m_vSeries.begin(), m_vSeries.end(), key );
 //  if ( p.first != p.second ) {
 //    m_vIterator = p.first;
 //  }
@@ -399,14 +427,14 @@ typename TimeSeries<T>::const_iterator TimeSeries<T>::After( const dt_t &dt ) co
   T key( dt );
   std::pair<const_iterator, const_iterator> p;
   //strict_lock<TimeSeries<T> > guard(*this);
-  p = equal_range( m_vSeries.begin(), m_vSeries.end(), key );
+  p = std::equal_range( m_vSeries.begin(), m_vSeries.end(), key );
   return p.second;
 }
 
 template<typename T>
 void TimeSeries<T>::Sort() {
   //strict_lock<TimeSeries<T> > guard(*this);
-  sort( m_vSeries.begin(), m_vSeries.end() );  // may not keep time series with identical keys in acquired order (may not be an issue, as external clock is written to be monotonically increasing)
+  std::sort( m_vSeries.begin(), m_vSeries.end() );  // may not keep time series with identical keys in acquired order (may not be an issue, as external clock is written to be monotonically increasing)
 }
 
 template<typename T>
@@ -415,7 +443,7 @@ TimeSeries<T>* TimeSeries<T>::Subset( const dt_t &dt ) {
   TimeSeries<T>* series = nullptr;
   const_iterator iter;
   //strict_lock<TimeSeries<T> > guard(*this);
-  iter = lower_bound( m_vSeries.begin(), m_vSeries.end(), datum );
+  iter = std::lower_bound( m_vSeries.begin(), m_vSeries.end(), datum );
   if ( m_vSeries.end() != iter ) {
     series = new TimeSeries<T>( (unsigned int) (m_vSeries.end() - iter) );
     while ( m_vSeries.end() != iter ) {
@@ -435,7 +463,7 @@ TimeSeries<T>* TimeSeries<T>::Subset( const dt_t &dt, unsigned int n ) { // n is
   TimeSeries<T>* series = NULL;
   const_iterator iter;
   //strict_lock<TimeSeries<T> > guard(*this);
-  iter = lower_bound( m_vSeries.begin(), m_vSeries.end(), datum );
+  iter = std::lower_bound( m_vSeries.begin(), m_vSeries.end(), datum );
   if ( m_vSeries.end() != iter ) {
     unsigned int todo = std::min<unsigned int>( n, (unsigned int) ( m_vSeries.end() - iter ) );
     series = new TimeSeries<T>( todo );
@@ -46,8 +46,11 @@ AccountManager::pAccountAdvisor_t AccountManager::ConstructAccountAdvisor( const
   }
   else {
     m_mapAccountAdvisor.insert( pairAccountAdvisor_t( idAdvisor, p ) );
-    ou::db::QueryFields<AccountAdvisor::TableRowDef>::pQueryFields_t pQuery
-      = m_pSession->Insert<AccountAdvisor::TableRowDef>( const_cast<AccountAdvisor::TableRowDef&>( p->GetRow() ) );
+    m_pSession->Journal().Exclusive( // outside of the writer's batch
+      [&p]( ou::db::Session& session ){
+        ou::db::QueryFields<AccountAdvisor::TableRowDef>::pQueryFields_t pQuery
+          = session.Insert<AccountAdvisor::TableRowDef>( const_cast<AccountAdvisor::TableRowDef&>( p->GetRow() ) );
+      } );
   }
 
   return p;
@@ -117,8 +120,11 @@ AccountManager::pAccountOwner_t AccountManager::ConstructAccountOwner(
   }
   else {
     m_mapAccountOwner.insert( pairAccountOwner_t( idAccountOwner, p ) );
-    ou::db::QueryFields<AccountOwner::TableRowDef>::pQueryFields_t pQuery
-      = m_pSession->Insert<AccountOwner::TableRowDef>( const_cast<AccountOwner::TableRowDef&>( p->GetRow() ) );
+    m_pSession->Journal().Exclusive( // outside of the writer's batch
+      [&p]( ou::db::Session& session ){
+        ou::db::QueryFields<AccountOwner::TableRowDef>::pQueryFields_t pQuery
+          = session.Insert<AccountOwner::TableRowDef>( const_cast<AccountOwner::TableRowDef&>( p->GetRow() ) );
+      } );
   }
 
   return p;
@@ -190,8 +196,11 @@ AccountManager::pAccount_t AccountManager::ConstructAccount(
   }
   else {
     m_mapAccount.insert( pairAccount_t( idAccount, p ) );
-    ou::db::QueryFields<Account::TableRowDef>::pQueryFields_t pQuery
-      = m_pSession->Insert<Account::TableRowDef>( const_cast<Account::TableRowDef&>( p->GetRow() ) );
+    m_pSession->Journal().Exclusive( // outside of the writer's batch
+      [&p]( ou::db::Session& session ){
+        ou::db::QueryFields<Account::TableRowDef>::pQueryFields_t pQuery
+          = session.Insert<Account::TableRowDef>( const_cast<Account::TableRowDef&>( p->GetRow() ) );
+      } );
   }
 
   return p;
@@ -39,8 +39,11 @@ CashManager::pCashAccount_t CashManager::ConstructCashAccount( const idAccount_t
   }
   else {
     mapCashAccount.insert( pairCashAccount_t( key, p ) );
-    ou::db::QueryFields<CashAccount::TableRowDef>::pQueryFields_t pQuery
-      = m_pSession->Insert<CashAccount::TableRowDef>( const_cast<CashAccount::TableRowDef&>( p->GetRow() ) );
+    m_pSession->Journal().Exclusive( // outside of the writer's batch
+      [&p]( ou::db::Session& session ){
+        ou::db::QueryFields<CashAccount::TableRowDef>::pQueryFields_t pQuery
+          = session.Insert<CashAccount::TableRowDef>( const_cast<CashAccount::TableRowDef&>( p->GetRow() ) );
+      } );
   }
 
   return p;
@@ -74,7 +74,7 @@ struct OptionsQueryParameters {
     ou::db::Field( a, "month", nMonth );
     ou::db::Field( a, "day", nDay );
   }
-  const ou::tf::keytypes::idInstrument_t& idInstrument;
+  ou::tf::keytypes::idInstrument_t idInstrument;
   boost::uint16_t nYear, nMonth, nDay;
   ou::tf::InstrumentType::EInstrumentType eType;
   OptionsQueryParameters( const ou::tf::keytypes::idInstrument_t& id, boost::uint16_t nYear_, boost::uint16_t nMonth_, boost::uint16_t nDay_ )
@@ -88,12 +88,11 @@ bool DBOps::LoadOptions( idInstrument_cref sInstrumentName, boost::uint16_t nYea
   OptionsQueryParameters query( sInstrumentName, nYear, nMonth, nDay );
 
   ou::db::QueryFields<OptionsQueryParameters>::pQueryFields_t pQuery
-    = SQL<OptionsQueryParameters>(
-      "select * from instruments", query ).Where( "instrumentid=? and type=? and year=? and month=? and day=?" ).OrderBy( "strike, optionside" ).NoExecute();
+    = Cached<OptionsQueryParameters>(
+      "select * from instruments WHERE instrumentid=? and type=? and year=? and month=? and day=? ORDER BY strike, optionside", query );
 
   ou::tf::Instrument::TableRowDef instrument;  // can we put stuff directly into object?
   ou::tf::Instrument::pInstrument_t pInstrument;
-  Bind<OptionsQueryParameters>( pQuery );
   if ( Execute( pQuery ) ) {
     bFound = true;
     if ( NULL != OnNewInstrument ) {
@@ -105,6 +104,7 @@ bool DBOps::LoadOptions( idInstrument_cref sInstrumentName, boost::uint16_t nYea
       while ( Execute( pQuery ) );
     }
   }
+  Reset( pQuery ); // cached, so release the read
 
   return bFound;
 
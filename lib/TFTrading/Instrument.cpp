@@ -115,6 +115,7 @@ std::string Instrument::BuildGenericFutureName( const std::string& sUnderlying,
 
 Instrument::Instrument( const TableRowDef& row )
 : m_row( row )
+, m_idIntern( InstrumentIntern::Instance().Intern( m_row.idInstrument ) )
 , m_dtrTimeLiquid( dtDefault, dtDefault )
 , m_dtrTimeTrading( dtDefault, dtDefault )
 {
@@ -137,6 +138,7 @@ Instrument::Instrument( const TableRowDef& row )
 // just enough to obtain fundamentals
 Instrument::Instrument( idInstrument_cref idInstrument )
 : m_row( idInstrument )
+, m_idIntern( InstrumentIntern::Instance().Intern( m_row.idInstrument ) )
 , m_dtrTimeLiquid( dtDefault, dtDefault ),  m_dtrTimeTrading( dtDefault, dtDefault )
 {}
 
@@ -147,6 +149,7 @@ Instrument::Instrument(
 , const idExchange_t &idExchange
 )
 : m_row( idInstrument, eType, idExchange )
+, m_idIntern( InstrumentIntern::Instance().Intern( m_row.idInstrument ) )
 , m_dtrTimeLiquid( dtDefault, dtDefault ),  m_dtrTimeTrading( dtDefault, dtDefault )
 {}
 
@@ -158,6 +161,7 @@ Instrument::Instrument(
 , boost::uint16_t year, boost::uint16_t month, boost::uint16_t day
 )
 : m_row( idInstrument, eType, idExchange, year, month, day )
+, m_idIntern( InstrumentIntern::Instance().Intern( m_row.idInstrument ) )
 , m_dtrTimeLiquid( dtDefault, dtDefault ),  m_dtrTimeTrading( dtDefault, dtDefault )
 {
   //assert( 0 < m_sSymbolName.size() );
@@ -176,6 +180,7 @@ Instrument::Instrument(
 : m_row(
   idInstrument, eType, idExchange
 , year, month, day, eOptionSide, dblStrike )
+, m_idIntern( InstrumentIntern::Instance().Intern( m_row.idInstrument ) )
 , m_dtrTimeLiquid( dtDefault, dtDefault ),  m_dtrTimeTrading( dtDefault, dtDefault )
 {
   //assert( 0 < m_sExchange.size() );
@@ -197,6 +202,7 @@ Instrument::Instrument(
 , eOptionSide
 , dblStrike
 )
+, m_idIntern( InstrumentIntern::Instance().Intern( m_row.idInstrument ) )
 , m_dtrTimeLiquid( dtDefault, dtDefault )
 , m_dtrTimeTrading( dtDefault, dtDefault )
 {
@@ -216,11 +222,13 @@ Instrument::Instrument(
   idInstrument
 //  idCounterInstrument,
 , eType, idExchange, base, counter )
+, m_idIntern( InstrumentIntern::Instance().Intern( m_row.idInstrument ) )
 , m_dtrTimeLiquid( dtDefault, dtDefault ),  m_dtrTimeTrading( dtDefault, dtDefault )
 {}
 
 Instrument::Instrument( const Instrument& instrument )
 : m_row( instrument.m_row )
+, m_idIntern( instrument.m_idIntern )
 , m_dtrTimeLiquid( dtDefault, dtDefault ), m_dtrTimeTrading( dtDefault, dtDefault )
 {
   mapAlternateNames_t::const_iterator iter = instrument.m_mapAlternateNames.begin();
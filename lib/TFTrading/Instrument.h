@@ -31,8 +31,11 @@
 
 #include <OUSQL/Functions.h>
 
+#include <TFTimeSeries/PriceTick.h>
+
 #include "TradingEnumerations.h"
 #include "KeyTypes.h"
+#include "InstrumentIntern.h"
 
 namespace ou { // One Unified
 namespace tf { // TradeFrame
@@ -44,6 +47,7 @@ public:
   using idExchange_t = keytypes::idExchange_t;
   using idInstrument_t = keytypes::idInstrument_t;
   using idInstrument_cref = const idInstrument_t&;
+  using idIntern_t = keytypes::idIntern_t;
   using pInstrument_t = std::shared_ptr<Instrument>;
   using pInstrument_cref = const pInstrument_t&;
 
@@ -233,6 +237,7 @@ public:
 
   idInstrument_cref GetInstrumentName( eidProvider_t id ) const;
   idInstrument_cref GetInstrumentName() const { return m_row.idInstrument; };
+  idIntern_t GetInternId() const { return m_idIntern; }; // dense id of the instrument name, see InstrumentIntern
 
   void SetAlternateName( eidProvider_t, idInstrument_cref );
 
@@ -284,6 +289,7 @@ public:
 
   void SetMinTick( double dblMinTick ) { m_row.dblMinTick = dblMinTick; };
   double GetMinTick() const { return m_row.dblMinTick; };
+  ou::tf::TickScale GetTickScale() const { return ou::tf::TickScale( m_row.dblMinTick ); } // price <-> PriceTick
   double NormalizeOrderPrice( double price ) const;
   static double NormalizeOrderPrice( double price, double interval );
 
@@ -313,6 +319,7 @@ protected:
 private:
 
   TableRowDef m_row;
+  const idIntern_t m_idIntern; // assigned from m_row.idInstrument, which does not change
 
   using mapAlternateNames_t = std::map<eidProvider_t, idInstrument_t>;
   mapAlternateNames_t m_mapAlternateNames;
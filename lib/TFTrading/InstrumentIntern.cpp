@@ -0,0 +1,80 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    InstrumentIntern.cpp
+ * Author:  raymond@burkholder.net
+ * Project: TFTrading
+ * Created: October 19, 2026 23:40 PM
+ */
+
+#include <mutex>
+#include <limits>
+#include <stdexcept>
+
+#include "InstrumentIntern.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+InstrumentIntern::InstrumentIntern() {
+  m_mapId.reserve( 16 * 1024 );
+}
+
+InstrumentIntern& InstrumentIntern::Instance() {
+  static InstrumentIntern intern; // constructed on first use, so available to static instruments
+  return intern;
+}
+
+InstrumentIntern::id_t InstrumentIntern::Intern( const idInstrument_t& sName ) {
+  {
+    std::shared_lock<std::shared_mutex> lock( m_mutex );
+    mapId_t::const_iterator iter = m_mapId.find( sName );
+    if ( m_mapId.end() != iter ) return iter->second;
+  }
+  std::unique_lock<std::shared_mutex> lock( m_mutex );
+  mapId_t::const_iterator iter = m_mapId.find( sName ); // may have been added while unlocked
+  if ( m_mapId.end() != iter ) return iter->second;
+  if ( std::numeric_limits<id_t>::max() <= m_dequeName.size() ) {
+    throw std::runtime_error( "InstrumentIntern::Intern ids exhausted" );
+  }
+  const id_t id( m_dequeName.size() );
+  m_dequeName.push_back( sName );
+  m_mapId.emplace( sName, id );
+  return id;
+}
+
+bool InstrumentIntern::Find( const idInstrument_t& sName, id_t& id ) const {
+  std::shared_lock<std::shared_mutex> lock( m_mutex );
+  mapId_t::const_iterator iter = m_mapId.find( sName );
+  if ( m_mapId.end() == iter ) return false;
+  id = iter->second;
+  return true;
+}
+
+const InstrumentIntern::idInstrument_t& InstrumentIntern::Name( id_t id ) const {
+  std::shared_lock<std::shared_mutex> lock( m_mutex );
+  if ( m_dequeName.size() <= id ) {
+    throw std::runtime_error( "InstrumentIntern::Name unknown id " + std::to_string( id ) );
+  }
+  return m_dequeName[ id ];
+}
+
+size_t InstrumentIntern::Size() const {
+  std::shared_lock<std::shared_mutex> lock( m_mutex );
+  return m_dequeName.size();
+}
+
+} // namespace tf
+} // namespace ou
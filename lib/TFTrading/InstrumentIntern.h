@@ -0,0 +1,102 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    InstrumentIntern.h
+ * Author:  raymond@burkholder.net
+ * Project: TFTrading
+ * Created: October 19, 2026 23:40 PM
+ */
+
+#pragma once
+
+// process wide table of instrument names, each name is assigned a dense id on first sight
+//   Instrument obtains its id on construction, so the id is available wherever the instrument is,
+//   and lookups between layers can index a vector rather than hash or compare a string
+// ids are never recycled, a name keeps its id for the life of the process
+// strings are needed only at the api boundary: wire messages, databases, user input
+
+#include <deque>
+#include <string>
+#include <vector>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "KeyTypes.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+class InstrumentIntern {
+public:
+
+  using id_t = keytypes::idIntern_t;
+  using idInstrument_t = keytypes::idInstrument_t;
+
+  static InstrumentIntern& Instance();
+
+  id_t Intern( const idInstrument_t& ); // assigns an id if the name is new
+  bool Find( const idInstrument_t&, id_t& ) const; // without assigning
+  const idInstrument_t& Name( id_t ) const; // reference remains valid for the life of the process
+  size_t Size() const;
+
+protected:
+private:
+
+  mutable std::shared_mutex m_mutex;
+
+  using mapId_t = std::unordered_map<idInstrument_t, id_t>;
+  mapId_t m_mapId;
+
+  using dequeName_t = std::deque<idInstrument_t>; // stable references as names are added
+  dequeName_t m_dequeName;
+
+  InstrumentIntern();
+  InstrumentIntern( const InstrumentIntern& ) = delete;
+  InstrumentIntern& operator=( const InstrumentIntern& ) = delete;
+};
+
+// a dense vector indexed by interned id, for a single owner, or with the owner's locking
+//   slots not set return a default constructed T
+template<typename T>
+class InternVector {
+public:
+
+  using id_t = InstrumentIntern::id_t;
+
+  const T& Get( id_t id ) const {
+    return ( id < m_vT.size() ) ? m_vT[ id ] : m_empty;
+  }
+
+  T& Slot( id_t id ) { // grows as required
+    if ( m_vT.size() <= id ) {
+      m_vT.resize( id + 1 );
+    }
+    return m_vT[ id ];
+  }
+
+  void Reset( id_t id ) {
+    if ( id < m_vT.size() ) m_vT[ id ] = T();
+  }
+
+  void Clear() { m_vT.clear(); }
+
+protected:
+private:
+  std::vector<T> m_vT;
+  const T m_empty {};
+};
+
+} // namespace tf
+} // namespace ou
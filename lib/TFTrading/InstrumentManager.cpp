@@ -32,6 +32,7 @@ InstrumentManager::~InstrumentManager() {
     iter->second->OnAlternateNameChanged.Remove( MakeDelegate( this, &InstrumentManager::HandleAlternateNameChanged ) );
   }
   m_mapInstruments.clear();
+  m_vInstruments.Clear();
 }
 
 InstrumentManager::pInstrument_t InstrumentManager::ConstructInstrument(
@@ -93,14 +94,20 @@ void InstrumentManager::Register( pInstrument_t& pInstrument ) {
   }
   Assign( pInstrument );
   if ( nullptr != inherited_t::m_pSession ) {
-    ou::db::QueryFields<Instrument::TableRowDef>::pQueryFields_t pQuery
-      = m_pSession->Insert<Instrument::TableRowDef>( const_cast<Instrument::TableRowDef&>( pInstrument->GetRow() ) );
-    // save alternate instrument names
-    pInstrument->ScanAlternateNames(
-      boost::phoenix::bind(
-        static_cast<void(InstrumentManager::*)(const keytypes::eidProvider_t&, const keytypes::idInstrument_t&, const keytypes::idInstrument_t&, pInstrument_t)>(&InstrumentManager::SaveAlternateInstrumentName),
-          this, boost::phoenix::arg_names::arg1, boost::phoenix::arg_names::arg2, boost::phoenix::arg_names::arg3, pInstrument
-        ) );
+    m_pSession->Journal().Exclusive( // own transaction, so not inside the writer's batch
+      [this,&pInstrument]( ou::db::Session& session ){
+        ou::db::Session::Transaction transaction( session ); // instrument and alternate names together
+        ou::db::QueryFields<Instrument::TableRowDef>::pQueryFields_t pQuery
+          = session.CachedInsert<Instrument::TableRowDef>( pInstrument->GetRow() );
+        session.Execute( pQuery );
+        // save alternate instrument names
+        pInstrument->ScanAlternateNames(
+          boost::phoenix::bind(
+            static_cast<void(InstrumentManager::*)(const keytypes::eidProvider_t&, const keytypes::idInstrument_t&, const keytypes::idInstrument_t&, pInstrument_t)>(&InstrumentManager::SaveAlternateInstrumentName),
+              this, boost::phoenix::arg_names::arg1, boost::phoenix::arg_names::arg2, boost::phoenix::arg_names::arg3, pInstrument
+            ) );
+        transaction.Commit();
+      } );
   }
 }
 
@@ -125,7 +132,8 @@ void InstrumentManager::SaveAlternateInstrumentName(
     const AlternateInstrumentName::TableRowDef row( idProvider, idAlternate, idInstrument );
     if ( nullptr != m_pSession ) {
       ou::db::QueryFields<AlternateInstrumentName::TableRowDef>::pQueryFields_t pQuery
-        = m_pSession->Insert<AlternateInstrumentName::TableRowDef>( const_cast<AlternateInstrumentName::TableRowDef&>( row ) );
+        = m_pSession->CachedInsert<AlternateInstrumentName::TableRowDef>( row );
+      m_pSession->Execute( pQuery );
     }
   }
 }
@@ -137,6 +145,7 @@ void InstrumentManager::Assign( pInstrument_cref pInstrument ) {
   }
   else {
     m_mapInstruments.insert( mapInstruments_t::value_type( pInstrument->GetInstrumentName(), pInstrument ) );
+    m_vInstruments.Slot( pInstrument->GetInternId() ) = pInstrument;
   }
   pInstrument->OnAlternateNameAdded.Add( MakeDelegate( this, &InstrumentManager::HandleAlternateNameAdded ) );
   pInstrument->OnAlternateNameChanged.Add( MakeDelegate( this, &InstrumentManager::HandleAlternateNameChanged ) );
@@ -161,6 +170,12 @@ InstrumentManager::pInstrument_t InstrumentManager::Get( idInstrument_cref idNam
   return pInstrument;
 }
 
+InstrumentManager::pInstrument_t InstrumentManager::Get( idIntern_t id ) {
+  const pInstrument_t& pInstrument( m_vInstruments.Get( id ) );
+  if ( pInstrument ) return pInstrument;
+  return Get( InstrumentIntern::Instance().Name( id ) ); // may be loaded from the database
+}
+
 bool InstrumentManager::Exists( idInstrument_cref id ) {  // todo:  cache the query to make the get faster rather than searching the map again
   //std::lock_guard<std::mutex> lock( m_mutex );
   bool bFound = ( m_mapInstruments.end() != m_mapInstruments.find( id ) );
@@ -174,6 +189,7 @@ bool InstrumentManager::Exists( idInstrument_cref id ) {  // todo:  cache the qu
 }
 
 bool InstrumentManager::Exists( pInstrument_cref pInstrument ) {
+  if ( m_vInstruments.Get( pInstrument->GetInternId() ) ) return true;
   return Exists( pInstrument->GetInstrumentName() );
 }
 
@@ -199,24 +215,23 @@ struct InstrumentKey {
   void Fields( A& a ) {
     ou::db::Field( a, "instrumentid", idInstrument );
   }
-  const ou::tf::keytypes::idInstrument_t& idInstrument;
+  ou::tf::keytypes::idInstrument_t idInstrument;
   InstrumentKey( const ou::tf::keytypes::idInstrument_t& idInstrument_ ): idInstrument( idInstrument_ ) {};
 };
 
 bool InstrumentManager::LoadInstrument( idInstrument_t id, pInstrument_t& pInstrument ) {
   std::lock_guard<std::mutex> lock( m_mutexLoadInstrument );
-      // TODO: need transaction when writing instrument, underlying, and alternate names to database to ensure consistency
   assert( nullptr != m_pSession );
   assert( m_mapInstruments.end() == m_mapInstruments.find( id ) );  // ensures we havn't already loaded an instrument
 
   bool bFound = false;
   InstrumentKey idInstrument( id );
   ou::db::QueryFields<InstrumentKey>::pQueryFields_t pExistsQuery // shouldn't do a * as fields may change order
-    = m_pSession->SQL<InstrumentKey>( "select * from instruments", idInstrument ).Where( "instrumentid = ?" ).NoExecute();
-  m_pSession->Bind<InstrumentKey>( pExistsQuery );
+    = m_pSession->Cached<InstrumentKey>( "select * from instruments WHERE instrumentid = ?", idInstrument );
   if ( m_pSession->Execute( pExistsQuery ) ) {  // <- need to be able to execute on query pointer, since there is session pointer in every query
     Instrument::TableRowDef instrument;
     m_pSession->Columns<InstrumentKey, Instrument::TableRowDef>( pExistsQuery, instrument );
+    m_pSession->Reset( pExistsQuery ); // cached, so release the read
       pInstrument = std::make_shared<Instrument>( instrument );
       Assign( pInstrument );
       LoadAlternateInstrumentNames( pInstrument );  // comes after assign
@@ -231,8 +246,8 @@ struct AltNameKey {
     ou::db::Field( a, "providerid", idProvider ); // part of unique key
     ou::db::Field( a, "alternateid", idAlternate ); // part of unique key
   }
-  const ou::tf::keytypes::eidProvider_t& idProvider;
-  const ou::tf::keytypes::idInstrument_t& idAlternate;
+  ou::tf::keytypes::eidProvider_t idProvider;
+  ou::tf::keytypes::idInstrument_t idAlternate;
   AltNameKey(
     const ou::tf::keytypes::eidProvider_t& idProvider_,
     const ou::tf::keytypes::idInstrument_t& idAlternate_
@@ -253,14 +268,13 @@ struct InstrumentName {
 InstrumentManager::pInstrument_t InstrumentManager::LoadInstrument( keytypes::eidProvider_t idProvider, const idInstrument_t& idInstrument ) {
   pInstrument_t pInstrument;
   AltNameKey key( idProvider, idInstrument );
-  ou::db::QueryFields<AltNameKey>::pQueryFields_t pExistsQuery
-    = m_pSession->SQL<AltNameKey>( "select instrumentid from altinstrumentnames", key )
-        .Where( "providerid = ? and alternateid = ?" ).NoExecute();
   if ( m_pSession ) {
-    m_pSession->Bind<AltNameKey>( pExistsQuery );
+    ou::db::QueryFields<AltNameKey>::pQueryFields_t pExistsQuery
+      = m_pSession->Cached<AltNameKey>( "select instrumentid from altinstrumentnames WHERE providerid = ? and alternateid = ?", key );
     InstrumentName result;
     if ( m_pSession->Execute( pExistsQuery ) ) { // should only be once
       m_pSession->Columns<AltNameKey, InstrumentName>( pExistsQuery, result );
+      m_pSession->Reset( pExistsQuery ); // cached, so release the read
       //LoadInstrument( result.idInstrument, pInstrument );
       bool bFound = Exists( result.idInstrument, pInstrument );
     }
@@ -278,8 +292,7 @@ void InstrumentManager::LoadAlternateInstrumentNames( pInstrument_t& pInstrument
   assert( pInstrument );
   InstrumentKey idInstrument( pInstrument->GetInstrumentName() );
   ou::db::QueryFields<InstrumentKey>::pQueryFields_t pExistsQuery // shouldn't do a * as fields may change order
-     = m_pSession->SQL<InstrumentKey>( "select * from altinstrumentnames", idInstrument ).Where( "instrumentid = ?" ).NoExecute();
-  m_pSession->Bind<InstrumentKey>( pExistsQuery );
+     = m_pSession->Cached<InstrumentKey>( "select * from altinstrumentnames WHERE instrumentid = ?", idInstrument );
   AlternateInstrumentName::TableRowDef altname;
   while ( m_pSession->Execute( pExistsQuery ) ) {
     m_pSession->Columns<InstrumentKey, AlternateInstrumentName::TableRowDef>( pExistsQuery, altname );
@@ -353,15 +366,14 @@ void InstrumentManager::HandlePopulateTables( ou::db::Session& session ) {
 
   std::vector<std::string>::iterator iter = vsExchangesPreload.begin();
 
-  ou::db::QueryFields<Exchange::TableRowDef>::pQueryFields_t pExchange = session.Insert<Exchange::TableRowDef>( exchange ).NoExecute();
-
+  ou::db::Session::Transaction transaction( session );
   while ( vsExchangesPreload.end() != iter ) {
     exchange.idExchange = *(iter++);
     exchange.sName = *(iter++);
-    session.Reset( pExchange );
-    session.Bind<Exchange::TableRowDef>( pExchange );
+    ou::db::QueryFields<Exchange::TableRowDef>::pQueryFields_t pExchange = session.CachedInsert<Exchange::TableRowDef>( exchange );
     session.Execute( pExchange );
   }
+  transaction.Commit();
 
 }
 
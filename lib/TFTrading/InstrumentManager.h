@@ -40,6 +40,7 @@ public:
   using pInstrument_cref = Instrument::pInstrument_cref;
   using idInstrument_t = Instrument::idInstrument_t;
   using idInstrument_cref = Instrument::idInstrument_cref;
+  using idIntern_t = Instrument::idIntern_t;
 
   InstrumentManager();
   virtual ~InstrumentManager();
@@ -72,6 +73,7 @@ public:
   bool Exists( idInstrument_cref, pInstrument_t& );
   bool Exists( pInstrument_cref );
   pInstrument_t Get( idInstrument_cref ); // for getting existing associated with id
+  pInstrument_t Get( idIntern_t ); // by Instrument::GetInternId, without a string lookup once assigned
   void Delete( idInstrument_cref );
 
   pInstrument_t LoadInstrument( keytypes::eidProvider_t, const idInstrument_t& ); // may have exeption?
@@ -93,6 +95,9 @@ private:
   using iterInstruments_t = mapInstruments_t::iterator;
   mapInstruments_t m_mapInstruments;
 
+  using vInstruments_t = InternVector<pInstrument_t>; // instruments assigned, by interned id
+  vInstruments_t m_vInstruments;
+
   using keyAltName_t = std::pair<keytypes::eidProvider_t, std::string>;
   using keyAltName_ref_t = std::pair<const keytypes::eidProvider_t&, const std::string&>;
   struct keyAltName_compare {
@@ -25,6 +25,7 @@ namespace keytypes { // KeyTypes
 
 // InstrumentManager
 using idInstrument_t = std::string;
+using idIntern_t = boost::uint32_t; // dense id per instrument name, InstrumentIntern
 using idExchange_t = std::string;
 // AccountManager
 using idAccountAdvisor_t = std::string;
@@ -38,7 +39,7 @@ using idCurrency_t = std::string;  // three character designation
 //typedef boost::uint16_t idProvider_t;  // identifies instance of a provider
 using idProvider_t = idAccount_t;
 enum eidProvider_t {
-  EProviderUnknown=0, EProviderSimulator=100, EProviderIQF, EProviderIB, EProviderGNDT, EProviderCalc, EProviderAlpaca, EProviderPhemex
+  EProviderUnknown=0, EProviderSimulator=100, EProviderIQF, EProviderIB, EProviderGNDT, EProviderCalc, EProviderAlpaca, EProviderPhemex, EProviderBus
 , EProviderUserBase=900/*, _EProviderCount*/ };
 // PortfolioManager
 using idPortfolio_t = std::string;
@@ -24,6 +24,8 @@
 
 #include <boost/asio/post.hpp>
 
+#include <OUCommon/Latency.h>
+
 #define STRAND( command ) \
   if ( m_bStrand ) {      \
     boost::asio::post(    \
@@ -37,12 +39,17 @@
     command;              \
   }
 
+// the latency trace, if any, follows the datum onto the strand
 #define STRAND_CAPTURE( command, capture ) \
   if ( m_bStrand ) {      \
+    const ou::latency::Trace trace( ou::latency::Capture() ); \
     boost::asio::post(    \
       *m_pStrand,         \
-      [this,capture](){   \
+      [this,capture,trace](){ \
+        ou::latency::Resume( trace ); \
+        ou::latency::Mark( ou::latency::EStage::Strand ); \
         command;          \
+        ou::latency::End(); \
       }                   \
       );                  \
   }                       \
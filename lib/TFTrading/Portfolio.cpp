@@ -198,15 +198,15 @@ void Portfolio::RemoveSubPortfolio( const idPortfolio_t& idPortfolio ) {
 
   mapPortfolios_iter_t iter = m_mapSubPortfolios.find( idPortfolio );
 
-  if ( m_mapSubPortfolios.end() != iter ) {
+  if ( m_mapSubPortfolios.end() == iter ) {
     throw std::runtime_error( "Portfolio::RemoveSubPortfolio portfolio does not exist: " + idPortfolio );
   }
 
   Portfolio* pPortfolio = iter->second.get();
 
-  pPortfolio->OnCommission.Add( MakeDelegate( this, &Portfolio::HandleCommission ) );
-  pPortfolio->OnExecution.Add( MakeDelegate( this, &Portfolio::HandleExecution ) );
-  pPortfolio->OnUnRealizedPL.Add( MakeDelegate( this, &Portfolio::HandleUnRealizedPL ) );
+  pPortfolio->OnCommission.Remove( MakeDelegate( this, &Portfolio::HandleCommission ) );
+  pPortfolio->OnExecution.Remove( MakeDelegate( this, &Portfolio::HandleExecution ) );
+  pPortfolio->OnUnRealizedPL.Remove( MakeDelegate( this, &Portfolio::HandleUnRealizedPL ) );
 
   m_mapSubPortfolios.erase( iter );
 }
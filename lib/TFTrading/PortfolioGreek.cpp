@@ -25,35 +25,99 @@ namespace tf { // TradeFrame
 
 PortfolioGreek::PortfolioGreek( const idPortfolio_t& idPortfolio, const idAccountOwner_t& idAccountOwner, const idPortfolio_t& idOwner, EPortfolioType ePortfolioType_, 
     currency_t eCurrency, const std::string& sDescription )
-: Portfolio( idPortfolio, idAccountOwner, idOwner, ePortfolioType_, eCurrency, sDescription )
+: Portfolio( idPortfolio, idAccountOwner, idOwner, ePortfolioType_, eCurrency, sDescription ),
+  m_bDirty( false )
 {
+  OnUnRealizedPLUpdate.Add( MakeDelegate( this, &PortfolioGreek::HandlePLUpdate ) );
+  OnExecutionUpdate.Add( MakeDelegate( this, &PortfolioGreek::HandlePLUpdate ) );
+  OnCommissionUpdate.Add( MakeDelegate( this, &PortfolioGreek::HandlePLUpdate ) );
 }
 
 PortfolioGreek::~PortfolioGreek( ) {
+  OnCommissionUpdate.Remove( MakeDelegate( this, &PortfolioGreek::HandlePLUpdate ) );
+  OnExecutionUpdate.Remove( MakeDelegate( this, &PortfolioGreek::HandlePLUpdate ) );
+  OnUnRealizedPLUpdate.Remove( MakeDelegate( this, &PortfolioGreek::HandlePLUpdate ) );
+  for ( mapPositionGreek_t::value_type& vt: m_mapPositionGreek ) {
+    vt.second->OnExposureDelta.Remove( MakeDelegate( this, &PortfolioGreek::HandleExposureDelta ) );
+  }
+  for ( mapPortfolioGreek_t::value_type& vt: m_mapSubPortfolioGreek ) {
+    vt.second->OnExposureDelta.Remove( MakeDelegate( this, &PortfolioGreek::HandleExposureDelta ) );
+  }
 }
 
 PortfolioGreek::pPositionGreek_t PortfolioGreek::AddPosition( const std::string& sName, pPositionGreek_t pPositionGreek ) {
   Portfolio::AddPosition( sName, pPositionGreek );
+  m_mapPositionGreek[ sName ] = pPositionGreek;
+  pPositionGreek->OnExposureDelta.Add( MakeDelegate( this, &PortfolioGreek::HandleExposureDelta ) );
+  HandleExposureDelta( pPositionGreek->GetExposure() );  // initial contribution
   return pPositionGreek;
 }
 
 void PortfolioGreek::DeletePosition( const std::string& sName, pPositionGreek_t ) {
   Portfolio::DeletePosition( sName );
+  mapPositionGreek_t::iterator iter = m_mapPositionGreek.find( sName );
+  if ( m_mapPositionGreek.end() != iter ) {
+    iter->second->OnExposureDelta.Remove( MakeDelegate( this, &PortfolioGreek::HandleExposureDelta ) );
+    HandleExposureDelta( Exposure() - iter->second->GetExposure() );  // remove contribution
+    m_mapPositionGreek.erase( iter );
+  }
 }
-  
+
 void PortfolioGreek::AddSubPortfolio( pPortfolioGreek_t& pPortfolioGreek ) {
   pPortfolio_t pPortfolio( std::dynamic_pointer_cast<Portfolio>( pPortfolioGreek ) );
   Portfolio::AddSubPortfolio( pPortfolio );
+  m_mapSubPortfolioGreek[ pPortfolioGreek->GetRow().idPortfolio ] = pPortfolioGreek;
+  pPortfolioGreek->OnExposureDelta.Add( MakeDelegate( this, &PortfolioGreek::HandleExposureDelta ) );
+  HandleExposureDelta( pPortfolioGreek->GetExposure() );
 }
 
 void PortfolioGreek::RemoveSubPortfolio( const idPortfolio_t& idPortfolio ) {
   Portfolio::RemoveSubPortfolio( idPortfolio );
+  mapPortfolioGreek_t::iterator iter = m_mapSubPortfolioGreek.find( idPortfolio );
+  if ( m_mapSubPortfolioGreek.end() != iter ) {
+    iter->second->OnExposureDelta.Remove( MakeDelegate( this, &PortfolioGreek::HandleExposureDelta ) );
+    HandleExposureDelta( Exposure() - iter->second->GetExposure() );
+    m_mapSubPortfolioGreek.erase( iter );
+  }
+}
+
+void PortfolioGreek::HandleExposureDelta( const Exposure& delta ) {
+  m_exposure += delta;
+  m_bDirty = true;
+  OnExposureDelta( delta ); // propagate increment to owning portfolio
+}
+
+void PortfolioGreek::HandlePLUpdate( const Portfolio& ) {
+  m_bDirty = true;
+}
+
+void PortfolioGreek::Publish() {
+  for ( mapPortfolioGreek_t::value_type& vt: m_mapSubPortfolioGreek ) {
+    vt.second->Publish();
+  }
+  if ( m_bDirty ) {
+    m_bDirty = false;
+    // incremental sums accumulate rounding, restart from the current contributions
+    Exposure exposure;
+    for ( const mapPositionGreek_t::value_type& vt: m_mapPositionGreek ) {
+      exposure += vt.second->GetExposure();
+    }
+    for ( const mapPortfolioGreek_t::value_type& vt: m_mapSubPortfolioGreek ) {
+      exposure += vt.second->GetExposure();
+    }
+    m_exposure = exposure;
+    OnGreekUpdate( *this );
+  }
 }
 
 std::ostream& operator<<( std::ostream& os, const PortfolioGreek& portfolio ) {
 
-  os 
+  os
     << (Portfolio) portfolio
+    << ", Delta " << portfolio.GetExposure().dblDelta
+    << ", Gamma " << portfolio.GetExposure().dblGamma
+    << ", Theta " << portfolio.GetExposure().dblTheta
+    << ", Vega " << portfolio.GetExposure().dblVega
     ;
   return os;
 }
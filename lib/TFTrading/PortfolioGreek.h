@@ -40,6 +40,8 @@ public:
 
   using pPortfolioGreek_t = std::shared_ptr<PortfolioGreek>;
 
+  using Exposure = PositionGreek::Exposure;
+
   PortfolioGreek(
     const idPortfolio_t& idPortfolio, const idAccountOwner_t& idAccountOwner, const idPortfolio_t& idOwner, EPortfolioType ePortfolioType_,
     currency_t eCurrency, const std::string& sDescription );
@@ -51,9 +53,31 @@ public:
   void AddSubPortfolio( pPortfolioGreek_t& );
   void RemoveSubPortfolio( const idPortfolio_t& idPortfolio );
 
+  const Exposure& GetExposure() const { return m_exposure; }
+
+  // coalesced notification: call once per frame (gui timer, etc), fires OnGreekUpdate
+  //   for this and each dirty sub-portfolio, nothing fires when nothing changed since last call
+  //   a dirty portfolio re-sums its exposure from its positions and sub-portfolios before firing
+  void Publish();
+
+  ou::Delegate<const Exposure&> OnExposureDelta; // < - used by owning portfolio, increment only
+  ou::Delegate<const PortfolioGreek&> OnGreekUpdate;
+
 protected:
 private:
 
+  using mapPositionGreek_t = std::map<std::string, pPositionGreek_t>;
+  mapPositionGreek_t m_mapPositionGreek;
+
+  using mapPortfolioGreek_t = std::map<idPortfolio_t, pPortfolioGreek_t>;
+  mapPortfolioGreek_t m_mapSubPortfolioGreek;
+
+  Exposure m_exposure;  // running sum of increments, re-summed at each Publish to shed drift
+  bool m_bDirty;  // exposure or pl changed since last Publish
+
+  void HandleExposureDelta( const Exposure& );
+  void HandlePLUpdate( const Portfolio& );
+
 };
 
 std::ostream& operator<<( std::ostream& os, const PortfolioGreek& );
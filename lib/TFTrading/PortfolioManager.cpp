@@ -11,9 +11,11 @@
  * See the file LICENSE.txt for redistribution information.             *
  ************************************************************************/
 
+#include <OUSqlite/WriteBehind.h>
+
 #include "PortfolioManager.h"
 
-// todo:  need to store the prepared queries for re-use
+// updates go through the session's journal, which prepares each query once
 
 namespace ou { // One Unified
 namespace tf { // TradeFrame
@@ -34,8 +36,7 @@ PortfolioManager::pPortfolio_t PortfolioManager::ConstructPortfolio(
   pPortfolio = std::make_shared<ou::tf::Portfolio>( idPortfolio, idAccountOwner, idOwner, ePortfolioType, eCurrency, sDescription );
   m_mapPortfolios.insert( mapPortfolio_pair_t( idPortfolio, pPortfolio ) );
   if ( nullptr != m_pSession ) {
-    ou::db::QueryFields<Portfolio::TableRowDef>::pQueryFields_t pQuery
-      = m_pSession->Insert<Portfolio::TableRowDef>( const_cast<Portfolio::TableRowDef&>( pPortfolio->GetRow() ) );
+    m_pSession->Journal().Insert<Portfolio::TableRowDef>( pPortfolio->GetRow() );
   }
 
   PortfolioCommon( pPortfolio );
@@ -58,7 +59,7 @@ namespace PortfolioManagerQueries {
       ou::db::Field( a, "realizedpl", dblRealizedPL );
       ou::db::Field( a, "positionid", idPosition );
     }
-    const ou::tf::keytypes::idPosition_t idPosition;
+    ou::tf::keytypes::idPosition_t idPosition;
     OrderSide::EOrderSide eOrderSidePending;
     boost::uint32_t nPositionPending;
     OrderSide::EOrderSide eOrderSideActive;
@@ -85,9 +86,8 @@ void PortfolioManager::HandlePositionOnExecution( const Position& position ) {
     const Position::TableRowDef& row( position.GetRow() );
     PortfolioManagerQueries::UpdatePositionData update( row.idPosition, row.eOrderSidePending, row.nPositionPending,
       row.eOrderSideActive, row.nPositionActive, row.dblConstructedValue, row.dblUnRealizedPL, row.dblRealizedPL );
-    ou::db::QueryFields<PortfolioManagerQueries::UpdatePositionData>::pQueryFields_t pQuery
-      = m_pSession->SQL<PortfolioManagerQueries::UpdatePositionData>(
-        "update positions set ordersidepending=?, quantitypending=?, ordersideactive=?, quantityactive=?, constructedvalue=?, unrealizedpl=?, realizedpl=?", update ).Where( "positionid=?" );
+    m_pSession->Journal().Post<PortfolioManagerQueries::UpdatePositionData>(
+      "update positions set ordersidepending=?, quantitypending=?, ordersideactive=?, quantityactive=?, constructedvalue=?, unrealizedpl=?, realizedpl=?", "positionid=?", update );
   }
 }
 
@@ -100,7 +100,7 @@ namespace PortfolioManagerQueries {
       ou::db::Field( a, "commission", dblCommissionPaid );
       ou::db::Field( a, "positionid", idPosition );
     }
-    const ou::tf::keytypes::idPosition_t idPosition;
+    ou::tf::keytypes::idPosition_t idPosition;
     double dblCommissionPaid;
     UpdatePositionCommission( const ou::tf::keytypes::idPosition_t idPosition_, double dblCommissionPaid_ )
       : idPosition( idPosition_ ), dblCommissionPaid( dblCommissionPaid_ ) {};
@@ -111,11 +111,9 @@ void PortfolioManager::HandlePositionOnCommission( const Position& position ) {
   if ( nullptr != m_pSession ) {
     const Position::TableRowDef& row( position.GetRow() );
     PortfolioManagerQueries::UpdatePositionCommission update( row.idPosition, row.dblCommissionPaid );
-    ou::db::QueryFields<PortfolioManagerQueries::UpdatePositionCommission>::pQueryFields_t pQuery
-      = m_pSession->SQL<PortfolioManagerQueries::UpdatePositionCommission>( "update positions set commission=?", update ).Where( "positionid=?" );
+    m_pSession->Journal().Post<PortfolioManagerQueries::UpdatePositionCommission>( "update positions set commission=?", "positionid=?", update );
   }
 }  // the Where could be appended with boost::fusion type structure for the fields, and bind?
-  // need to cache the queries
 
 /////
 
@@ -126,7 +124,7 @@ namespace PortfolioManagerQueries {
       ou::db::Field( a, "realizedpl", dblRealizedPL );
       ou::db::Field( a, "portfolioid", idPortfolio );
     }
-    const ou::tf::keytypes::idPortfolio_t idPortfolio;
+    ou::tf::keytypes::idPortfolio_t idPortfolio;
     double dblRealizedPL;
     UpdatePortfolioRealizedPL( const ou::tf::keytypes::idPortfolio_t idPortfolio_, double dblRealizedPL_ )
       : idPortfolio( idPortfolio_ ), dblRealizedPL( dblRealizedPL_ ) {};
@@ -137,8 +135,7 @@ void PortfolioManager::HandlePortfolioOnExecution( const Portfolio& portfolio )
   if ( nullptr != m_pSession ) {
     const Portfolio::TableRowDef& row( portfolio.GetRow() );
     PortfolioManagerQueries::UpdatePortfolioRealizedPL update( row.idPortfolio, row.dblRealizedPL );
-    ou::db::QueryFields<PortfolioManagerQueries::UpdatePortfolioRealizedPL>::pQueryFields_t pQuery
-      = m_pSession->SQL<PortfolioManagerQueries::UpdatePortfolioRealizedPL>( "update portfolios set realizedpl=?", update ).Where( "portfolioid=?" );
+    m_pSession->Journal().Post<PortfolioManagerQueries::UpdatePortfolioRealizedPL>( "update portfolios set realizedpl=?", "portfolioid=?", update );
   }
 }
 
@@ -151,7 +148,7 @@ namespace PortfolioManagerQueries {
       ou::db::Field( a, "commission", dblCommissionsPaid );
       ou::db::Field( a, "portfolioid", idPortfolio );
     }
-    const ou::tf::keytypes::idPortfolio_t idPortfolio;
+    ou::tf::keytypes::idPortfolio_t idPortfolio;
     double dblCommissionsPaid;
     UpdatePortfolioCommission( const ou::tf::keytypes::idPortfolio_t idPortfolio_, double dblCommissionsPaid_ )
       : idPortfolio( idPortfolio_ ), dblCommissionsPaid( dblCommissionsPaid_ ) {};
@@ -162,8 +159,7 @@ void PortfolioManager::HandlePortfolioOnCommission( const Portfolio& portfolio )
   if ( nullptr != m_pSession ) {
     const Portfolio::TableRowDef& row( portfolio.GetRow() );
     PortfolioManagerQueries::UpdatePortfolioCommission update( row.idPortfolio, row.dblCommissionsPaid );
-    ou::db::QueryFields<PortfolioManagerQueries::UpdatePortfolioCommission>::pQueryFields_t pQuery
-      = m_pSession->SQL<PortfolioManagerQueries::UpdatePortfolioCommission>( "update portfolios set commission=?", update ).Where( "portfolioid=?" );
+    m_pSession->Journal().Post<PortfolioManagerQueries::UpdatePortfolioCommission>( "update portfolios set commission=?", "portfolioid=?", update );
   }
 }
 
@@ -175,7 +171,7 @@ namespace PortfolioManagerQueries {
     void Fields( A& a ) {
       ou::db::Field( a, "portfolioid", idPortfolio );
     }
-    const ou::tf::keytypes::idPortfolio_t& idPortfolio;
+    ou::tf::keytypes::idPortfolio_t idPortfolio;
     PortfolioKey( const ou::tf::keytypes::idPortfolio_t& idPortfolio_ ): idPortfolio( idPortfolio_ ) {};
   };
 }
@@ -193,11 +189,11 @@ PortfolioManager::pPortfolio_t PortfolioManager::GetPortfolio( const idPortfolio
     // following portfolio / position code is shared with LoadActivePortfolios and could be factored out
     PortfolioManagerQueries::PortfolioKey key( idPortfolio );
     ou::db::QueryFields<PortfolioManagerQueries::PortfolioKey>::pQueryFields_t pExistsQuery // shouldn't do a * as fields may change order
-      = m_pSession->SQL<PortfolioManagerQueries::PortfolioKey>( "select * from portfolios", key ).Where( "portfolioid = ?" ).NoExecute();
-    m_pSession->Bind<PortfolioManagerQueries::PortfolioKey>( pExistsQuery );
+      = m_pSession->Cached<PortfolioManagerQueries::PortfolioKey>( "select * from portfolios WHERE portfolioid = ?", key );
     if ( m_pSession->Execute( pExistsQuery ) ) {  // <- need to be able to execute on query pointer, since there is session pointer in every query
       Portfolio::TableRowDef rowPortfolio;
       m_pSession->Columns<PortfolioManagerQueries::PortfolioKey, Portfolio::TableRowDef>( pExistsQuery, rowPortfolio );
+      m_pSession->Reset( pExistsQuery ); // cached, so release the read
       pPortfolio = std::make_shared<ou::tf::Portfolio>( rowPortfolio );
 
       std::pair<mapPortfolios_iter_t, bool> response;
@@ -228,7 +224,7 @@ namespace PortfolioManagerQueries {
       ou::db::Field( a, "active", bActive );
       ou::db::Field( a, "portfolioid", idPortfolio );
     }
-    const ou::tf::keytypes::idPortfolio_t idPortfolio;
+    ou::tf::keytypes::idPortfolio_t idPortfolio;
     bool bActive;
     UpdatePortfolioActive( const ou::tf::keytypes::idPortfolio_t idPortfolio_, bool bActive_ )
       : idPortfolio( idPortfolio_ ), bActive( bActive_ ) {};
@@ -239,8 +235,7 @@ void PortfolioManager::PortfolioUpdateActive( pPortfolio_t pPortfolio ) {
   if ( nullptr != m_pSession ) {
     const Portfolio::TableRowDef& row( pPortfolio->GetRow() );
     PortfolioManagerQueries::UpdatePortfolioActive update( row.idPortfolio, row.bActive );
-    ou::db::QueryFields<PortfolioManagerQueries::UpdatePortfolioActive>::pQueryFields_t pQuery
-      = m_pSession->SQL<PortfolioManagerQueries::UpdatePortfolioActive>( "update portfolios set active=?", update ).Where( "portfolioid=?" );
+    m_pSession->Journal().Post<PortfolioManagerQueries::UpdatePortfolioActive>( "update portfolios set active=?", "portfolioid=?", update );
   }
 }
 
@@ -253,7 +248,7 @@ namespace PortfolioManagerQueries {
       ou::db::Field( a, "notes", sNotes );
       ou::db::Field( a, "positionid", idPosition );
     }
-    const ou::tf::keytypes::idPosition_t idPosition;
+    ou::tf::keytypes::idPosition_t idPosition;
     std::string sNotes;
     UpdatePositionNotes( const ou::tf::keytypes::idPosition_t idPosition_, const std::string& sNotes_ )
       : idPosition( idPosition_ ), sNotes( sNotes_ ) {};
@@ -264,11 +259,9 @@ void PortfolioManager::PositionUpdateNotes( pPosition_t pPosition ) {
   if ( nullptr != m_pSession ) {
     const Position::TableRowDef& row( pPosition->GetRow() );
     PortfolioManagerQueries::UpdatePositionNotes update( row.idPosition, row.sNotes );
-    ou::db::QueryFields<PortfolioManagerQueries::UpdatePositionNotes>::pQueryFields_t pQuery
-      = m_pSession->SQL<PortfolioManagerQueries::UpdatePositionNotes>( "update positions set notes=?", update ).Where( "positionid=?" );
+    m_pSession->Journal().Post<PortfolioManagerQueries::UpdatePositionNotes>( "update positions set notes=?", "positionid=?", update );
   }
 }  // the Where could be appended with boost::fusion type structure for the fields, and bind?
-  // need to cache the queries
 
 //////
 
@@ -286,11 +279,11 @@ bool PortfolioManager::PortfolioExists( const idPortfolio_t& idPortfolio ) {
     // following portfolio / position code is shared with LoadActivePortfolios and could be factored out
     PortfolioManagerQueries::PortfolioKey key( idPortfolio );
     ou::db::QueryFields<PortfolioManagerQueries::PortfolioKey>::pQueryFields_t pExistsQuery // shouldn't do a * as fields may change order
-      = m_pSession->SQL<PortfolioManagerQueries::PortfolioKey>( "select portfolioid from portfolios", key ).Where( "portfolioid = ?" ).NoExecute();
-    m_pSession->Bind<PortfolioManagerQueries::PortfolioKey>( pExistsQuery );
+      = m_pSession->Cached<PortfolioManagerQueries::PortfolioKey>( "select portfolioid from portfolios WHERE portfolioid = ?", key );
     if ( m_pSession->Execute( pExistsQuery ) ) {  // <- need to be able to execute on query pointer, since there is session pointer in every query
       bExists = true;
     }
+    m_pSession->Reset( pExistsQuery ); // cached, so release the read
   }
   return bExists;
 }
@@ -522,10 +515,14 @@ void PortfolioManager::ConstructPosition( // re-factored code
     throw std::runtime_error( "ConstructPosition:  database session not available" );
   }
 
-  ou::db::QueryFields<Position::TableRowDefNoKey>::pQueryFields_t pQuery
-    = m_pSession->Insert<Position::TableRowDefNoKey>(
-    const_cast<Position::TableRowDefNoKey&>( dynamic_cast<const Position::TableRowDefNoKey&>( pPosition->GetRow() ) ) );
-  idPosition_t idPosition( m_pSession->GetLastRowId() );
+  idPosition_t idPosition {};
+  m_pSession->Journal().Exclusive( // the row id is needed now, and the journal's inserts would disturb it
+    [&pPosition,&idPosition]( ou::db::Session& session ){
+      ou::db::QueryFields<Position::TableRowDefNoKey>::pQueryFields_t pQuery
+        = session.Insert<Position::TableRowDefNoKey>(
+        const_cast<Position::TableRowDefNoKey&>( dynamic_cast<const Position::TableRowDefNoKey&>( pPosition->GetRow() ) ) );
+      idPosition = session.GetLastRowId();
+    } );
   pPosition->Set( idPosition );
 
   pPosition->OnUpdateCommissionForPortfolioManager.Add( MakeDelegate( this, &PortfolioManager::HandlePositionOnCommission ) );
@@ -669,6 +666,7 @@ void PortfolioManager::AttachToSession( ou::db::Session* pSession ) {
 }
 
 void PortfolioManager::DetachFromSession( ou::db::Session* pSession ) {
+  pSession->Journal().Flush();
   pSession->OnRegisterTables.Remove( MakeDelegate( this, &PortfolioManager::HandleRegisterTables ) );
   pSession->OnRegisterRows.Remove( MakeDelegate( this, &PortfolioManager::HandleRegisterRows ) );
   pSession->OnPopulate.Remove( MakeDelegate( this, &PortfolioManager::HandlePopulateTables ) );
@@ -36,16 +36,47 @@ PositionGreek::PositionGreek( pOption_t& pOption, pUnderlying_t& pUnderlying )
 
 PositionGreek::~PositionGreek( ) {
   //std::cout << "PositionGreek::Destruction: " << m_row.sName << std::endl;
+  Position::OnExecution.Remove( MakeDelegate( this, &PositionGreek::HandleExecution ) );
   m_pOption->OnGreek.Remove( MakeDelegate( this, &PositionGreek::HandleGreek ) );
 }
 
 void PositionGreek::Construction() {
   m_pOption->OnGreek.Add( MakeDelegate( this, &PositionGreek::HandleGreek ) );
+  Position::OnExecution.Add( MakeDelegate( this, &PositionGreek::HandleExecution ) );
   //std::cout << "PositionGreek::Construction: " << m_row.sName << std::endl;
 }
 
 void PositionGreek::HandleGreek( greek_t greek ) {
   OnGreek( greek );
+  UpdateExposure( greek );
+}
+
+void PositionGreek::HandleExecution( const PositionDelta_delegate_t& ) {
+  UpdateExposure( m_pOption->LastGreek() );  // quantity changed, re-weight with the last greek
+}
+
+// only the increment is passed upwards, so a tick costs one update per portfolio level
+void PositionGreek::UpdateExposure( const ou::tf::Greek& greek ) {
+
+  double dblWeight {};
+  switch ( m_row.eOrderSideActive ) {
+    case OrderSide::Buy:
+      dblWeight = m_row.nPositionActive;
+      break;
+    case OrderSide::Sell:
+      dblWeight = -(double)m_row.nPositionActive;
+      break;
+    default:
+      break;
+  }
+  dblWeight *= m_pOption->GetInstrument()->GetMultiplier();
+
+  const Exposure exposure( dblWeight * greek.Delta(), dblWeight * greek.Gamma(), dblWeight * greek.Theta(), dblWeight * greek.Vega() );
+  const Exposure delta( exposure - m_exposure );
+  if ( !delta.IsZero() ) {
+    m_exposure = exposure;
+    OnExposureDelta( delta );
+  }
 }
 
 void PositionGreek::PositionPendingDelta( int n ) {
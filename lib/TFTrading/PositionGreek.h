@@ -45,6 +45,25 @@ public:
 
   typedef ProviderInterfaceBase::pProvider_t pProvider_t;
 
+  // greeks weighted by signed quantity and multiplier, summed by PortfolioGreek
+  struct Exposure {
+    double dblDelta;
+    double dblGamma;
+    double dblTheta;
+    double dblVega;
+    Exposure(): dblDelta {}, dblGamma {}, dblTheta {}, dblVega {} {}
+    Exposure( double dblDelta_, double dblGamma_, double dblTheta_, double dblVega_ )
+    : dblDelta( dblDelta_ ), dblGamma( dblGamma_ ), dblTheta( dblTheta_ ), dblVega( dblVega_ ) {}
+    Exposure& operator+=( const Exposure& rhs ) {
+      dblDelta += rhs.dblDelta; dblGamma += rhs.dblGamma; dblTheta += rhs.dblTheta; dblVega += rhs.dblVega;
+      return *this;
+    }
+    Exposure operator-( const Exposure& rhs ) const {
+      return Exposure( dblDelta - rhs.dblDelta, dblGamma - rhs.dblGamma, dblTheta - rhs.dblTheta, dblVega - rhs.dblVega );
+    }
+    bool IsZero() const { return ( 0.0 == dblDelta ) && ( 0.0 == dblGamma ) && ( 0.0 == dblTheta ) && ( 0.0 == dblVega ); }
+  };
+
   PositionGreek( pOption_t&, pUnderlying_t& );
   virtual ~PositionGreek( );
 
@@ -52,6 +71,9 @@ public:
   pUnderlying_t GetUnderlying() { return m_pUnderlying; }
 
   ou::Delegate<const ou::tf::Greek&> OnGreek; // need to fire this on option updates
+  ou::Delegate<const Exposure&> OnExposureDelta; // < - used by PortfolioGreek, increment only, fired when exposure changes
+
+  const Exposure& GetExposure() const { return m_exposure; }
 
   void PositionPendingDelta( int n );  // -1 or +1
 
@@ -66,9 +88,14 @@ private:
 
   int m_nQuantity;  // number of contracts
 
+  Exposure m_exposure; // contribution last reported through OnExposureDelta
+
   void Construction();
 
   void HandleGreek( greek_t );
+  void HandleExecution( const PositionDelta_delegate_t& );
+
+  void UpdateExposure( const ou::tf::Greek& );
 
   template<typename Archive>
   void save( Archive& ar, const unsigned int version ) const {
@@ -29,6 +29,7 @@
 
 #include "KeyTypes.h"
 #include "Symbol.h"
+#include "InstrumentIntern.h"
 #include "Order.h"
 
 // need to include a check that callbacks and virtuals are in the correct thread
@@ -226,7 +227,12 @@ public:
 protected:
 
   using mapSymbols_t = std::map<idSymbol_t, pSymbol_t>;
-  mapSymbols_t m_mapSymbols;
+  mapSymbols_t m_mapSymbols; // by provider symbol name, for the feed side
+
+  // by the interned id of the instrument, for the Add/Remove handler side, filled in by AddCSymbol
+  //   assumes an instrument's provider name does not change once its symbol is in use
+  using vSymbols_t = InternVector<pSymbol_t>;
+  vSymbols_t m_vSymbols;
 
   //void Connecting( void );
   void ConnectionComplete();
@@ -255,7 +261,8 @@ protected:
 
 private:
 
-  typename mapSymbols_t::iterator Find( const pInstrument_t& );
+  pSymbol_t Find( const pInstrument_t& ); // adds the symbol when not present
+  pSymbol_t Lookup( const pInstrument_t& ); // nullptr when not present
 
 };
 
@@ -266,6 +273,7 @@ ProviderInterface<P,S>::ProviderInterface(void)
 
 template <typename P, typename S>
 ProviderInterface<P,S>::~ProviderInterface(void) {
+  m_vSymbols.Clear();
   m_mapSymbols.clear();
 }
 
@@ -297,9 +305,7 @@ void ProviderInterface<P,S>::Disconnecting() {
 
 template <typename P, typename S>
 bool ProviderInterface<P,S>::Exists( pInstrument_cref pInstrument ) {
-  typename mapSymbols_t::iterator iter = m_mapSymbols.find( pInstrument->GetInstrumentName( ID() ) );
-  bool b( m_mapSymbols.end() != iter );
-  return b;
+  return bool( Lookup( pInstrument ) );
 }
 
 template <typename P, typename S>
@@ -328,6 +334,7 @@ typename ProviderInterface<P,S>::pSymbol_t ProviderInterface<P,S>::AddCSymbol( p
     m_mapSymbols.insert( typename mapSymbols_t::value_type( pSymbol->GetId(), pSymbol ) );
     iter = m_mapSymbols.find( pSymbol->GetId() );
     assert( m_mapSymbols.end() != iter );
+    m_vSymbols.Slot( pSymbol->GetInstrument()->GetInternId() ) = pSymbol;
   }
   else {
     throw std::runtime_error( "AddCSymbol " + pSymbol->GetId() + " symbol already exists in provider" );
@@ -337,14 +344,24 @@ typename ProviderInterface<P,S>::pSymbol_t ProviderInterface<P,S>::AddCSymbol( p
 }
 
 template <typename P, typename S>
-typename ProviderInterface<P,S>::mapSymbols_t::iterator ProviderInterface<P,S>:: Find( const pInstrument_t& pInstrument ) {
-  typename mapSymbols_t::iterator iter;
-  if ( !Exists( pInstrument, iter ) ) {
+typename ProviderInterface<P,S>::pSymbol_t ProviderInterface<P,S>::Lookup( const pInstrument_t& pInstrument ) {
+  const pSymbol_t& pSymbol( m_vSymbols.Get( pInstrument->GetInternId() ) );
+  if ( pSymbol ) return pSymbol;
+  // an instrument sharing its provider name with a symbol added for another instrument
+  typename mapSymbols_t::iterator iter = m_mapSymbols.find( pInstrument->GetInstrumentName( ID() ) );
+  if ( m_mapSymbols.end() == iter ) return pSymbol_t();
+  return iter->second;
+}
+
+template <typename P, typename S>
+typename ProviderInterface<P,S>::pSymbol_t ProviderInterface<P,S>::Find( const pInstrument_t& pInstrument ) {
+  pSymbol_t pSymbol( Lookup( pInstrument ) );
+  if ( !pSymbol ) {
     Add( pInstrument );
-    iter = m_mapSymbols.find( pInstrument->GetInstrumentName( ID() ) );
-    assert( m_mapSymbols.end() != iter );
+    pSymbol = Lookup( pInstrument );
+    assert( pSymbol );
   }
-  return iter;
+  return pSymbol;
 }
 
 
@@ -360,133 +377,127 @@ typename ProviderInterface<P,S>::pSymbol_t ProviderInterface<P,S>::GetSymbol( co
 
 template <typename P, typename S>
 typename ProviderInterface<P,S>::pSymbol_t ProviderInterface<P,S>:: GetSymbol( const pInstrument_t& pInstrument ) {
-  return Find( pInstrument )->second;
+  return Find( pInstrument );
 }
 
 template <typename P, typename S>
 void ProviderInterface<P,S>::AddQuoteHandler(pInstrument_cref pInstrument, quotehandler_t handler) {
-  typename mapSymbols_t::iterator iter = Find( pInstrument );
-  if ( iter->second->AddQuoteHandler( handler ) ) {
-    if ( m_bConnected ) StartQuoteWatch( iter->second );
+  pSymbol_t pSymbol( Find( pInstrument ) );
+  if ( pSymbol->AddQuoteHandler( handler ) ) {
+    if ( m_bConnected ) StartQuoteWatch( pSymbol );
   }
 }
 
 template <typename P, typename S>
 void ProviderInterface<P,S>::RemoveQuoteHandler(pInstrument_cref pInstrument, quotehandler_t handler) {
-  typename mapSymbols_t::iterator iter;
-  iter = m_mapSymbols.find( pInstrument->GetInstrumentName( ID() ) );
-  if ( m_mapSymbols.end() == iter ) {
+  pSymbol_t pSymbol( Lookup( pInstrument ) );
+  if ( !pSymbol ) {
     assert( false );
   }
   else {
-    if ( iter->second->RemoveQuoteHandler( handler ) ) {
-      if ( m_bConnected ) StopQuoteWatch( iter->second );
+    if ( pSymbol->RemoveQuoteHandler( handler ) ) {
+      if ( m_bConnected ) StopQuoteWatch( pSymbol );
     }
   }
 }
 
 template <typename P, typename S>
 void ProviderInterface<P,S>::AddTradeHandler(pInstrument_cref pInstrument, tradehandler_t handler) {
-  typename mapSymbols_t::iterator iter = Find( pInstrument );
-  if ( iter->second->AddTradeHandler( handler ) ) {
-    if ( m_bConnected ) StartTradeWatch( iter->second );
+  pSymbol_t pSymbol( Find( pInstrument ) );
+  if ( pSymbol->AddTradeHandler( handler ) ) {
+    if ( m_bConnected ) StartTradeWatch( pSymbol );
   }
 }
 
 template <typename P, typename S>
 void ProviderInterface<P,S>::RemoveTradeHandler(pInstrument_cref pInstrument, tradehandler_t handler) {
-  typename mapSymbols_t::iterator iter;
-  iter = m_mapSymbols.find( pInstrument->GetInstrumentName( ID() ) );
-  if ( m_mapSymbols.end() == iter ) {
+  pSymbol_t pSymbol( Lookup( pInstrument ) );
+  if ( !pSymbol ) {
     assert( false );
   }
   else {
-    if ( iter->second->RemoveTradeHandler( handler ) ) {
-      if ( m_bConnected ) StopTradeWatch( iter->second );
+    if ( pSymbol->RemoveTradeHandler( handler ) ) {
+      if ( m_bConnected ) StopTradeWatch( pSymbol );
     }
   }
 }
 
 template <typename P, typename S>
 void ProviderInterface<P,S>::AddOnOpenHandler(pInstrument_cref pInstrument, tradehandler_t handler) {
-  typename mapSymbols_t::iterator iter = Find( pInstrument );
-  iter->second->AddOnOpenHandler( handler );
+  pSymbol_t pSymbol( Find( pInstrument ) );
+  pSymbol->AddOnOpenHandler( handler );
 }
 
 template <typename P, typename S>
 void ProviderInterface<P,S>::RemoveOnOpenHandler(pInstrument_cref pInstrument, tradehandler_t handler) {
-  typename mapSymbols_t::iterator iter;
-  iter = m_mapSymbols.find( pInstrument->GetInstrumentName( ID() ) );
-  if ( m_mapSymbols.end() == iter ) {
+  pSymbol_t pSymbol( Lookup( pInstrument ) );
+  if ( !pSymbol ) {
     assert( false );
   }
   else {
-    iter->second->RemoveOnOpenHandler( handler );
+    pSymbol->RemoveOnOpenHandler( handler );
   }
 }
 
 template <typename P, typename S>
 void ProviderInterface<P,S>::AddDepthByMMHandler(pInstrument_cref pInstrument, depthbymmhandler_t handler) {
-  typename mapSymbols_t::iterator iter = Find( pInstrument );
-  if ( iter->second->AddDepthByMMHandler( handler ) ) {
-    if ( m_bConnected ) StartDepthByMMWatch( iter->second );
+  pSymbol_t pSymbol( Find( pInstrument ) );
+  if ( pSymbol->AddDepthByMMHandler( handler ) ) {
+    if ( m_bConnected ) StartDepthByMMWatch( pSymbol );
   }
 }
 
 template <typename P, typename S>
 void ProviderInterface<P,S>::RemoveDepthByMMHandler(pInstrument_cref pInstrument, depthbymmhandler_t handler) {
-  typename mapSymbols_t::iterator iter;
-  iter = m_mapSymbols.find( pInstrument->GetInstrumentName( ID() ) );
-  if ( m_mapSymbols.end() == iter ) {
+  pSymbol_t pSymbol( Lookup( pInstrument ) );
+  if ( !pSymbol ) {
     assert( false );
   }
   else {
-    if ( iter->second->RemoveDepthByMMHandler( handler ) ) {
-      if ( m_bConnected ) StopDepthByMMWatch( iter->second );
+    if ( pSymbol->RemoveDepthByMMHandler( handler ) ) {
+      if ( m_bConnected ) StopDepthByMMWatch( pSymbol );
     }
   }
 }
 
 template <typename P, typename S>
 void ProviderInterface<P,S>::AddDepthByOrderHandler(pInstrument_cref pInstrument, depthbyorderhandler_t handler) {
-  typename mapSymbols_t::iterator iter = Find( pInstrument );
-  if ( iter->second->AddDepthByOrderHandler( handler ) ) {
-    if ( m_bConnected ) StartDepthByOrderWatch( iter->second );
+  pSymbol_t pSymbol( Find( pInstrument ) );
+  if ( pSymbol->AddDepthByOrderHandler( handler ) ) {
+    if ( m_bConnected ) StartDepthByOrderWatch( pSymbol );
   }
 }
 
 template <typename P, typename S>
 void ProviderInterface<P,S>::RemoveDepthByOrderHandler(pInstrument_cref pInstrument, depthbyorderhandler_t handler) {
-  typename mapSymbols_t::iterator iter;
-  iter = m_mapSymbols.find( pInstrument->GetInstrumentName( ID() ) );
-  if ( m_mapSymbols.end() == iter ) {
+  pSymbol_t pSymbol( Lookup( pInstrument ) );
+  if ( !pSymbol ) {
     assert( false );
   }
   else {
-    if ( iter->second->RemoveDepthByOrderHandler( handler ) ) {
-      if ( m_bConnected ) StopDepthByOrderWatch( iter->second );
+    if ( pSymbol->RemoveDepthByOrderHandler( handler ) ) {
+      if ( m_bConnected ) StopDepthByOrderWatch( pSymbol );
     }
   }
 }
 
 template <typename P, typename S>
 void ProviderInterface<P,S>::AddGreekHandler(pInstrument_cref pInstrument, greekhandler_t handler) {
-  typename mapSymbols_t::iterator iter = Find( pInstrument );
-  if ( iter->second->AddGreekHandler( handler ) ) {
-    if ( m_bConnected ) StartGreekWatch( iter->second );
+  pSymbol_t pSymbol( Find( pInstrument ) );
+  if ( pSymbol->AddGreekHandler( handler ) ) {
+    if ( m_bConnected ) StartGreekWatch( pSymbol );
   }
 }
 
 template <typename P, typename S>
 void ProviderInterface<P,S>::RemoveGreekHandler(pInstrument_cref pInstrument, greekhandler_t handler) {
-  typename mapSymbols_t::iterator iter;
-  iter = m_mapSymbols.find( pInstrument->GetInstrumentName( ID() ) );
-  if ( m_mapSymbols.end() == iter ) {
+  pSymbol_t pSymbol( Lookup( pInstrument ) );
+  if ( !pSymbol ) {
     assert( false );
   }
   else {
-    if ( iter->second->RemoveGreekHandler( handler ) ) {
-      if ( m_bConnected ) StopGreekWatch( iter->second );
+    if ( pSymbol->RemoveGreekHandler( handler ) ) {
+      if ( m_bConnected ) StopGreekWatch( pSymbol );
     }
   }
 }
@@ -16,7 +16,9 @@
 #include <TFHDF5TimeSeries/HDF5WriteTimeSeries.h>
 #include <TFHDF5TimeSeries/HDF5IterateGroups.h>
 #include <TFHDF5TimeSeries/HDF5Attribute.h>
+#include <TFHDF5TimeSeries/HDF5WriteBatch.h>
 
+#include <OUCommon/Latency.h>
 #include <OUCommon/TimeSource.h>
 
 #include <TFIQFeed/Provider.h>
@@ -245,6 +247,8 @@ void Watch::EmitValues( bool bEmitName ) const {
 
 void Watch::HandleQuote( const Quote& quote ) {
 
+  ou::latency::Mark( ou::latency::EStage::Watch );
+
   // TODO: mean, median, mode on spread to determine 'normal' spread for actionable events
   //   * sliding window for n quotes or n seconds?
   //   * need to filter quotes when value is at zero as end of life otm
@@ -287,21 +291,24 @@ void Watch::HandleQuote( const Quote& quote ) {
 
       m_quote = quote;
       if ( m_bRecordSeries ) {
+        std::lock_guard<std::mutex> lock( m_mutexLockAppend );
         m_quotes.Append( quote );
       }
 
       OnQuote( quote );
+      ou::latency::Mark( ou::latency::EStage::Callback );
     }
     else {
         m_quote = quote;
         //OnPossibleResizeBegin( stateTimeSeries_t( m_quotes.Capacity(), m_quotes.Size() ) );
-        {
-          //boost::mutex::scoped_lock lock(m_mutexLockAppend);
-          if ( m_bRecordSeries ) m_quotes.Append( quote );
+        if ( m_bRecordSeries ) {
+          std::lock_guard<std::mutex> lock( m_mutexLockAppend );
+          m_quotes.Append( quote );
         }
 
         //OnPossibleResizeEnd( stateTimeSeries_t( m_quotes.Capacity(), m_quotes.Size() ) );
         OnQuote( quote );
+        ou::latency::Mark( ou::latency::EStage::Callback );
     }
   }
   else {
@@ -316,27 +323,35 @@ void Watch::HandleQuote( const Quote& quote ) {
 }
 
 void Watch::HandleTrade( const Trade& trade ) {
+  ou::latency::Mark( ou::latency::EStage::Watch );
   m_trade = trade;
   if ( trade.Price() > m_PriceMax ) m_PriceMax = trade.Price();
   if ( trade.Price() < m_PriceMin ) m_PriceMin = trade.Price();
   m_VolumeTotal += trade.Volume();
   //OnPossibleResizeBegin( stateTimeSeries_t( m_trades.Capacity(), m_trades.Size() ) );
-  {
-    //boost::mutex::scoped_lock lock(m_mutexLockAppend);
-    if ( m_bRecordSeries ) m_trades.Append( trade );
+  if ( m_bRecordSeries ) {
+    std::lock_guard<std::mutex> lock( m_mutexLockAppend );
+    m_trades.Append( trade );
   }
   //OnPossibleResizeEnd( stateTimeSeries_t( m_trades.Capacity(), m_trades.Size() ) );
   //if ( 0 != m_OnTrade ) m_OnTrade( trade );
   OnTrade( trade );
+  ou::latency::Mark( ou::latency::EStage::Callback );
 }
 
 void Watch::HandleDepthByMM( const DepthByMM& depth ) {
-  if ( m_bRecordSeries ) m_depths_mm.Append( depth );
+  if ( m_bRecordSeries ) {
+    std::lock_guard<std::mutex> lock( m_mutexLockAppend );
+    m_depths_mm.Append( depth );
+  }
   OnDepthByMM( depth );
 }
 
 void Watch::HandleDepthByOrder( const DepthByOrder& depth ) {
-  if ( m_bRecordSeries ) m_depths_order.Append( depth );
+  if ( m_bRecordSeries ) {
+    std::lock_guard<std::mutex> lock( m_mutexLockAppend );
+    m_depths_order.Append( depth );
+  }
   OnDepthByOrder( depth );
 }
 
@@ -364,96 +379,68 @@ void Watch::HandleIQFeedSummaryMessage( ou::tf::iqfeed::IQFeedSymbol::pSummary_t
 }
 
 void Watch::SaveSeries( const std::string& sPrefix ) {
-
-  ou::tf::HDF5DataManager dm( ou::tf::HDF5DataManager::RDWR );
-
   try {
-
-    std::string sPathName;
-
-    if ( 0 != m_quotes.Size() ) {
-      sPathName = sPrefix + Quotes::Directory() + m_pInstrument->GetInstrumentName();
-      HDF5WriteTimeSeries<ou::tf::Quotes> wtsQuotes( dm, true, true, 5, 256 );
-      wtsQuotes.Write( sPathName, &m_quotes );
-      HDF5Attributes attrQuotes( dm, sPathName );
-      attrQuotes.SetSignature( ou::tf::Quote::Signature() );
-      attrQuotes.SetMultiplier( m_pInstrument->GetMultiplier() );
-      attrQuotes.SetSignificantDigits( m_pInstrument->GetSignificantDigits() );
-      attrQuotes.SetProviderType( m_pDataProvider->ID() );
-    }
-
-    if ( 0 != m_trades.Size() ) {
-      sPathName = sPrefix + Trades::Directory() + m_pInstrument->GetInstrumentName();
-      HDF5WriteTimeSeries<ou::tf::Trades> wtsTrades( dm, true, true, 5, 256 );
-      wtsTrades.Write( sPathName, &m_trades );
-      HDF5Attributes attrTrades( dm, sPathName );
-      attrTrades.SetSignature( ou::tf::Trade::Signature() );
-      attrTrades.SetMultiplier( m_pInstrument->GetMultiplier() );
-      attrTrades.SetSignificantDigits( m_pInstrument->GetSignificantDigits() );
-      attrTrades.SetProviderType( m_pDataProvider->ID() );
-    }
-
-    if ( 0 != m_depths_mm.Size() ) {
-      sPathName = sPrefix + DepthsByMM::Directory() + m_pInstrument->GetInstrumentName();
-      HDF5WriteTimeSeries<ou::tf::DepthsByMM> wtsDepths( dm, true, true, 5, 256 );
-      wtsDepths.Write( sPathName, &m_depths_mm );
-      HDF5Attributes attrDepths( dm, sPathName );
-      attrDepths.SetSignature( ou::tf::DepthByMM::Signature() );
-      //attrDepths.SetMultiplier( m_pInstrument->GetMultiplier() );
-      //attrDepths.SetSignificantDigits( m_pInstrument->GetSignificantDigits() );
-      attrDepths.SetProviderType( m_pDataProvider->ID() );
-    }
-
-    if ( 0 != m_depths_order.Size() ) {
-      sPathName = sPrefix + DepthsByOrder::Directory() + m_pInstrument->GetInstrumentName();
-      HDF5WriteTimeSeries<ou::tf::DepthsByOrder> wtsDepths( dm, true, true, 5, 256 );
-      wtsDepths.Write( sPathName, &m_depths_order );
-      HDF5Attributes attrDepths( dm, sPathName );
-      attrDepths.SetSignature( ou::tf::DepthByOrder::Signature() );
-      //attrDepths.SetMultiplier( m_pInstrument->GetMultiplier() );
-      //attrDepths.SetSignificantDigits( m_pInstrument->GetSignificantDigits() );
-      attrDepths.SetProviderType( m_pDataProvider->ID() );
-    }
-
+    HDF5WriteBatch batch( 256, 1, false ); // single watch, quiet
+    CollectSeries( batch, sPrefix );
+    batch.Write();
   }
   catch (...) {
     std::cout << "Watch::SaveSeries error: " << sPrefix << std::endl;
   }
-
 }
 
 void Watch::SaveSeries( const std::string& sPrefix, const std::string& sDaily ) {
+  try {
+    HDF5WriteBatch batch( 256, 1, false ); // single watch, quiet
+    CollectSeries( batch, sPrefix, sDaily );
+    batch.Write();
+  }
+  catch (...) {
+    std::cout << "Watch::SaveSeries2 error: " << sPrefix << std::endl;
+  }
+}
 
-  SaveSeries( sPrefix );
+void Watch::CollectSeries( HDF5WriteBatch& batch, const std::string& sPrefix ) {
 
-  ou::tf::HDF5DataManager dm( ou::tf::HDF5DataManager::RDWR );
+  const std::string& sName( m_pInstrument->GetInstrumentName() );
 
-  std::string sPathName;
+  batch.Add(
+    sName, sPrefix + Quotes::Directory() + sName, m_quotes,
+    HDF5WriteBatch::Attributes( ou::tf::Quote::Signature(), m_pInstrument->GetMultiplier(), m_pInstrument->GetSignificantDigits(), m_pDataProvider->ID() ),
+    &m_mutexLockAppend );
 
-  try {
+  batch.Add(
+    sName, sPrefix + Trades::Directory() + sName, m_trades,
+    HDF5WriteBatch::Attributes( ou::tf::Trade::Signature(), m_pInstrument->GetMultiplier(), m_pInstrument->GetSignificantDigits(), m_pDataProvider->ID() ),
+    &m_mutexLockAppend );
 
-    if ( 0 != m_VolumeTotal ) {
-      ou::tf::Bar bar( m_trade.DateTime(), m_summary.dblOpen, m_PriceMax, m_PriceMin, m_trade.Price(), m_VolumeTotal );
-      ou::tf::Bars bars;
-      bars.Append( bar );
-      sPathName = sDaily + "/daily/" + m_pInstrument->GetInstrumentName();
-      HDF5WriteTimeSeries<ou::tf::Bars> wtsBars( dm, true, true, 5, 256 );
-      wtsBars.Write( sPathName, &bars );
-      HDF5Attributes attrBars( dm, sPathName );
-      attrBars.SetSignature( ou::tf::Bar::Signature() );
-      attrBars.SetMultiplier( m_pInstrument->GetMultiplier() );
-      attrBars.SetSignificantDigits( m_pInstrument->GetSignificantDigits() );
-      attrBars.SetProviderType( m_pDataProvider->ID() );
-    }
+  batch.Add(
+    sName, sPrefix + DepthsByMM::Directory() + sName, m_depths_mm,
+    HDF5WriteBatch::Attributes( ou::tf::DepthByMM::Signature(), m_pDataProvider->ID() ),
+    &m_mutexLockAppend );
 
-  }
-  catch (...) {
-    std::cout << "Watch::SaveSeries2 error: " << sPrefix << std::endl;
-  }
+  batch.Add(
+    sName, sPrefix + DepthsByOrder::Directory() + sName, m_depths_order,
+    HDF5WriteBatch::Attributes( ou::tf::DepthByOrder::Signature(), m_pDataProvider->ID() ),
+    &m_mutexLockAppend );
+}
 
+void Watch::CollectSeries( HDF5WriteBatch& batch, const std::string& sPrefix, const std::string& sDaily ) {
+
+  CollectSeries( batch, sPrefix );
+
+  if ( 0 != m_VolumeTotal ) {
+    const std::string& sName( m_pInstrument->GetInstrumentName() );
+    std::shared_ptr<ou::tf::Bars> pBars( std::make_shared<ou::tf::Bars>() );
+    pBars->Append( ou::tf::Bar( m_trade.DateTime(), m_summary.dblOpen, m_PriceMax, m_PriceMin, m_trade.Price(), m_VolumeTotal ) );
+    batch.Add(
+      sName, sDaily + "/daily/" + sName, pBars,
+      HDF5WriteBatch::Attributes( ou::tf::Bar::Signature(), m_pInstrument->GetMultiplier(), m_pInstrument->GetSignificantDigits(), m_pDataProvider->ID() ) );
+  }
 }
 
 void Watch::ClearSeries() {
+  std::lock_guard<std::mutex> lock( m_mutexLockAppend );
   m_quotes.Clear();
   m_trades.Clear();
   m_depths_mm.Clear();
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <mutex>
 #include <memory>
 
 #include <boost/archive/text_oarchive.hpp>
@@ -38,6 +39,8 @@
 namespace ou { // One Unified
 namespace tf { // TradeFrame
 
+class HDF5WriteBatch;
+
 class Watch {
 public:
 
@@ -105,6 +108,10 @@ public:
   virtual void SaveSeries( const std::string& sPrefix );
   virtual void SaveSeries( const std::string& sPrefix, const std::string& sDaily );
 
+  // adds series to a batch, for writing many watches with one pass over the file
+  virtual void CollectSeries( HDF5WriteBatch&, const std::string& sPrefix );
+  void CollectSeries( HDF5WriteBatch&, const std::string& sPrefix, const std::string& sDaily );
+
   virtual void ClearSeries();
 
   // track quotes (maybe rename as such), facilitates order submission with decent spread
@@ -133,6 +140,8 @@ protected:
   ou::tf::DepthsByMM m_depths_mm;
   ou::tf::DepthsByOrder m_depths_order;
 
+  std::mutex m_mutexLockAppend; // appends to the recorded series, and HDF5WriteBatch's copy of them
+
   pInstrument_t m_pInstrument;
 
   pProvider_t m_pDataProvider;
@@ -47,7 +47,7 @@ void DataRowElementIndicatorStatic::Append( const std::string& sValue ) {
   else {
     m_sValue += " " + sValue;
   }
-  m_bChanged = true;
+  Changed();
 }
 
 void DataRowElementIndicatorStatic::UpdateWinRowElement() {
@@ -85,7 +85,7 @@ void DataRowElementIndicatorDynamic::Set( const std::string& sValue ) {
     m_setIndicator.clear();
     m_setIndicator.insert( sValue );
     m_bListChanged = true;
-    m_bChanged = true;
+    Changed();
   }
 }
 
@@ -94,7 +94,7 @@ void DataRowElementIndicatorDynamic::Add( const std::string& sValue ) {
   if ( m_setIndicator.end() == iter ) {
     m_setIndicator.insert( sValue );
     m_bListChanged = true;
-    m_bChanged = true;
+    Changed();
   }
 }
 
@@ -103,7 +103,7 @@ void DataRowElementIndicatorDynamic::Del( const std::string& sValue ) {
   if ( m_setIndicator.end() != iter ) {
     m_setIndicator.erase( iter );
     m_bListChanged = true;
-    m_bChanged = true;
+    Changed();
   }
 }
 
@@ -50,6 +50,7 @@ public:
   WinRowElement* GetWinRowElement() { return m_pWinRowElement; }
 
   virtual void UpdateWinRowElement();
+  void Refresh(); // UpdateWinRowElement, only when changed or newly attached
 
   virtual void Set( const T );
   void Set( bool bHighlight );
@@ -63,6 +64,12 @@ public:
 protected:
 
   bool& m_bChanged; // reference to global
+  bool m_bDirty; // this element, so a row refresh repaints only the cells which differ
+
+  void Changed() {
+    m_bDirty = true;
+    m_bChanged = true;
+  }
 
   T m_value;
 
@@ -83,6 +90,7 @@ DataRowElement<T>::DataRowElement(
   bool& bChanged, const DataRowElement& rhs
 )
 : m_bChanged( bChanged )
+, m_bDirty( false )
 , m_bHighlight( rhs.m_bHighlight )
 , m_format( rhs.m_format )
 , m_pWinRowElement( rhs.m_pWinRowElement )
@@ -96,6 +104,7 @@ DataRowElement<T>::DataRowElement(
   const Colours& colours
 )
 : m_bChanged( bChanged )
+, m_bDirty( false )
 , m_bHighlight( false )
 , m_format( sFormat )
 , m_pWinRowElement( nullptr )
@@ -112,7 +121,7 @@ template<typename T>
 void DataRowElement<T>::Set( const T value ) {
   if ( m_value != value ) {
     m_value = value;
-    m_bChanged = true;
+    Changed();
   }
 }
 
@@ -120,7 +129,7 @@ template<typename T>
 void DataRowElement<T>::Set( bool bHighlight ) {
   if ( m_bHighlight != bHighlight ) {
     m_bHighlight = bHighlight;
-    m_bChanged = true;
+    Changed();
   }
 }
 
@@ -129,7 +138,7 @@ void DataRowElement<T>::Set( const T value, bool bHighlight ) {
   if ( ( m_value != value ) || ( m_bHighlight != bHighlight ) ) {
     m_value = value;
     m_bHighlight = bHighlight;
-    m_bChanged = true;
+    Changed();
   }
 }
 
@@ -138,7 +147,7 @@ void DataRowElement<T>::Set( const T value, EColour bg ) {
   if ( ( m_value != value ) || ( bg != m_colours.bg ) ) {
     m_value = value;
     m_colours.bg = bg;
-    m_bChanged = true;
+    Changed();
   }
 }
 
@@ -150,11 +159,15 @@ T DataRowElement<T>::Get() const {
 template<typename T>
 void DataRowElement<T>::Inc()  {
   m_value++;
+  Changed();
 }
 
 template<typename T>
 void DataRowElement<T>::Add( T value )  {
-  m_value += value;
+  if ( 0 != value ) {
+    m_value += value;
+    Changed();
+  }
 }
 
 template<typename T>
@@ -163,6 +176,15 @@ void DataRowElement<T>::SetWinRowElement( WinRowElement* pwre ) {
   //   will need to reset, refresh, then unattach in caller
   // TODO: clear the FMouseClick_t callbacks?
   m_pWinRowElement = pwre;
+  m_bDirty = true; // paint on attachment
+}
+
+template<typename T>
+void DataRowElement<T>::Refresh() {
+  if ( m_bDirty ) {
+    UpdateWinRowElement();
+    m_bDirty = false;
+  }
 }
 
 // TODO:
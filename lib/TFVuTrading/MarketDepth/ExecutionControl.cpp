@@ -50,6 +50,7 @@ ExecutionControl::ExecutionControl( pPosition_t pPosition, unsigned int sizeDefa
 , m_nActiveOrders {}
 , m_dblAveragePrice {}
 , m_pPosition( std::move( pPosition ) )
+, m_scale( m_pPosition->GetInstrument()->GetTickScale() )
 {
   m_pPosition->OnPositionChanged.Add( MakeDelegate( this, &ExecutionControl::HandlePositionChanged ) );
 
@@ -163,12 +164,13 @@ void ExecutionControl::Set( ou::tf::l2::PanelTrade* pPanelTrade ) {
 
 // TODO: on each click, to increase quantity, cancel order & re-submit with new quantity
 void ExecutionControl::AskLimit( double price ) {
-  mapOrders_t::iterator iterOrders = m_mapAskOrders.find( price );
+  const ou::tf::PriceTick tick( m_scale.Nearest( price ) );
+  mapOrders_t::iterator iterOrders = m_mapAskOrders.find( tick );
   if ( m_mapAskOrders.end() == iterOrders ) {
     pOrder_t pOrder = m_pPosition->ConstructOrder(
       ou::tf::OrderType::Limit, ou::tf::OrderSide::Sell, m_sizeDefaultOrder, price );
     std::cout << "Submitted limit order#" << pOrder->GetOrderId() << " at ask " << price << std::endl;
-    auto pair = m_mapAskOrders.emplace( price, PriceLevelOrder() );
+    auto pair = m_mapAskOrders.emplace( tick, PriceLevelOrder() );
     assert( pair.second );
     mapOrders_t::iterator iterOrders( pair.first );
     PriceLevelOrder& plo( iterOrders->second );
@@ -193,7 +195,8 @@ void ExecutionControl::AskLimit( double price ) {
 // on futures, only available during regular trading hours, will need to be simulated
 void ExecutionControl::AskStop( double price ) {
 
-  mapOrders_t::iterator iterOrders = m_mapAskOrders.find( price );
+  const ou::tf::PriceTick tick( m_scale.Nearest( price ) );
+  mapOrders_t::iterator iterOrders = m_mapAskOrders.find( tick );
   if ( m_mapAskOrders.end() == iterOrders ) {
     // TODO: need to check regular hours to do it this way
     //pOrder_t pOrder = m_pPosition->ConstructOrder(
@@ -205,20 +208,20 @@ void ExecutionControl::AskStop( double price ) {
     //std::cout << "Submitted stop order#" << pOrder->GetOrderId() << " at ask " << price << std::endl;
     std::cout << "tracking stop order#" << pOrder->GetOrderId() << " at ask " << price << std::endl;
 
-    auto pairOrders = m_mapAskOrders.emplace( price, PriceLevelOrder() );
+    auto pairOrders = m_mapAskOrders.emplace( tick, PriceLevelOrder() );
     assert( pairOrders.second );
     mapOrders_t::iterator iterOrders( pairOrders.first );
 
-    mapTrackStop_t::iterator iterTrackStop = m_mapAskTrackStop.find( price );
+    mapTrackStop_t::iterator iterTrackStop = m_mapAskTrackStop.find( tick );
     assert( m_mapAskTrackStop.end() == iterTrackStop );
 
     auto pairTrackingStop = m_mapAskTrackStop.emplace(
-      price,
+      tick,
       TrackStop(
         ou::tf::OrderSide::Buy, price, m_pPosition->GetWatch(),
-        [this, iterOrders, pOrder, price]( ou::tf::OrderSide::EOrderSide ){
+        [this, iterOrders, pOrder, price, tick]( ou::tf::OrderSide::EOrderSide ){
 
-          mapTrackStop_t::iterator iterTrackStop = m_mapAskTrackStop.find( price );
+          mapTrackStop_t::iterator iterTrackStop = m_mapAskTrackStop.find( tick );
           assert( m_mapAskTrackStop.end() != iterTrackStop );
 
           m_KillTrackStop = std::move( iterTrackStop->second );
@@ -248,17 +251,18 @@ void ExecutionControl::AskStop( double price ) {
 
 void ExecutionControl::AskCancel( double price ) {
   m_pPanelTrade->SetAskQuantity( price, 0, OrderColour_NoOrder );
-  Cancel( price, m_mapAskOrders, m_mapAskTrackStop );
+  Cancel( m_scale.Nearest( price ), m_mapAskOrders, m_mapAskTrackStop );
 }
 
 // TODO: on each click, to increase quantity, cancel order & re-submit with new quantity
 void ExecutionControl::BidLimit( double price ) {
-  mapOrders_t::iterator iterOrders = m_mapBidOrders.find( price );
+  const ou::tf::PriceTick tick( m_scale.Nearest( price ) );
+  mapOrders_t::iterator iterOrders = m_mapBidOrders.find( tick );
   if ( m_mapBidOrders.end() == iterOrders ) {
     pOrder_t pOrder = m_pPosition->ConstructOrder(
       ou::tf::OrderType::Limit, ou::tf::OrderSide::Buy, m_sizeDefaultOrder, price );
     std::cout << "Submitted limit order#" << pOrder->GetOrderId() << " at bid " << price << std::endl;
-    auto pair = m_mapBidOrders.emplace( price, PriceLevelOrder() );
+    auto pair = m_mapBidOrders.emplace( tick, PriceLevelOrder() );
     assert( pair.second );
     mapOrders_t::iterator iterOrders( pair.first );
     PriceLevelOrder& plo( iterOrders->second );
@@ -283,7 +287,8 @@ void ExecutionControl::BidLimit( double price ) {
 // on futures, only available during regular trading hours, will need to be simulated
 void ExecutionControl::BidStop( double price ) {
 
-  mapOrders_t::iterator iterOrders = m_mapBidOrders.find( price );
+  const ou::tf::PriceTick tick( m_scale.Nearest( price ) );
+  mapOrders_t::iterator iterOrders = m_mapBidOrders.find( tick );
   if ( m_mapBidOrders.end() == iterOrders ) {
     // TODO: need to check regular hours to do it this way
     //pOrder_t pOrder = m_pPosition->ConstructOrder(
@@ -295,20 +300,20 @@ void ExecutionControl::BidStop( double price ) {
     //std::cout << "Submitted stop order#" << pOrder->GetOrderId() << " at bid " << price << std::endl;
     std::cout << "tracking stop order#" << pOrder->GetOrderId() << " at bid " << price << std::endl;
 
-    auto pairOrders = m_mapBidOrders.emplace( price, PriceLevelOrder() );
+    auto pairOrders = m_mapBidOrders.emplace( tick, PriceLevelOrder() );
     assert( pairOrders.second );
     mapOrders_t::iterator iterOrders( pairOrders.first );
 
-    mapTrackStop_t::iterator iterTrackStop = m_mapBidTrackStop.find( price );
+    mapTrackStop_t::iterator iterTrackStop = m_mapBidTrackStop.find( tick );
     assert( m_mapBidTrackStop.end() == iterTrackStop );
 
     auto pairTrackingStop = m_mapBidTrackStop.emplace(
-      price,
+      tick,
       TrackStop(
         ou::tf::OrderSide::Sell, price, m_pPosition->GetWatch(),
-        [this, iterOrders, pOrder, price]( ou::tf::OrderSide::EOrderSide side ) {
+        [this, iterOrders, pOrder, price, tick]( ou::tf::OrderSide::EOrderSide side ) {
 
-          mapTrackStop_t::iterator iterTrackStop = m_mapBidTrackStop.find( price );
+          mapTrackStop_t::iterator iterTrackStop = m_mapBidTrackStop.find( tick );
           assert( m_mapBidTrackStop.end() != iterTrackStop );
 
           m_KillTrackStop = std::move( iterTrackStop->second );
@@ -338,14 +343,14 @@ void ExecutionControl::BidStop( double price ) {
 
 void ExecutionControl::BidCancel( double price ) {
   m_pPanelTrade->SetBidQuantity( price, 0, OrderColour_NoOrder );
-  Cancel( price, m_mapBidOrders, m_mapBidTrackStop );
+  Cancel( m_scale.Nearest( price ), m_mapBidOrders, m_mapBidTrackStop );
 }
 
-void ExecutionControl::Cancel( double price, mapOrders_t& mapOrders, mapTrackStop_t& mapTrackStop ) {
-  mapTrackStop_t::iterator iterTrackStop = mapTrackStop.find( price );
+void ExecutionControl::Cancel( ou::tf::PriceTick tick, mapOrders_t& mapOrders, mapTrackStop_t& mapTrackStop ) {
+  mapTrackStop_t::iterator iterTrackStop = mapTrackStop.find( tick );
   if ( mapTrackStop.end() == iterTrackStop ) { // not a stop order
 
-    mapOrders_t::iterator iterOrders = mapOrders.find( price );
+    mapOrders_t::iterator iterOrders = mapOrders.find( tick );
     if ( mapOrders.end() == iterOrders ) {}
     else {
       pOrder_t pOrder = iterOrders->second.Order();
@@ -357,7 +362,7 @@ void ExecutionControl::Cancel( double price, mapOrders_t& mapOrders, mapTrackSto
 
     mapTrackStop.erase( iterTrackStop );
 
-    mapOrders_t::iterator iterOrders = mapOrders.find( price );
+    mapOrders_t::iterator iterOrders = mapOrders.find( tick );
     if ( mapOrders.end() == iterOrders ) {}
     else {
       mapOrders.erase( iterOrders ); // nothing has been submitted yet
@@ -28,6 +28,8 @@
 
 #include <map>
 
+#include <TFTimeSeries/PriceTick.h>
+
 #include <TFTrading/Order.h>
 #include <TFTrading/Position.h>
 
@@ -54,13 +56,14 @@ protected:
 private:
 
   pPosition_t m_pPosition;
+  const ou::tf::TickScale m_scale; // from the instrument, orders are keyed by PriceTick
 
   ou::tf::l2::PanelTrade* m_pPanelTrade;
 
   unsigned int m_sizeDefaultOrder;
 
   // TODO: allow multiple orders per level
-  using mapOrders_t = std::map<double,PriceLevelOrder>;
+  using mapOrders_t = std::map<ou::tf::PriceTick,PriceLevelOrder>;
   // note: the exchange will complain if there are orders on both sides
   mapOrders_t m_mapAskOrders;
   mapOrders_t m_mapBidOrders;
@@ -172,7 +175,7 @@ private:
     }
   };
 
-  using mapTrackStop_t = std::map<double,TrackStop>;
+  using mapTrackStop_t = std::map<ou::tf::PriceTick,TrackStop>;
   mapTrackStop_t m_mapAskTrackStop;
   mapTrackStop_t m_mapBidTrackStop;
 
@@ -186,7 +189,7 @@ private:
   void BidStop( double );
   void BidCancel( double );
 
-  void Cancel( double, mapOrders_t&, mapTrackStop_t& );
+  void Cancel( ou::tf::PriceTick, mapOrders_t&, mapTrackStop_t& );
 
   void HandleExecution( const ou::tf::Execution& );
   void HandlePositionChanged( const ou::tf::Position& );
@@ -0,0 +1,63 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    LadderModel.cpp
+ * Author:  raymond@burkholder.net
+ * Project: TFVuTrading/MarketDepth
+ * Created: October 19, 2026 23:50
+ */
+
+#include <algorithm>
+
+#include "LadderModel.hpp"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace l2 { // market depth
+
+LadderModel::LadderModel( unsigned int nLevels )
+: m_nLevels( ( ( std::max( 64u, nLevels ) + 63 ) / 64 ) * 64 )
+, m_nWords( m_nLevels / 64 )
+, m_bBased( false ), m_ixBase {}
+, m_pAsk( new std::atomic<uint32_t>[ m_nLevels ] )
+, m_pBid( new std::atomic<uint32_t>[ m_nLevels ] )
+, m_pDirty( new std::atomic<uint64_t>[ m_nWords ] )
+, m_nUpdates {}, m_nOutOfRange {}
+, m_vFrontAsk( m_nLevels, 0 ), m_vFrontBid( m_nLevels, 0 )
+, m_nSwaps {}, m_nReported {}
+{
+  for ( unsigned int ix = 0; ix < m_nLevels; ix++ ) {
+    m_pAsk[ ix ].store( 0, std::memory_order_relaxed );
+    m_pBid[ ix ].store( 0, std::memory_order_relaxed );
+  }
+  for ( unsigned int ix = 0; ix < m_nWords; ix++ ) {
+    m_pDirty[ ix ].store( 0, std::memory_order_relaxed );
+  }
+}
+
+LadderModel::~LadderModel() {}
+
+LadderModel::Stats LadderModel::GetStats() const {
+  Stats stats;
+  stats.nUpdates = m_nUpdates.load( std::memory_order_relaxed );
+  stats.nOutOfRange = m_nOutOfRange.load( std::memory_order_relaxed );
+  stats.nSwaps = m_nSwaps.load( std::memory_order_relaxed );
+  stats.nReported = m_nReported.load( std::memory_order_relaxed );
+  return stats;
+}
+
+} // market depth
+} // namespace tf
+} // namespace ou
@@ -0,0 +1,152 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    LadderModel.hpp
+ * Author:  raymond@burkholder.net
+ * Project: TFVuTrading/MarketDepth
+ * Created: October 19, 2026 23:50
+ */
+
+#pragma once
+
+// l2 sizes by price index, handed from the feed thread to the gui thread without locks
+//   back buffer: atomic ask/bid sizes plus a dirty bit per level, written by the feed thread
+//   front buffer: the sizes last handed to the gui, owned by the gui thread
+//   Swap, on the gui timer, claims the dirty bits a word at a time, and reports the levels
+//     which differ from the front buffer, so a level changed many times between refreshes
+//     is reported once, and a level changed and changed back is not reported at all
+// a single feed thread writes, a single gui thread swaps
+// the window of levels is fixed on the first update, centered on it,
+//   updates outside the window are counted, and otherwise ignored
+// no wx dependencies, so can be exercised headless
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace l2 { // market depth
+
+class LadderModel {
+public:
+
+  struct Stats {
+    uint64_t nUpdates;    // written to the back buffer
+    uint64_t nOutOfRange; // outside the window
+    uint64_t nSwaps;
+    uint64_t nReported;   // levels handed to the gui
+  };
+
+  LadderModel( unsigned int nLevels = 1 << 16 ); // rounded up to a multiple of 64
+  ~LadderModel();
+
+  // feed thread
+  void SetAsk( int ix, uint32_t volume ) { Set( ix, volume, m_pAsk.get() ); }
+  void SetBid( int ix, uint32_t volume ) { Set( ix, volume, m_pBid.get() ); }
+
+  // gui thread, f( int ix, uint32_t ask, uint32_t bid ) for each level which differs, returns the count
+  template<typename F>
+  size_t Swap( F&& f );
+
+  Stats GetStats() const;
+
+protected:
+private:
+
+  const unsigned int m_nLevels;
+  const unsigned int m_nWords;
+
+  using pVolume_t = std::unique_ptr<std::atomic<uint32_t>[]>;
+  using pWord_t = std::unique_ptr<std::atomic<uint64_t>[]>;
+
+  // written by the feed thread
+  bool m_bBased;
+  int m_ixBase; // price index of level 0, published to the gui by the first dirty bit
+  pVolume_t m_pAsk;
+  pVolume_t m_pBid;
+  pWord_t m_pDirty;
+  std::atomic<uint64_t> m_nUpdates;
+  std::atomic<uint64_t> m_nOutOfRange;
+
+  // owned by the gui thread
+  std::vector<uint32_t> m_vFrontAsk;
+  std::vector<uint32_t> m_vFrontBid;
+  std::atomic<uint64_t> m_nSwaps;
+  std::atomic<uint64_t> m_nReported;
+
+  void Set( int ix, uint32_t volume, std::atomic<uint32_t>* );
+
+  static unsigned int LowBit( uint64_t n ) { // n is not 0
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll( n );
+#else
+    unsigned int ix {};
+    while ( 0 == ( n & 1 ) ) {
+      n >>= 1;
+      ix++;
+    }
+    return ix;
+#endif
+  }
+
+};
+
+inline void LadderModel::Set( int ix, uint32_t volume, std::atomic<uint32_t>* pVolume ) {
+  if ( !m_bBased ) {
+    m_ixBase = ix - (int)( m_nLevels / 2 );
+    m_bBased = true;
+  }
+  const int slot = ix - m_ixBase;
+  if ( ( 0 > slot ) || ( (int)m_nLevels <= slot ) ) {
+    m_nOutOfRange.fetch_add( 1, std::memory_order_relaxed );
+  }
+  else {
+    pVolume[ slot ].store( volume, std::memory_order_relaxed );
+    // release: the volume, and m_ixBase, are visible to the Swap which claims this bit
+    m_pDirty[ slot >> 6 ].fetch_or( uint64_t( 1 ) << ( slot & 63 ), std::memory_order_release );
+    m_nUpdates.fetch_add( 1, std::memory_order_relaxed );
+  }
+}
+
+template<typename F>
+size_t LadderModel::Swap( F&& f ) {
+  size_t nReported {};
+  for ( unsigned int ixWord = 0; ixWord < m_nWords; ixWord++ ) {
+    std::atomic<uint64_t>& word( m_pDirty[ ixWord ] );
+    if ( 0 == word.load( std::memory_order_relaxed ) ) continue;
+    uint64_t bits = word.exchange( 0, std::memory_order_acquire );
+    while ( 0 != bits ) {
+      const unsigned int slot = ( ixWord << 6 ) + LowBit( bits );
+      bits &= bits - 1;
+      const uint32_t nAsk = m_pAsk[ slot ].load( std::memory_order_relaxed );
+      const uint32_t nBid = m_pBid[ slot ].load( std::memory_order_relaxed );
+      if ( ( nAsk != m_vFrontAsk[ slot ] ) || ( nBid != m_vFrontBid[ slot ] ) ) {
+        m_vFrontAsk[ slot ] = nAsk;
+        m_vFrontBid[ slot ] = nBid;
+        f( m_ixBase + (int)slot, nAsk, nBid );
+        nReported++;
+      }
+    }
+  }
+  m_nSwaps.fetch_add( 1, std::memory_order_relaxed );
+  m_nReported.fetch_add( nReported, std::memory_order_relaxed );
+  return nReported;
+}
+
+} // market depth
+} // namespace tf
+} // namespace ou
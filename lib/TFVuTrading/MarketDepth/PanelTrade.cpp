@@ -123,6 +123,13 @@ void PanelTrade::OnPaint( wxPaintEvent& event ) {
 
 void PanelTrade::HandleTimerRefresh( wxTimerEvent& event ) {
   if ( m_fTimer ) m_fTimer();
+  // l2 levels changed since the last refresh, each once, with its latest sizes
+  m_ladder.Swap(
+    [this]( int ix, uint32_t nAsk, uint32_t nBid ){
+      PriceRow& row( m_PriceRows[ ix ] );
+      row.SetAskVolume( (unsigned int)nAsk );
+      row.SetBidVolume( (unsigned int)nBid );
+    } );
   //std::scoped_lock<std::mutex> lock( m_mutexTimer );
   if ( 0 < m_cntWinRows_Data ) {
     for ( int ix = m_ixFirstPriceRow; ix <= m_ixLastPriceRow; ix++ ) {
@@ -322,16 +329,12 @@ void PanelTrade::OnQuote( const ou::tf::Quote& quote ) {
 
 // l2 update
 void PanelTrade::OnQuoteAsk( double price, unsigned int volume ) {
-  int ixPrice = m_PriceRows.Cast( price );
-  PriceRow& row( m_PriceRows[ ixPrice ] );
-  row.SetAskVolume( volume );
+  m_ladder.SetAsk( m_PriceRows.Cast( price ), volume );
 }
 
 // l2 update
 void PanelTrade::OnQuoteBid( double price, unsigned int volume ) {
-  int ixPrice = m_PriceRows.Cast( price );
-  PriceRow& row( m_PriceRows[ ixPrice ] );
-  row.SetBidVolume( volume );
+  m_ladder.SetBid( m_PriceRows.Cast( price ), volume );
 }
 
 // l1 update
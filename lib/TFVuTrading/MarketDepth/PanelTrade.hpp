@@ -29,6 +29,7 @@
 
 #include "WinRow.hpp"
 #include "PriceRows.hpp"
+#include "LadderModel.hpp"
 
 namespace ou { // One Unified
 namespace tf { // TradeFrame
@@ -75,8 +76,8 @@ public:
   void OnQuote( const ou::tf::Quote& ); // l1 quote for recentering
   void OnTrade( const ou::tf::Trade& ); // l1 trade for colour, recentering
 
-  void OnQuoteAsk( double price, unsigned int volume ); // l2 update at level
-  void OnQuoteBid( double price, unsigned int volume ); // l2 update at level
+  void OnQuoteAsk( double price, unsigned int volume ); // l2 update at level, lock free, applied on the refresh timer
+  void OnQuoteBid( double price, unsigned int volume ); // l2 update at level, lock free, applied on the refresh timer
 
   // Interface - Events - Out - Timer
   using fTimer_t = std::function<void()>; // triggered on visible ladder refresh
@@ -126,6 +127,7 @@ private:
   vWinRow_t m_vWinRow; // non header rows only
 
   PriceRows m_PriceRows;
+  LadderModel m_ladder; // l2 sizes from the feed thread, coalesced until the refresh timer
 
   bool m_bReCenter;
 
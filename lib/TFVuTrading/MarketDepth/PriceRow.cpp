@@ -102,20 +102,20 @@ void PriceRow::SetRowElements( WinRow& wr ) {
 
 void PriceRow::Refresh() {
   if ( m_bChanged ) {
-    m_dreAcctPl.UpdateWinRowElement();
-    m_dreBuyCount.UpdateWinRowElement();
-    m_dreBuyVolume.UpdateWinRowElement();
-    m_dreBidSize.UpdateWinRowElement();
-    m_dreBidOrder.UpdateWinRowElement();
-    m_drePrice.UpdateWinRowElement();
-    m_dreAskOrder.UpdateWinRowElement();
-    m_dreAskSize.UpdateWinRowElement();
-    m_dreSellVolume.UpdateWinRowElement();
-    m_dreSellCount.UpdateWinRowElement();
-    m_dreTicks.UpdateWinRowElement();
-    m_dreVolume.UpdateWinRowElement();
-    m_dreIndicatorStatic.UpdateWinRowElement();
-    m_dreIndicatorDynamic.UpdateWinRowElement();
+    m_dreAcctPl.Refresh();
+    m_dreBuyCount.Refresh();
+    m_dreBuyVolume.Refresh();
+    m_dreBidSize.Refresh();
+    m_dreBidOrder.Refresh();
+    m_drePrice.Refresh();
+    m_dreAskOrder.Refresh();
+    m_dreAskSize.Refresh();
+    m_dreSellVolume.Refresh();
+    m_dreSellCount.Refresh();
+    m_dreTicks.Refresh();
+    m_dreVolume.Refresh();
+    m_dreIndicatorStatic.Refresh();
+    m_dreIndicatorDynamic.Refresh();
     m_bChanged = false;
   }
 }
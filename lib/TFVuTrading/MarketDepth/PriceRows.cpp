@@ -39,16 +39,15 @@ PriceRows::~PriceRows() {
 
 void PriceRows::SetInterval( double interval ) {
   assert( 0.0 < interval );
-  m_interval = interval;
-  m_intervalby2 = interval / 2.0;
+  m_scale = ou::tf::TickScale( interval );
 }
 
 int PriceRows::Cast( double price ) const {
-  return std::floor( ( price + m_intervalby2 ) / m_interval );
+  return m_scale.Nearest( price ).Count();
 }
 
 double PriceRows::Cast( int ix ) const {
-  return ix * m_interval;
+  return m_scale.Price( ou::tf::PriceTick( ix ) );
 }
 
 PriceRow& PriceRows::operator[]( double price ) {
@@ -24,6 +24,8 @@
 #include <map>
 #include <mutex>
 
+#include <TFTimeSeries/PriceTick.h>
+
 #include "PriceRow.hpp"
 
 namespace ou { // One Unified
@@ -37,9 +39,9 @@ public:
   PriceRows( double interval );
   ~PriceRows();
 
-  void SetInterval( double );
+  void SetInterval( double ); // the instrument's min tick
 
-  int Cast( double price ) const; // price to index
+  int Cast( double price ) const; // price to index, the index is the price in ticks
   double Cast( int ix ) const;    // index to price
 
   PriceRow& operator[]( double ); // by price
@@ -51,8 +53,7 @@ public:
 protected:
 private:
 
-  double m_interval;
-  double m_intervalby2;
+  ou::tf::TickScale m_scale;
 
   // to consider: build total ladder in memory?
   // however, locks used only on map expansion (for now)
@@ -122,7 +122,7 @@ protected:
 private:
 
   enum { ID_Null=wxID_HIGHEST, ID_PANEL_OPTIONCOMBO,
-    ID_LblIdPortfolio, ID_LblCurrency, ID_LblDescription, ID_LblUnrealizedPL, ID_LblCommission, ID_LblRealizedPL, ID_LblTotal,
+    ID_LblIdPortfolio, ID_LblCurrency, ID_LblDescription, ID_LblExposure, ID_LblUnrealizedPL, ID_LblCommission, ID_LblRealizedPL, ID_LblTotal,
     ID_TxtDescription,
     ID_TxtUnRealizedPL, ID_TxtCommission, ID_TxtRealizedPL, ID_TxtTotal,
     ID_MenuAddPosition, ID_MenuDeletePosition, ID_MenuClosePosition, ID_MenuCancelOrders, ID_MenuAddOrder,
@@ -42,6 +42,7 @@ PanelOptionCombo_impl::PanelOptionCombo_impl( PanelOptionCombo& poc )
     m_lblCurrency = nullptr;
     m_lblIdPortfolio = nullptr;
     m_txtDescription = nullptr;
+    m_lblExposure = nullptr;
     m_gridPositions = nullptr;
     m_gridPortfolioStats = nullptr;
 
@@ -65,6 +66,12 @@ PanelOptionCombo_impl::~PanelOptionCombo_impl() {
   m_vPositions.clear();
   m_vPortfolioCalcs.clear();
   m_vPortfolioModelCell.clear();
+  if ( m_pPortfolioGreek ) {
+    m_pPortfolioGreek->OnGreekUpdate.Remove( MakeDelegate( this, &PanelOptionCombo_impl::HandleOnGreekUpdate ) );
+    m_pPortfolioGreek->OnCommissionUpdate.Remove( MakeDelegate( this, &PanelOptionCombo_impl::HandleOnCommissionUpdate ) );
+    m_pPortfolioGreek->OnExecutionUpdate.Remove( MakeDelegate( this, &PanelOptionCombo_impl::HandleOnExecutionUpdate ) );
+    m_pPortfolioGreek->OnUnRealizedPLUpdate.Remove( MakeDelegate( this, &PanelOptionCombo_impl::HandleOnUnRealizedPLUpdate ) );
+  }
   m_pPortfolioGreek.reset();
   //std::cout << "PanelOptionCombo_impl destructor end" << std::endl;
 }
@@ -88,6 +95,9 @@ void PanelOptionCombo_impl::CreateControls( wxWindow* parent ) {
     m_txtDescription = new wxTextCtrl( itemPanel1, m_poc.ID_TxtDescription, _("description"), wxDefaultPosition, wxSize(-1, 30), wxTE_MULTILINE|wxTE_READONLY );
     m_sizerHeader->Add(m_txtDescription, 1, wxALIGN_TOP|wxALL, 2);
 
+    m_lblExposure = new wxStaticText( itemPanel1, m_poc.ID_LblExposure, _("exposure"), wxDefaultPosition, wxDefaultSize, 0 );
+    m_sizerHeader->Add(m_lblExposure, 0, wxALIGN_TOP|wxALL, 2);
+
     m_gridPositions = new wxGrid( parent, m_poc.ID_GridPositions, wxDefaultPosition, wxSize(-1, -1 ), wxFULL_REPAINT_ON_RESIZE|wxVSCROLL );
     m_gridPositions->SetDefaultColSize(50);
     m_gridPositions->SetDefaultRowSize(22);
@@ -272,6 +282,7 @@ void PanelOptionCombo_impl::SetPortfolioGreek( pPortfolioGreek_t pPortfolioGreek
   pPortfolioGreek->OnUnRealizedPLUpdate.Add( MakeDelegate( this, &PanelOptionCombo_impl::HandleOnUnRealizedPLUpdate ) );
   pPortfolioGreek->OnExecutionUpdate.Add( MakeDelegate( this, &PanelOptionCombo_impl::HandleOnExecutionUpdate ) );
   pPortfolioGreek->OnCommissionUpdate.Add( MakeDelegate( this, &PanelOptionCombo_impl::HandleOnCommissionUpdate ) );
+  pPortfolioGreek->OnGreekUpdate.Add( MakeDelegate( this, &PanelOptionCombo_impl::HandleOnGreekUpdate ) );
   if ( ou::tf::Portfolio::Master == pPortfolioGreek->GetRow().ePortfolioType ) {
     //m_gridPositions->Hide();
     //m_sizerMain->Detach( m_gridPositions );
@@ -326,6 +337,17 @@ void PanelOptionCombo_impl::HandleOnExecutionUpdate( const Portfolio& ) {
 void PanelOptionCombo_impl::HandleOnCommissionUpdate( const Portfolio& ) {
 }
 
+// fired from PortfolioGreek::Publish, once per gui refresh at most
+void PanelOptionCombo_impl::HandleOnGreekUpdate( const PortfolioGreek& portfolio ) {
+  double dblUnRealized, dblRealized, dblCommissionsPaid, dblTotal;
+  portfolio.QueryStats( dblUnRealized, dblRealized, dblCommissionsPaid, dblTotal );
+  const PortfolioGreek::Exposure& exposure( portfolio.GetExposure() );
+  m_lblExposure->SetLabelText(
+    wxString::Format( "pl %0.2f delta %0.2f gamma %0.4f theta %0.2f vega %0.2f",
+      dblTotal, exposure.dblDelta, exposure.dblGamma, exposure.dblTheta, exposure.dblVega )
+    );
+}
+
 void PanelOptionCombo_impl::OnRightClickGridLabel( wxGridEvent& event ) {
   m_poc.PopupMenu( m_menuGridLabelPositionPopUp );
 }
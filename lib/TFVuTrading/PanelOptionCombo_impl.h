@@ -242,6 +242,7 @@ struct PanelOptionCombo_impl {
     wxStaticText* m_lblCurrency;
     wxStaticText* m_lblIdPortfolio;
     wxTextCtrl* m_txtDescription;
+    wxStaticText* m_lblExposure;
     wxGrid* m_gridPositions;
     wxGrid* m_gridPortfolioStats;
 
@@ -289,6 +290,7 @@ struct PanelOptionCombo_impl {
   void HandleOnUnRealizedPLUpdate( const Portfolio& );
   void HandleOnExecutionUpdate( const Portfolio& );
   void HandleOnCommissionUpdate( const Portfolio& );
+  void HandleOnGreekUpdate( const PortfolioGreek& ); // coalesced, active positions
 
   void HandleWindowDestroy( wxWindowDestroyEvent& event );
 